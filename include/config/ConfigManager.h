@@ -60,6 +60,13 @@ class ConfigManager {
     std::string filename;
     SecureStorage secure;
     uint8_t lcd_rotation = 4;
+    bool gif_row_skip = true;
+    bool gif_rgb444 = false;
+    bool gif_dither = true;
+    bool gif_frame_drop = true;
+    bool gif_native = true;
+    bool gif_auto_scale = true;
+    bool gif_interlace = true;
     std::string ntp_server;
 
     const char* getNtpServer() const { return ntp_server.c_str(); }
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_COMPOSITOR_H
+#define SRC_DISPLAY_COMPOSITOR_H
+
+#include <Arduino.h>
+#include <array>
+
+enum class LayerKind : uint8_t { Rect, Text, Icon };
+
+/**
+ * @brief Counters of the overlay compositor
+ *
+ * Composed rows are GIF row segments that had layers merged in before they were sent, strips are
+ * the STRIP_ROWS high bands recomposed for changed layers, each pushed through one window per
+ * layer it holds
+ */
+struct CompositorStats {
+    uint32_t composedRows = 0;
+    uint32_t flushes = 0;
+    uint32_t strips = 0;
+    uint32_t pushes = 0;
+    uint32_t bytes = 0;
+};
+
+/**
+ * @brief Overlay layers (rectangles, text, icons) merged into whatever is drawn under them
+ *
+ * There is no frame buffer: every layer keeps a copy of the pixels drawn under it (its backing),
+ * refreshed by composeRow() from each GIF line that crosses it, and the layer is painted over the
+ * line in RAM before the line goes to the panel, so GIF frames never erase an overlay and the
+ * overlay never flickers. Changed or removed layers are redrawn from their backing by flush(),
+ * strip by strip through a STRIP_ROWS high buffer, only for the strips they overlap. A layer added
+ * over a playing GIF only learns the pixels drawn after it, its backing is known once the screen
+ * was cleared or the frame under it was replayed (markBackingsKnown())
+ *
+ * Layers are identified by slot, higher slots are drawn over lower ones. Pixels are kept in panel
+ * byte order like the GIF line buffers
+ */
+class Compositor {
+   public:
+    static constexpr int MAX_LAYERS = 8;
+    static constexpr int MAX_WIDTH = 240;
+    static constexpr int STRIP_ROWS = 8;
+    static constexpr size_t TEXT_MAX = 32;
+    // Layer backings together, the strip buffer comes on top
+    static constexpr uint32_t BUDGET_BYTES = 16U * 1024U;
+
+    auto addRect(int16_t xPos, int16_t yPos, int16_t width, int16_t height, uint16_t color) -> int;
+    auto addText(int16_t xPos, int16_t yPos, uint8_t maxChars, const char* text, uint8_t textSize, uint16_t fgColor,
+                 uint16_t bgColor, bool transparentBg) -> int;
+    auto addIcon(int16_t xPos, int16_t yPos, int16_t width, int16_t height, const uint16_t* pixels, uint16_t keyColor)
+        -> int;
+    auto setText(int layer, const char* text) -> bool;
+    auto setColors(int layer, uint16_t fgColor, uint16_t bgColor) -> bool;
+    auto remove(int layer) -> bool;
+    auto clear() -> void;
+    auto markCleared(uint16_t bgColor) -> void;
+    auto markBackingsKnown() -> void;
+    auto flush() -> void;
+    auto composeRow(int yPos, int xStart, uint16_t* pixels, int len) -> void;
+    auto isActive() const -> bool;
+    auto isDirty() const -> bool;
+    auto hasUnknownBacking() const -> bool;
+    auto layerCount() const -> int;
+    auto heapBytes() const -> uint32_t;
+    auto getStats() const -> const CompositorStats&;
+
+   private:
+    enum class LayerState : uint8_t { Free, Shown, Removed };
+
+    struct Layer {
+        LayerKind kind = LayerKind::Rect;
+        LayerState state = LayerState::Free;
+        bool dirty = false;
+        bool keyed = false;
+        bool known = false;
+        int16_t x = 0;
+        int16_t y = 0;
+        int16_t width = 0;
+        int16_t height = 0;
+        uint16_t fgColor = 0;
+        uint16_t bgColor = 0;
+        uint8_t textSize = 1;
+        std::array<char, TEXT_MAX> text{};
+        const uint16_t* icon = nullptr;
+        uint16_t* backing = nullptr;
+    };
+
+    std::array<Layer, MAX_LAYERS> m_layers{};
+    uint16_t* m_strip = nullptr;
+    uint16_t m_background = 0;
+    CompositorStats m_stats;
+
+    auto addLayer(const Layer& layer) -> int;
+    auto mergeLayers(int yPos, int xStart, uint16_t* pixels, int len) -> bool;
+    auto paintSpan(const Layer& layer, int row, int colStart, int colEnd, uint16_t* out) -> void;
+    auto release(Layer& layer) -> void;
+    auto shownLayer(int layer) -> Layer*;
+};
+
+#endif  // SRC_DISPLAY_COMPOSITOR_H
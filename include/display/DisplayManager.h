@@ -22,19 +22,49 @@
 #include <Arduino.h>
 #include <Arduino_GFX_Library.h>
 
+#include "display/Compositor.h"
+#include "display/Gif.h"
+#include "display/GifPlaylist.h"
+#include "display/OffscreenBand.h"
+#include "display/ScrollTicker.h"
+
 // Colors definitions
 static constexpr uint16_t LCD_BLACK = 0x0000;
 static constexpr uint16_t LCD_WHITE = 0xFFFF;
 static constexpr uint16_t LCD_RED = 0xF800;
 static constexpr uint16_t LCD_GREEN = 0x07E0;
 static constexpr uint16_t LCD_BLUE = 0x001F;
+static constexpr uint16_t LCD_DARK_GREY = 0x2104;
 
 static constexpr int ONE_LINE_SPACE = 20;
 static constexpr int TWO_LINES_SPACE = 40;
 static constexpr int THREE_LINES_SPACE = 60;
 
+// Pixel format of panel writes (ST7789 COLMOD), UI drawing always runs in RGB565
+enum class PanelColorMode : uint8_t { Rgb565, Rgb444 };
+
+// Bytes on the wire for one address window (CASET + 4, RASET + 4, RAMWR)
+static constexpr uint32_t PANEL_ADDR_WINDOW_BYTES = 11;
+
+// Heap a display buffer (strip, backing, cache, RAM copy) leaves to the rest of the firmware
+static constexpr uint32_t DISPLAY_HEAP_RESERVE = 12U * 1024U;
+
+/**
+ * @brief Convert an RGB565 color to the big-endian order used on the SPI wire
+ *
+ * @param color Color in native (little-endian) order
+ *
+ * @return Color with its bytes swapped
+ */
+static constexpr auto toPanelOrder(uint16_t color) -> uint16_t {
+    return static_cast<uint16_t>((color >> 8U) | (color << 8U));
+}
+
 class DisplayManager {
    public:
+    // Frame memory rows of the ST7789, the rows past the visible height are never shown unscrolled
+    static constexpr int16_t PANEL_GRAM_ROWS = 320;
+
     static void begin();
     static Arduino_GFX* getGfx();
     static void drawStartup(String currentIP);
@@ -44,6 +74,50 @@ class DisplayManager {
                                uint16_t fgColor = 0x07E0, uint16_t bgColor = 0x39E7);
     static bool playGifFullScreen(const String& path, uint32_t timeMs = 0);
     static bool stopGif();
+    static bool enqueueGif(const GifQueueEntry& entry);
+    static bool skipGif();
+    static void setGifQueueRepeat(bool enabled);
+    static const GifPlaylist& getGifPlaylist();
+    static bool seekGif(uint16_t frame);
+    static void setGifSpeed(uint16_t percent);
+    static GifPosition getGifPosition();
+    static GifScale getGifScale();
     static void update();
     static void clearScreen();
+    static void clearOutside(int16_t xPos, int16_t yPos, int16_t width, int16_t height);
+    static void writePanelPixels(const uint16_t* data, uint32_t len);
+    static void writePanelPixelsAsync(const uint16_t* data, uint32_t len);
+    static void writePanelBytes(const uint8_t* data, uint32_t len);
+    static void writePanelBytesAsync(const uint8_t* data, uint32_t len);
+    static void setPanelColorMode(PanelColorMode mode);
+    static PanelColorMode getPanelColorMode();
+    static void waitPanelIdle();
+    static void setPanelScrollArea(int16_t top, int16_t height);
+    static void setPanelScrollStart(int16_t line);
+    static bool startTicker(int16_t yPos, int16_t height, const String& text, uint8_t textSize, uint16_t fgColor,
+                            uint16_t bgColor, uint16_t rowsPerSecond);
+    static void stopTicker();
+    static bool isTickerActive();
+    static const ScrollTickerStats& getTickerStats();
+    static bool beginOffscreenBand(int16_t height);
+    static void endOffscreenBand();
+    static bool stageOffscreenText(uint8_t slot, const String& text, uint8_t textSize, uint16_t fgColor,
+                                   uint16_t bgColor);
+    static bool showOffscreenSlot(uint8_t slot);
+    static const OffscreenBand& getOffscreenBand();
+    static bool showStatusBar(const String& text, uint16_t fgColor = LCD_WHITE, uint16_t bgColor = LCD_DARK_GREY);
+    static void hideStatusBar();
+    static int addOverlayRect(int16_t xPos, int16_t yPos, int16_t width, int16_t height, uint16_t color);
+    static int addOverlayText(int16_t xPos, int16_t yPos, uint8_t maxChars, const String& text, uint8_t textSize,
+                              uint16_t fgColor, uint16_t bgColor, bool transparentBg = false);
+    static int addOverlayIcon(int16_t xPos, int16_t yPos, int16_t width, int16_t height, const uint16_t* pixels,
+                              uint16_t keyColor);
+    static bool setOverlayText(int layer, const String& text);
+    static bool removeOverlay(int layer);
+    static void clearOverlays();
+    static const Compositor& getCompositor();
+    static uint32_t getPanelWaitCycles();
+    static GifPipelineStats getGifPipelineStats();
+    static const GifFrameStats& getGifFileTiming();
+    static const GifFrameStats& getGifSessionTiming();
 };
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_FONT_H
+#define SRC_DISPLAY_FONT_H
+
+#include <Arduino.h>
+#include <array>
+
+#include "display/TextRaster.h"
+
+// Glyph bitmap stored as nibble runs instead of packed bits
+static constexpr uint8_t FONT_GLYPH_RLE = 0x01;
+// Largest decoded glyph bitmap, the converter rejects bigger glyphs
+static constexpr size_t FONT_GLYPH_MAX_BYTES = 160;
+
+/**
+ * @brief One glyph of a generated font table, kept in flash
+ *
+ * Tables are written by scripts/fontconv.py sorted by codepoint. The ink box is placed relative to
+ * the pen position and the top of the text line, the bitmap behind it is width x height pixels
+ */
+struct FontGlyph {
+    uint32_t offset;
+    uint16_t codepoint;
+    uint8_t width;
+    uint8_t height;
+    int8_t xOffset;
+    int8_t top;
+    uint8_t advance;
+    uint8_t flags;
+};
+
+/**
+ * @brief Proportional bitmap font: glyph table and bitmaps in flash, metrics in RAM
+ */
+struct Font {
+    const FontGlyph* glyphs;
+    const uint8_t* bitmaps;
+    uint16_t glyphCount;
+    uint8_t lineHeight;
+    uint8_t ascent;
+};
+
+/**
+ * @brief Counters of the decoded glyph cache
+ *
+ * Uncached lookups are glyphs decoded into the caller's scratch because the cache could not be
+ * allocated
+ */
+struct GlyphCacheStats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+    uint32_t uncached = 0;
+};
+
+/**
+ * @brief Decoded glyph: metrics plus the bitmap unpacked to rows of stride bytes, MSB first
+ */
+struct CachedGlyph {
+    const Font* font = nullptr;
+    uint16_t codepoint = 0;
+    uint8_t width = 0;
+    uint8_t height = 0;
+    int8_t xOffset = 0;
+    int8_t top = 0;
+    uint8_t advance = 0;
+    uint8_t stride = 0;
+    uint32_t lastUse = 0;
+    std::array<uint8_t, FONT_GLYPH_MAX_BYTES> bits{};
+};
+
+/**
+ * @brief UTF-8 text in the generated proportional fonts
+ *
+ * Glyph bitmaps stay compressed in flash, the ones in use are decoded into a small LRU cache
+ * (CACHE_SLOTS glyphs, allocated on first use) so clock digits and labels drawn again skip the
+ * decompression. Codepoints the font lacks are drawn as '?'. Lines are composed in RAM and pushed
+ * through one address window like TextRaster::drawLine()
+ */
+class FontEngine {
+   public:
+    static constexpr int CACHE_SLOTS = 16;
+    static constexpr uint16_t REPLACEMENT = '?';
+    static constexpr int MAX_WIDTH = 240;
+    // Largest part of a text line composed at once in a heap strip, taller lines go out in bands
+    static constexpr uint32_t STRIP_MAX_BYTES = 8U * 1024U;
+
+    static auto forTextSize(uint8_t textSize) -> const Font*;
+    static auto decodeUtf8(const char*& text) -> uint32_t;
+    static auto findGlyph(const Font& font, uint32_t codepoint, FontGlyph& out) -> bool;
+    static auto glyph(const Font& font, uint32_t codepoint, CachedGlyph& scratch) -> const CachedGlyph*;
+    static auto measure(const Font& font, const char* text, size_t length) -> int;
+    static auto wrap(const Font& font, const String& text, int maxWidth, int maxLines, TextRaster::Lines& outLines)
+        -> int;
+    static auto drawLine(const Font& font, int16_t xPos, int16_t yPos, const char* text, uint16_t fgColor,
+                         uint16_t bgColor, int16_t minWidth) -> uint32_t;
+    static auto getCacheStats() -> const GlyphCacheStats&;
+    static auto releaseCache() -> void;
+};
+
+#endif  // SRC_DISPLAY_FONT_H
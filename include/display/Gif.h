@@ -25,46 +25,278 @@
 #include <LittleFS.h>
 #include <array>
 
+#include "display/GifDecoder.h"
+#include "display/GifFrameIndex.h"
+#include "display/GifFrameStats.h"
+#include "display/GifNative.h"
+
+class Arduino_TFT;
+class Compositor;
+
+// Where the decoder reads the current file from
+enum class GifReadTier : uint8_t { Direct, ReadAhead, Ram, Flash };
+
+/**
+ * @brief Decode/transmit overlap counters of the GIF draw pipeline
+ *
+ * Cycles are CPU cycles from the first line of a frame to its last one, idle cycles are the part
+ * of it spent spinning on the SPI bus instead of decoding
+ * Skipped rows and bytes are lines left out because the panel already showed the same pixels
+ * Lateness is how far after its deadline (start + sum of previous delays) a frame reached the panel,
+ * dropped frames were decoded without being drawn to catch up, resyncs gave up on a backlog entirely
+ * File reads count the LittleFS read calls and bytes behind the decoder, whatever the read tier
+ * Index rewinds are loops restarted from the frame index instead of reopening and reparsing the file
+ * Native frames were played from the transcoded file of the GIF, without running the decoder
+ * Interlaced frames only sent every other row (alternating odd and even) while playback could not
+ * keep up, degraded time is how long those frames were on screen
+ * RGB444 palette builds count the 12-bit tables converted from a new palette or dither setting
+ */
+struct GifPipelineStats {
+    uint32_t frames = 0;
+    uint32_t streamedFrames = 0;
+    uint32_t lastFrameCycles = 0;
+    uint32_t lastIdleCycles = 0;
+    uint64_t totalFrameCycles = 0;
+    uint64_t totalIdleCycles = 0;
+    uint32_t lastSkippedRows = 0;
+    uint32_t lastSkippedBytes = 0;
+    uint64_t totalSkippedRows = 0;
+    uint64_t totalSkippedBytes = 0;
+    uint32_t lateFrames = 0;
+    uint32_t droppedFrames = 0;
+    uint32_t resyncs = 0;
+    uint32_t lastLateMs = 0;
+    uint32_t maxLateMs = 0;
+    uint64_t totalLateMs = 0;
+    uint64_t fileReadCalls = 0;
+    uint64_t fileReadBytes = 0;
+    GifReadTier readTier = GifReadTier::Direct;
+    uint32_t indexRewinds = 0;
+    uint32_t nativeFrames = 0;
+    bool interlaced = false;
+    uint32_t interlacedFrames = 0;
+    uint64_t degradedMs = 0;
+    uint32_t rgb444PaletteBuilds = 0;
+};
+
+/**
+ * @brief Playback position in the current file, frame count is 0 when the file has no frame index
+ * (or transcoded file)
+ */
+struct GifPosition {
+    uint16_t frame = 0;
+    uint16_t frameCount = 0;
+    uint16_t speedPercent = 100;
+};
+
+/**
+ * @brief Integer scale of a GIF on the panel: nearest-neighbour enlargement, or decimation that
+ * keeps every other line and pixel
+ */
+struct GifScale {
+    uint8_t up = 1;
+    uint8_t down = 1;
+};
+
+/**
+ * @brief Logical screen size from a GIF header
+ */
+struct GifCanvas {
+    uint16_t width = 0;
+    uint16_t height = 0;
+};
+
 class Gif {
    public:
+    static constexpr uint16_t SPEED_MIN_PERCENT = 50;
+    static constexpr uint16_t SPEED_MAX_PERCENT = 400;
+    static constexpr uint8_t SCALE_UP_MAX = 3;
+    static constexpr uint8_t SCALE_DOWN_MAX = 2;
+
+    static auto autoScale(uint16_t canvasW, uint16_t canvasH, int screenW, int screenH) -> GifScale;
+
     Gif();
     ~Gif();
 
     auto begin() -> bool;
-    auto playOne(const String& path) -> bool;
+    auto playOne(const String& path, bool keepSchedule = false) -> bool;
+    auto preload(const String& path) -> bool;
+    auto isPreloaded(const String& path) const -> bool;
+    auto getPreloadedCanvas() const -> GifCanvas;
+    auto getNextFrameDueMs() const -> uint32_t;
     auto update() -> void;
-    auto playAllFromLittleFS() -> bool;
     auto stop() -> void;
     auto isPlaying() const -> bool;
+    auto seekToFrame(uint16_t frame) -> bool;
+    auto redrawUnderOverlays() -> bool;
+    auto setSpeed(uint16_t percent) -> void;
+    auto getPosition() const -> GifPosition;
     auto setLoopEnabled(bool enabled) -> void;
+    auto setPlayCount(uint16_t plays) -> void;
+    auto setFrameStreamingEnabled(bool enabled) -> void;
+    auto setRowSkipEnabled(bool enabled) -> void;
+    auto setGapCoalescingEnabled(bool enabled) -> void;
+    auto setRgb444Enabled(bool enabled) -> void;
+    auto setDitherEnabled(bool enabled) -> void;
+    auto setFrameDropEnabled(bool enabled) -> void;
+    auto setReadCacheEnabled(bool enabled) -> void;
+    auto setInterlaceEnabled(bool enabled) -> void;
+    auto setNativeEnabled(bool enabled) -> void;
+    auto setAutoScaleEnabled(bool enabled) -> void;
+    auto setCompositor(Compositor* compositor) -> void;
+    auto getScale() const -> GifScale;
+    auto isRgb444Active() const -> bool;
+    auto invalidatePanelRows() -> void;
+    auto markPanelCleared() -> void;
+    auto getPipelineStats() const -> const GifPipelineStats&;
+    auto getFileTiming() const -> const GifFrameStats&;
+    auto getSessionTiming() const -> const GifFrameStats&;
+
+    static auto reservedBytes() -> size_t;
 
    private:
-    AnimatedGIF* m_gif;
+    GifFrameDecoder* m_gif;
     volatile bool m_playRequested;
     volatile bool m_playing;
     volatile bool m_loopEnabled;
     volatile bool m_stopRequested;
 
-    int m_delayMsFromGif;
-    uint32_t m_targetMs;
-    uint32_t m_lastFrameMs;
-    uint32_t m_startMs;
-    int m_frameCount;
+    // Remaining plays of the current file when looping, 0 loops until stopped
+    uint16_t m_playsLeft = 0;
+
+    // Absolute schedule: frame N is due at the first deadline plus the delays of frames 0..N-1
+    uint32_t m_startMs = 0;
+    uint32_t m_nextDueMs = 0;
+    uint32_t m_lastDelayMs = 0;
+
+    // Frame delays are divided by this factor (percent of the authored speed)
+    uint16_t m_speedPercent = 100;
+
+    // Frames decoded without drawing while behind, only for files made of full opaque frames
+    bool m_frameDropEnabled = true;
+    bool m_skipDraw = false;
+    bool m_fullFramesOnly = true;
+    uint8_t m_consecutiveDrops = 0;
+
+    // Adaptive quality: frames of full-frame files only send rows of one parity while behind
+    bool m_interlaceEnabled = true;
+    bool m_interlaced = false;
+    uint8_t m_interlacePhase = 0;
+    uint8_t m_qualityStreak = 0;
+    uint32_t m_prevLateMs = 0;
 
     static constexpr size_t LINEBUF_MAX = 240;
 
     std::array<uint16_t, LINEBUF_MAX> m_lineBuf;
     bool m_inFrameWrite = false;
 
+    // Streamed lines alternate between both buffers, one is decoded into while the other is on the wire
+    std::array<uint16_t, LINEBUF_MAX> m_lineBufAlt;
+    bool m_useAltLineBuf = false;
+
+    GifPipelineStats m_stats;
+    uint32_t m_frameStartCycles = 0;
+    uint32_t m_frameStartIdle = 0;
+
+    // Per frame cost breakdown, rolled into the file (reset by playOne) and session windows
+    GifFrameStats m_fileTiming;
+    GifFrameStats m_sessionTiming;
+    uint32_t m_frameSpiUs = 0;
+    uint32_t m_frameYieldUs = 0;
+    uint32_t m_frameBytes = 0;
+    uint16_t m_frameWindows = 0;
+    uint32_t m_lastDrawnMs = 0;
+    uint32_t m_delaySinceDrawnMs = 0;
+
+    static constexpr size_t TRACKED_ROWS = 240;
+    static constexpr size_t TRACKED_COLS = 240;
+
+    // Hash of the last segment written to each panel row, 0 when the row content is unknown
+    std::array<uint32_t, TRACKED_ROWS> m_rowHash{};
+    bool m_rowSkipEnabled = true;
+    bool m_streamWindowStale = false;
+    uint32_t m_frameSkippedRows = 0;
+    uint32_t m_frameSkippedBytes = 0;
+
+    // Columns of each panel row known to still show the background colour, empty when start == end
+    struct CleanSpan {
+        uint8_t start;
+        uint8_t end;
+    };
+
+    std::array<CleanSpan, TRACKED_ROWS> m_cleanSpans{};
+    bool m_gapCoalesceEnabled = true;
+
+    // RGB444 playback: one 12-bit palette per 2x2 Bayer phase, two pixels packed into three bytes
+    static constexpr size_t DITHER_PHASES = 4;
+    static constexpr size_t PALETTE_SIZE = 256;
+
+    std::array<std::array<uint16_t, PALETTE_SIZE>, DITHER_PHASES> m_palette444{};
+    // Palette the tables were built from, only a global one is kept across frames of the same file
+    const uint16_t* m_palette444Source = nullptr;
+    bool m_palette444Dither = false;
+    bool m_rgb444Enabled = false;
+    bool m_ditherEnabled = true;
+    bool m_rgb444Active = false;
+
+    // Overlay layers merged into every line sent while the compositor has any, RGB444 stays off meanwhile
+    Compositor* m_compositor = nullptr;
+    bool m_composite = false;
+
+    // Opaque on-screen frames are sent through one address window opened at the first line
+    bool m_frameStreamEnabled = true;
+    bool m_frameStream = false;
+    int m_streamNextY = 0;
+
     int16_t m_offsetX = 0;
     int16_t m_offsetY = 0;
     bool m_centered = false;
 
+    // Scale of the current file, picked from its canvas size when automatic scaling is on
+    bool m_autoScaleEnabled = false;
+    GifScale m_scale;
+
     String m_currentPath;
 
     File m_file;
     bool m_fileInUse = false;
 
+    // Next file opened and header-checked ahead of time, handed over when it is opened for playback
+    File m_nextFile;
+    String m_nextPath;
+    GifCanvas m_nextCanvas;
+
+    // Small files are copied to RAM once and decoded from there, loops included
+    bool m_readCacheEnabled = true;
+    uint8_t* m_ramData = nullptr;
+    int32_t m_ramSize = 0;
+    String m_ramPath;
+
+    // Larger files are read through a window of the file kept in RAM, short backward seeks stay inside it
+    static constexpr size_t READ_AHEAD_BYTES = 2048;
+
+    std::array<uint8_t, READ_AHEAD_BYTES> m_readAhead{};
+    int32_t m_readAheadStart = 0;
+    int32_t m_readAheadLen = 0;
+    int32_t m_filePos = 0;
+
+    // RAM and flash tiers are served to the same I/O callbacks from this buffer
+    const uint8_t* m_memData = nullptr;
+    int32_t m_memSize = 0;
+
+    // Decoder file state as last seen by the callbacks, AnimatedGIF exposes its position nowhere else
+    // With a frame index, loops and seeks move that position instead of reopening the file
+    GIFFILE* m_decoderFile = nullptr;
+    bool m_indexed = false;
+    GifFrameIndexHeader m_index{};
+    uint32_t m_firstFrameOffset = 0;
+    uint16_t m_frameNumber = 0;
+
+    // Transcoded file played instead of the GIF when an up-to-date one exists (see GifTranscoder)
+    GifNative m_native;
+    bool m_nativeEnabled = true;
+    bool m_nativeActive = false;
+
     bool m_havePrev = false;
     uint8_t m_prevDisposal = 0;
     bool m_prevHadTransparency = false;
@@ -84,11 +316,46 @@ class Gif {
 
     static Gif* s_instance;
 
+    auto releaseDecoder() -> void;
+
     static auto gifOpenFile(const char* fname, int32_t* pSize) -> void*;
     static auto gifCloseFile(void* pHandle) -> void;
     static auto gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t;
     static auto gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t;
     static auto gifDraw(GIFDRAW* pDraw) -> void;
+
+    auto canStreamFrame(const GIFDRAW* pDraw, int screenW, int screenH) const -> bool;
+    auto streamFrameLine(Arduino_TFT* tft, const GIFDRAW* pDraw) -> bool;
+    auto finishFrame(Arduino_TFT* tft) -> void;
+    auto skipUnchangedRow(int screenY, int xStart, const uint16_t* pixels, int len, uint32_t wireBytes = 0) -> bool;
+    auto forgetRow(int screenY) -> void;
+    auto cleanSpanOf(int screenY) const -> CleanSpan;
+    auto noteRowWrite(int screenY, int xStart, int xEnd, bool background) -> void;
+    static auto writeRunWindow(Arduino_TFT* tft, uint16_t* pixels, int xStart, int yPos, int len) -> void;
+    static auto sendLine(uint16_t* pixels, int len, int xStart, int yPos) -> void;
+    static auto openWindow(Arduino_TFT* tft, int16_t xPos, int16_t yPos, uint16_t width, uint16_t height) -> void;
+    static auto pushToPanel(const uint8_t* data, uint32_t len, bool async) -> void;
+    static auto timedYield() -> void;
+    auto recordFrameTiming(uint32_t workUs, uint32_t yieldInWorkUs, uint32_t lateMs) -> void;
+    auto openDecoder(const String& path) -> bool;
+    auto loadFrameIndex() -> void;
+    auto seekDecoder(uint32_t offset) -> bool;
+    auto closeDecoder() -> void;
+    auto playNativeFrame(int* delayMs) -> int;
+    auto toScreen(int canvasPos) const -> int;
+    auto sourceColumn(const GIFDRAW* pDraw, int screenX) const -> int;
+    auto drawScaledLine(Arduino_TFT* tft, const GIFDRAW* pDraw) -> void;
+    auto writeScaledRows(Arduino_TFT* tft, int xStart, int yTop, int len) -> void;
+    auto loadIntoRam(const String& path) -> bool;
+    auto releaseRam() -> void;
+    auto takeFile(const String& path) -> File;
+    auto readFile(File& file, int32_t pos, uint8_t* dst, int32_t len) -> int32_t;
+    auto readThrough(File& file, int32_t pos, uint8_t* dst, int32_t len) -> int32_t;
+    auto noteFrameCoverage(const GIFDRAW* pDraw) -> void;
+    auto adaptQuality(uint32_t lateMs, uint32_t workUs) -> void;
+    auto skipInterlacedRow(int row) const -> bool;
+    auto beginFrameColorMode(const GIFDRAW* pDraw) -> void;
+    auto lineWireBytes(int len) const -> uint32_t;
 };
 
 #endif  // SRC_DISPLAY_GIF_H
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SRC_DISPLAY_GIF_CATALOG_H
+#define SRC_DISPLAY_GIF_CATALOG_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <array>
+
+// Directory a catalogued GIF lives in, /gifs is looked up before /gif
+static constexpr uint8_t GIF_CATALOG_DIR_GIF = 0;
+static constexpr uint8_t GIF_CATALOG_DIR_GIFS = 1;
+
+/**
+ * @brief Everything listing and playback need to know about a GIF without opening it
+ */
+struct GifCatalogEntry {
+    std::array<char, 32> name;
+    uint32_t size;
+    uint32_t hash;
+    uint32_t durationMs;
+    uint16_t width;
+    uint16_t height;
+    uint16_t frameCount;
+    uint8_t state;
+    uint8_t dir;
+};
+
+/**
+ * @brief Catalogue header, the stamp sums one term per file so it can be checked against a directory walk
+ */
+struct GifCatalogHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t buckets;
+    uint16_t count;
+    uint16_t tombstones;
+    uint32_t stamp;
+};
+
+/**
+ * @brief Position while walking every catalogued GIF
+ */
+struct GifCatalogCursor {
+    File file;
+    uint16_t buckets;
+    uint16_t bucket;
+};
+
+/**
+ * @brief Binary catalogue of the GIFs in /gif and /gifs, stored in /gifidx/catalog.bin
+ *
+ * The file is an open addressing hash table keyed by directory and name, so a lookup reads one
+ * bucket in the common case and no directory is walked. It is updated on upload and delete and
+ * rebuilt at boot when missing or when its stamp no longer matches the directories
+ */
+class GifCatalog {
+   public:
+    static constexpr const char* PATH = "/gifidx/catalog.bin";
+    static constexpr uint16_t MIN_BUCKETS = 32;
+
+    static auto begin() -> bool;
+    static auto rebuild() -> bool;
+    static auto find(const String& name, GifCatalogEntry& entry) -> bool;
+    static auto path(const GifCatalogEntry& entry) -> String;
+    static auto upsert(const String& gifPath) -> bool;
+    static auto remove(const String& gifPath) -> bool;
+    static auto openCursor(GifCatalogCursor& cursor) -> bool;
+    static auto next(GifCatalogCursor& cursor, GifCatalogEntry& entry) -> bool;
+};
+
+#endif  // SRC_DISPLAY_GIF_CATALOG_H
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_GIF_DECODER_H
+#define SRC_DISPLAY_GIF_DECODER_H
+
+#include <Arduino.h>
+#include <AnimatedGIF.h>
+#include <array>
+
+/**
+ * @brief Streaming GIF decoder specialised for the line pipeline of the player
+ *
+ * Drop-in for the part of AnimatedGIF the player and the transcoder use: same file and draw
+ * callbacks, same GIFFILE position (so index rewinds keep working), same GIFDRAW lines. Input is
+ * read in chunks into a small buffer, LZW codes are expanded straight into the line handed to
+ * the draw callback, no frame buffer is kept, and the global palette is converted once per file
+ *
+ * Disposal and transparency are passed through GIFDRAW and handled by the draw callback, like
+ * with AnimatedGIF. Interlaced frames are sent in stored row order with their real row number
+ */
+class GifDecoder {
+   public:
+    static constexpr int MAX_WIDTH = 480;
+
+    auto begin(uint8_t paletteType) -> void;
+    auto open(const char* name, GIF_OPEN_CALLBACK* openFile, GIF_CLOSE_CALLBACK* closeFile, GIF_READ_CALLBACK* readFile,
+              GIF_SEEK_CALLBACK* seekFile, GIF_DRAW_CALLBACK* draw) -> int;
+    auto close() -> void;
+    auto playFrame(bool sync, int* delayMs, void* user) -> int;
+    auto getCanvasWidth() const -> int;
+    auto getCanvasHeight() const -> int;
+
+   private:
+    static constexpr size_t INPUT_BYTES = 512;
+    static constexpr size_t MAX_CODES = 4096;
+
+    GIFFILE m_file{};
+    GIF_CLOSE_CALLBACK* m_closeFile = nullptr;
+    GIF_READ_CALLBACK* m_readFile = nullptr;
+    GIF_SEEK_CALLBACK* m_seekFile = nullptr;
+    GIF_DRAW_CALLBACK* m_draw = nullptr;
+    bool m_bigEndian = false;
+
+    uint16_t m_canvasW = 0;
+    uint16_t m_canvasH = 0;
+    uint8_t m_background = 0;
+    bool m_hasGlobalPalette = false;
+    std::array<uint16_t, 256> m_globalPalette{};
+    std::array<uint16_t, 256> m_localPalette{};
+
+    // Read-ahead window over the file, m_file.iPos is the file offset just past it
+    std::array<uint8_t, INPUT_BYTES> m_input{};
+    int32_t m_inputPos = 0;
+    int32_t m_inputLen = 0;
+    uint8_t m_blockLeft = 0;
+    bool m_dataEnded = false;
+
+    // LZW dictionary: each code is its prefix code plus one last index, expanded backwards on a stack
+    std::array<uint16_t, MAX_CODES> m_prefix{};
+    std::array<uint8_t, MAX_CODES> m_suffix{};
+    std::array<uint8_t, MAX_CODES + 1> m_stack{};
+    std::array<uint8_t, MAX_WIDTH> m_line{};
+
+    auto fill() -> bool;
+    auto readByte() -> int;
+    auto readBytes(uint8_t* dst, int32_t len) -> bool;
+    auto skipBytes(int32_t len) -> bool;
+    auto skipSubBlocks() -> bool;
+    auto dataByte() -> int;
+    auto readPalette(uint16_t* palette, int entries) -> bool;
+    auto decodeImage(GIFDRAW& draw, bool interlaced) -> bool;
+    auto emitRow(GIFDRAW& draw, int row) -> void;
+    auto consumedPos() const -> int32_t;
+};
+
+// The player and the transcoder decode with the in-tree decoder when built with GIF_INTREE_DECODER
+#ifdef GIF_INTREE_DECODER
+using GifFrameDecoder = GifDecoder;
+#else
+using GifFrameDecoder = AnimatedGIF;
+#endif
+
+#endif  // SRC_DISPLAY_GIF_DECODER_H
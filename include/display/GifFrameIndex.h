@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_GIF_FRAME_INDEX_H
+#define SRC_DISPLAY_GIF_FRAME_INDEX_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+
+// Frame flags: transparency enabled in its control extension, image covers the whole canvas
+static constexpr uint16_t GIF_FRAME_TRANSPARENT = 0x0001;
+static constexpr uint16_t GIF_FRAME_FULL_CANVAS = 0x0002;
+
+/**
+ * @brief Where a frame starts in its GIF and what it draws
+ *
+ * The offset is the first block after the previous image (control extension included), so the
+ * decoder can be positioned there directly without parsing anything before it
+ */
+struct GifFrameEntry {
+    uint32_t offset;
+    uint16_t delayMs;
+    uint16_t flags;
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+};
+
+/**
+ * @brief Sidecar header, the GIF size detects a sidecar left over from a replaced file
+ */
+struct GifFrameIndexHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t frameCount;
+    uint32_t gifSize;
+    uint32_t durationMs;
+};
+
+/**
+ * @brief Per-GIF frame index stored as a sidecar file under /gifidx
+ *
+ * Built by walking the GIF block structure (image data is skipped, not decoded), when a GIF is
+ * uploaded or the first time it is played without an index
+ */
+class GifFrameIndex {
+   public:
+    static auto sidecarPath(const String& gifPath) -> String;
+    static auto build(const String& gifPath) -> bool;
+    static auto ensure(const String& gifPath) -> bool;
+    static auto load(const String& gifPath, uint32_t gifSize, GifFrameIndexHeader& header, GifFrameEntry& first)
+        -> bool;
+    static auto readEntry(File& sidecar, uint16_t frame, GifFrameEntry& entry) -> bool;
+    static auto remove(const String& gifPath) -> void;
+};
+
+#endif  // SRC_DISPLAY_GIF_FRAME_INDEX_H
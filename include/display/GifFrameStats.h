@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_GIF_FRAME_STATS_H
+#define SRC_DISPLAY_GIF_FRAME_STATS_H
+
+#include <Arduino.h>
+#include <array>
+
+/**
+ * @brief Cost of one drawn frame, split by where the time went
+ *
+ * Decode time is the frame work minus the SPI and yield time spent inside it, SPI time covers
+ * address windows and pixel writes up to the point the bus accepted them. Interval is the time
+ * since the previous frame was drawn, delay what the file asked for (dropped frames included)
+ */
+struct GifFrameSample {
+    uint32_t decodeUs = 0;
+    uint32_t spiUs = 0;
+    uint32_t yieldUs = 0;
+    uint32_t bytes = 0;
+    uint16_t windows = 0;
+    uint16_t intervalMs = 0;
+    uint16_t delayMs = 0;
+    uint16_t lateMs = 0;
+};
+
+enum class GifFrameMetric : uint8_t { DecodeUs, SpiUs, YieldUs, Bytes, Windows, IntervalMs, DelayMs, LateMs };
+
+/**
+ * @brief Mean and 95th percentile of one metric over the rolling window
+ */
+struct GifMetricSummary {
+    uint32_t avg = 0;
+    uint32_t p95 = 0;
+};
+
+/**
+ * @brief Rolling window of the last drawn frames plus counters since the last reset
+ *
+ * Recording a frame is a copy into a ring, averages and percentiles are only worked out when
+ * asked for, so the collection can stay on during normal playback
+ */
+class GifFrameStats {
+   public:
+    static constexpr size_t WINDOW = 32;
+
+    auto reset() -> void;
+    auto record(const GifFrameSample& sample, bool late) -> void;
+    auto recordDrop() -> void;
+    auto summarize(GifFrameMetric metric) const -> GifMetricSummary;
+    auto fps(GifFrameMetric metric) const -> float;
+    auto samples() const -> size_t;
+    auto frames() const -> uint32_t;
+    auto lateFrames() const -> uint32_t;
+    auto droppedFrames() const -> uint32_t;
+
+   private:
+    std::array<GifFrameSample, WINDOW> m_samples{};
+    size_t m_next = 0;
+    size_t m_count = 0;
+    uint32_t m_frames = 0;
+    uint32_t m_lateFrames = 0;
+    uint32_t m_droppedFrames = 0;
+};
+
+#endif  // SRC_DISPLAY_GIF_FRAME_STATS_H
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SRC_DISPLAY_GIF_NATIVE_H
+#define SRC_DISPLAY_GIF_NATIVE_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <array>
+
+// Frame flag: every row of the dirty rectangle is one span covering its full width
+static constexpr uint16_t GIF_NATIVE_SOLID = 0x0001;
+
+// RLE packet header: high bit set for a run of one pixel, the low bits hold the pixel count - 1
+static constexpr uint8_t GIF_NATIVE_RUN = 0x80;
+static constexpr uint8_t GIF_NATIVE_COUNT_MASK = 0x7F;
+
+/**
+ * @brief Native animation header, the GIF size detects a file left over from a replaced GIF
+ *
+ * The first frame rectangle is kept so the player centres the animation exactly like the GIF
+ */
+struct GifNativeHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t frameCount;
+    uint32_t gifSize;
+    uint16_t width;
+    uint16_t height;
+    uint16_t firstX;
+    uint16_t firstY;
+    uint16_t firstWidth;
+    uint16_t firstHeight;
+};
+
+/**
+ * @brief One frame: its delay and the rectangle around everything it changes, followed by its rows
+ *
+ * Bytes counts the rows after this record, so a frame can be skipped without parsing it
+ */
+struct GifNativeFrame {
+    uint32_t bytes;
+    uint16_t delayMs;
+    uint16_t rowCount;
+    uint16_t flags;
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint16_t reserved;
+};
+
+/**
+ * @brief Changed canvas row, followed by its spans
+ */
+struct GifNativeRow {
+    uint16_t y;
+    uint16_t spanCount;
+};
+
+/**
+ * @brief Run of changed pixels in a row, followed by its RLE packets
+ */
+struct GifNativeSpan {
+    uint16_t x;
+    uint16_t length;
+};
+
+/**
+ * @brief Reader for the native animation format transcoded from a GIF (see GifTranscoder)
+ *
+ * Frames are deltas: only rows that change are stored, as spans of RGB565 pixels in panel byte
+ * order, compressed with a byte-oriented RLE, so playing them needs no LZW decoding at all
+ * Files live next to the frame index as /gifidx/<gif path>.gma
+ */
+class GifNative {
+   public:
+    static constexpr uint32_t MAGIC = 0x414E4D47;  // "GMNA"
+    static constexpr uint16_t VERSION = 1;
+
+    static auto path(const String& gifPath) -> String;
+    static auto exists(const String& gifPath) -> bool;
+    static auto remove(const String& gifPath) -> void;
+
+    auto open(const String& gifPath) -> bool;
+    auto close() -> void;
+    auto isOpen() const -> bool;
+    auto header() const -> const GifNativeHeader&;
+    auto frameNumber() const -> uint16_t;
+    auto rewind() -> bool;
+    auto readFrame(GifNativeFrame& frame) -> bool;
+    auto readRow(GifNativeRow& row) -> bool;
+    auto readSpan(GifNativeSpan& span, uint16_t* pixels, size_t capacity) -> bool;
+
+   private:
+    static constexpr size_t READ_BUFFER_BYTES = 512;
+
+    File m_file;
+    GifNativeHeader m_header{};
+    uint16_t m_frameNumber = 0;
+    std::array<uint8_t, READ_BUFFER_BYTES> m_buf{};
+    size_t m_bufPos = 0;
+    size_t m_bufLen = 0;
+
+    auto read(void* dst, size_t len) -> bool;
+};
+
+#endif  // SRC_DISPLAY_GIF_NATIVE_H
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_GIF_PLAYLIST_H
+#define SRC_DISPLAY_GIF_PLAYLIST_H
+
+#include <Arduino.h>
+#include <array>
+
+#include "display/Gif.h"
+
+/**
+ * @brief One queued GIF: played loops times, or until durationMs when set (whichever ends first)
+ */
+struct GifQueueEntry {
+    String path;
+    uint32_t durationMs = 0;
+    uint16_t loops = 1;
+};
+
+/**
+ * @brief Non-blocking GIF queue, advanced only from update()
+ *
+ * The front entry is the one playing, it is removed when it ends (or moved to the back when
+ * repeating). While it plays, the next file is opened and its header checked so switching only
+ * costs opening the decoder, and its first frame keeps the frame deadlines of the previous file
+ */
+class GifPlaylist {
+   public:
+    static constexpr size_t QUEUE_MAX = 16;
+
+    explicit GifPlaylist(Gif& gif);
+
+    auto enqueue(const GifQueueEntry& entry) -> bool;
+    auto playNow(const GifQueueEntry& entry) -> bool;
+    auto skip() -> bool;
+    auto clear() -> void;
+    auto update() -> void;
+    auto setRepeat(bool enabled) -> void;
+    auto isRepeat() const -> bool;
+    auto isActive() const -> bool;
+    auto size() const -> size_t;
+    auto entryAt(size_t index) const -> const GifQueueEntry&;
+
+   private:
+    Gif& m_gif;
+    std::array<GifQueueEntry, QUEUE_MAX> m_entries;
+    size_t m_count = 0;
+    bool m_repeat = false;
+    bool m_active = false;
+    uint32_t m_entryStartMs = 0;
+    String m_preloadPath;
+
+    // Canvas of the file on screen, empty when the panel holds no GIF
+    GifCanvas m_canvas;
+
+    auto startFront(bool gapless) -> bool;
+    auto advance(bool gapless) -> void;
+    auto dropFront() -> void;
+    auto nextEntry() const -> const GifQueueEntry*;
+};
+
+#endif  // SRC_DISPLAY_GIF_PLAYLIST_H
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_GIF_SLOT_STORE_H
+#define SRC_DISPLAY_GIF_SLOT_STORE_H
+
+#include <Arduino.h>
+#include <array>
+
+// Playback paths starting with this prefix name a slot instead of a LittleFS file
+static constexpr const char* GIF_SLOT_PREFIX = "slot:";
+
+/**
+ * @brief One GIF stored contiguously in the slot region, offset is a flash address
+ */
+struct GifSlot {
+    std::array<char, 24> name;
+    uint32_t offset;
+    uint32_t size;
+};
+
+/**
+ * @brief Raw flash GIF store outside LittleFS, read through the memory-mapped flash cache
+ *
+ * The region (reserved by the gifslots linker script, see the esp12e-gifslots env) starts with
+ * one sector holding the slot table, GIFs follow, each starting on a sector boundary
+ * Files are written sequentially into the largest free gap, so an upload needs no size up front and
+ * a slot of the same name is only replaced once the new data is complete
+ * Slot data must be read with 32-bit aligned accesses (memcpy_P / AnimatedGIF openFLASH)
+ */
+class GifSlotStore {
+   public:
+    static constexpr size_t SLOT_MAX = 16;
+    static constexpr uint32_t SECTOR_BYTES = 4096;
+
+    static auto begin() -> bool;
+    static auto begin(uint32_t flashOffset, uint32_t size, const uint8_t* mapped) -> bool;
+    static auto isAvailable() -> bool;
+    static auto count() -> size_t;
+    static auto slotAt(size_t index) -> const GifSlot&;
+    static auto find(const String& name) -> const GifSlot*;
+    static auto data(const GifSlot& slot) -> const uint8_t*;
+    static auto capacity() -> uint32_t;
+    static auto largestFree() -> uint32_t;
+    static auto beginWrite(const String& name) -> bool;
+    static auto write(const uint8_t* data, size_t len) -> bool;
+    static auto endWrite() -> bool;
+    static auto abortWrite() -> void;
+    static auto remove(const String& name) -> bool;
+};
+
+#endif  // SRC_DISPLAY_GIF_SLOT_STORE_H
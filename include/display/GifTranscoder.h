@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SRC_DISPLAY_GIF_TRANSCODER_H
+#define SRC_DISPLAY_GIF_TRANSCODER_H
+
+#include <Arduino.h>
+#include <array>
+
+/**
+ * @brief Background conversion of uploaded GIFs to the native animation format (see GifNative)
+ *
+ * Files are converted one frame per update() while no GIF is playing, with a decoder of their
+ * own; a conversion in progress is abandoned (and started again later) as soon as playback
+ * needs the heap back. Frames are composed the way the GIF player draws them, then reduced to
+ * the spans of each row that differ from what the previous frames left on the panel
+ */
+class GifTranscoder {
+   public:
+    static constexpr size_t QUEUE_MAX = 8;
+
+    static auto enqueue(const String& gifPath) -> bool;
+    static auto cancel(const String& gifPath) -> void;
+    static auto update(bool idle) -> void;
+    static auto setAutoScaleEnabled(bool enabled) -> void;
+    static auto pending() -> size_t;
+    static auto isRunning() -> bool;
+};
+
+#endif  // SRC_DISPLAY_GIF_TRANSCODER_H
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef SRC_DISPLAY_HOT_PATH_H
+#define SRC_DISPLAY_HOT_PATH_H
+
+#include <Arduino.h>
+
+/**
+ * Placement of the per-pixel and per-line drawing code
+ *
+ * Built with DISPLAY_IRAM_HOT_PATH, functions marked HOT_PATH are linked into IRAM and no longer
+ * compete with WiFi, lwIP and the web server for the 32 KB flash instruction cache. IRAM is
+ * scarce (see scripts/memory_budget.py), so only code that runs for every line or pixel of a
+ * frame is marked; without the flag everything stays in flash
+ */
+#ifdef DISPLAY_IRAM_HOT_PATH
+#define HOT_PATH IRAM_ATTR
+static constexpr bool HOT_PATH_IN_IRAM = true;
+#else
+#define HOT_PATH
+static constexpr bool HOT_PATH_IN_IRAM = false;
+#endif
+
+#endif  // SRC_DISPLAY_HOT_PATH_H
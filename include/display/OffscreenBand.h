@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_OFFSCREEN_BAND_H
+#define SRC_DISPLAY_OFFSCREEN_BAND_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Counters of an off-screen band
+ *
+ * Staged bytes went to slots ahead of time, swaps are the start address changes that showed a
+ * slot, each a 3 byte command whatever the band size
+ */
+struct OffscreenBandStats {
+    uint32_t stagedBytes = 0;
+    uint32_t swaps = 0;
+    uint32_t swapBytes = 0;
+};
+
+/**
+ * @brief Band at the bottom of the screen backed by the GRAM rows the panel never shows
+ *
+ * The ST7789 has 320 rows of frame memory for a 240 row screen. Making the band plus the hidden
+ * rows the vertical scroll area (VSCRDEF) lets the scroll start address (VSCSAD) pick which
+ * band-high slice of them the band shows: slot 0 is the band's own rows, drawn as usual, slots
+ * 1 and up are hidden rows where content is staged ahead of time and revealed with one command,
+ * so the band never shows a partial redraw. While a hidden slot is shown the rows of slot 0 keep
+ * receiving whatever is drawn to the screen (a GIF, the UI) and reappear with slot 0
+ *
+ * The scroll area has to end at the last GRAM row, so the band sits at the bottom of the screen,
+ * and only rotations 0 and 4 keep GRAM rows in screen order
+ */
+class OffscreenBand {
+   public:
+    static constexpr int MAX_WIDTH = 240;
+
+    auto begin(int16_t height) -> bool;
+    auto end() -> void;
+    auto stageText(uint8_t slot, int16_t xPos, const String& text, uint8_t textSize, uint16_t fgColor,
+                   uint16_t bgColor) -> bool;
+    auto show(uint8_t slot) -> bool;
+    auto slots() const -> uint8_t;
+    auto shownSlot() const -> uint8_t;
+    auto slotRow(uint8_t slot) const -> int16_t;
+    auto top() const -> int16_t;
+    auto isActive() const -> bool;
+    auto getStats() const -> const OffscreenBandStats&;
+
+   private:
+    int16_t m_top = 0;
+    int16_t m_height = 0;
+    int16_t m_width = 0;
+    uint8_t m_slots = 0;
+    uint8_t m_shown = 0;
+    bool m_active = false;
+    OffscreenBandStats m_stats;
+};
+
+#endif  // SRC_DISPLAY_OFFSCREEN_BAND_H
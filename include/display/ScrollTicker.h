@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_SCROLL_TICKER_H
+#define SRC_DISPLAY_SCROLL_TICKER_H
+
+#include <Arduino.h>
+#include <array>
+
+#include "display/TextRaster.h"
+
+/**
+ * @brief SPI cost of a running ticker
+ *
+ * Ticks count the updates that moved the band, bytes cover address windows, pixels and the
+ * scroll start command. Redraw bytes are what repainting the whole band once would cost, the
+ * price of one tick without hardware scrolling
+ */
+struct ScrollTickerStats {
+    uint32_t ticks = 0;
+    uint32_t rows = 0;
+    uint32_t bytes = 0;
+    uint32_t lastTickBytes = 0;
+    uint32_t redrawBytes = 0;
+};
+
+/**
+ * @brief Text scrolled upwards through a horizontal band of the screen with the panel's vertical scroll
+ *
+ * The band is made the panel's vertical scroll area (VSCRDEF), moving its start address (VSCSAD)
+ * by one moves every line of the band at once. Only the rows entering at the bottom are written,
+ * into the GRAM rows that just left at the top, so a tick costs a few hundred bytes whatever the
+ * band height. The wrapped text loops with a band-high gap between repeats
+ *
+ * Vertical scrolling runs along GRAM rows, so only rotations that keep rows horizontal and top
+ * down (0 and its mirror 4) are supported
+ */
+class ScrollTicker {
+   public:
+    static constexpr int MAX_WIDTH = 240;
+    static constexpr uint16_t MAX_ROWS_PER_SECOND = 480;
+
+    auto begin(int16_t xPos, int16_t top, int16_t height, const String& text, uint8_t textSize, uint16_t fgColor,
+               uint16_t bgColor, uint16_t rowsPerSecond) -> bool;
+    auto end() -> void;
+    auto update() -> void;
+    auto scroll(uint16_t rows) -> void;
+    auto isActive() const -> bool;
+    auto getStats() const -> const ScrollTickerStats&;
+
+   private:
+    String m_lines;
+    std::array<uint16_t, TextRaster::WRAP_MAX_LINES + 1> m_lineStart{};
+    uint8_t m_lineCount = 0;
+    int16_t m_xPos = 0;
+    int16_t m_top = 0;
+    int16_t m_height = 0;
+    int16_t m_width = 0;
+    uint8_t m_textSize = 1;
+    uint16_t m_fgColor = 0;
+    uint16_t m_bgColor = 0;
+    uint16_t m_rowsPerSecond = 0;
+    uint16_t m_offset = 0;
+    uint32_t m_nextRow = 0;
+    uint32_t m_contentRows = 0;
+    uint32_t m_lastMs = 0;
+    uint32_t m_pendingRows = 0;
+    bool m_active = false;
+    ScrollTickerStats m_stats;
+
+    auto renderRow(uint32_t row, uint16_t* out) const -> void;
+    auto fillBand() -> void;
+};
+
+#endif  // SRC_DISPLAY_SCROLL_TICKER_H
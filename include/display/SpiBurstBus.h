@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_SPI_BURST_BUS_H
+#define SRC_DISPLAY_SPI_BURST_BUS_H
+
+#include <Arduino.h>
+
+/**
+ * @brief Register level writer for the ESP8266 HSPI (SPI1) data FIFO
+ *
+ * Bytes are copied as 32-bit words into SPI1W0..SPI1W15 and sent in 64-byte bursts
+ * The peripheral must already be configured (clock, mode, MOSI enabled) by the Arduino_GFX bus
+ * Data is sent as-is so pixels must already be in panel (big-endian) byte order
+ *
+ * writeBytesAsync() queues one buffer and returns after the first burst is started, the
+ * SPI transfer-done interrupt (or pump() when polling) refills the FIFO until the buffer is out
+ * The queued buffer must stay untouched until the next call to waitIdle() or writeBytes*()
+ */
+class SpiBurstBus {
+   public:
+    static constexpr uint32_t FIFO_BYTES = 64;
+
+    static auto begin() -> void;
+    static auto writeBytes(const uint8_t* data, uint32_t len) -> void;
+    static auto writeBytesAsync(const uint8_t* data, uint32_t len) -> void;
+    static auto pump() -> void;
+    static auto waitIdle() -> void;
+    static auto isIdle() -> bool;
+    static auto waitCycles() -> uint32_t;
+};
+
+#endif  // SRC_DISPLAY_SPI_BURST_BUS_H
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SRC_DISPLAY_TEXT_RASTER_H
+#define SRC_DISPLAY_TEXT_RASTER_H
+
+#include <Arduino.h>
+#include <array>
+
+/**
+ * @brief Built-in 6x8 text cell rendered into RAM line buffers
+ *
+ * Same cell as the GFX default font: a 5x7 glyph plus one column and one row of spacing, printable
+ * ASCII only, anything else shows as '?'. Rows are produced one pixel line at a time so callers can
+ * send text with their own address windows instead of one GFX call per glyph pixel run, drawLine()
+ * does that for a whole text line
+ */
+class TextRaster {
+   public:
+    static constexpr int CELL_W = 6;
+    static constexpr int CELL_H = 8;
+    static constexpr int WRAP_MAX_CHARS = 128;
+    static constexpr int WRAP_MAX_LINES = 10;
+    static constexpr int MAX_WIDTH = 240;
+    // Largest text line composed whole in a heap strip, bigger ones go out one pixel row at a time
+    static constexpr uint32_t STRIP_MAX_BYTES = 8U * 1024U;
+
+    using Lines = std::array<std::array<char, WRAP_MAX_CHARS>, WRAP_MAX_LINES>;
+
+    static auto wrap(const String& text, int maxCharsPerLine, int maxLines, Lines& outLines) -> int;
+    static auto glyphColumn(char chr, int column) -> uint8_t;
+    static auto rasterizeRow(const char* text, size_t length, uint8_t scale, int row, uint16_t fgColor,
+                             uint16_t bgColor, uint16_t* out, int width) -> void;
+    static auto drawLine(int16_t xPos, int16_t yPos, const char* text, uint8_t scale, uint16_t fgColor,
+                         uint16_t bgColor, int16_t minWidth) -> uint32_t;
+};
+
+#endif  // SRC_DISPLAY_TEXT_RASTER_H
@@ -0,0 +1,302 @@
+// This file is auto-generated by scripts/fontconv.py from fonts/geekmagic-sans.bdf.
+// Please do not edit manually.
+#pragma once
+
+#include "display/Font.h"
+
+// 227 glyphs, 971 bitmap bytes (1489 decoded), line height 10
+static const FontGlyph GEEK_MAGIC_SANS_10_GLYPHS[] PROGMEM = {
+    {0, 0x0020, 0, 0, 0, 0, 3, 0},  // ' '
+    {0, 0x0021, 1, 7, 0, 2, 2, 0},  // '!'
+    {1, 0x0022, 3, 3, 0, 2, 4, 0},  // '"'
+    {3, 0x0023, 5, 7, 0, 2, 6, 0},  // '#'
+    {8, 0x0024, 5, 7, 0, 2, 6, 0},  // '$'
+    {13, 0x0025, 5, 7, 0, 2, 6, 0},  // '%'
+    {18, 0x0026, 5, 7, 0, 2, 6, 0},  // '&'
+    {23, 0x0027, 2, 3, 0, 2, 3, 0},  // '\''
+    {24, 0x0028, 3, 7, 0, 2, 4, 0},  // '('
+    {27, 0x0029, 3, 7, 0, 2, 4, 0},  // ')'
+    {30, 0x002A, 5, 5, 0, 3, 6, 0},  // '*'
+    {34, 0x002B, 5, 5, 0, 3, 6, 0},  // '+'
+    {38, 0x002C, 2, 3, 0, 6, 3, 0},  // ','
+    {39, 0x002D, 5, 1, 0, 5, 6, 0},  // '-'
+    {40, 0x002E, 2, 2, 0, 7, 3, 0},  // '.'
+    {41, 0x002F, 5, 5, 0, 3, 6, 0},  // '/'
+    {45, 0x0030, 5, 7, 0, 2, 6, 0},  // '0'
+    {50, 0x0031, 3, 7, 0, 2, 4, 0},  // '1'
+    {53, 0x0032, 5, 7, 0, 2, 6, 0},  // '2'
+    {58, 0x0033, 5, 7, 0, 2, 6, 0},  // '3'
+    {63, 0x0034, 5, 7, 0, 2, 6, 0},  // '4'
+    {68, 0x0035, 5, 7, 0, 2, 6, 0},  // '5'
+    {73, 0x0036, 5, 7, 0, 2, 6, 0},  // '6'
+    {78, 0x0037, 5, 7, 0, 2, 6, 0},  // '7'
+    {83, 0x0038, 5, 7, 0, 2, 6, 0},  // '8'
+    {88, 0x0039, 5, 7, 0, 2, 6, 0},  // '9'
+    {93, 0x003A, 2, 5, 0, 3, 3, 0},  // ':'
+    {95, 0x003B, 2, 6, 0, 3, 3, 0},  // ';'
+    {97, 0x003C, 4, 7, 0, 2, 5, 0},  // '<'
+    {101, 0x003D, 5, 3, 0, 4, 6, 0},  // '='
+    {103, 0x003E, 4, 7, 0, 2, 5, 0},  // '>'
+    {107, 0x003F, 5, 7, 0, 2, 6, 0},  // '?'
+    {112, 0x0040, 5, 7, 0, 2, 6, 0},  // '@'
+    {117, 0x0041, 5, 7, 0, 2, 6, 0},  // 'A'
+    {122, 0x0042, 5, 7, 0, 2, 6, 0},  // 'B'
+    {127, 0x0043, 5, 7, 0, 2, 6, 0},  // 'C'
+    {132, 0x0044, 5, 7, 0, 2, 6, 0},  // 'D'
+    {137, 0x0045, 5, 7, 0, 2, 6, 0},  // 'E'
+    {142, 0x0046, 5, 7, 0, 2, 6, 0},  // 'F'
+    {147, 0x0047, 5, 7, 0, 2, 6, 0},  // 'G'
+    {152, 0x0048, 5, 7, 0, 2, 6, 0},  // 'H'
+    {157, 0x0049, 3, 7, 0, 2, 4, 0},  // 'I'
+    {160, 0x004A, 5, 7, 0, 2, 6, 0},  // 'J'
+    {165, 0x004B, 5, 7, 0, 2, 6, 0},  // 'K'
+    {170, 0x004C, 5, 7, 0, 2, 6, 0},  // 'L'
+    {175, 0x004D, 5, 7, 0, 2, 6, 0},  // 'M'
+    {180, 0x004E, 5, 7, 0, 2, 6, 0},  // 'N'
+    {185, 0x004F, 5, 7, 0, 2, 6, 0},  // 'O'
+    {190, 0x0050, 5, 7, 0, 2, 6, 0},  // 'P'
+    {195, 0x0051, 5, 7, 0, 2, 6, 0},  // 'Q'
+    {200, 0x0052, 5, 7, 0, 2, 6, 0},  // 'R'
+    {205, 0x0053, 5, 7, 0, 2, 6, 0},  // 'S'
+    {210, 0x0054, 5, 7, 0, 2, 6, 0},  // 'T'
+    {215, 0x0055, 5, 7, 0, 2, 6, 0},  // 'U'
+    {220, 0x0056, 5, 7, 0, 2, 6, 0},  // 'V'
+    {225, 0x0057, 5, 7, 0, 2, 6, 0},  // 'W'
+    {230, 0x0058, 5, 7, 0, 2, 6, 0},  // 'X'
+    {235, 0x0059, 5, 7, 0, 2, 6, 0},  // 'Y'
+    {240, 0x005A, 5, 7, 0, 2, 6, 0},  // 'Z'
+    {245, 0x005B, 3, 7, 0, 2, 4, 0},  // '['
+    {248, 0x005C, 5, 5, 0, 3, 6, 0},  // '\\'
+    {252, 0x005D, 3, 7, 0, 2, 4, 0},  // ']'
+    {255, 0x005E, 5, 3, 0, 2, 6, 0},  // '^'
+    {257, 0x005F, 5, 1, 0, 8, 6, 0},  // '_'
+    {258, 0x0060, 3, 3, 0, 2, 4, 0},  // '`'
+    {260, 0x0061, 5, 5, 0, 4, 6, 0},  // 'a'
+    {264, 0x0062, 5, 7, 0, 2, 6, 0},  // 'b'
+    {269, 0x0063, 5, 5, 0, 4, 6, 0},  // 'c'
+    {273, 0x0064, 5, 7, 0, 2, 6, 0},  // 'd'
+    {278, 0x0065, 5, 5, 0, 4, 6, 0},  // 'e'
+    {282, 0x0066, 5, 7, 0, 2, 6, 0},  // 'f'
+    {287, 0x0067, 5, 6, 0, 3, 6, 0},  // 'g'
+    {291, 0x0068, 5, 7, 0, 2, 6, 0},  // 'h'
+    {296, 0x0069, 3, 7, 0, 2, 4, 0},  // 'i'
+    {299, 0x006A, 4, 7, 0, 2, 5, 0},  // 'j'
+    {303, 0x006B, 4, 7, 0, 2, 5, 0},  // 'k'
+    {307, 0x006C, 3, 7, 0, 2, 4, 0},  // 'l'
+    {310, 0x006D, 5, 5, 0, 4, 6, 0},  // 'm'
+    {314, 0x006E, 5, 5, 0, 4, 6, 0},  // 'n'
+    {318, 0x006F, 5, 5, 0, 4, 6, 0},  // 'o'
+    {322, 0x0070, 5, 5, 0, 4, 6, 0},  // 'p'
+    {326, 0x0071, 5, 5, 0, 4, 6, 0},  // 'q'
+    {330, 0x0072, 5, 5, 0, 4, 6, 0},  // 'r'
+    {334, 0x0073, 5, 5, 0, 4, 6, 0},  // 's'
+    {338, 0x0074, 5, 7, 0, 2, 6, 0},  // 't'
+    {343, 0x0075, 5, 5, 0, 4, 6, 0},  // 'u'
+    {347, 0x0076, 5, 5, 0, 4, 6, 0},  // 'v'
+    {351, 0x0077, 5, 5, 0, 4, 6, 0},  // 'w'
+    {355, 0x0078, 5, 5, 0, 4, 6, 0},  // 'x'
+    {359, 0x0079, 5, 5, 0, 4, 6, 0},  // 'y'
+    {363, 0x007A, 5, 5, 0, 4, 6, 0},  // 'z'
+    {367, 0x007B, 3, 7, 0, 2, 4, 0},  // '{'
+    {370, 0x007C, 1, 7, 0, 2, 2, 0},  // '|'
+    {371, 0x007D, 3, 7, 0, 2, 4, 0},  // '}'
+    {374, 0x007E, 5, 2, 0, 4, 6, 0},  // '~'
+    {376, 0x00A0, 0, 0, 0, 0, 3, 0},  // U+00A0
+    {376, 0x00A1, 1, 7, 0, 2, 2, 0},  // U+00A1
+    {377, 0x00A2, 5, 7, 0, 2, 6, 0},  // U+00A2
+    {382, 0x00A3, 5, 7, 0, 2, 6, 0},  // U+00A3
+    {387, 0x00A5, 5, 7, 0, 2, 6, 0},  // U+00A5
+    {392, 0x00A7, 4, 7, 0, 2, 5, 0},  // U+00A7
+    {396, 0x00A9, 5, 7, 0, 2, 6, 0},  // U+00A9
+    {401, 0x00AB, 5, 5, 0, 3, 6, 0},  // U+00AB
+    {405, 0x00B0, 4, 4, 0, 2, 5, 0},  // U+00B0
+    {407, 0x00B1, 5, 7, 0, 2, 6, 0},  // U+00B1
+    {412, 0x00B2, 3, 4, 0, 1, 4, 0},  // U+00B2
+    {414, 0x00B3, 3, 4, 0, 1, 4, 0},  // U+00B3
+    {416, 0x00B5, 4, 6, 0, 4, 5, 0},  // U+00B5
+    {419, 0x00B7, 2, 2, 0, 5, 3, 0},  // U+00B7
+    {420, 0x00BB, 5, 5, 0, 3, 6, 0},  // U+00BB
+    {424, 0x00BF, 5, 7, 0, 2, 6, 0},  // U+00BF
+    {429, 0x00C0, 5, 9, 0, 0, 6, 0},  // U+00C0
+    {435, 0x00C1, 5, 9, 0, 0, 6, 0},  // U+00C1
+    {441, 0x00C2, 5, 9, 0, 0, 6, 0},  // U+00C2
+    {447, 0x00C3, 5, 9, 0, 0, 6, 0},  // U+00C3
+    {453, 0x00C4, 5, 9, 0, 0, 6, 0},  // U+00C4
+    {459, 0x00C5, 5, 9, 0, 0, 6, 0},  // U+00C5
+    {465, 0x00C6, 5, 7, 0, 2, 6, 0},  // U+00C6
+    {470, 0x00C7, 5, 8, 0, 2, 6, 0},  // U+00C7
+    {475, 0x00C8, 5, 9, 0, 0, 6, 0},  // U+00C8
+    {481, 0x00C9, 5, 9, 0, 0, 6, 0},  // U+00C9
+    {487, 0x00CA, 5, 9, 0, 0, 6, 0},  // U+00CA
+    {493, 0x00CB, 5, 9, 0, 0, 6, 0},  // U+00CB
+    {499, 0x00CC, 3, 9, 0, 0, 4, 0},  // U+00CC
+    {503, 0x00CD, 3, 9, 0, 0, 4, 0},  // U+00CD
+    {507, 0x00CE, 3, 9, 0, 0, 4, 0},  // U+00CE
+    {511, 0x00CF, 3, 9, 0, 0, 4, 0},  // U+00CF
+    {515, 0x00D0, 5, 7, 0, 2, 6, 0},  // U+00D0
+    {520, 0x00D1, 5, 9, 0, 0, 6, 0},  // U+00D1
+    {526, 0x00D2, 5, 9, 0, 0, 6, 0},  // U+00D2
+    {532, 0x00D3, 5, 9, 0, 0, 6, 0},  // U+00D3
+    {538, 0x00D4, 5, 9, 0, 0, 6, 0},  // U+00D4
+    {544, 0x00D5, 5, 9, 0, 0, 6, 0},  // U+00D5
+    {550, 0x00D6, 5, 9, 0, 0, 6, 0},  // U+00D6
+    {556, 0x00D7, 5, 5, 0, 3, 6, 0},  // U+00D7
+    {560, 0x00D8, 5, 7, 0, 2, 6, 0},  // U+00D8
+    {565, 0x00D9, 5, 9, 0, 0, 6, 0},  // U+00D9
+    {571, 0x00DA, 5, 9, 0, 0, 6, 0},  // U+00DA
+    {577, 0x00DB, 5, 9, 0, 0, 6, 0},  // U+00DB
+    {583, 0x00DC, 5, 9, 0, 0, 6, 0},  // U+00DC
+    {589, 0x00DD, 5, 9, 0, 0, 6, 0},  // U+00DD
+    {595, 0x00DE, 5, 7, 0, 2, 6, 0},  // U+00DE
+    {600, 0x00DF, 4, 7, 0, 2, 5, 0},  // U+00DF
+    {604, 0x00E0, 5, 8, 0, 1, 6, 0},  // U+00E0
+    {609, 0x00E1, 5, 8, 0, 1, 6, 0},  // U+00E1
+    {614, 0x00E2, 5, 8, 0, 1, 6, 0},  // U+00E2
+    {619, 0x00E3, 5, 8, 0, 1, 6, 0},  // U+00E3
+    {624, 0x00E4, 5, 7, 0, 2, 6, 0},  // U+00E4
+    {629, 0x00E5, 5, 8, 0, 1, 6, 0},  // U+00E5
+    {634, 0x00E6, 5, 5, 0, 4, 6, 0},  // U+00E6
+    {638, 0x00E7, 5, 6, 0, 4, 6, 0},  // U+00E7
+    {642, 0x00E8, 5, 8, 0, 1, 6, 0},  // U+00E8
+    {647, 0x00E9, 5, 8, 0, 1, 6, 0},  // U+00E9
+    {652, 0x00EA, 5, 8, 0, 1, 6, 0},  // U+00EA
+    {657, 0x00EB, 5, 7, 0, 2, 6, 0},  // U+00EB
+    {662, 0x00EC, 3, 8, 0, 1, 4, 0},  // U+00EC
+    {665, 0x00ED, 3, 8, 0, 1, 4, 0},  // U+00ED
+    {668, 0x00EE, 3, 8, 0, 1, 4, 0},  // U+00EE
+    {671, 0x00EF, 3, 7, 0, 2, 4, 0},  // U+00EF
+    {674, 0x00F0, 4, 7, 0, 2, 5, 0},  // U+00F0
+    {678, 0x00F1, 5, 8, 0, 1, 6, 0},  // U+00F1
+    {683, 0x00F2, 5, 8, 0, 1, 6, 0},  // U+00F2
+    {688, 0x00F3, 5, 8, 0, 1, 6, 0},  // U+00F3
+    {693, 0x00F4, 5, 8, 0, 1, 6, 0},  // U+00F4
+    {698, 0x00F5, 5, 8, 0, 1, 6, 0},  // U+00F5
+    {703, 0x00F6, 5, 7, 0, 2, 6, 0},  // U+00F6
+    {708, 0x00F7, 5, 5, 0, 3, 6, 0},  // U+00F7
+    {712, 0x00F8, 5, 7, 0, 3, 6, 0},  // U+00F8
+    {717, 0x00F9, 5, 8, 0, 1, 6, 0},  // U+00F9
+    {722, 0x00FA, 5, 8, 0, 1, 6, 0},  // U+00FA
+    {727, 0x00FB, 5, 8, 0, 1, 6, 0},  // U+00FB
+    {732, 0x00FC, 5, 7, 0, 2, 6, 0},  // U+00FC
+    {737, 0x00FD, 5, 8, 0, 1, 6, 0},  // U+00FD
+    {742, 0x00FE, 4, 7, 0, 2, 5, 0},  // U+00FE
+    {746, 0x00FF, 5, 7, 0, 2, 6, 0},  // U+00FF
+    {751, 0x0391, 5, 7, 0, 2, 6, 0},  // U+0391
+    {756, 0x0392, 5, 7, 0, 2, 6, 0},  // U+0392
+    {761, 0x0393, 5, 7, 0, 2, 6, 0},  // U+0393
+    {766, 0x0394, 5, 7, 0, 2, 6, 0},  // U+0394
+    {771, 0x0395, 5, 7, 0, 2, 6, 0},  // U+0395
+    {776, 0x0396, 5, 7, 0, 2, 6, 0},  // U+0396
+    {781, 0x0397, 5, 7, 0, 2, 6, 0},  // U+0397
+    {786, 0x0398, 5, 7, 0, 2, 6, 0},  // U+0398
+    {791, 0x0399, 3, 7, 0, 2, 4, 0},  // U+0399
+    {794, 0x039A, 5, 7, 0, 2, 6, 0},  // U+039A
+    {799, 0x039B, 5, 7, 0, 2, 6, 0},  // U+039B
+    {804, 0x039C, 5, 7, 0, 2, 6, 0},  // U+039C
+    {809, 0x039D, 5, 7, 0, 2, 6, 0},  // U+039D
+    {814, 0x039E, 5, 7, 0, 2, 6, 1},  // U+039E
+    {817, 0x039F, 5, 7, 0, 2, 6, 0},  // U+039F
+    {822, 0x03A0, 5, 7, 0, 2, 6, 0},  // U+03A0
+    {827, 0x03A1, 5, 7, 0, 2, 6, 0},  // U+03A1
+    {832, 0x03A3, 5, 7, 0, 2, 6, 0},  // U+03A3
+    {837, 0x03A4, 5, 7, 0, 2, 6, 0},  // U+03A4
+    {842, 0x03A5, 5, 7, 0, 2, 6, 0},  // U+03A5
+    {847, 0x03A6, 5, 7, 0, 2, 6, 0},  // U+03A6
+    {852, 0x03A7, 5, 7, 0, 2, 6, 0},  // U+03A7
+    {857, 0x03A8, 5, 7, 0, 2, 6, 0},  // U+03A8
+    {862, 0x03A9, 5, 7, 0, 2, 6, 0},  // U+03A9
+    {867, 0x03B1, 5, 5, 0, 4, 6, 0},  // U+03B1
+    {871, 0x03B2, 4, 8, 0, 2, 5, 0},  // U+03B2
+    {875, 0x03B3, 5, 5, 0, 4, 6, 0},  // U+03B3
+    {879, 0x03B4, 4, 7, 0, 2, 5, 0},  // U+03B4
+    {883, 0x03B5, 4, 5, 0, 4, 5, 0},  // U+03B5
+    {886, 0x03B6, 5, 7, 0, 2, 6, 0},  // U+03B6
+    {891, 0x03B7, 5, 6, 0, 4, 6, 0},  // U+03B7
+    {895, 0x03B8, 4, 7, 0, 2, 5, 0},  // U+03B8
+    {899, 0x03B9, 2, 5, 0, 4, 3, 0},  // U+03B9
+    {901, 0x03BA, 4, 5, 0, 4, 5, 0},  // U+03BA
+    {904, 0x03BB, 5, 7, 0, 2, 6, 0},  // U+03BB
+    {909, 0x03BC, 4, 6, 0, 4, 5, 0},  // U+03BC
+    {912, 0x03BD, 5, 5, 0, 4, 6, 0},  // U+03BD
+    {916, 0x03BE, 5, 7, 0, 2, 6, 0},  // U+03BE
+    {921, 0x03BF, 5, 5, 0, 4, 6, 0},  // U+03BF
+    {925, 0x03C0, 5, 5, 0, 4, 6, 0},  // U+03C0
+    {929, 0x03C1, 4, 6, 0, 4, 5, 0},  // U+03C1
+    {932, 0x03C2, 4, 5, 0, 4, 5, 0},  // U+03C2
+    {935, 0x03C3, 5, 5, 0, 4, 6, 0},  // U+03C3
+    {939, 0x03C4, 5, 5, 0, 4, 6, 0},  // U+03C4
+    {943, 0x03C5, 5, 5, 0, 4, 6, 0},  // U+03C5
+    {947, 0x03C6, 5, 6, 0, 3, 6, 0},  // U+03C6
+    {951, 0x03C7, 5, 5, 0, 4, 6, 0},  // U+03C7
+    {955, 0x03C8, 5, 6, 0, 3, 6, 0},  // U+03C8
+    {959, 0x03C9, 5, 5, 0, 4, 6, 0},  // U+03C9
+    {963, 0x2022, 4, 4, 0, 4, 5, 0},  // U+2022
+    {965, 0x2026, 5, 1, 0, 8, 6, 0},  // U+2026
+    {966, 0x20AC, 5, 7, 0, 2, 6, 0},  // U+20AC
+};
+
+static const uint8_t GEEK_MAGIC_SANS_10_BITMAPS[] PROGMEM = {
+    0xFA, 0xB6, 0x80, 0x52, 0xBE, 0xAF, 0xA9, 0x40, 0x23, 0xE8, 0xE2, 0xF8, 0x80, 0xC6, 0x44, 0x44,
+    0x4C, 0x60, 0x64, 0xA8, 0x8A, 0xC9, 0xA0, 0xD8, 0x2A, 0x48, 0x88, 0x88, 0x92, 0xA0, 0x51, 0x3E,
+    0x45, 0x00, 0x21, 0x3E, 0x42, 0x00, 0xD8, 0xF8, 0xF0, 0x08, 0x88, 0x88, 0x00, 0x74, 0x67, 0x5C,
+    0xC5, 0xC0, 0x59, 0x24, 0xB8, 0x74, 0x42, 0x22, 0x23, 0xE0, 0xF8, 0x88, 0x20, 0xC5, 0xC0, 0x11,
+    0x95, 0x2F, 0x88, 0x40, 0xFC, 0x3C, 0x10, 0xC5, 0xC0, 0x32, 0x21, 0xE8, 0xC5, 0xC0, 0xF8, 0x44,
+    0x44, 0x21, 0x00, 0x74, 0x62, 0xE8, 0xC5, 0xC0, 0x74, 0x62, 0xF0, 0x89, 0x80, 0xF3, 0xC0, 0xF3,
+    0x60, 0x12, 0x48, 0x42, 0x10, 0xF8, 0x3E, 0x84, 0x21, 0x24, 0x80, 0x74, 0x42, 0x22, 0x00, 0x80,
+    0x74, 0x42, 0xDA, 0xD5, 0xC0, 0x74, 0x63, 0x1F, 0xC6, 0x20, 0xF4, 0x63, 0xE8, 0xC7, 0xC0, 0x74,
+    0x61, 0x08, 0x45, 0xC0, 0xE4, 0xA3, 0x18, 0xCB, 0x80, 0xFC, 0x21, 0xE8, 0x43, 0xE0, 0xFC, 0x21,
+    0xE8, 0x42, 0x00, 0x74, 0x61, 0x78, 0xC5, 0xE0, 0x8C, 0x63, 0xF8, 0xC6, 0x20, 0xE9, 0x24, 0xB8,
+    0x38, 0x84, 0x21, 0x49, 0x80, 0x8C, 0xA9, 0x8A, 0x4A, 0x20, 0x84, 0x21, 0x08, 0x43, 0xE0, 0x8E,
+    0xEB, 0x58, 0xC6, 0x20, 0x8C, 0x73, 0x59, 0xC6, 0x20, 0x74, 0x63, 0x18, 0xC5, 0xC0, 0xF4, 0x63,
+    0xE8, 0x42, 0x00, 0x74, 0x63, 0x1A, 0xC9, 0xA0, 0xF4, 0x63, 0xEA, 0x4A, 0x20, 0x7C, 0x20, 0xE0,
+    0x87, 0xC0, 0xF9, 0x08, 0x42, 0x10, 0x80, 0x8C, 0x63, 0x18, 0xC5, 0xC0, 0x8C, 0x63, 0x18, 0xA8,
+    0x80, 0x8C, 0x63, 0x5A, 0xD5, 0x40, 0x8C, 0x54, 0x45, 0x46, 0x20, 0x8C, 0x62, 0xA2, 0x10, 0x80,
+    0xF8, 0x44, 0x44, 0x43, 0xE0, 0xF2, 0x49, 0x38, 0x82, 0x08, 0x20, 0x80, 0xE4, 0x92, 0x78, 0x22,
+    0xA2, 0xF8, 0x88, 0x80, 0x70, 0x5F, 0x17, 0x80, 0x84, 0x2D, 0x98, 0xC7, 0xC0, 0x74, 0x21, 0x17,
+    0x00, 0x08, 0x5B, 0x38, 0xC5, 0xE0, 0x74, 0x7F, 0x07, 0x00, 0x32, 0x51, 0xC4, 0x21, 0x00, 0x7C,
+    0x62, 0xF0, 0xB8, 0x84, 0x2D, 0x98, 0xC6, 0x20, 0x43, 0x24, 0xB8, 0x10, 0x31, 0x19, 0x60, 0x88,
+    0x9A, 0xCA, 0x90, 0xC9, 0x24, 0xB8, 0xD5, 0x6B, 0x18, 0x80, 0xB6, 0x63, 0x18, 0x80, 0x74, 0x63,
+    0x17, 0x00, 0xF4, 0x7D, 0x08, 0x00, 0x6C, 0xDE, 0x10, 0x80, 0xB6, 0x61, 0x08, 0x00, 0x74, 0x1C,
+    0x1F, 0x00, 0x42, 0x38, 0x84, 0x24, 0xC0, 0x8C, 0x63, 0x36, 0x80, 0x8C, 0x62, 0xA2, 0x00, 0x8C,
+    0x6B, 0x55, 0x00, 0x8A, 0x88, 0xA8, 0x80, 0x8C, 0x5E, 0x17, 0x00, 0xF8, 0x88, 0x8F, 0x80, 0x29,
+    0x44, 0x88, 0xFE, 0x89, 0x14, 0xA0, 0x6C, 0x80, 0xBE, 0x23, 0xA9, 0x4A, 0xB8, 0x80, 0x32, 0x51,
+    0xC4, 0x26, 0xC0, 0x8A, 0xBE, 0x4F, 0x90, 0x80, 0x78, 0x69, 0x61, 0xE0, 0x74, 0x6F, 0x5B, 0xC5,
+    0xC0, 0x2A, 0xA8, 0xA2, 0x80, 0x69, 0x96, 0x21, 0x3E, 0x42, 0x03, 0xE0, 0xC5, 0x70, 0xCC, 0xE0,
+    0x99, 0x9B, 0xD8, 0xF0, 0xA2, 0x8A, 0xAA, 0x00, 0x20, 0x08, 0x44, 0x45, 0xC0, 0x41, 0x1D, 0x18,
+    0xC7, 0xF1, 0x88, 0x11, 0x1D, 0x18, 0xC7, 0xF1, 0x88, 0x22, 0x9D, 0x18, 0xC7, 0xF1, 0x88, 0x6C,
+    0x9D, 0x18, 0xC7, 0xF1, 0x88, 0x50, 0x1D, 0x18, 0xC7, 0xF1, 0x88, 0x22, 0x9D, 0x18, 0xC7, 0xF1,
+    0x88, 0x7D, 0x29, 0xFA, 0x52, 0xE0, 0x74, 0x61, 0x08, 0x45, 0xC6, 0x41, 0x3F, 0x08, 0x7A, 0x10,
+    0xF8, 0x11, 0x3F, 0x08, 0x7A, 0x10, 0xF8, 0x22, 0xBF, 0x08, 0x7A, 0x10, 0xF8, 0x50, 0x3F, 0x08,
+    0x7A, 0x10, 0xF8, 0x8B, 0xA4, 0x92, 0xE0, 0x2B, 0xA4, 0x92, 0xE0, 0x57, 0xA4, 0x92, 0xE0, 0xA3,
+    0xA4, 0x92, 0xE0, 0xE2, 0x93, 0xD4, 0xAB, 0x80, 0x6C, 0xA3, 0x1C, 0xD6, 0x71, 0x88, 0x41, 0x1D,
+    0x18, 0xC6, 0x31, 0x70, 0x11, 0x1D, 0x18, 0xC6, 0x31, 0x70, 0x22, 0x9D, 0x18, 0xC6, 0x31, 0x70,
+    0x6C, 0x9D, 0x18, 0xC6, 0x31, 0x70, 0x50, 0x1D, 0x18, 0xC6, 0x31, 0x70, 0x8A, 0x88, 0xA8, 0x80,
+    0x7C, 0xEB, 0x5A, 0xE7, 0xC0, 0x41, 0x23, 0x18, 0xC6, 0x31, 0x70, 0x11, 0x23, 0x18, 0xC6, 0x31,
+    0x70, 0x22, 0xA3, 0x18, 0xC6, 0x31, 0x70, 0x50, 0x23, 0x18, 0xC6, 0x31, 0x70, 0x11, 0x23, 0x18,
+    0xA8, 0x84, 0x20, 0x87, 0xA3, 0x1F, 0x42, 0x00, 0x69, 0xA9, 0x99, 0xA0, 0x41, 0x00, 0xE0, 0xBE,
+    0x2F, 0x11, 0x00, 0xE0, 0xBE, 0x2F, 0x22, 0x80, 0xE0, 0xBE, 0x2F, 0x6C, 0x80, 0xE0, 0xBE, 0x2F,
+    0x50, 0x1C, 0x17, 0xC5, 0xE0, 0x22, 0x88, 0xE0, 0xBE, 0x2F, 0xD1, 0x5F, 0x45, 0x80, 0x74, 0x21,
+    0x17, 0x18, 0x41, 0x00, 0xE8, 0xFE, 0x0E, 0x11, 0x00, 0xE8, 0xFE, 0x0E, 0x22, 0x80, 0xE8, 0xFE,
+    0x0E, 0x50, 0x1D, 0x1F, 0xC1, 0xC0, 0x88, 0x64, 0x97, 0x28, 0x64, 0x97, 0x54, 0x64, 0x97, 0xA3,
+    0x24, 0xB8, 0x52, 0x51, 0x79, 0x60, 0x6C, 0x81, 0x6C, 0xC6, 0x31, 0x41, 0x00, 0xE8, 0xC6, 0x2E,
+    0x11, 0x00, 0xE8, 0xC6, 0x2E, 0x22, 0x80, 0xE8, 0xC6, 0x2E, 0x6C, 0x80, 0xE8, 0xC6, 0x2E, 0x50,
+    0x1D, 0x18, 0xC5, 0xC0, 0x20, 0x3E, 0x02, 0x00, 0x0B, 0xA7, 0x5C, 0xBA, 0x00, 0x41, 0x01, 0x18,
+    0xC6, 0x6D, 0x11, 0x01, 0x18, 0xC6, 0x6D, 0x22, 0x81, 0x18, 0xC6, 0x6D, 0x50, 0x23, 0x18, 0xCD,
+    0xA0, 0x11, 0x01, 0x18, 0xBC, 0x2E, 0x88, 0xE9, 0x9E, 0x80, 0x50, 0x23, 0x17, 0x85, 0xC0, 0x74,
+    0x63, 0x1F, 0xC6, 0x20, 0xF4, 0x63, 0xE8, 0xC7, 0xC0, 0xFC, 0x21, 0x08, 0x42, 0x00, 0x21, 0x14,
+    0xA8, 0xC7, 0xE0, 0xFC, 0x21, 0xE8, 0x43, 0xE0, 0xF8, 0x44, 0x44, 0x43, 0xE0, 0x8C, 0x63, 0xF8,
+    0xC6, 0x20, 0x74, 0x63, 0xF8, 0xC5, 0xC0, 0xE9, 0x24, 0xB8, 0x8C, 0xA9, 0x8A, 0x4A, 0x20, 0x21,
+    0x14, 0xA8, 0xC6, 0x20, 0x8E, 0xEB, 0x58, 0xC6, 0x20, 0x8C, 0x73, 0x59, 0xC6, 0x20, 0x05, 0xB3,
+    0xB5, 0x74, 0x63, 0x18, 0xC5, 0xC0, 0xFC, 0x63, 0x18, 0xC6, 0x20, 0xF4, 0x63, 0xE8, 0x42, 0x00,
+    0xFC, 0x10, 0x44, 0x43, 0xE0, 0xF9, 0x08, 0x42, 0x10, 0x80, 0x8C, 0x62, 0xA2, 0x10, 0x80, 0x23,
+    0xAB, 0x5A, 0xB8, 0x80, 0x8C, 0x54, 0x45, 0x46, 0x20, 0xAD, 0x6A, 0xE2, 0x10, 0x80, 0x74, 0x63,
+    0x15, 0x2B, 0x60, 0x6C, 0xA5, 0x26, 0x80, 0x69, 0xE9, 0x9E, 0x88, 0x8A, 0x88, 0x42, 0x00, 0x78,
+    0x69, 0x99, 0x60, 0x78, 0x68, 0x70, 0xF1, 0x11, 0x08, 0x38, 0x20, 0xB6, 0x63, 0x18, 0x84, 0x69,
+    0x9F, 0x99, 0x60, 0xAA, 0x40, 0x9A, 0xCA, 0x90, 0x82, 0x10, 0x45, 0x46, 0x20, 0x99, 0x9B, 0xD8,
+    0x8C, 0x54, 0xA2, 0x00, 0xF2, 0x0C, 0x88, 0x38, 0x20, 0x74, 0x63, 0x17, 0x00, 0xFA, 0x94, 0xA4,
+    0x80, 0x69, 0x9E, 0x88, 0x78, 0x61, 0x60, 0x7C, 0xA5, 0x26, 0x00, 0xF9, 0x08, 0x41, 0x00, 0x94,
+    0x63, 0x17, 0x00, 0x55, 0x6B, 0x57, 0x10, 0x8A, 0x88, 0xA8, 0x80, 0xAD, 0x6A, 0xE2, 0x10, 0x54,
+    0x6B, 0x55, 0x00, 0x6F, 0xF6, 0xA8, 0x3A, 0x3C, 0x8F, 0x20, 0xE0,
+};
+
+static const Font GEEK_MAGIC_SANS_10 = {GEEK_MAGIC_SANS_10_GLYPHS, GEEK_MAGIC_SANS_10_BITMAPS, 227, 10, 9};
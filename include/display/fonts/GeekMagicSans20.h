@@ -0,0 +1,406 @@
+// This file is auto-generated by scripts/fontconv.py from fonts/geekmagic-sans-20.bdf.
+// Please do not edit manually.
+#pragma once
+
+#include "display/Font.h"
+
+// 227 glyphs, 2639 bitmap bytes (3627 decoded), line height 20
+static const FontGlyph GEEK_MAGIC_SANS_20_GLYPHS[] PROGMEM = {
+    {0, 0x0020, 0, 0, 0, 0, 4, 0},  // ' '
+    {0, 0x0021, 2, 12, 1, 4, 5, 0},  // '!'
+    {3, 0x0022, 5, 4, 1, 4, 7, 0},  // '"'
+    {6, 0x0023, 11, 12, 0, 4, 11, 0},  // '#'
+    {23, 0x0024, 8, 14, 1, 3, 10, 0},  // '$'
+    {37, 0x0025, 12, 12, 1, 4, 14, 0},  // '%'
+    {55, 0x0026, 10, 12, 1, 4, 12, 0},  // '&'
+    {70, 0x0027, 2, 4, 1, 4, 4, 0},  // '\''
+    {71, 0x0028, 3, 15, 1, 4, 5, 0},  // '('
+    {77, 0x0029, 3, 15, 1, 4, 5, 0},  // ')'
+    {83, 0x002A, 7, 8, 1, 3, 9, 0},  // '*'
+    {90, 0x002B, 8, 9, 1, 5, 10, 0},  // '+'
+    {99, 0x002C, 2, 4, 1, 14, 4, 0},  // ','
+    {100, 0x002D, 3, 1, 1, 11, 5, 0},  // '-'
+    {101, 0x002E, 2, 2, 1, 14, 5, 0},  // '.'
+    {102, 0x002F, 6, 12, 0, 4, 6, 0},  // '/'
+    {111, 0x0030, 8, 12, 1, 4, 10, 0},  // '0'
+    {123, 0x0031, 4, 12, 2, 4, 10, 0},  // '1'
+    {129, 0x0032, 8, 12, 1, 4, 10, 0},  // '2'
+    {141, 0x0033, 8, 12, 1, 4, 10, 0},  // '3'
+    {153, 0x0034, 10, 12, 0, 4, 10, 0},  // '4'
+    {168, 0x0035, 8, 12, 1, 4, 10, 0},  // '5'
+    {180, 0x0036, 8, 12, 1, 4, 10, 0},  // '6'
+    {192, 0x0037, 8, 12, 1, 4, 10, 0},  // '7'
+    {204, 0x0038, 8, 12, 1, 4, 10, 0},  // '8'
+    {216, 0x0039, 8, 12, 1, 4, 10, 0},  // '9'
+    {228, 0x003A, 2, 9, 1, 7, 5, 1},  // ':'
+    {230, 0x003B, 2, 11, 1, 7, 5, 0},  // ';'
+    {233, 0x003C, 8, 8, 1, 6, 10, 0},  // '<'
+    {241, 0x003D, 8, 4, 1, 8, 10, 1},  // '='
+    {244, 0x003E, 8, 8, 1, 6, 10, 0},  // '>'
+    {252, 0x003F, 6, 12, 1, 4, 7, 0},  // '?'
+    {261, 0x0040, 13, 14, 1, 4, 15, 0},  // '@'
+    {284, 0x0041, 11, 12, 0, 4, 11, 0},  // 'A'
+    {301, 0x0042, 8, 12, 2, 4, 11, 0},  // 'B'
+    {313, 0x0043, 9, 12, 1, 4, 11, 1},  // 'C'
+    {325, 0x0044, 9, 12, 2, 4, 12, 0},  // 'D'
+    {339, 0x0045, 6, 12, 2, 4, 9, 0},  // 'E'
+    {348, 0x0046, 7, 12, 2, 4, 9, 0},  // 'F'
+    {359, 0x0047, 10, 12, 1, 4, 12, 0},  // 'G'
+    {374, 0x0048, 9, 12, 2, 4, 13, 1},  // 'H'
+    {386, 0x0049, 1, 12, 2, 4, 5, 1},  // 'I'
+    {387, 0x004A, 4, 15, -2, 4, 5, 0},  // 'J'
+    {395, 0x004B, 8, 12, 2, 4, 10, 0},  // 'K'
+    {407, 0x004C, 7, 12, 2, 4, 9, 0},  // 'L'
+    {418, 0x004D, 11, 12, 2, 4, 15, 0},  // 'M'
+    {435, 0x004E, 9, 12, 2, 4, 13, 0},  // 'N'
+    {449, 0x004F, 11, 12, 1, 4, 13, 0},  // 'O'
+    {466, 0x0050, 7, 12, 2, 4, 10, 0},  // 'P'
+    {477, 0x0051, 11, 15, 1, 4, 13, 0},  // 'Q'
+    {498, 0x0052, 8, 12, 2, 4, 11, 0},  // 'R'
+    {510, 0x0053, 7, 12, 1, 4, 9, 0},  // 'S'
+    {521, 0x0054, 9, 12, 0, 4, 9, 1},  // 'T'
+    {534, 0x0055, 10, 12, 1, 4, 12, 0},  // 'U'
+    {549, 0x0056, 10, 12, 0, 4, 10, 0},  // 'V'
+    {564, 0x0057, 16, 12, 0, 4, 16, 0},  // 'W'
+    {588, 0x0058, 10, 12, 0, 4, 10, 0},  // 'X'
+    {603, 0x0059, 10, 12, 0, 4, 10, 0},  // 'Y'
+    {618, 0x005A, 8, 12, 1, 4, 10, 0},  // 'Z'
+    {630, 0x005B, 5, 15, 1, 4, 6, 0},  // '['
+    {640, 0x005C, 6, 12, 0, 4, 6, 0},  // '\\'
+    {649, 0x005D, 5, 15, 0, 4, 6, 0},  // ']'
+    {659, 0x005E, 7, 7, 1, 4, 9, 0},  // '^'
+    {666, 0x005F, 8, 1, -1, 18, 8, 0},  // '_'
+    {667, 0x0060, 2, 3, 4, 3, 10, 0},  // '`'
+    {668, 0x0061, 7, 9, 1, 7, 9, 0},  // 'a'
+    {676, 0x0062, 8, 13, 1, 3, 10, 0},  // 'b'
+    {689, 0x0063, 6, 9, 1, 7, 8, 0},  // 'c'
+    {696, 0x0064, 8, 13, 1, 3, 10, 0},  // 'd'
+    {709, 0x0065, 8, 9, 1, 7, 10, 0},  // 'e'
+    {718, 0x0066, 6, 13, 0, 3, 6, 0},  // 'f'
+    {728, 0x0067, 9, 13, 0, 7, 9, 0},  // 'g'
+    {743, 0x0068, 8, 13, 1, 3, 10, 0},  // 'h'
+    {756, 0x0069, 2, 13, 1, 3, 4, 1},  // 'i'
+    {759, 0x006A, 4, 17, -2, 3, 4, 0},  // 'j'
+    {768, 0x006B, 7, 13, 1, 3, 9, 0},  // 'k'
+    {780, 0x006C, 2, 13, 1, 3, 4, 1},  // 'l'
+    {782, 0x006D, 14, 9, 1, 7, 16, 0},  // 'm'
+    {798, 0x006E, 8, 9, 1, 7, 10, 0},  // 'n'
+    {807, 0x006F, 8, 9, 1, 7, 10, 0},  // 'o'
+    {816, 0x0070, 8, 13, 1, 7, 10, 0},  // 'p'
+    {829, 0x0071, 8, 13, 1, 7, 10, 0},  // 'q'
+    {842, 0x0072, 6, 9, 1, 7, 7, 0},  // 'r'
+    {849, 0x0073, 6, 9, 1, 7, 8, 0},  // 's'
+    {856, 0x0074, 6, 11, 0, 5, 6, 0},  // 't'
+    {865, 0x0075, 8, 9, 1, 7, 10, 0},  // 'u'
+    {874, 0x0076, 9, 9, 0, 7, 9, 0},  // 'v'
+    {885, 0x0077, 13, 9, 0, 7, 13, 0},  // 'w'
+    {900, 0x0078, 7, 9, 1, 7, 9, 0},  // 'x'
+    {908, 0x0079, 9, 13, 0, 7, 9, 0},  // 'y'
+    {923, 0x007A, 6, 9, 1, 7, 8, 0},  // 'z'
+    {930, 0x007B, 5, 15, 0, 4, 6, 0},  // '{'
+    {940, 0x007C, 1, 17, 4, 3, 9, 1},  // '|'
+    {942, 0x007D, 5, 15, 1, 4, 6, 0},  // '}'
+    {952, 0x007E, 8, 2, 1, 9, 10, 0},  // '~'
+    {954, 0x00A0, 0, 0, 0, 0, 4, 0},  // U+00A0
+    {954, 0x00A1, 2, 12, 1, 7, 5, 0},  // U+00A1
+    {957, 0x00A2, 6, 12, 2, 4, 10, 0},  // U+00A2
+    {966, 0x00A3, 8, 12, 1, 4, 10, 0},  // U+00A3
+    {978, 0x00A5, 8, 12, 1, 4, 10, 0},  // U+00A5
+    {990, 0x00A7, 7, 13, 1, 3, 9, 0},  // U+00A7
+    {1002, 0x00A9, 12, 12, 1, 4, 14, 0},  // U+00A9
+    {1020, 0x00AB, 6, 7, 1, 8, 8, 0},  // U+00AB
+    {1026, 0x00B0, 5, 5, 1, 4, 7, 0},  // U+00B0
+    {1030, 0x00B1, 8, 10, 1, 5, 10, 0},  // U+00B1
+    {1040, 0x00B2, 6, 7, 0, 4, 6, 0},  // U+00B2
+    {1046, 0x00B3, 5, 7, 0, 4, 6, 0},  // U+00B3
+    {1051, 0x00B5, 7, 13, 2, 7, 11, 0},  // U+00B5
+    {1063, 0x00B7, 2, 2, 1, 9, 5, 0},  // U+00B7
+    {1064, 0x00BB, 6, 7, 1, 8, 8, 0},  // U+00BB
+    {1070, 0x00BF, 6, 12, 0, 7, 7, 0},  // U+00BF
+    {1079, 0x00C0, 11, 16, 0, 0, 11, 0},  // U+00C0
+    {1101, 0x00C1, 11, 16, 0, 0, 11, 0},  // U+00C1
+    {1123, 0x00C2, 11, 16, 0, 0, 11, 0},  // U+00C2
+    {1145, 0x00C3, 11, 15, 0, 1, 11, 0},  // U+00C3
+    {1166, 0x00C4, 11, 15, 0, 1, 11, 0},  // U+00C4
+    {1187, 0x00C5, 11, 15, 0, 1, 11, 0},  // U+00C5
+    {1208, 0x00C6, 14, 12, -1, 4, 15, 0},  // U+00C6
+    {1229, 0x00C7, 9, 16, 1, 4, 11, 1},  // U+00C7
+    {1246, 0x00C8, 6, 16, 2, 0, 9, 0},  // U+00C8
+    {1258, 0x00C9, 6, 16, 2, 0, 9, 0},  // U+00C9
+    {1270, 0x00CA, 6, 16, 2, 0, 9, 0},  // U+00CA
+    {1282, 0x00CB, 6, 15, 2, 1, 9, 0},  // U+00CB
+    {1294, 0x00CC, 2, 16, 1, 0, 5, 0},  // U+00CC
+    {1298, 0x00CD, 2, 16, 2, 0, 5, 0},  // U+00CD
+    {1302, 0x00CE, 6, 16, -1, 0, 5, 0},  // U+00CE
+    {1314, 0x00CF, 4, 15, -1, 1, 5, 0},  // U+00CF
+    {1322, 0x00D0, 11, 12, 0, 4, 12, 0},  // U+00D0
+    {1339, 0x00D1, 9, 15, 2, 1, 13, 0},  // U+00D1
+    {1356, 0x00D2, 11, 16, 1, 0, 13, 1},  // U+00D2
+    {1377, 0x00D3, 11, 16, 1, 0, 13, 1},  // U+00D3
+    {1398, 0x00D4, 11, 16, 1, 0, 13, 0},  // U+00D4
+    {1420, 0x00D5, 11, 15, 1, 1, 13, 0},  // U+00D5
+    {1441, 0x00D6, 11, 15, 1, 1, 13, 0},  // U+00D6
+    {1462, 0x00D7, 8, 7, 1, 5, 10, 0},  // U+00D7
+    {1469, 0x00D8, 11, 12, 1, 4, 13, 0},  // U+00D8
+    {1486, 0x00D9, 10, 16, 1, 0, 12, 0},  // U+00D9
+    {1506, 0x00DA, 10, 16, 1, 0, 12, 0},  // U+00DA
+    {1526, 0x00DB, 10, 16, 1, 0, 12, 0},  // U+00DB
+    {1546, 0x00DC, 10, 15, 1, 1, 12, 0},  // U+00DC
+    {1565, 0x00DD, 10, 16, 0, 0, 10, 0},  // U+00DD
+    {1585, 0x00DE, 7, 12, 2, 4, 10, 0},  // U+00DE
+    {1596, 0x00DF, 8, 13, 2, 3, 11, 0},  // U+00DF
+    {1609, 0x00E0, 7, 13, 1, 3, 9, 0},  // U+00E0
+    {1621, 0x00E1, 7, 13, 1, 3, 9, 0},  // U+00E1
+    {1633, 0x00E2, 7, 13, 1, 3, 9, 0},  // U+00E2
+    {1645, 0x00E3, 7, 12, 1, 4, 9, 0},  // U+00E3
+    {1656, 0x00E4, 7, 12, 1, 4, 9, 0},  // U+00E4
+    {1667, 0x00E5, 7, 14, 1, 2, 9, 0},  // U+00E5
+    {1680, 0x00E6, 13, 9, 1, 6, 15, 0},  // U+00E6
+    {1695, 0x00E7, 6, 13, 1, 7, 8, 0},  // U+00E7
+    {1705, 0x00E8, 8, 13, 1, 3, 10, 0},  // U+00E8
+    {1718, 0x00E9, 8, 13, 1, 3, 10, 0},  // U+00E9
+    {1731, 0x00EA, 8, 13, 1, 3, 10, 0},  // U+00EA
+    {1744, 0x00EB, 8, 12, 1, 4, 10, 0},  // U+00EB
+    {1756, 0x00EC, 3, 13, 0, 3, 4, 0},  // U+00EC
+    {1761, 0x00ED, 3, 13, 1, 3, 4, 0},  // U+00ED
+    {1766, 0x00EE, 6, 13, -1, 3, 4, 0},  // U+00EE
+    {1776, 0x00EF, 4, 12, -1, 4, 4, 0},  // U+00EF
+    {1782, 0x00F0, 8, 13, 1, 3, 10, 0},  // U+00F0
+    {1795, 0x00F1, 8, 12, 1, 4, 10, 0},  // U+00F1
+    {1807, 0x00F2, 8, 13, 1, 3, 10, 0},  // U+00F2
+    {1820, 0x00F3, 8, 13, 1, 3, 10, 0},  // U+00F3
+    {1833, 0x00F4, 8, 13, 1, 3, 10, 0},  // U+00F4
+    {1846, 0x00F5, 8, 12, 1, 4, 10, 0},  // U+00F5
+    {1858, 0x00F6, 8, 12, 1, 4, 10, 0},  // U+00F6
+    {1870, 0x00F7, 8, 7, 1, 6, 10, 1},  // U+00F7
+    {1876, 0x00F8, 8, 9, 1, 7, 10, 0},  // U+00F8
+    {1885, 0x00F9, 8, 13, 1, 3, 10, 0},  // U+00F9
+    {1898, 0x00FA, 8, 13, 1, 3, 10, 0},  // U+00FA
+    {1911, 0x00FB, 8, 13, 1, 3, 10, 0},  // U+00FB
+    {1924, 0x00FC, 8, 12, 1, 4, 10, 0},  // U+00FC
+    {1936, 0x00FD, 9, 17, 0, 3, 9, 0},  // U+00FD
+    {1956, 0x00FE, 8, 17, 1, 3, 10, 0},  // U+00FE
+    {1973, 0x00FF, 9, 16, 0, 4, 9, 0},  // U+00FF
+    {1991, 0x0391, 11, 12, 0, 4, 11, 0},  // U+0391
+    {2008, 0x0392, 8, 12, 2, 4, 11, 0},  // U+0392
+    {2020, 0x0393, 7, 12, 2, 4, 9, 0},  // U+0393
+    {2031, 0x0394, 10, 12, 0, 4, 10, 0},  // U+0394
+    {2046, 0x0395, 6, 12, 2, 4, 9, 0},  // U+0395
+    {2055, 0x0396, 8, 12, 1, 4, 10, 0},  // U+0396
+    {2067, 0x0397, 9, 12, 2, 4, 13, 1},  // U+0397
+    {2079, 0x0398, 11, 12, 1, 4, 13, 0},  // U+0398
+    {2096, 0x0399, 1, 12, 2, 4, 5, 1},  // U+0399
+    {2097, 0x039A, 8, 12, 2, 4, 10, 0},  // U+039A
+    {2109, 0x039B, 10, 12, 0, 4, 10, 0},  // U+039B
+    {2124, 0x039C, 11, 12, 2, 4, 15, 0},  // U+039C
+    {2141, 0x039D, 9, 12, 2, 4, 13, 0},  // U+039D
+    {2155, 0x039E, 7, 12, 1, 4, 9, 1},  // U+039E
+    {2160, 0x039F, 11, 12, 1, 4, 13, 0},  // U+039F
+    {2177, 0x03A0, 8, 12, 2, 4, 12, 0},  // U+03A0
+    {2189, 0x03A1, 7, 12, 2, 4, 10, 0},  // U+03A1
+    {2200, 0x03A3, 9, 12, 1, 4, 10, 1},  // U+03A3
+    {2212, 0x03A4, 9, 12, 0, 4, 9, 1},  // U+03A4
+    {2225, 0x03A5, 10, 12, 0, 4, 10, 0},  // U+03A5
+    {2240, 0x03A6, 12, 12, 1, 4, 14, 0},  // U+03A6
+    {2258, 0x03A7, 10, 12, 0, 4, 10, 0},  // U+03A7
+    {2273, 0x03A8, 12, 12, 1, 4, 14, 0},  // U+03A8
+    {2291, 0x03A9, 11, 12, 1, 4, 13, 0},  // U+03A9
+    {2308, 0x03B1, 9, 9, 1, 7, 10, 0},  // U+03B1
+    {2319, 0x03B2, 9, 17, 1, 3, 11, 0},  // U+03B2
+    {2339, 0x03B3, 9, 13, 0, 7, 9, 0},  // U+03B3
+    {2354, 0x03B4, 8, 13, 1, 3, 10, 0},  // U+03B4
+    {2367, 0x03B5, 6, 9, 1, 7, 8, 0},  // U+03B5
+    {2374, 0x03B6, 7, 16, 1, 3, 8, 0},  // U+03B6
+    {2388, 0x03B7, 8, 13, 1, 7, 10, 0},  // U+03B7
+    {2401, 0x03B8, 8, 13, 1, 3, 10, 0},  // U+03B8
+    {2414, 0x03B9, 5, 9, 1, 7, 6, 0},  // U+03B9
+    {2420, 0x03BA, 8, 9, 1, 7, 9, 0},  // U+03BA
+    {2429, 0x03BB, 9, 13, -1, 3, 9, 0},  // U+03BB
+    {2444, 0x03BC, 7, 13, 2, 7, 11, 0},  // U+03BC
+    {2456, 0x03BD, 8, 9, 0, 7, 9, 0},  // U+03BD
+    {2465, 0x03BE, 7, 16, 1, 3, 8, 0},  // U+03BE
+    {2479, 0x03BF, 8, 9, 1, 7, 10, 0},  // U+03BF
+    {2488, 0x03C0, 10, 9, 0, 7, 11, 0},  // U+03C0
+    {2500, 0x03C1, 8, 13, 1, 7, 10, 0},  // U+03C1
+    {2513, 0x03C2, 7, 12, 1, 7, 8, 0},  // U+03C2
+    {2524, 0x03C3, 9, 9, 1, 7, 10, 0},  // U+03C3
+    {2535, 0x03C4, 8, 9, 0, 7, 8, 0},  // U+03C4
+    {2544, 0x03C5, 8, 9, 1, 7, 10, 0},  // U+03C5
+    {2553, 0x03C6, 10, 13, 1, 7, 12, 0},  // U+03C6
+    {2570, 0x03C7, 9, 13, -1, 7, 9, 0},  // U+03C7
+    {2585, 0x03C8, 11, 17, 1, 3, 13, 0},  // U+03C8
+    {2609, 0x03C9, 11, 9, 1, 7, 13, 0},  // U+03C9
+    {2622, 0x2022, 4, 4, 1, 8, 6, 0},  // U+2022
+    {2624, 0x2026, 11, 2, 1, 14, 13, 0},  // U+2026
+    {2627, 0x20AC, 8, 12, 1, 4, 10, 0},  // U+20AC
+};
+
+static const uint8_t GEEK_MAGIC_SANS_20_BITMAPS[] PROGMEM = {
+    0x55, 0x55, 0x4F, 0xDE, 0xE3, 0x10, 0x08, 0x81, 0x10, 0x22, 0x04, 0x87, 0xFE, 0x22, 0x04, 0x47,
+    0xFE, 0x12, 0x04, 0x40, 0x88, 0x11, 0x00, 0x18, 0x18, 0x3E, 0xD8, 0xD8, 0x58, 0x38, 0x1E, 0x1B,
+    0x1B, 0x9A, 0xFC, 0x18, 0x18, 0x70, 0xC9, 0x08, 0x89, 0x88, 0x90, 0x8A, 0x09, 0xAE, 0x75, 0x90,
+    0x51, 0x09, 0x11, 0x91, 0x11, 0x93, 0x0E, 0x3C, 0x19, 0x84, 0x61, 0x98, 0x2C, 0x0C, 0x06, 0x87,
+    0x13, 0x82, 0xA0, 0x6C, 0x39, 0xF1, 0xFA, 0x2D, 0x69, 0x24, 0x92, 0x64, 0xC8, 0x99, 0x32, 0x49,
+    0x24, 0xB5, 0xA0, 0x10, 0x20, 0x47, 0xF1, 0x05, 0x1B, 0x22, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18,
+    0x18, 0x18, 0x18, 0xEA, 0xE0, 0xF0, 0x0C, 0x20, 0x86, 0x10, 0x42, 0x08, 0x61, 0x04, 0x30, 0x3C,
+    0x42, 0xC3, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C, 0x37, 0x91, 0x11, 0x11, 0x11,
+    0x11, 0x7C, 0xC6, 0x02, 0x03, 0x02, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFF, 0x7C, 0xC2, 0x03,
+    0x03, 0x06, 0x38, 0x06, 0x03, 0x01, 0x03, 0x82, 0xFC, 0x03, 0x01, 0x40, 0xF0, 0x2C, 0x13, 0x0C,
+    0xC6, 0x31, 0x0C, 0xFF, 0xC0, 0xC0, 0x30, 0x0C, 0x7E, 0x40, 0x40, 0x40, 0x40, 0xFC, 0x02, 0x03,
+    0x01, 0x03, 0x82, 0xFC, 0x1E, 0x30, 0x40, 0xC0, 0xC0, 0xBE, 0xC3, 0xC1, 0x81, 0xC1, 0x63, 0x3C,
+    0xFF, 0x03, 0x02, 0x06, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x30, 0x20, 0x3C, 0x42, 0xC3, 0xC3,
+    0x66, 0x38, 0x66, 0xC3, 0x81, 0x81, 0xC3, 0x3C, 0x3C, 0x46, 0x83, 0x81, 0x81, 0xC3, 0x7D, 0x03,
+    0x03, 0x02, 0x04, 0x78, 0x04, 0xA4, 0xF0, 0x03, 0xE8, 0x01, 0x06, 0x18, 0x60, 0xC0, 0x38, 0x0E,
+    0x01, 0x08, 0xF1, 0x80, 0x80, 0x60, 0x18, 0x06, 0x03, 0x1C, 0x70, 0x80, 0xF0, 0x20, 0xC3, 0x08,
+    0x42, 0x18, 0x40, 0x06, 0x18, 0x0F, 0xC0, 0xC3, 0x08, 0x04, 0x8F, 0x2C, 0xC8, 0xC4, 0x46, 0x62,
+    0x33, 0x11, 0x98, 0x8C, 0x4C, 0xB3, 0x9C, 0x80, 0x03, 0x04, 0x0F, 0xC0, 0x04, 0x01, 0xC0, 0x28,
+    0x0D, 0x81, 0x10, 0x22, 0x0C, 0x61, 0xFC, 0x60, 0xC8, 0x09, 0x01, 0x60, 0x30, 0xFC, 0x82, 0x83,
+    0x83, 0x82, 0xFC, 0x82, 0x83, 0x81, 0x83, 0x82, 0xFC, 0x36, 0x22, 0x62, 0x62, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x82, 0x82, 0x86, 0xFC, 0x43, 0x20, 0x50, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC1,
+    0xA1, 0x9F, 0x80, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0xFF, 0x02, 0x04, 0x08,
+    0x10, 0x3F, 0x40, 0x81, 0x02, 0x04, 0x00, 0x1F, 0x8C, 0x06, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x3F,
+    0x03, 0xC0, 0xD0, 0x33, 0x0C, 0x7F, 0x01, 0x72, 0x72, 0x72, 0x72, 0x7B, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x71, 0x0C, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0xE0, 0x82, 0x84, 0x8C, 0x98, 0xB0,
+    0xE0, 0xF0, 0x98, 0x88, 0x84, 0x86, 0x83, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02,
+    0x07, 0xF0, 0xC0, 0x78, 0x0F, 0x83, 0xD0, 0x5A, 0x0B, 0x62, 0x64, 0x4C, 0xD9, 0x8A, 0x31, 0x46,
+    0x38, 0xC2, 0x10, 0xC0, 0xE0, 0x78, 0x36, 0x19, 0x0C, 0xC6, 0x33, 0x09, 0x86, 0xC1, 0xE0, 0x70,
+    0x30, 0x1F, 0x04, 0x11, 0x01, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x68, 0x08, 0x82,
+    0x0F, 0x80, 0xF9, 0x0E, 0x0C, 0x18, 0x30, 0xBE, 0x40, 0x81, 0x02, 0x04, 0x00, 0x1F, 0x04, 0x11,
+    0x01, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x68, 0x08, 0x82, 0x0F, 0x80, 0x30, 0x03,
+    0x00, 0x30, 0xFC, 0x86, 0x83, 0x83, 0x83, 0x86, 0xFC, 0x8C, 0x84, 0x86, 0x83, 0x81, 0x7F, 0x86,
+    0x04, 0x0C, 0x0E, 0x07, 0x03, 0x02, 0x04, 0x1F, 0xE0, 0x09, 0x41, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x40, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+    0x40, 0x90, 0x26, 0x18, 0x78, 0xC0, 0xD0, 0x24, 0x09, 0x86, 0x21, 0x08, 0x43, 0x30, 0x48, 0x16,
+    0x07, 0x80, 0xC0, 0x30, 0xC1, 0x83, 0x41, 0x82, 0x43, 0x82, 0x62, 0xC6, 0x62, 0x46, 0x22, 0x44,
+    0x26, 0x64, 0x34, 0x2C, 0x14, 0x28, 0x1C, 0x38, 0x18, 0x18, 0x18, 0x18, 0x40, 0x98, 0x63, 0x30,
+    0x48, 0x1E, 0x03, 0x00, 0xC0, 0x58, 0x33, 0x08, 0x46, 0x1B, 0x03, 0xC0, 0xD0, 0x26, 0x18, 0xCC,
+    0x12, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0x03, 0x06, 0x06, 0x0C, 0x18,
+    0x10, 0x30, 0x60, 0x40, 0xC0, 0xFF, 0xFE, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xE0,
+    0xC1, 0x04, 0x18, 0x20, 0x81, 0x04, 0x18, 0x20, 0x83, 0xF8, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6,
+    0x31, 0x8F, 0xE0, 0x10, 0x70, 0xA2, 0x64, 0x50, 0x60, 0x80, 0xFF, 0xB4, 0x7C, 0x88, 0x18, 0x37,
+    0xF8, 0xE1, 0xC3, 0x7A, 0xC0, 0xC0, 0xC0, 0xC0, 0xDC, 0xE2, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xE2,
+    0xDC, 0x3D, 0x0C, 0x20, 0x82, 0x0C, 0x10, 0x3C, 0x03, 0x03, 0x03, 0x03, 0x3B, 0x47, 0xC3, 0x83,
+    0x83, 0x83, 0xC3, 0x47, 0x3B, 0x3C, 0x62, 0xC3, 0xC1, 0xFF, 0x80, 0xC0, 0x61, 0x3F, 0x1C, 0xC2,
+    0x08, 0xFC, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x3F, 0xB1, 0x10, 0xC8, 0x66, 0x21, 0xE0, 0x80,
+    0xC0, 0x3F, 0x20, 0xB0, 0x58, 0x67, 0xE0, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xE2, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0x04, 0x4F, 0x30, 0x33, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xE0,
+    0xC1, 0x83, 0x06, 0x0C, 0x78, 0xB2, 0x68, 0xF1, 0xB3, 0x36, 0x3C, 0x20, 0x0F, 0xB0, 0xDE, 0xF3,
+    0x8E, 0x2C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0C, 0xDE, 0xE2,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x42, 0xC3, 0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C,
+    0xDC, 0xE2, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xE2, 0xDC, 0xC0, 0xC0, 0xC0, 0xC0, 0x3B, 0x47, 0xC3,
+    0x83, 0x83, 0x83, 0xC3, 0x47, 0x3B, 0x03, 0x03, 0x03, 0x03, 0xDF, 0x8C, 0x30, 0xC3, 0x0C, 0x30,
+    0xC0, 0x7E, 0x18, 0x30, 0x38, 0x30, 0x61, 0xF8, 0x20, 0x8F, 0xC8, 0x20, 0x82, 0x08, 0x20, 0x83,
+    0xC0, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x47, 0x7B, 0xC1, 0xA0, 0x98, 0xCC, 0x62, 0x21,
+    0xB0, 0x50, 0x28, 0x1C, 0x00, 0xC2, 0x1A, 0x38, 0x91, 0x44, 0x8A, 0x26, 0xDB, 0x14, 0x50, 0xA2,
+    0x85, 0x14, 0x30, 0x40, 0x82, 0x89, 0xB1, 0xC1, 0x05, 0x1B, 0x63, 0x82, 0xC1, 0xA0, 0x98, 0xCC,
+    0x62, 0x21, 0xB0, 0x50, 0x28, 0x1C, 0x04, 0x06, 0x06, 0x0E, 0x00, 0xFC, 0x30, 0x84, 0x30, 0x84,
+    0x30, 0xFC, 0x08, 0x8C, 0x63, 0x18, 0xD8, 0x31, 0x8C, 0x63, 0x08, 0x60, 0x0F, 0x20, 0xC2, 0x18,
+    0xC6, 0x30, 0x83, 0x23, 0x18, 0xC6, 0x23, 0x00, 0xF1, 0x8F, 0xF1, 0x55, 0x55, 0x10, 0xFC, 0x20,
+    0x82, 0x08, 0x20, 0xC0, 0xF1, 0x04, 0x1F, 0x20, 0x60, 0x60, 0x60, 0x60, 0xFC, 0x60, 0x60, 0x60,
+    0x40, 0xFF, 0x81, 0xC3, 0x42, 0x66, 0x24, 0x38, 0x7E, 0x18, 0x18, 0x7E, 0x18, 0x18, 0x7F, 0x83,
+    0x03, 0x07, 0xD8, 0xE0, 0xB3, 0x3C, 0x18, 0x18, 0x3F, 0xC0, 0x0F, 0x03, 0x0C, 0x47, 0x28, 0x81,
+    0x90, 0x19, 0x01, 0x90, 0x19, 0x01, 0x88, 0x14, 0xF2, 0x20, 0x41, 0xF8, 0x25, 0xBD, 0xA4, 0xD9,
+    0xB2, 0x40, 0x74, 0x63, 0x17, 0x00, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    0x78, 0x20, 0x86, 0x31, 0x0F, 0xC0, 0x78, 0x42, 0xF0, 0x87, 0xE0, 0x83, 0x06, 0x0C, 0x18, 0x30,
+    0x60, 0xE3, 0xFB, 0x02, 0x04, 0x08, 0x00, 0xF0, 0x93, 0x66, 0xC9, 0x6F, 0x69, 0x00, 0x18, 0x60,
+    0x02, 0x18, 0x42, 0x10, 0xC3, 0x04, 0x0F, 0x10, 0x03, 0x00, 0x20, 0x00, 0x00, 0x40, 0x1C, 0x02,
+    0x80, 0xD8, 0x11, 0x02, 0x20, 0xC6, 0x1F, 0xC6, 0x0C, 0x80, 0x90, 0x16, 0x03, 0x02, 0x00, 0xC0,
+    0x10, 0x00, 0x00, 0x40, 0x1C, 0x02, 0x80, 0xD8, 0x11, 0x02, 0x20, 0xC6, 0x1F, 0xC6, 0x0C, 0x80,
+    0x90, 0x16, 0x03, 0x0C, 0x03, 0xC0, 0xCC, 0x00, 0x00, 0x40, 0x1C, 0x02, 0x80, 0xD8, 0x11, 0x02,
+    0x20, 0xC6, 0x1F, 0xC6, 0x0C, 0x80, 0x90, 0x16, 0x03, 0x1D, 0x04, 0xE0, 0x00, 0x02, 0x00, 0xE0,
+    0x14, 0x06, 0xC0, 0x88, 0x11, 0x06, 0x30, 0xFE, 0x30, 0x64, 0x04, 0x80, 0xB0, 0x18, 0x12, 0x02,
+    0x40, 0x00, 0x02, 0x00, 0xE0, 0x14, 0x06, 0xC0, 0x88, 0x11, 0x06, 0x30, 0xFE, 0x30, 0x64, 0x04,
+    0x80, 0xB0, 0x18, 0x0C, 0x02, 0x40, 0x48, 0x06, 0x00, 0xE0, 0x14, 0x06, 0xC0, 0x88, 0x11, 0x06,
+    0x30, 0xFE, 0x30, 0x64, 0x04, 0x80, 0xB0, 0x18, 0x03, 0xFC, 0x12, 0x00, 0x48, 0x03, 0x20, 0x08,
+    0x80, 0x63, 0xF1, 0x08, 0x0F, 0xE0, 0x20, 0x81, 0x82, 0x04, 0x08, 0x30, 0x3F, 0x36, 0x22, 0x62,
+    0x62, 0x72, 0x72, 0x72, 0x72, 0x72, 0x82, 0x82, 0x86, 0x41, 0x82, 0x91, 0x53, 0x30, 0x41, 0x82,
+    0x00, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x08, 0x61, 0x00, 0xFE, 0x08, 0x20,
+    0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0x31, 0xEC, 0xC0, 0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82,
+    0x08, 0x3F, 0x49, 0x20, 0x3F, 0x82, 0x08, 0x20, 0xFE, 0x08, 0x20, 0x82, 0x0F, 0xC0, 0xB4, 0x55,
+    0x55, 0x55, 0x78, 0xAA, 0xAA, 0xAA, 0x31, 0xEC, 0xC0, 0x10, 0x41, 0x04, 0x10, 0x41, 0x04, 0x10,
+    0x41, 0x04, 0x99, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x3F, 0x04, 0x30, 0x81, 0x10, 0x32,
+    0x07, 0xF8, 0xC8, 0x19, 0x03, 0x20, 0x64, 0x18, 0x86, 0x1F, 0x80, 0x3A, 0x27, 0x00, 0x18, 0x1C,
+    0x0F, 0x06, 0xC3, 0x21, 0x98, 0xC6, 0x61, 0x30, 0xD8, 0x3C, 0x0E, 0x06, 0x41, 0xA2, 0xA1, 0xF4,
+    0x55, 0x15, 0x13, 0x17, 0x11, 0x27, 0x47, 0x47, 0x47, 0x47, 0x47, 0x21, 0x17, 0x13, 0x15, 0x15,
+    0x53, 0x61, 0x92, 0x91, 0xF4, 0x55, 0x15, 0x13, 0x17, 0x11, 0x27, 0x47, 0x47, 0x47, 0x47, 0x47,
+    0x21, 0x17, 0x13, 0x15, 0x15, 0x53, 0x06, 0x01, 0xE0, 0x66, 0x00, 0x01, 0xF0, 0x41, 0x10, 0x16,
+    0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x06, 0x80, 0x88, 0x20, 0xF8, 0x1D, 0x04, 0xE0, 0x00,
+    0x0F, 0x82, 0x08, 0x80, 0xB0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x34, 0x04, 0x41, 0x07,
+    0xC0, 0x09, 0x01, 0x20, 0x00, 0x0F, 0x82, 0x08, 0x80, 0xB0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+    0xE0, 0x34, 0x04, 0x41, 0x07, 0xC0, 0xC3, 0x66, 0x3C, 0x18, 0x3C, 0x66, 0xC3, 0x1F, 0x44, 0x11,
+    0x07, 0x61, 0xBC, 0x27, 0x88, 0xF3, 0x1E, 0x43, 0xD0, 0x6E, 0x09, 0x82, 0x2F, 0x80, 0x08, 0x03,
+    0x00, 0x40, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x40, 0x90, 0x26,
+    0x18, 0x78, 0x02, 0x01, 0x80, 0x40, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+    0x03, 0x40, 0x90, 0x26, 0x18, 0x78, 0x0C, 0x07, 0x83, 0x30, 0x00, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+    0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x40, 0x90, 0x26, 0x18, 0x78, 0x12, 0x04, 0x80, 0x03, 0x03, 0xC0,
+    0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x02, 0x40, 0x98, 0x61, 0xE0, 0x04, 0x03, 0x00,
+    0x80, 0x00, 0xC0, 0xD0, 0x26, 0x18, 0xCC, 0x12, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+    0x30, 0x81, 0x03, 0xF4, 0x38, 0x30, 0x60, 0xC3, 0xF9, 0x02, 0x04, 0x00, 0x7C, 0x86, 0x82, 0x86,
+    0x8C, 0x98, 0x98, 0x8C, 0x86, 0x81, 0x81, 0xA3, 0x9E, 0x20, 0x60, 0x40, 0x07, 0xC8, 0x81, 0x83,
+    0x7F, 0x8E, 0x1C, 0x37, 0xA0, 0x08, 0x30, 0x40, 0x07, 0xC8, 0x81, 0x83, 0x7F, 0x8E, 0x1C, 0x37,
+    0xA0, 0x18, 0x79, 0x98, 0x07, 0xC8, 0x81, 0x83, 0x7F, 0x8E, 0x1C, 0x37, 0xA0, 0x75, 0x38, 0x03,
+    0xE4, 0x40, 0xC1, 0xBF, 0xC7, 0x0E, 0x1B, 0xD0, 0x24, 0x48, 0x03, 0xE4, 0x40, 0xC1, 0xBF, 0xC7,
+    0x0E, 0x1B, 0xD0, 0x18, 0x48, 0x90, 0xC0, 0x0F, 0x91, 0x03, 0x06, 0xFF, 0x1C, 0x38, 0x6F, 0x40,
+    0x7C, 0xE0, 0x38, 0x80, 0x86, 0x04, 0x17, 0xFF, 0xE1, 0x02, 0x08, 0x10, 0xE1, 0x78, 0xF8, 0x3D,
+    0x0C, 0x20, 0x82, 0x0C, 0x10, 0x3C, 0x41, 0x81, 0x38, 0x20, 0x30, 0x10, 0x00, 0x3C, 0x62, 0xC3,
+    0xC1, 0xFF, 0x80, 0xC0, 0x61, 0x3F, 0x04, 0x0C, 0x08, 0x00, 0x3C, 0x62, 0xC3, 0xC1, 0xFF, 0x80,
+    0xC0, 0x61, 0x3F, 0x18, 0x3C, 0x66, 0x00, 0x3C, 0x62, 0xC3, 0xC1, 0xFF, 0x80, 0xC0, 0x61, 0x3F,
+    0x24, 0x24, 0x00, 0x3C, 0x62, 0xC3, 0xC1, 0xFF, 0x80, 0xC0, 0x61, 0x3F, 0x99, 0x06, 0xDB, 0x6D,
+    0xB6, 0x2D, 0x0D, 0xB6, 0xDB, 0x6C, 0x31, 0xEC, 0xC0, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30,
+    0x99, 0x06, 0x66, 0x66, 0x66, 0x66, 0x32, 0x1C, 0x1C, 0x26, 0x02, 0x3F, 0x43, 0xC1, 0x81, 0x81,
+    0xC1, 0x42, 0x3C, 0x3A, 0x4E, 0x00, 0xDE, 0xE2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x10,
+    0x18, 0x08, 0x00, 0x3C, 0x42, 0xC3, 0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C, 0x04, 0x0C, 0x08, 0x00,
+    0x3C, 0x42, 0xC3, 0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C, 0x18, 0x3C, 0x66, 0x00, 0x3C, 0x42, 0xC3,
+    0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C, 0x3A, 0x4E, 0x00, 0x3C, 0x42, 0xC3, 0x81, 0x81, 0x81, 0xC3,
+    0x42, 0x3C, 0x24, 0x24, 0x00, 0x3C, 0x42, 0xC3, 0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C, 0x32, 0x62,
+    0xB8, 0xB2, 0x62, 0x30, 0x3F, 0x46, 0xC7, 0x89, 0x99, 0x91, 0xE3, 0x62, 0xFC, 0x10, 0x18, 0x08,
+    0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x47, 0x7B, 0x04, 0x0C, 0x08, 0x00, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x47, 0x7B, 0x18, 0x3C, 0x66, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0x47, 0x7B, 0x24, 0x24, 0x00, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x47, 0x7B,
+    0x04, 0x06, 0x02, 0x00, 0x0C, 0x1A, 0x09, 0x8C, 0xC6, 0x22, 0x1B, 0x05, 0x02, 0x81, 0xC0, 0x40,
+    0x60, 0x60, 0xE0, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xDC, 0xE2, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xE2,
+    0xDC, 0xC0, 0xC0, 0xC0, 0xC0, 0x24, 0x12, 0x00, 0x18, 0x34, 0x13, 0x19, 0x8C, 0x44, 0x36, 0x0A,
+    0x05, 0x03, 0x80, 0x80, 0xC0, 0xC1, 0xC0, 0x04, 0x01, 0xC0, 0x28, 0x0D, 0x81, 0x10, 0x22, 0x0C,
+    0x61, 0xFC, 0x60, 0xC8, 0x09, 0x01, 0x60, 0x30, 0xFC, 0x82, 0x83, 0x83, 0x82, 0xFC, 0x82, 0x83,
+    0x81, 0x83, 0x82, 0xFC, 0xFF, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x00, 0x0C,
+    0x03, 0x01, 0xE0, 0x48, 0x12, 0x0C, 0xC2, 0x10, 0x84, 0x61, 0x90, 0x24, 0x0B, 0xFF, 0xFE, 0x08,
+    0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x3F, 0xFF, 0x03, 0x06, 0x06, 0x0C, 0x18, 0x10, 0x30, 0x60,
+    0x40, 0xC0, 0xFF, 0x01, 0x72, 0x72, 0x72, 0x72, 0x7B, 0x72, 0x72, 0x72, 0x72, 0x72, 0x71, 0x1F,
+    0x04, 0x11, 0x01, 0x60, 0x3C, 0x07, 0xBE, 0xF0, 0x1E, 0x03, 0xC0, 0x68, 0x08, 0x82, 0x0F, 0x80,
+    0x0C, 0x82, 0x84, 0x8C, 0x98, 0xB0, 0xE0, 0xF0, 0x98, 0x88, 0x84, 0x86, 0x83, 0x0C, 0x03, 0x01,
+    0xE0, 0x48, 0x12, 0x0C, 0xC2, 0x10, 0x84, 0x61, 0x90, 0x24, 0x0B, 0x03, 0xC0, 0x78, 0x0F, 0x83,
+    0xD0, 0x5A, 0x0B, 0x62, 0x64, 0x4C, 0xD9, 0x8A, 0x31, 0x46, 0x38, 0xC2, 0x10, 0xC0, 0xE0, 0x78,
+    0x36, 0x19, 0x0C, 0xC6, 0x33, 0x09, 0x86, 0xC1, 0xE0, 0x70, 0x30, 0x07, 0xFE, 0x5F, 0xF6, 0x70,
+    0x1F, 0x04, 0x11, 0x01, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x68, 0x08, 0x82, 0x0F,
+    0x80, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xF9, 0x0E, 0x0C,
+    0x18, 0x30, 0xBE, 0x40, 0x81, 0x02, 0x04, 0x00, 0x08, 0x12, 0x82, 0x82, 0x81, 0x91, 0x72, 0x62,
+    0x71, 0x71, 0x72, 0x79, 0x09, 0x41, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x40, 0xC0, 0xD0, 0x26, 0x18, 0xCC, 0x12, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+    0x06, 0x03, 0xFC, 0x66, 0x6C, 0x63, 0x86, 0x18, 0x61, 0x86, 0x1C, 0x63, 0x66, 0x63, 0xFC, 0x06,
+    0x00, 0x60, 0x40, 0x98, 0x63, 0x30, 0x48, 0x1E, 0x03, 0x00, 0xC0, 0x58, 0x33, 0x08, 0x46, 0x1B,
+    0x03, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x1C, 0x63, 0x66, 0x63, 0xFC, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x1F, 0x0C, 0x19, 0x01, 0x60, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0x40, 0x4C,
+    0x18, 0xC6, 0x78, 0xF0, 0x3D, 0x23, 0xB0, 0xD0, 0x68, 0x34, 0x1B, 0x0C, 0x8E, 0x39, 0x80, 0x3E,
+    0x31, 0x90, 0x68, 0x3C, 0x16, 0x1B, 0x3D, 0x83, 0xC0, 0xE0, 0x70, 0x38, 0x3F, 0xE6, 0x03, 0x01,
+    0x80, 0xC0, 0x00, 0xC1, 0xA0, 0x98, 0xC4, 0x62, 0x21, 0xB0, 0x50, 0x28, 0x0C, 0x04, 0x06, 0x03,
+    0x01, 0x80, 0x3E, 0x21, 0x60, 0x20, 0x18, 0x1E, 0x63, 0xC1, 0x81, 0x81, 0xC1, 0x43, 0x3C, 0x7F,
+    0x08, 0x30, 0x3B, 0x08, 0x30, 0x7C, 0xFE, 0x18, 0x61, 0x86, 0x08, 0x30, 0x40, 0x81, 0x03, 0x03,
+    0x81, 0xC0, 0x81, 0x06, 0xDE, 0xE2, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x03,
+    0x03, 0x3C, 0x66, 0x42, 0xC3, 0x81, 0x81, 0xFF, 0x81, 0x81, 0xC3, 0x42, 0x66, 0x3C, 0xC6, 0x31,
+    0x8C, 0x63, 0x08, 0x78, 0xC6, 0xC4, 0xC8, 0xD8, 0xF8, 0xC8, 0xCC, 0xC6, 0xC3, 0x60, 0x08, 0x06,
+    0x01, 0x00, 0x80, 0xE0, 0x50, 0x68, 0x26, 0x31, 0x10, 0x88, 0x6C, 0x18, 0x83, 0x06, 0x0C, 0x18,
+    0x30, 0x60, 0xE3, 0xFB, 0x02, 0x04, 0x08, 0x00, 0xC1, 0x41, 0x41, 0x61, 0x23, 0x22, 0x36, 0x14,
+    0x18, 0xFC, 0x41, 0x02, 0x04, 0x07, 0x98, 0x60, 0x81, 0x03, 0x03, 0xC1, 0xC0, 0xC1, 0x02, 0x3C,
+    0x42, 0xC3, 0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C, 0xFF, 0xC8, 0x62, 0x18, 0x86, 0x21, 0x88, 0x62,
+    0x18, 0x86, 0x20, 0xC0, 0x3C, 0x62, 0x43, 0xC1, 0xC1, 0xC1, 0xC3, 0xC2, 0xFC, 0xC0, 0xC0, 0xC0,
+    0xC0, 0x3C, 0x83, 0x04, 0x08, 0x10, 0x30, 0x38, 0x3C, 0x0C, 0x10, 0x20, 0x3F, 0xB1, 0x30, 0xD0,
+    0x68, 0x34, 0x1B, 0x0C, 0x84, 0x3C, 0x00, 0xFF, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0E,
+    0xC3, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC3, 0x62, 0x3C, 0x47, 0x13, 0x2C, 0xCE, 0x31, 0x8C, 0x63,
+    0x1C, 0xCD, 0xB6, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0xE1, 0x11, 0x8C, 0x82, 0xC1, 0x40,
+    0xE0, 0x60, 0x38, 0x34, 0x12, 0x19, 0x88, 0x4C, 0x38, 0x04, 0x00, 0x80, 0x10, 0x02, 0x0C, 0x47,
+    0x88, 0xF1, 0x1E, 0x21, 0xC4, 0x38, 0x8D, 0x11, 0x32, 0x61, 0xF0, 0x08, 0x01, 0x00, 0x20, 0x04,
+    0x00, 0x40, 0x58, 0x0F, 0x01, 0xC2, 0x18, 0x43, 0x08, 0x71, 0x1A, 0x52, 0x7B, 0xC0, 0x6F, 0xF6,
+    0xCC, 0x79, 0x8C, 0x1F, 0x30, 0x60, 0x40, 0xFE, 0x40, 0x40, 0xFC, 0x40, 0x60, 0x30, 0x1F,
+};
+
+static const Font GEEK_MAGIC_SANS_20 = {GEEK_MAGIC_SANS_20_GLYPHS, GEEK_MAGIC_SANS_20_BITMAPS, 227, 20, 16};
@@ -0,0 +1,575 @@
+// This file is auto-generated by scripts/fontconv.py from fonts/geekmagic-sans-30.bdf.
+// Please do not edit manually.
+#pragma once
+
+#include "display/Font.h"
+
+// 227 glyphs, 5338 bitmap bytes (7896 decoded), line height 30
+static const FontGlyph GEEK_MAGIC_SANS_30_GLYPHS[] PROGMEM = {
+    {0, 0x0020, 0, 0, 0, 0, 7, 0},  // ' '
+    {0, 0x0021, 3, 19, 2, 5, 7, 0},  // '!'
+    {8, 0x0022, 6, 7, 2, 5, 10, 0},  // '"'
+    {14, 0x0023, 15, 19, 1, 5, 17, 1},  // '#'
+    {49, 0x0024, 11, 22, 2, 4, 15, 0},  // '$'
+    {80, 0x0025, 19, 19, 1, 5, 21, 0},  // '%'
+    {126, 0x0026, 17, 19, 1, 5, 19, 1},  // '&'
+    {164, 0x0027, 2, 7, 2, 5, 6, 1},  // '\''
+    {165, 0x0028, 6, 23, 1, 5, 8, 0},  // '('
+    {183, 0x0029, 6, 23, 1, 5, 8, 0},  // ')'
+    {201, 0x002A, 12, 12, 1, 4, 14, 0},  // '*'
+    {219, 0x002B, 13, 12, 1, 8, 15, 1},  // '+'
+    {231, 0x002C, 3, 6, 1, 21, 6, 0},  // ','
+    {234, 0x002D, 6, 2, 1, 16, 8, 1},  // '-'
+    {235, 0x002E, 3, 3, 2, 21, 7, 1},  // '.'
+    {236, 0x002F, 10, 19, 0, 5, 10, 1},  // '/'
+    {256, 0x0030, 13, 19, 1, 5, 15, 1},  // '0'
+    {286, 0x0031, 6, 19, 3, 5, 15, 0},  // '1'
+    {301, 0x0032, 13, 19, 1, 5, 15, 1},  // '2'
+    {322, 0x0033, 12, 19, 1, 5, 15, 1},  // '3'
+    {342, 0x0034, 13, 19, 1, 5, 15, 1},  // '4'
+    {371, 0x0035, 11, 19, 2, 5, 15, 1},  // '5'
+    {391, 0x0036, 13, 19, 1, 5, 15, 1},  // '6'
+    {420, 0x0037, 13, 19, 1, 5, 15, 1},  // '7'
+    {439, 0x0038, 13, 19, 1, 5, 15, 0},  // '8'
+    {470, 0x0039, 13, 19, 1, 5, 15, 1},  // '9'
+    {498, 0x003A, 3, 14, 2, 10, 7, 1},  // ':'
+    {501, 0x003B, 4, 17, 1, 10, 7, 0},  // ';'
+    {510, 0x003C, 13, 13, 1, 8, 15, 1},  // '<'
+    {523, 0x003D, 11, 7, 2, 11, 15, 1},  // '='
+    {527, 0x003E, 13, 13, 1, 8, 15, 1},  // '>'
+    {541, 0x003F, 10, 19, 0, 5, 11, 1},  // '?'
+    {560, 0x0040, 19, 21, 2, 5, 23, 1},  // '@'
+    {607, 0x0041, 16, 19, 0, 5, 16, 1},  // 'A'
+    {639, 0x0042, 13, 19, 3, 5, 17, 0},  // 'B'
+    {670, 0x0043, 13, 19, 2, 5, 16, 1},  // 'C'
+    {692, 0x0044, 14, 19, 3, 5, 19, 1},  // 'D'
+    {718, 0x0045, 10, 19, 2, 5, 14, 1},  // 'E'
+    {734, 0x0046, 11, 19, 2, 5, 13, 1},  // 'F'
+    {752, 0x0047, 15, 19, 2, 5, 19, 1},  // 'G'
+    {777, 0x0048, 13, 19, 3, 5, 19, 1},  // 'H'
+    {796, 0x0049, 3, 19, 2, 5, 7, 1},  // 'I'
+    {799, 0x004A, 7, 24, -2, 5, 7, 0},  // 'J'
+    {820, 0x004B, 13, 19, 3, 5, 16, 0},  // 'K'
+    {851, 0x004C, 10, 19, 3, 5, 14, 1},  // 'L'
+    {870, 0x004D, 19, 19, 2, 5, 23, 0},  // 'M'
+    {916, 0x004E, 14, 19, 3, 5, 20, 1},  // 'N'
+    {946, 0x004F, 16, 19, 2, 5, 20, 1},  // 'O'
+    {972, 0x0050, 12, 19, 3, 5, 16, 1},  // 'P'
+    {997, 0x0051, 16, 23, 2, 5, 20, 1},  // 'Q'
+    {1027, 0x0052, 12, 19, 3, 5, 16, 0},  // 'R'
+    {1056, 0x0053, 12, 19, 1, 5, 14, 1},  // 'S'
+    {1077, 0x0054, 14, 19, 0, 5, 14, 1},  // 'T'
+    {1096, 0x0055, 15, 19, 2, 5, 19, 1},  // 'U'
+    {1120, 0x0056, 15, 19, 0, 5, 15, 0},  // 'V'
+    {1156, 0x0057, 24, 19, 0, 5, 24, 0},  // 'W'
+    {1213, 0x0058, 15, 19, 0, 5, 15, 1},  // 'X'
+    {1247, 0x0059, 15, 19, 0, 5, 15, 1},  // 'Y'
+    {1276, 0x005A, 13, 19, 1, 5, 15, 1},  // 'Z'
+    {1294, 0x005B, 6, 23, 2, 5, 9, 0},  // '['
+    {1312, 0x005C, 10, 19, 0, 5, 10, 1},  // '\\'
+    {1331, 0x005D, 6, 23, 1, 5, 9, 0},  // ']'
+    {1349, 0x005E, 12, 12, 1, 5, 14, 0},  // '^'
+    {1367, 0x005F, 12, 2, -1, 26, 12, 1},  // '_'
+    {1369, 0x0060, 5, 4, 5, 4, 15, 0},  // '`'
+    {1372, 0x0061, 11, 14, 1, 10, 14, 1},  // 'a'
+    {1389, 0x0062, 13, 20, 2, 4, 16, 0},  // 'b'
+    {1422, 0x0063, 10, 14, 1, 10, 12, 1},  // 'c'
+    {1439, 0x0064, 13, 20, 1, 4, 16, 1},  // 'd'
+    {1471, 0x0065, 13, 14, 1, 10, 15, 1},  // 'e'
+    {1490, 0x0066, 10, 20, 0, 4, 9, 1},  // 'f'
+    {1511, 0x0067, 13, 20, 0, 10, 14, 1},  // 'g'
+    {1540, 0x0068, 12, 20, 2, 4, 16, 1},  // 'h'
+    {1564, 0x0069, 3, 19, 2, 5, 7, 0},  // 'i'
+    {1572, 0x006A, 6, 25, -2, 5, 7, 0},  // 'j'
+    {1591, 0x006B, 11, 20, 2, 4, 14, 0},  // 'k'
+    {1619, 0x006C, 2, 20, 2, 4, 7, 1},  // 'l'
+    {1621, 0x006D, 20, 14, 2, 10, 24, 1},  // 'm'
+    {1652, 0x006E, 12, 14, 2, 10, 16, 1},  // 'n'
+    {1670, 0x006F, 14, 14, 1, 10, 16, 1},  // 'o'
+    {1694, 0x0070, 13, 20, 2, 10, 16, 0},  // 'p'
+    {1727, 0x0071, 13, 20, 1, 10, 16, 1},  // 'q'
+    {1759, 0x0072, 9, 14, 2, 10, 11, 0},  // 'r'
+    {1775, 0x0073, 10, 14, 1, 10, 12, 1},  // 's'
+    {1790, 0x0074, 8, 17, 0, 7, 9, 0},  // 't'
+    {1807, 0x0075, 12, 14, 2, 10, 16, 1},  // 'u'
+    {1824, 0x0076, 13, 14, 0, 10, 13, 0},  // 'v'
+    {1847, 0x0077, 20, 14, 0, 10, 20, 0},  // 'w'
+    {1882, 0x0078, 12, 14, 1, 10, 14, 0},  // 'x'
+    {1903, 0x0079, 13, 20, 0, 10, 13, 0},  // 'y'
+    {1936, 0x007A, 10, 14, 1, 10, 12, 1},  // 'z'
+    {1949, 0x007B, 8, 23, 1, 5, 10, 0},  // '{'
+    {1972, 0x007C, 2, 26, 6, 4, 14, 1},  // '|'
+    {1975, 0x007D, 8, 23, 1, 5, 10, 0},  // '}'
+    {1998, 0x007E, 13, 3, 1, 13, 15, 1},  // '~'
+    {2002, 0x00A0, 0, 0, 0, 0, 7, 0},  // U+00A0
+    {2002, 0x00A1, 3, 19, 2, 10, 7, 0},  // U+00A1
+    {2010, 0x00A2, 10, 19, 2, 5, 15, 1},  // U+00A2
+    {2030, 0x00A3, 13, 19, 1, 5, 15, 1},  // U+00A3
+    {2050, 0x00A5, 13, 19, 1, 5, 15, 1},  // U+00A5
+    {2078, 0x00A7, 9, 20, 2, 4, 13, 1},  // U+00A7
+    {2100, 0x00A9, 20, 19, 1, 5, 22, 1},  // U+00A9
+    {2145, 0x00AB, 11, 11, 1, 12, 13, 0},  // U+00AB
+    {2161, 0x00B0, 7, 8, 2, 5, 11, 0},  // U+00B0
+    {2168, 0x00B1, 13, 15, 1, 8, 15, 1},  // U+00B1
+    {2182, 0x00B2, 7, 11, 1, 5, 9, 0},  // U+00B2
+    {2192, 0x00B3, 8, 11, 0, 5, 9, 0},  // U+00B3
+    {2203, 0x00B5, 12, 20, 2, 10, 16, 1},  // U+00B5
+    {2225, 0x00B7, 3, 3, 2, 13, 7, 1},  // U+00B7
+    {2226, 0x00BB, 11, 11, 1, 12, 13, 0},  // U+00BB
+    {2242, 0x00BF, 10, 19, 1, 10, 11, 1},  // U+00BF
+    {2261, 0x00C0, 16, 24, 0, 0, 16, 1},  // U+00C0
+    {2299, 0x00C1, 16, 24, 0, 0, 16, 1},  // U+00C1
+    {2336, 0x00C2, 16, 24, 0, 0, 16, 1},  // U+00C2
+    {2375, 0x00C3, 16, 23, 0, 1, 16, 1},  // U+00C3
+    {2413, 0x00C4, 16, 23, 0, 1, 16, 1},  // U+00C4
+    {2452, 0x00C5, 16, 23, 0, 1, 16, 1},  // U+00C5
+    {2491, 0x00C6, 21, 19, -1, 5, 23, 1},  // U+00C6
+    {2524, 0x00C7, 13, 25, 2, 5, 16, 1},  // U+00C7
+    {2552, 0x00C8, 10, 24, 2, 0, 14, 1},  // U+00C8
+    {2572, 0x00C9, 10, 24, 2, 0, 14, 1},  // U+00C9
+    {2592, 0x00CA, 10, 24, 2, 0, 14, 1},  // U+00CA
+    {2614, 0x00CB, 10, 23, 2, 1, 14, 1},  // U+00CB
+    {2636, 0x00CC, 5, 24, -1, 0, 7, 0},  // U+00CC
+    {2651, 0x00CD, 5, 24, 2, 0, 7, 0},  // U+00CD
+    {2666, 0x00CE, 7, 24, 0, 0, 7, 0},  // U+00CE
+    {2687, 0x00CF, 7, 23, -1, 1, 7, 0},  // U+00CF
+    {2708, 0x00D0, 16, 19, 1, 5, 19, 1},  // U+00D0
+    {2741, 0x00D1, 14, 23, 3, 1, 20, 1},  // U+00D1
+    {2777, 0x00D2, 16, 24, 2, 0, 20, 1},  // U+00D2
+    {2808, 0x00D3, 16, 24, 2, 0, 20, 1},  // U+00D3
+    {2838, 0x00D4, 16, 24, 2, 0, 20, 1},  // U+00D4
+    {2870, 0x00D5, 16, 23, 2, 1, 20, 1},  // U+00D5
+    {2901, 0x00D6, 16, 23, 2, 1, 20, 1},  // U+00D6
+    {2933, 0x00D7, 11, 11, 2, 8, 15, 0},  // U+00D7
+    {2949, 0x00D8, 16, 21, 2, 4, 20, 1},  // U+00D8
+    {2988, 0x00D9, 15, 24, 2, 0, 19, 1},  // U+00D9
+    {3016, 0x00DA, 15, 24, 2, 0, 19, 1},  // U+00DA
+    {3044, 0x00DB, 15, 24, 2, 0, 19, 1},  // U+00DB
+    {3074, 0x00DC, 15, 23, 2, 1, 19, 1},  // U+00DC
+    {3104, 0x00DD, 15, 24, 0, 0, 15, 1},  // U+00DD
+    {3137, 0x00DE, 12, 19, 3, 5, 16, 1},  // U+00DE
+    {3162, 0x00DF, 13, 20, 2, 4, 16, 0},  // U+00DF
+    {3195, 0x00E0, 11, 20, 1, 4, 14, 1},  // U+00E0
+    {3217, 0x00E1, 11, 20, 1, 4, 14, 1},  // U+00E1
+    {3239, 0x00E2, 11, 20, 1, 4, 14, 1},  // U+00E2
+    {3263, 0x00E3, 11, 19, 1, 5, 14, 1},  // U+00E3
+    {3286, 0x00E4, 11, 19, 1, 5, 14, 1},  // U+00E4
+    {3310, 0x00E5, 11, 21, 1, 3, 14, 1},  // U+00E5
+    {3336, 0x00E6, 20, 14, 1, 9, 22, 1},  // U+00E6
+    {3366, 0x00E7, 10, 20, 1, 10, 12, 1},  // U+00E7
+    {3389, 0x00E8, 13, 20, 1, 4, 15, 1},  // U+00E8
+    {3413, 0x00E9, 13, 20, 1, 4, 15, 1},  // U+00E9
+    {3437, 0x00EA, 13, 20, 1, 4, 15, 1},  // U+00EA
+    {3463, 0x00EB, 13, 19, 1, 5, 15, 1},  // U+00EB
+    {3489, 0x00EC, 5, 20, -1, 4, 7, 0},  // U+00EC
+    {3502, 0x00ED, 5, 20, 2, 4, 7, 0},  // U+00ED
+    {3515, 0x00EE, 7, 20, 0, 4, 7, 0},  // U+00EE
+    {3533, 0x00EF, 7, 19, -1, 5, 7, 0},  // U+00EF
+    {3550, 0x00F0, 14, 20, 1, 4, 16, 1},  // U+00F0
+    {3582, 0x00F1, 12, 19, 2, 5, 16, 1},  // U+00F1
+    {3606, 0x00F2, 14, 20, 1, 4, 16, 1},  // U+00F2
+    {3635, 0x00F3, 14, 20, 1, 4, 16, 1},  // U+00F3
+    {3664, 0x00F4, 14, 20, 1, 4, 16, 1},  // U+00F4
+    {3695, 0x00F5, 14, 19, 1, 5, 16, 1},  // U+00F5
+    {3725, 0x00F6, 14, 19, 1, 5, 16, 1},  // U+00F6
+    {3756, 0x00F7, 13, 12, 1, 9, 15, 1},  // U+00F7
+    {3766, 0x00F8, 14, 16, 1, 9, 16, 0},  // U+00F8
+    {3794, 0x00F9, 12, 20, 2, 4, 16, 1},  // U+00F9
+    {3816, 0x00FA, 12, 20, 2, 4, 16, 1},  // U+00FA
+    {3838, 0x00FB, 12, 20, 2, 4, 16, 1},  // U+00FB
+    {3862, 0x00FC, 12, 19, 2, 5, 16, 1},  // U+00FC
+    {3886, 0x00FD, 13, 26, 0, 4, 13, 1},  // U+00FD
+    {3924, 0x00FE, 13, 26, 2, 4, 16, 1},  // U+00FE
+    {3963, 0x00FF, 13, 25, 0, 5, 13, 1},  // U+00FF
+    {4002, 0x0391, 16, 19, 0, 5, 16, 1},  // U+0391
+    {4034, 0x0392, 13, 19, 3, 5, 17, 0},  // U+0392
+    {4065, 0x0393, 10, 19, 3, 5, 14, 1},  // U+0393
+    {4083, 0x0394, 15, 19, 0, 5, 15, 1},  // U+0394
+    {4117, 0x0395, 10, 19, 2, 5, 14, 1},  // U+0395
+    {4133, 0x0396, 13, 19, 1, 5, 15, 1},  // U+0396
+    {4151, 0x0397, 13, 19, 3, 5, 19, 1},  // U+0397
+    {4170, 0x0398, 16, 19, 2, 5, 20, 1},  // U+0398
+    {4198, 0x0399, 3, 19, 2, 5, 7, 1},  // U+0399
+    {4201, 0x039A, 13, 19, 3, 5, 16, 0},  // U+039A
+    {4232, 0x039B, 16, 19, 0, 5, 16, 1},  // U+039B
+    {4266, 0x039C, 19, 19, 2, 5, 23, 0},  // U+039C
+    {4312, 0x039D, 14, 19, 3, 5, 20, 1},  // U+039D
+    {4342, 0x039E, 12, 19, 1, 5, 14, 1},  // U+039E
+    {4352, 0x039F, 16, 19, 2, 5, 20, 1},  // U+039F
+    {4378, 0x03A0, 13, 19, 3, 5, 19, 1},  // U+03A0
+    {4397, 0x03A1, 12, 19, 3, 5, 16, 1},  // U+03A1
+    {4422, 0x03A3, 13, 19, 1, 5, 15, 1},  // U+03A3
+    {4440, 0x03A4, 14, 19, 0, 5, 14, 1},  // U+03A4
+    {4459, 0x03A5, 15, 19, 0, 5, 15, 1},  // U+03A5
+    {4488, 0x03A6, 19, 19, 1, 5, 21, 1},  // U+03A6
+    {4526, 0x03A7, 15, 19, 0, 5, 15, 1},  // U+03A7
+    {4560, 0x03A8, 19, 19, 1, 5, 21, 1},  // U+03A8
+    {4597, 0x03A9, 18, 19, 1, 5, 20, 1},  // U+03A9
+    {4632, 0x03B1, 15, 14, 1, 10, 16, 0},  // U+03B1
+    {4659, 0x03B2, 13, 26, 2, 4, 16, 1},  // U+03B2
+    {4698, 0x03B3, 13, 20, 0, 10, 13, 1},  // U+03B3
+    {4730, 0x03B4, 13, 20, 1, 4, 15, 1},  // U+03B4
+    {4759, 0x03B5, 10, 14, 1, 10, 12, 1},  // U+03B5
+    {4776, 0x03B6, 10, 25, 2, 4, 13, 1},  // U+03B6
+    {4801, 0x03B7, 12, 20, 2, 10, 16, 1},  // U+03B7
+    {4824, 0x03B8, 13, 20, 1, 4, 15, 0},  // U+03B8
+    {4857, 0x03B9, 7, 14, 2, 10, 9, 0},  // U+03B9
+    {4870, 0x03BA, 11, 14, 2, 10, 13, 0},  // U+03BA
+    {4890, 0x03BB, 14, 20, -1, 4, 14, 1},  // U+03BB
+    {4920, 0x03BC, 12, 20, 2, 10, 16, 1},  // U+03BC
+    {4942, 0x03BD, 13, 14, 0, 10, 14, 0},  // U+03BD
+    {4965, 0x03BE, 10, 25, 1, 4, 12, 1},  // U+03BE
+    {4991, 0x03BF, 14, 14, 1, 10, 16, 1},  // U+03BF
+    {5015, 0x03C0, 16, 14, 0, 10, 17, 1},  // U+03C0
+    {5041, 0x03C1, 13, 20, 2, 10, 16, 1},  // U+03C1
+    {5072, 0x03C2, 10, 19, 2, 10, 13, 1},  // U+03C2
+    {5092, 0x03C3, 14, 14, 1, 10, 16, 0},  // U+03C3
+    {5117, 0x03C4, 11, 14, 0, 10, 12, 1},  // U+03C4
+    {5131, 0x03C5, 13, 14, 2, 10, 16, 0},  // U+03C5
+    {5154, 0x03C6, 17, 20, 1, 10, 19, 0},  // U+03C6
+    {5197, 0x03C7, 14, 20, -1, 10, 14, 1},  // U+03C7
+    {5231, 0x03C8, 16, 26, 2, 4, 20, 1},  // U+03C8
+    {5273, 0x03C9, 18, 14, 1, 10, 20, 0},  // U+03C9
+    {5305, 0x2022, 6, 6, 2, 11, 10, 0},  // U+2022
+    {5310, 0x2026, 16, 3, 2, 21, 20, 0},  // U+2026
+    {5316, 0x20AC, 13, 19, 1, 5, 15, 1},  // U+20AC
+};
+
+static const uint8_t GEEK_MAGIC_SANS_30_BITMAPS[] PROGMEM = {
+    0xFF, 0xFF, 0xF2, 0x49, 0x24, 0x00, 0xFF, 0x80, 0xCF, 0x3C, 0xF3, 0xCF, 0x3C, 0xC0, 0x52, 0x42,
+    0x72, 0x42, 0x72, 0x42, 0x72, 0x41, 0x82, 0x32, 0x81, 0x42, 0x4E, 0x1E, 0x42, 0x42, 0x72, 0x41,
+    0x81, 0x42, 0x72, 0x42, 0x4E, 0x1E, 0x42, 0x41, 0x81, 0x42, 0x81, 0x42, 0x72, 0x42, 0x72, 0x41,
+    0x60, 0x04, 0x00, 0x80, 0x7E, 0x3F, 0xFE, 0x45, 0x88, 0x31, 0x06, 0x20, 0x64, 0x0F, 0x80, 0x7E,
+    0x03, 0xE0, 0x4E, 0x08, 0xC1, 0x18, 0x23, 0x84, 0xFF, 0xF9, 0xFC, 0x02, 0x00, 0x40, 0x08, 0x00,
+    0x3C, 0x06, 0x0F, 0xC0, 0xC1, 0x98, 0x30, 0x61, 0x06, 0x0C, 0x31, 0x81, 0x86, 0x30, 0x30, 0xCC,
+    0x06, 0x19, 0xBC, 0x42, 0x6F, 0xCC, 0xC9, 0x99, 0xFB, 0x61, 0x1E, 0x4C, 0x30, 0x19, 0x86, 0x06,
+    0x30, 0xC0, 0xC6, 0x18, 0x30, 0xC2, 0x06, 0x0C, 0xC1, 0x81, 0xF8, 0x30, 0x1E, 0x00, 0x45, 0xB7,
+    0x93, 0x33, 0x82, 0x52, 0x82, 0x52, 0x83, 0x42, 0x92, 0x33, 0x93, 0x13, 0xB5, 0xB5, 0xB3, 0x13,
+    0x53, 0x13, 0x33, 0x42, 0x22, 0x53, 0x32, 0x13, 0x63, 0x13, 0x13, 0x75, 0x32, 0x83, 0x43, 0x56,
+    0x4A, 0x13, 0x47, 0x43, 0x0E, 0x0C, 0x63, 0x8C, 0x71, 0x86, 0x38, 0xE3, 0x0C, 0x30, 0xC3, 0x0E,
+    0x38, 0x61, 0x87, 0x0C, 0x38, 0x60, 0xC0, 0xC1, 0x87, 0x0C, 0x38, 0x61, 0x87, 0x1C, 0x30, 0xC3,
+    0x0C, 0x31, 0xC7, 0x18, 0x63, 0x8C, 0x71, 0x8C, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xE6,
+    0x7F, 0xFF, 0x06, 0x00, 0xF0, 0x1B, 0x81, 0x98, 0x39, 0xC1, 0x08, 0x61, 0xC1, 0xC1, 0xC1, 0xC1,
+    0x6F, 0xB6, 0x1C, 0x1C, 0x1C, 0x1C, 0x16, 0x6D, 0xED, 0x00, 0x0C, 0x09, 0x73, 0x72, 0x82, 0x72,
+    0x82, 0x73, 0x72, 0x82, 0x72, 0x82, 0x73, 0x72, 0x82, 0x73, 0x72, 0x82, 0x72, 0x82, 0x73, 0x70,
+    0x45, 0x77, 0x53, 0x33, 0x33, 0x53, 0x22, 0x72, 0x22, 0x72, 0x13, 0x72, 0x12, 0x85, 0x85, 0x94,
+    0x86, 0x76, 0x72, 0x22, 0x72, 0x22, 0x72, 0x23, 0x53, 0x33, 0x33, 0x57, 0x75, 0x40, 0x0C, 0xF7,
+    0xF3, 0x8C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x36, 0x68, 0x43,
+    0x43, 0x31, 0x73, 0xB2, 0xB2, 0xA3, 0xA2, 0xB2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xAF, 0xB0, 0x36, 0x4A, 0x23, 0x43, 0xA3, 0xA2, 0xA2, 0x92, 0x93, 0x46, 0x67, 0xA4, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA4, 0x6F, 0x03, 0x73, 0x83, 0x94, 0x94, 0x82, 0x12, 0x72, 0x22, 0x72, 0x22, 0x62,
+    0x32, 0x52, 0x42, 0x52, 0x42, 0x42, 0x52, 0x32, 0x62, 0x32, 0x62, 0x22, 0x72, 0x2F, 0xB9, 0x2B,
+    0x2B, 0x2B, 0x22, 0x19, 0x29, 0x22, 0x92, 0x82, 0x92, 0x92, 0x98, 0x3A, 0x84, 0x92, 0x92, 0x92,
+    0x92, 0x92, 0x84, 0x63, 0x19, 0x37, 0x30, 0x65, 0x67, 0x53, 0x93, 0xA2, 0xA2, 0xB2, 0xB2, 0x25,
+    0x4A, 0x34, 0x43, 0x13, 0x72, 0x13, 0x73, 0x12, 0x82, 0x12, 0x82, 0x12, 0x73, 0x13, 0x62, 0x33,
+    0x43, 0x48, 0x65, 0x40, 0x0F, 0xBA, 0x2B, 0x2A, 0x2B, 0x2A, 0x3A, 0x2A, 0x3A, 0x2B, 0x2A, 0x2B,
+    0x2A, 0x2B, 0x2A, 0x3A, 0x2A, 0x3A, 0x28, 0x0F, 0x81, 0xFF, 0x1C, 0x1C, 0xC0, 0x66, 0x03, 0x30,
+    0x19, 0xC1, 0x87, 0x1C, 0x1F, 0x80, 0xFE, 0x0E, 0x78, 0xE0, 0xE6, 0x03, 0x60, 0x0F, 0x00, 0xFC,
+    0x06, 0x70, 0x71, 0xFF, 0x07, 0xE0, 0x45, 0x68, 0x43, 0x43, 0x32, 0x63, 0x22, 0x72, 0x12, 0x82,
+    0x12, 0x86, 0x73, 0x12, 0x73, 0x13, 0x45, 0x2A, 0x45, 0x22, 0xB2, 0xB2, 0xA2, 0xA3, 0x93, 0x57,
+    0x65, 0x60, 0x09, 0xF9, 0x90, 0x77, 0x70, 0x00, 0x00, 0x00, 0x07, 0x66, 0xEC, 0xC0, 0xC1, 0xA3,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0xA4, 0xC4, 0xB4, 0xB4, 0xB4, 0xB2, 0x0F, 0x7F, 0xF3, 0xF7, 0x01,
+    0xC3, 0xB4, 0xC3, 0xC3, 0xC3, 0xC3, 0x94, 0x64, 0x74, 0x74, 0x74, 0x91, 0xC0, 0x26, 0x29, 0x21,
+    0x53, 0x82, 0x82, 0x82, 0x82, 0x73, 0x63, 0x63, 0x63, 0x72, 0x81, 0x91, 0xFD, 0x37, 0x37, 0x34,
+    0x77, 0xAB, 0x63, 0x83, 0x42, 0xB3, 0x22, 0xD2, 0x22, 0x56, 0x34, 0x48, 0x34, 0x42, 0x42, 0x43,
+    0x32, 0x52, 0x42, 0x42, 0x52, 0x42, 0x42, 0x52, 0x42, 0x42, 0x52, 0x42, 0x42, 0x43, 0x33, 0x42,
+    0x43, 0x34, 0x46, 0x15, 0x12, 0x54, 0x24, 0x32, 0xF2, 0x3F, 0x23, 0x91, 0x7C, 0x98, 0x60, 0x72,
+    0xE2, 0xD4, 0xC4, 0xB2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x42, 0x82, 0x42, 0x82, 0x42, 0x72,
+    0x62, 0x6A, 0x5C, 0x42, 0x82, 0x42, 0x82, 0x32, 0x93, 0x22, 0xA2, 0x22, 0xA2, 0x12, 0xC2, 0xFF,
+    0x87, 0xFF, 0x30, 0x39, 0x80, 0xEC, 0x03, 0x60, 0x1B, 0x01, 0xD8, 0x1C, 0xFF, 0x87, 0xFE, 0x30,
+    0x39, 0x80, 0x6C, 0x03, 0x60, 0x1F, 0x00, 0xF8, 0x06, 0xC0, 0xF7, 0xFF, 0x3F, 0xE0, 0x57, 0x4A,
+    0x24, 0x52, 0x13, 0xA2, 0xA3, 0xA2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xA3, 0xB3, 0xB4,
+    0x61, 0x3A, 0x57, 0x10, 0x09, 0x5B, 0x32, 0x64, 0x22, 0x83, 0x12, 0x92, 0x12, 0x95, 0xA4, 0xA4,
+    0xA4, 0xA4, 0xA4, 0xA4, 0xA4, 0x95, 0x92, 0x12, 0x83, 0x12, 0x64, 0x2B, 0x38, 0x60, 0x0F, 0x87,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0xF8, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7F, 0x50, 0x0F, 0xA8,
+    0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xA1, 0xA1, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+    0x67, 0x5C, 0x24, 0x62, 0x23, 0xC2, 0xC3, 0xC2, 0xD2, 0xD2, 0xD2, 0x78, 0x78, 0xB4, 0xB5, 0xA2,
+    0x12, 0xA2, 0x13, 0x92, 0x24, 0x72, 0x3C, 0x59, 0x10, 0x02, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94,
+    0x94, 0x9F, 0xF0, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x0F, 0xFF, 0xC0, 0x0E,
+    0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38,
+    0x70, 0xC3, 0xBE, 0x78, 0xC0, 0x36, 0x03, 0x30, 0x31, 0x83, 0x8C, 0x38, 0x63, 0x83, 0x38, 0x1B,
+    0x80, 0xD8, 0x07, 0xE0, 0x3B, 0x81, 0x8E, 0x0C, 0x30, 0x61, 0xC3, 0x07, 0x18, 0x18, 0xC0, 0x66,
+    0x03, 0xB0, 0x0E, 0x02, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x8F, 0x50, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0x60, 0x0F, 0xEC, 0x01, 0xFD,
+    0x80, 0x3F, 0x98, 0x0D, 0xF3, 0x01, 0xBF, 0x60, 0x27, 0xE6, 0x0C, 0xFC, 0xC1, 0x9F, 0x9C, 0x63,
+    0xF1, 0x8C, 0x7E, 0x31, 0x8F, 0xC3, 0x61, 0xF8, 0x6C, 0x3F, 0x0D, 0x87, 0xE0, 0xE0, 0xFC, 0x1C,
+    0x1F, 0x83, 0x03, 0x80, 0x02, 0xA5, 0x96, 0x83, 0x12, 0x87, 0x74, 0x13, 0x64, 0x22, 0x64, 0x23,
+    0x54, 0x33, 0x44, 0x42, 0x44, 0x43, 0x34, 0x53, 0x24, 0x62, 0x24, 0x63, 0x14, 0x77, 0x86, 0x86,
+    0x95, 0xA2, 0x56, 0x8A, 0x53, 0x63, 0x33, 0x83, 0x13, 0xA2, 0x12, 0xB5, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC4, 0xC4, 0xC4, 0xB6, 0xA3, 0x13, 0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0x08, 0x4A, 0x22, 0x54,
+    0x12, 0x72, 0x12, 0x75, 0x75, 0x75, 0x72, 0x12, 0x72, 0x12, 0x54, 0x19, 0x37, 0x52, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0x56, 0x8A, 0x53, 0x63, 0x33, 0x83, 0x13, 0xA2, 0x12, 0xB5, 0xC4,
+    0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB6, 0xA2, 0x23, 0x83, 0x33, 0x63, 0x5A, 0x86, 0xE3, 0xE3,
+    0xE3, 0xE3, 0x10, 0xFF, 0x0F, 0xFC, 0xC1, 0xEC, 0x06, 0xC0, 0x6C, 0x06, 0xC0, 0x6C, 0x0E, 0xC1,
+    0xCF, 0xF8, 0xFF, 0x0C, 0x30, 0xC3, 0x8C, 0x18, 0xC1, 0xCC, 0x0E, 0xC0, 0x6C, 0x07, 0xC0, 0x30,
+    0x37, 0x49, 0x23, 0x52, 0x22, 0xA2, 0xA2, 0xA2, 0xA3, 0xA5, 0x95, 0x94, 0xA3, 0xA3, 0xA2, 0xA2,
+    0x95, 0x63, 0x1A, 0x37, 0x40, 0x0F, 0xD6, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x26, 0x03, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x12, 0x92, 0x23, 0x73, 0x33, 0x53, 0x59, 0x76, 0x50,
+    0xC0, 0x06, 0xC0, 0x1D, 0x80, 0x33, 0x00, 0x63, 0x01, 0x86, 0x03, 0x0C, 0x06, 0x0C, 0x18, 0x18,
+    0x30, 0x30, 0x60, 0x31, 0x80, 0x63, 0x00, 0xC6, 0x00, 0xD8, 0x01, 0xB0, 0x03, 0x60, 0x03, 0x80,
+    0x07, 0x00, 0x0E, 0x00, 0xE0, 0x18, 0x07, 0x60, 0x38, 0x06, 0x60, 0x3C, 0x06, 0x70, 0x3C, 0x0E,
+    0x30, 0x7C, 0x0C, 0x30, 0x66, 0x0C, 0x30, 0x66, 0x0C, 0x30, 0x66, 0x1C, 0x18, 0xC7, 0x18, 0x18,
+    0xC3, 0x18, 0x18, 0xC3, 0x18, 0x19, 0xC3, 0x38, 0x0D, 0x81, 0xB0, 0x0D, 0x81, 0xB0, 0x0D, 0x81,
+    0xB0, 0x0D, 0x00, 0xB0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x07, 0x00, 0xE0, 0x12, 0x92, 0x23,
+    0x73, 0x32, 0x72, 0x52, 0x52, 0x63, 0x33, 0x72, 0x32, 0x92, 0x12, 0xA5, 0xB3, 0xC3, 0xB5, 0xA2,
+    0x12, 0x92, 0x32, 0x73, 0x33, 0x62, 0x52, 0x53, 0x53, 0x42, 0x72, 0x32, 0x92, 0x13, 0x93, 0x03,
+    0x93, 0x12, 0x92, 0x23, 0x73, 0x32, 0x72, 0x43, 0x53, 0x52, 0x52, 0x72, 0x32, 0x82, 0x32, 0x92,
+    0x12, 0xA5, 0xB3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x60, 0x0F, 0xBA, 0x2A, 0x39,
+    0x3A, 0x2A, 0x39, 0x3A, 0x2A, 0x39, 0x3A, 0x2A, 0x39, 0x3A, 0x2A, 0x3A, 0x2A, 0xFB, 0xFF, 0xFC,
+    0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xFF, 0xC0,
+    0x03, 0x82, 0x82, 0x92, 0x82, 0x83, 0x82, 0x82, 0x92, 0x82, 0x83, 0x82, 0x82, 0x83, 0x82, 0x82,
+    0x92, 0x82, 0x83, 0xFF, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C,
+    0x30, 0xC3, 0x0F, 0xFF, 0xC0, 0x06, 0x00, 0xE0, 0x0F, 0x01, 0xB0, 0x19, 0x81, 0x18, 0x30, 0xC3,
+    0x0C, 0x60, 0x66, 0x06, 0xC0, 0x3C, 0x03, 0x0F, 0x90, 0xE3, 0x0C, 0x30, 0x36, 0x48, 0x32, 0x43,
+    0x92, 0x92, 0x92, 0x38, 0x1A, 0x13, 0x55, 0x64, 0x66, 0x44, 0x1A, 0x25, 0x22, 0xC0, 0x06, 0x00,
+    0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x3E, 0x1B, 0xFC, 0xF0, 0x77, 0x01, 0xB8, 0x0D, 0x80,
+    0x6C, 0x03, 0xE0, 0x1F, 0x00, 0xDC, 0x06, 0xE0, 0x37, 0x83, 0xB7, 0xF9, 0x9F, 0x00, 0x46, 0x28,
+    0x22, 0x51, 0x12, 0x82, 0x82, 0x73, 0x73, 0x73, 0x82, 0x82, 0x84, 0x41, 0x28, 0x45, 0x10, 0xB2,
+    0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x45, 0x22, 0x28, 0x12, 0x23, 0x44, 0x13, 0x63, 0x12, 0x73, 0x12,
+    0x85, 0x85, 0x82, 0x12, 0x82, 0x12, 0x73, 0x12, 0x73, 0x13, 0x54, 0x28, 0x12, 0x45, 0x22, 0x45,
+    0x78, 0x43, 0x43, 0x23, 0x62, 0x22, 0x72, 0x22, 0x73, 0x1F, 0xA1, 0x2B, 0x2B, 0x3B, 0x36, 0x14,
+    0x95, 0x72, 0x55, 0x46, 0x33, 0x72, 0x82, 0x82, 0x68, 0x19, 0x42, 0x82, 0x82, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x50, 0x49, 0x3A, 0x23, 0x42, 0x42, 0x53, 0x32, 0x62, 0x32,
+    0x62, 0x33, 0x42, 0x58, 0x65, 0x72, 0xA2, 0xB2, 0xC8, 0x5A, 0x12, 0x82, 0x12, 0x85, 0x82, 0x12,
+    0x73, 0x1B, 0x47, 0x30, 0x02, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x26, 0x22, 0x18, 0x14, 0x52,
+    0x13, 0x66, 0x74, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0xDF, 0x01, 0xB6, 0xDB,
+    0x6D, 0xB6, 0xDB, 0x00, 0x18, 0x71, 0x80, 0x00, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86,
+    0x18, 0x61, 0x86, 0x18, 0x61, 0xBE, 0xF0, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30,
+    0x3E, 0x0E, 0xC3, 0x98, 0xE3, 0x38, 0x6E, 0x0F, 0xC1, 0xDC, 0x31, 0x86, 0x18, 0xC1, 0x98, 0x3B,
+    0x03, 0xE0, 0x30, 0x0F, 0xFA, 0x02, 0x25, 0x45, 0x22, 0x17, 0x18, 0x14, 0x45, 0x46, 0x63, 0x56,
+    0x62, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74, 0x72, 0x74,
+    0x72, 0x74, 0x72, 0x72, 0x02, 0x26, 0x22, 0x18, 0x14, 0x52, 0x13, 0x66, 0x74, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x82, 0x46, 0x78, 0x53, 0x43, 0x33, 0x63, 0x22, 0x82, 0x22, 0x82,
+    0x13, 0x86, 0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x43, 0x58, 0x76, 0x40, 0xCF, 0x86,
+    0xFF, 0x3C, 0x3D, 0xC0, 0xEE, 0x03, 0x60, 0x1B, 0x00, 0xF8, 0x07, 0xC0, 0x37, 0x01, 0xB8, 0x1D,
+    0xE1, 0xCD, 0xFE, 0x67, 0xC3, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x00, 0x45,
+    0x22, 0x28, 0x12, 0x23, 0x44, 0x13, 0x63, 0x12, 0x73, 0x12, 0x85, 0x85, 0x82, 0x12, 0x82, 0x12,
+    0x73, 0x12, 0x73, 0x14, 0x44, 0x28, 0x12, 0x45, 0x22, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xC7,
+    0xEF, 0xB6, 0x1E, 0x0E, 0x07, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x00, 0x26,
+    0x38, 0x13, 0x51, 0x12, 0x83, 0x83, 0x85, 0x75, 0x73, 0x92, 0x84, 0x5C, 0x26, 0x30, 0x10, 0x10,
+    0x10, 0x7F, 0xFF, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x18, 0x1F, 0x0F, 0x02,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x76, 0x66, 0x54, 0x18, 0x12, 0x26, 0x22,
+    0xC0, 0x1B, 0x01, 0x98, 0x0C, 0xE0, 0xE3, 0x06, 0x18, 0x30, 0xE3, 0x83, 0x18, 0x18, 0xC0, 0x6C,
+    0x03, 0x60, 0x1B, 0x00, 0x70, 0x03, 0x80, 0xE0, 0x60, 0x76, 0x0F, 0x06, 0x60, 0xF0, 0x66, 0x0F,
+    0x06, 0x71, 0x98, 0xE3, 0x19, 0x8C, 0x31, 0x98, 0xC3, 0x19, 0x8C, 0x1B, 0x0D, 0x81, 0xB0, 0xD8,
+    0x1B, 0x0D, 0x81, 0xE0, 0x78, 0x0E, 0x07, 0x00, 0xE0, 0x70, 0xE0, 0x76, 0x06, 0x30, 0xC3, 0x9C,
+    0x19, 0x80, 0xF0, 0x0E, 0x00, 0xF0, 0x0F, 0x01, 0x98, 0x30, 0xC7, 0x0E, 0x60, 0x6C, 0x03, 0xC0,
+    0x1B, 0x01, 0x98, 0x0C, 0xE0, 0xE3, 0x06, 0x18, 0x30, 0x63, 0x83, 0x18, 0x0C, 0xC0, 0x6C, 0x03,
+    0x60, 0x0B, 0x00, 0x70, 0x01, 0x80, 0x1C, 0x00, 0xC0, 0x0E, 0x00, 0xE0, 0x3E, 0x01, 0xE0, 0x00,
+    0x0F, 0x57, 0x27, 0x28, 0x27, 0x27, 0x28, 0x27, 0x27, 0x27, 0x37, 0x27, 0xF5, 0x07, 0x0F, 0x1C,
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x70, 0xC0, 0x70, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x1C, 0x0F, 0x07, 0x0F, 0xFF, 0x70, 0xE0, 0xF0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x18, 0x0E, 0x03, 0x0E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xE0, 0x16, 0x5F,
+    0x05, 0x61, 0xFF, 0x80, 0x12, 0x49, 0x6D, 0xBF, 0xFF, 0x80, 0x52, 0x82, 0x76, 0x28, 0x22, 0x72,
+    0x82, 0x82, 0x73, 0x73, 0x73, 0x82, 0x82, 0x83, 0x88, 0x46, 0x52, 0x82, 0x82, 0x30, 0x56, 0x68,
+    0x43, 0x42, 0x42, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x8A, 0x3A, 0x53, 0xA3, 0xA3, 0xA2, 0xB2, 0xA3,
+    0x9F, 0xB0, 0x02, 0x94, 0x92, 0x12, 0x72, 0x22, 0x72, 0x32, 0x52, 0x42, 0x43, 0x52, 0x32, 0x62,
+    0x23, 0x72, 0x12, 0x85, 0x5B, 0x2B, 0x63, 0xA3, 0x6B, 0x2B, 0x63, 0xA3, 0xA3, 0x50, 0x26, 0x1B,
+    0x54, 0x72, 0x83, 0x66, 0x23, 0x23, 0x12, 0x54, 0x54, 0x55, 0x42, 0x14, 0x12, 0x45, 0x64, 0x72,
+    0x73, 0x5B, 0x26, 0x20, 0x76, 0xC3, 0x43, 0x83, 0x83, 0x52, 0xC2, 0x41, 0x55, 0x41, 0x32, 0x46,
+    0x42, 0x21, 0x42, 0xA1, 0x21, 0x32, 0xB1, 0x12, 0x32, 0xB4, 0x32, 0xB4, 0x32, 0xB4, 0x32, 0xB2,
+    0x11, 0x42, 0xA1, 0x22, 0x37, 0x42, 0x31, 0x55, 0x41, 0x42, 0xC2, 0x53, 0x83, 0x83, 0x43, 0xC6,
+    0x70, 0x08, 0x43, 0x1C, 0xE7, 0x18, 0xC6, 0x31, 0x8C, 0x18, 0xC1, 0x8C, 0x39, 0xC3, 0x1C, 0x21,
+    0x00, 0x39, 0xDF, 0x1C, 0x18, 0x38, 0xFB, 0x9C, 0x61, 0xC1, 0xC1, 0xC1, 0xC1, 0x6F, 0xB6, 0x1C,
+    0x1C, 0x1C, 0x1C, 0x1F, 0x4F, 0xB0, 0x7D, 0xDC, 0x18, 0x30, 0x61, 0x86, 0x18, 0x61, 0xFF, 0xF8,
+    0x3E, 0x67, 0x03, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xE7, 0x7C, 0x02, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x76, 0x67, 0x4D, 0x14, 0x15, 0x24, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA0, 0x09, 0x42, 0x1C, 0x61, 0xCE, 0x18, 0xC1, 0x8C, 0x18, 0xC6, 0x31, 0x8C, 0x73, 0x9C, 0x61,
+    0x08, 0x00, 0x43, 0x73, 0x73, 0xFD, 0x19, 0x18, 0x27, 0x36, 0x36, 0x36, 0x37, 0x28, 0x28, 0x28,
+    0x28, 0x35, 0x12, 0x92, 0x62, 0x43, 0xE2, 0xF0, 0x2F, 0x02, 0xFF, 0x02, 0xE2, 0xD4, 0xC4, 0xB2,
+    0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x42, 0x82, 0x42, 0x82, 0x42, 0x72, 0x62, 0x6A, 0x5C, 0x42,
+    0x82, 0x42, 0x82, 0x32, 0x93, 0x22, 0xA2, 0x22, 0xA2, 0x12, 0xC2, 0x93, 0xD2, 0xD2, 0xD2, 0xFF,
+    0x02, 0xE2, 0xD4, 0xC4, 0xB2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x42, 0x82, 0x42, 0x82, 0x42,
+    0x72, 0x62, 0x6A, 0x5C, 0x42, 0x82, 0x42, 0x82, 0x32, 0x93, 0x22, 0xA2, 0x22, 0xA2, 0x12, 0xC2,
+    0x63, 0xC5, 0xA3, 0x13, 0x92, 0x32, 0xFD, 0x2E, 0x2D, 0x4C, 0x4B, 0x22, 0x2A, 0x22, 0x2A, 0x22,
+    0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x27, 0x26, 0x26, 0xA5, 0xC4, 0x28, 0x24, 0x28, 0x23, 0x29,
+    0x32, 0x2A, 0x22, 0x2A, 0x21, 0x2C, 0x20, 0x44, 0x31, 0x88, 0x72, 0x33, 0xFD, 0x2E, 0x2D, 0x4C,
+    0x4B, 0x22, 0x2A, 0x22, 0x2A, 0x22, 0x29, 0x24, 0x28, 0x24, 0x28, 0x24, 0x27, 0x26, 0x26, 0xA5,
+    0xC4, 0x28, 0x24, 0x28, 0x23, 0x29, 0x32, 0x2A, 0x22, 0x2A, 0x21, 0x2C, 0x20, 0x52, 0x32, 0x92,
+    0x32, 0x92, 0x32, 0xFC, 0x2E, 0x2D, 0x4C, 0x4B, 0x22, 0x2A, 0x22, 0x2A, 0x22, 0x29, 0x24, 0x28,
+    0x24, 0x28, 0x24, 0x27, 0x26, 0x26, 0xA5, 0xC4, 0x28, 0x24, 0x28, 0x23, 0x29, 0x32, 0x2A, 0x22,
+    0x2A, 0x21, 0x2C, 0x20, 0x73, 0xC2, 0x12, 0xB1, 0x31, 0xB2, 0x12, 0xC3, 0xD2, 0xD4, 0xC4, 0xB2,
+    0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x42, 0x82, 0x42, 0x82, 0x42, 0x72, 0x62, 0x6A, 0x5C, 0x42,
+    0x82, 0x42, 0x82, 0x32, 0x93, 0x22, 0xA2, 0x22, 0xA2, 0x12, 0xC2, 0x9C, 0x8D, 0x82, 0x22, 0xE3,
+    0x22, 0xE2, 0x32, 0xD3, 0x32, 0xD2, 0x42, 0xC3, 0x42, 0xC2, 0x59, 0x43, 0x59, 0x42, 0x62, 0xAB,
+    0xAB, 0xA2, 0x72, 0x92, 0x82, 0x92, 0x82, 0x82, 0x92, 0x82, 0x9B, 0xA9, 0x57, 0x4A, 0x24, 0x52,
+    0x13, 0xA2, 0xA3, 0xA2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB3, 0xA3, 0xB3, 0xB4, 0x61, 0x3A,
+    0x57, 0x82, 0xB3, 0xB2, 0xC2, 0xA2, 0x84, 0x40, 0x23, 0x82, 0x92, 0x92, 0xDF, 0x87, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0xF8, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7F, 0x50, 0x63, 0x72, 0x72, 0x72,
+    0xEF, 0x87, 0x37, 0x37, 0x37, 0x37, 0x37, 0xF8, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7F, 0x50,
+    0x43, 0x65, 0x43, 0x13, 0x32, 0x32, 0xBF, 0x87, 0x37, 0x37, 0x37, 0x37, 0x37, 0xF8, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x7F, 0x50, 0x22, 0x32, 0x32, 0x32, 0x32, 0x32, 0xBF, 0x87, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0xF8, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x7F, 0x50, 0xE3, 0x0C, 0x30, 0x1C,
+    0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0x99, 0x80, 0x73, 0x9C,
+    0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0x38, 0xFB, 0xBE, 0x30, 0x07, 0x0E,
+    0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0xC7,
+    0x8F, 0x18, 0x03, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+    0xC3, 0x87, 0x0E, 0x00, 0x29, 0x7B, 0x52, 0x64, 0x42, 0x83, 0x32, 0x92, 0x32, 0x93, 0x22, 0xA2,
+    0x22, 0xA2, 0x22, 0xAB, 0x5B, 0x52, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x93, 0x22, 0x92, 0x32, 0x83,
+    0x32, 0x64, 0x4B, 0x59, 0x50, 0x34, 0x31, 0x68, 0x52, 0x33, 0xF3, 0x2A, 0x59, 0x68, 0x31, 0x28,
+    0x77, 0x41, 0x36, 0x42, 0x26, 0x42, 0x35, 0x43, 0x34, 0x44, 0x24, 0x44, 0x33, 0x45, 0x32, 0x46,
+    0x22, 0x46, 0x31, 0x47, 0x78, 0x68, 0x69, 0x5A, 0x20, 0x53, 0xE2, 0xF0, 0x2F, 0x02, 0xFC, 0x68,
+    0xA5, 0x36, 0x33, 0x38, 0x31, 0x3A, 0x21, 0x2B, 0x5C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B,
+    0x6A, 0x31, 0x38, 0x33, 0x36, 0x35, 0xA8, 0x65, 0x83, 0xD2, 0xD2, 0xD2, 0xFE, 0x68, 0xA5, 0x36,
+    0x33, 0x38, 0x31, 0x3A, 0x21, 0x2B, 0x5C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x6A, 0x31,
+    0x38, 0x33, 0x36, 0x35, 0xA8, 0x65, 0x63, 0xC5, 0xA3, 0x13, 0x92, 0x32, 0xFB, 0x68, 0xA5, 0x36,
+    0x33, 0x38, 0x31, 0x3A, 0x21, 0x2B, 0x5C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x6A, 0x31,
+    0x38, 0x33, 0x36, 0x35, 0xA8, 0x65, 0x44, 0x31, 0x88, 0x72, 0x33, 0xFB, 0x68, 0xA5, 0x36, 0x33,
+    0x38, 0x31, 0x3A, 0x21, 0x2B, 0x5C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x6A, 0x31, 0x38,
+    0x33, 0x36, 0x35, 0xA8, 0x65, 0x52, 0x32, 0x92, 0x32, 0x92, 0x32, 0xFA, 0x68, 0xA5, 0x36, 0x33,
+    0x38, 0x31, 0x3A, 0x21, 0x2B, 0x5C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x6A, 0x31, 0x38,
+    0x33, 0x36, 0x35, 0xA8, 0x65, 0xC0, 0x7C, 0x1D, 0xC7, 0x1D, 0xC1, 0xF0, 0x1C, 0x07, 0xC1, 0xDC,
+    0x71, 0xDC, 0x1F, 0x01, 0x80, 0xE1, 0x66, 0x22, 0x4C, 0x33, 0x63, 0x33, 0x74, 0x13, 0x75, 0x12,
+    0x82, 0x15, 0x72, 0x34, 0x62, 0x44, 0x53, 0x44, 0x52, 0x54, 0x42, 0x64, 0x33, 0x64, 0x32, 0x75,
+    0x12, 0x78, 0x83, 0x14, 0x73, 0x33, 0x63, 0x3C, 0x42, 0x26, 0x61, 0xE0, 0x43, 0xD2, 0xE2, 0xE2,
+    0xF6, 0x39, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x31,
+    0x29, 0x22, 0x37, 0x33, 0x35, 0x35, 0x97, 0x65, 0x83, 0xC2, 0xC2, 0xC2, 0xF7, 0x39, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x31, 0x29, 0x22, 0x37, 0x33,
+    0x35, 0x35, 0x97, 0x65, 0x63, 0xB5, 0x93, 0x13, 0x82, 0x32, 0xF4, 0x39, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x31, 0x29, 0x22, 0x37, 0x33, 0x35, 0x35,
+    0x97, 0x65, 0x42, 0x32, 0x82, 0x32, 0x82, 0x32, 0xF4, 0x39, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x31, 0x29, 0x22, 0x37, 0x33, 0x35, 0x35, 0x97, 0x65,
+    0x83, 0xC2, 0xC2, 0xC2, 0xF7, 0x39, 0x31, 0x29, 0x22, 0x37, 0x33, 0x27, 0x24, 0x35, 0x35, 0x25,
+    0x27, 0x23, 0x28, 0x23, 0x29, 0x21, 0x2A, 0x5B, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C,
+    0x36, 0x02, 0xA2, 0xA2, 0xA8, 0x4A, 0x22, 0x54, 0x12, 0x72, 0x12, 0x75, 0x75, 0x75, 0x72, 0x12,
+    0x72, 0x12, 0x54, 0x1A, 0x28, 0x42, 0xA2, 0xA2, 0xA2, 0xA0, 0x1F, 0x83, 0xFE, 0x18, 0x39, 0xC0,
+    0xCC, 0x06, 0x60, 0x73, 0x07, 0x18, 0x70, 0xC3, 0x06, 0x18, 0x30, 0xE1, 0x83, 0x8C, 0x0E, 0x60,
+    0x3B, 0x00, 0xF8, 0x03, 0xC0, 0x1E, 0x61, 0xF3, 0xFD, 0x8F, 0xC0, 0x33, 0x92, 0xA2, 0xA2, 0xFD,
+    0x64, 0x83, 0x24, 0x39, 0x29, 0x29, 0x23, 0x81, 0xA1, 0x35, 0x56, 0x46, 0x64, 0x41, 0xA2, 0x52,
+    0x20, 0x73, 0x82, 0x82, 0x82, 0xFE, 0x64, 0x83, 0x24, 0x39, 0x29, 0x29, 0x23, 0x81, 0xA1, 0x35,
+    0x56, 0x46, 0x64, 0x41, 0xA2, 0x52, 0x20, 0x43, 0x75, 0x53, 0x13, 0x42, 0x32, 0xFC, 0x64, 0x83,
+    0x24, 0x39, 0x29, 0x29, 0x23, 0x81, 0xA1, 0x35, 0x56, 0x46, 0x64, 0x41, 0xA2, 0x52, 0x20, 0x24,
+    0x31, 0x38, 0x22, 0x33, 0xFC, 0x64, 0x83, 0x24, 0x39, 0x29, 0x29, 0x23, 0x81, 0xA1, 0x35, 0x56,
+    0x46, 0x64, 0x41, 0xA2, 0x52, 0x20, 0x32, 0x32, 0x42, 0x32, 0x42, 0x32, 0xFB, 0x64, 0x83, 0x24,
+    0x39, 0x29, 0x29, 0x23, 0x81, 0xA1, 0x35, 0x56, 0x46, 0x64, 0x41, 0xA2, 0x52, 0x20, 0x53, 0x72,
+    0x12, 0x61, 0x31, 0x62, 0x12, 0x73, 0xFD, 0x64, 0x83, 0x24, 0x39, 0x29, 0x29, 0x23, 0x81, 0xA1,
+    0x35, 0x56, 0x46, 0x64, 0x41, 0xA2, 0x52, 0x20, 0x36, 0x35, 0x49, 0x17, 0x41, 0x55, 0x33, 0x94,
+    0x52, 0xA2, 0x62, 0xA2, 0x63, 0x3F, 0x21, 0xF4, 0x13, 0x52, 0x93, 0x62, 0x92, 0x64, 0x83, 0x46,
+    0x51, 0x28, 0x28, 0x35, 0x56, 0x20, 0x46, 0x28, 0x22, 0x51, 0x12, 0x82, 0x82, 0x73, 0x73, 0x73,
+    0x82, 0x82, 0x84, 0x41, 0x28, 0x45, 0x62, 0x83, 0x82, 0x92, 0x72, 0x54, 0x30, 0x33, 0xB2, 0xC2,
+    0xC2, 0xFF, 0x55, 0x78, 0x43, 0x43, 0x23, 0x62, 0x22, 0x72, 0x22, 0x73, 0x1F, 0xA1, 0x2B, 0x2B,
+    0x3B, 0x36, 0x14, 0x95, 0x72, 0x73, 0xA2, 0xA2, 0xA2, 0xFF, 0x65, 0x78, 0x43, 0x43, 0x23, 0x62,
+    0x22, 0x72, 0x22, 0x73, 0x1F, 0xA1, 0x2B, 0x2B, 0x3B, 0x36, 0x14, 0x95, 0x72, 0x53, 0x95, 0x73,
+    0x13, 0x62, 0x32, 0xFF, 0x35, 0x78, 0x43, 0x43, 0x23, 0x62, 0x22, 0x72, 0x22, 0x73, 0x1F, 0xA1,
+    0x2B, 0x2B, 0x3B, 0x36, 0x14, 0x95, 0x72, 0x32, 0x32, 0x62, 0x32, 0x62, 0x32, 0xFF, 0x35, 0x78,
+    0x43, 0x43, 0x23, 0x62, 0x22, 0x72, 0x22, 0x73, 0x1F, 0xA1, 0x2B, 0x2B, 0x3B, 0x36, 0x14, 0x95,
+    0x72, 0xE3, 0x0C, 0x30, 0x00, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x60, 0x39, 0x99,
+    0x80, 0x03, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x80, 0x38, 0xFB, 0xBE, 0x30, 0x00,
+    0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x80, 0xC7, 0x8F, 0x18,
+    0x00, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x42, 0x51,
+    0x63, 0x23, 0x76, 0x85, 0x83, 0x13, 0x71, 0x43, 0xC2, 0xC3, 0x56, 0x12, 0x3B, 0x23, 0x64, 0x12,
+    0x83, 0x12, 0x86, 0x95, 0x83, 0x12, 0x82, 0x22, 0x82, 0x24, 0x52, 0x4A, 0x66, 0x40, 0x24, 0x31,
+    0x48, 0x32, 0x33, 0xFC, 0x22, 0x62, 0x21, 0x81, 0x45, 0x21, 0x36, 0x67, 0x48, 0x48, 0x48, 0x48,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x20, 0x33, 0xC2, 0xD2, 0xD2, 0xFF, 0x86, 0x78, 0x53, 0x43, 0x33,
+    0x63, 0x22, 0x82, 0x22, 0x82, 0x13, 0x86, 0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x43,
+    0x58, 0x76, 0x40, 0x73, 0xB2, 0xB2, 0xB2, 0xFF, 0x96, 0x78, 0x53, 0x43, 0x33, 0x63, 0x22, 0x82,
+    0x22, 0x82, 0x13, 0x86, 0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x43, 0x58, 0x76, 0x40,
+    0x53, 0xA5, 0x83, 0x13, 0x72, 0x32, 0xFF, 0x66, 0x78, 0x53, 0x43, 0x33, 0x63, 0x22, 0x82, 0x22,
+    0x82, 0x13, 0x86, 0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x43, 0x58, 0x76, 0x40, 0x34,
+    0x31, 0x68, 0x52, 0x33, 0xFF, 0x66, 0x78, 0x53, 0x43, 0x33, 0x63, 0x22, 0x82, 0x22, 0x82, 0x13,
+    0x86, 0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x43, 0x58, 0x76, 0x40, 0x32, 0x32, 0x72,
+    0x32, 0x72, 0x32, 0xFF, 0x66, 0x78, 0x53, 0x43, 0x33, 0x63, 0x22, 0x82, 0x22, 0x82, 0x13, 0x86,
+    0x82, 0x22, 0x82, 0x22, 0x82, 0x23, 0x63, 0x33, 0x43, 0x58, 0x76, 0x40, 0x53, 0xA3, 0xA3, 0xFF,
+    0x1F, 0xBF, 0xF1, 0x3A, 0x3A, 0x35, 0x00, 0x10, 0x3F, 0x61, 0xFF, 0x0E, 0x1C, 0x70, 0x79, 0x83,
+    0x66, 0x19, 0xB8, 0xE7, 0xE7, 0x19, 0x98, 0x66, 0xC1, 0x9E, 0x0E, 0x38, 0x70, 0xFF, 0x86, 0xFC,
+    0x08, 0x00, 0x23, 0xA2, 0xB2, 0xB2, 0xFE, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+    0x47, 0x66, 0x65, 0x41, 0x81, 0x22, 0x62, 0x20, 0x63, 0x92, 0x92, 0x92, 0xFF, 0x02, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x76, 0x66, 0x54, 0x18, 0x12, 0x26, 0x22, 0x43, 0x85,
+    0x63, 0x13, 0x52, 0x32, 0xFC, 0x28, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x66,
+    0x65, 0x41, 0x81, 0x22, 0x62, 0x20, 0x22, 0x32, 0x52, 0x32, 0x52, 0x32, 0xFC, 0x28, 0x48, 0x48,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x47, 0x66, 0x65, 0x41, 0x81, 0x22, 0x62, 0x20, 0x73, 0xA2,
+    0xA2, 0xA2, 0xFF, 0x22, 0x92, 0x12, 0x72, 0x22, 0x72, 0x23, 0x53, 0x32, 0x52, 0x42, 0x52, 0x52,
+    0x33, 0x52, 0x32, 0x72, 0x22, 0x72, 0x12, 0x82, 0x12, 0x91, 0x12, 0x93, 0xB2, 0xA3, 0xA2, 0xA3,
+    0x93, 0x75, 0x84, 0x90, 0x02, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x25, 0x42, 0x18, 0x24, 0x52,
+    0x23, 0x72, 0x13, 0x72, 0x12, 0x82, 0x12, 0x85, 0x85, 0x82, 0x13, 0x72, 0x13, 0x72, 0x14, 0x53,
+    0x12, 0x18, 0x22, 0x25, 0x42, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB0, 0x32, 0x32, 0x62, 0x32, 0x62,
+    0x32, 0xFE, 0x29, 0x21, 0x27, 0x22, 0x27, 0x22, 0x35, 0x33, 0x25, 0x24, 0x25, 0x25, 0x23, 0x35,
+    0x23, 0x27, 0x22, 0x27, 0x21, 0x28, 0x21, 0x29, 0x11, 0x29, 0x3B, 0x2A, 0x3A, 0x2A, 0x39, 0x37,
+    0x58, 0x49, 0x72, 0xE2, 0xD4, 0xC4, 0xB2, 0x22, 0xA2, 0x22, 0xA2, 0x22, 0x92, 0x42, 0x82, 0x42,
+    0x82, 0x42, 0x72, 0x62, 0x6A, 0x5C, 0x42, 0x82, 0x42, 0x82, 0x32, 0x93, 0x22, 0xA2, 0x22, 0xA2,
+    0x12, 0xC2, 0xFF, 0x87, 0xFF, 0x30, 0x39, 0x80, 0xEC, 0x03, 0x60, 0x1B, 0x01, 0xD8, 0x1C, 0xFF,
+    0x87, 0xFE, 0x30, 0x39, 0x80, 0x6C, 0x03, 0x60, 0x1F, 0x00, 0xF8, 0x06, 0xC0, 0xF7, 0xFF, 0x3F,
+    0xE0, 0x0F, 0x78, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x28, 0x28, 0x63, 0xC3, 0xC3, 0xB2, 0x12, 0xA2, 0x12, 0xA2, 0x12, 0x92, 0x32, 0x82, 0x32,
+    0x82, 0x32, 0x72, 0x52, 0x62, 0x52, 0x62, 0x52, 0x52, 0x72, 0x42, 0x72, 0x42, 0x72, 0x32, 0x92,
+    0x22, 0x92, 0x2D, 0x1F, 0x00, 0x0F, 0x87, 0x37, 0x37, 0x37, 0x37, 0x37, 0xF8, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x7F, 0x50, 0x0F, 0xBA, 0x2A, 0x39, 0x3A, 0x2A, 0x39, 0x3A, 0x2A, 0x39, 0x3A,
+    0x2A, 0x39, 0x3A, 0x2A, 0x3A, 0x2A, 0xFB, 0x02, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x9F,
+    0xF0, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x94, 0x92, 0x56, 0x8A, 0x53, 0x63, 0x33, 0x83,
+    0x13, 0xA2, 0x12, 0xB5, 0xC4, 0xC4, 0x28, 0x24, 0x28, 0x24, 0xC4, 0xC4, 0xC5, 0xB5, 0xA3, 0x13,
+    0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0x0F, 0xFF, 0xC0, 0xC0, 0x36, 0x03, 0x30, 0x31, 0x83, 0x8C,
+    0x38, 0x63, 0x83, 0x38, 0x1B, 0x80, 0xD8, 0x07, 0xE0, 0x3B, 0x81, 0x8E, 0x0C, 0x30, 0x61, 0xC3,
+    0x07, 0x18, 0x18, 0xC0, 0x66, 0x03, 0xB0, 0x0E, 0x72, 0xD4, 0xC4, 0xC4, 0xB2, 0x22, 0xA2, 0x22,
+    0x93, 0x22, 0x92, 0x42, 0x82, 0x42, 0x73, 0x43, 0x62, 0x62, 0x62, 0x62, 0x53, 0x63, 0x42, 0x82,
+    0x42, 0x82, 0x33, 0x83, 0x22, 0xA2, 0x22, 0xA2, 0x13, 0xA3, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0x60,
+    0x0F, 0xEC, 0x01, 0xFD, 0x80, 0x3F, 0x98, 0x0D, 0xF3, 0x01, 0xBF, 0x60, 0x27, 0xE6, 0x0C, 0xFC,
+    0xC1, 0x9F, 0x9C, 0x63, 0xF1, 0x8C, 0x7E, 0x31, 0x8F, 0xC3, 0x61, 0xF8, 0x6C, 0x3F, 0x0D, 0x87,
+    0xE0, 0xE0, 0xFC, 0x1C, 0x1F, 0x83, 0x03, 0x80, 0x02, 0xA5, 0x96, 0x83, 0x12, 0x87, 0x74, 0x13,
+    0x64, 0x22, 0x64, 0x23, 0x54, 0x33, 0x44, 0x42, 0x44, 0x43, 0x34, 0x53, 0x24, 0x62, 0x24, 0x63,
+    0x14, 0x77, 0x86, 0x86, 0x95, 0xA2, 0x0F, 0x9F, 0xFF, 0xFD, 0xA2, 0xAF, 0xFF, 0xFF, 0xAF, 0x90,
+    0x56, 0x8A, 0x53, 0x63, 0x33, 0x83, 0x13, 0xA2, 0x12, 0xB5, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4,
+    0xC4, 0xB6, 0xA3, 0x13, 0x83, 0x33, 0x63, 0x5A, 0x86, 0x50, 0x0F, 0xD9, 0x49, 0x49, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x20, 0x08, 0x4A, 0x22,
+    0x54, 0x12, 0x72, 0x12, 0x75, 0x75, 0x75, 0x72, 0x12, 0x72, 0x12, 0x54, 0x19, 0x37, 0x52, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0x0F, 0xB1, 0x2B, 0x3B, 0x3B, 0x3B, 0x2C, 0x2C, 0x2B, 0x2A,
+    0x2A, 0x3A, 0x2A, 0x2A, 0x2A, 0x39, 0x3A, 0xFB, 0x0F, 0xD6, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C,
+    0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x2C, 0x26, 0x03, 0x93, 0x12, 0x92, 0x23,
+    0x73, 0x32, 0x72, 0x43, 0x53, 0x52, 0x52, 0x72, 0x32, 0x82, 0x32, 0x92, 0x12, 0xA5, 0xB3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x60, 0x83, 0xF1, 0x3D, 0x98, 0xD5, 0x33, 0x33, 0x33,
+    0x34, 0x34, 0x32, 0x25, 0x35, 0x21, 0x35, 0x35, 0x65, 0x35, 0x65, 0x35, 0x65, 0x35, 0x22, 0x25,
+    0x35, 0x22, 0x34, 0x34, 0x33, 0x33, 0x33, 0x35, 0xD8, 0x9D, 0x3F, 0x13, 0xF1, 0x38, 0x12, 0x92,
+    0x23, 0x73, 0x32, 0x72, 0x52, 0x52, 0x63, 0x33, 0x72, 0x32, 0x92, 0x12, 0xA5, 0xB3, 0xC3, 0xB5,
+    0xA2, 0x12, 0x92, 0x32, 0x73, 0x33, 0x62, 0x52, 0x53, 0x53, 0x42, 0x72, 0x32, 0x92, 0x13, 0x93,
+    0x03, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53, 0x56, 0x53,
+    0x52, 0x22, 0x53, 0x52, 0x23, 0x43, 0x43, 0x33, 0x33, 0x33, 0x5D, 0x89, 0xD3, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF1, 0x38, 0x66, 0xAA, 0x73, 0x63, 0x53, 0x83, 0x33, 0xA3, 0x22, 0xC2, 0x22,
+    0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x23, 0xA3, 0x32, 0xA2, 0x43,
+    0x83, 0x52, 0x82, 0x72, 0x62, 0x47, 0x4E, 0x47, 0x0F, 0x98, 0x7F, 0xB0, 0xC1, 0xE3, 0x81, 0xC6,
+    0x03, 0x8C, 0x03, 0x38, 0x06, 0x70, 0x0C, 0x60, 0x18, 0xC0, 0x71, 0x80, 0xE3, 0x83, 0xC3, 0xFD,
+    0xE1, 0xF1, 0xC0, 0x36, 0x69, 0x33, 0x43, 0x32, 0x63, 0x12, 0x82, 0x12, 0x82, 0x12, 0x82, 0x12,
+    0x72, 0x22, 0x62, 0x32, 0x34, 0x42, 0x36, 0x22, 0x73, 0x12, 0x85, 0x94, 0x94, 0x94, 0x87, 0x53,
+    0x1B, 0x22, 0x17, 0x32, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB0, 0x02, 0x92, 0x12, 0x72, 0x22, 0x72,
+    0x32, 0x53, 0x32, 0x52, 0x42, 0x52, 0x52, 0x32, 0x62, 0x32, 0x72, 0x22, 0x72, 0x12, 0x82, 0x12,
+    0x94, 0x93, 0xB2, 0xA2, 0xB2, 0xB2, 0xB2, 0xA3, 0xA3, 0x60, 0x55, 0x69, 0x42, 0x52, 0x42, 0xB2,
+    0xB3, 0xB3, 0xB4, 0x86, 0x63, 0x33, 0x32, 0x62, 0x22, 0x82, 0x12, 0x85, 0x85, 0x82, 0x12, 0x82,
+    0x12, 0x73, 0x14, 0x43, 0x39, 0x66, 0x30, 0x36, 0x29, 0x12, 0x52, 0x12, 0x82, 0x83, 0x86, 0x46,
+    0x32, 0x72, 0x82, 0x83, 0x61, 0x19, 0x36, 0x10, 0x0F, 0x57, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+    0x37, 0x27, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x47, 0x75, 0x77, 0x38, 0x28, 0x27, 0x37,
+    0x21, 0x02, 0x26, 0x22, 0x18, 0x14, 0x56, 0x66, 0x74, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0x82, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x0F, 0x80, 0xFE, 0x0E, 0x38, 0xE0, 0xE6, 0x03,
+    0x30, 0x19, 0x80, 0xCC, 0x06, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x76, 0x03, 0x30, 0x19, 0x80,
+    0xCC, 0x06, 0x70, 0x71, 0xC7, 0x07, 0xF0, 0x1F, 0x00, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60,
+    0xC1, 0x83, 0x07, 0x07, 0xE7, 0xC0, 0xC0, 0xD8, 0x33, 0x0C, 0x63, 0x8C, 0xE1, 0x98, 0x37, 0x07,
+    0xE0, 0xE6, 0x18, 0xE3, 0x0C, 0x60, 0xCC, 0x1D, 0x81, 0xC0, 0x14, 0xA5, 0xC3, 0xC2, 0xC2, 0xD2,
+    0xC2, 0xB4, 0xA4, 0x92, 0x12, 0x92, 0x13, 0x82, 0x22, 0x72, 0x32, 0x72, 0x42, 0x52, 0x52, 0x52,
+    0x53, 0x33, 0x62, 0x32, 0x72, 0x23, 0x76, 0x93, 0x02, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0x76, 0x67, 0x4D, 0x14, 0x15, 0x24, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA0, 0xC0, 0x1B,
+    0x00, 0xD8, 0x06, 0xC0, 0x33, 0x03, 0x98, 0x18, 0xE0, 0xC3, 0x06, 0x18, 0x60, 0xE3, 0x03, 0x30,
+    0x1B, 0x80, 0x78, 0x03, 0x80, 0x19, 0x19, 0x42, 0x62, 0x82, 0x72, 0x82, 0x83, 0x83, 0x87, 0x37,
+    0x23, 0x62, 0x82, 0x73, 0x73, 0x82, 0x83, 0x85, 0x67, 0x73, 0x82, 0x82, 0x82, 0x72, 0x10, 0x46,
+    0x78, 0x53, 0x43, 0x33, 0x63, 0x22, 0x82, 0x22, 0x82, 0x13, 0x86, 0x82, 0x22, 0x82, 0x22, 0x82,
+    0x23, 0x63, 0x33, 0x43, 0x58, 0x76, 0x40, 0x1F, 0xF1, 0x32, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x52, 0x74, 0x32,
+    0x74, 0x45, 0x69, 0x33, 0x43, 0x32, 0x72, 0x13, 0x72, 0x12, 0x82, 0x12, 0x85, 0x82, 0x12, 0x82,
+    0x12, 0x82, 0x12, 0x82, 0x14, 0x43, 0x2A, 0x32, 0x16, 0x42, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB0,
+    0x37, 0x28, 0x13, 0x54, 0x72, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x93, 0x77, 0x57, 0x73, 0x82,
+    0x82, 0x82, 0x72, 0x10, 0x07, 0xFC, 0x7F, 0xF3, 0x87, 0x1C, 0x0C, 0x60, 0x19, 0x80, 0x6E, 0x01,
+    0xB8, 0x06, 0x60, 0x19, 0x80, 0x67, 0x03, 0x8E, 0x1C, 0x3F, 0xE0, 0x3F, 0x00, 0x1F, 0x64, 0x29,
+    0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x39, 0x66, 0x50, 0xC0, 0x36, 0x01, 0xB0, 0x0D,
+    0x80, 0x6C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x37, 0x01, 0xB8, 0x1C, 0xE1, 0xC3, 0xFE,
+    0x0F, 0xC0, 0x10, 0x7C, 0x1C, 0x7F, 0x1C, 0x31, 0xCC, 0x38, 0x66, 0x18, 0x33, 0x0C, 0x1B, 0x86,
+    0x0F, 0xC3, 0x06, 0x61, 0x83, 0x30, 0xC1, 0x9C, 0x61, 0xC7, 0x33, 0xC1, 0xFF, 0xC0, 0x7F, 0x80,
+    0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x13, 0x72, 0x24,
+    0x52, 0x43, 0x52, 0x52, 0x42, 0x72, 0x32, 0x72, 0x22, 0x83, 0x12, 0x94, 0xA4, 0xB2, 0xB3, 0xA5,
+    0x92, 0x12, 0x83, 0x12, 0x82, 0x32, 0x62, 0x42, 0x62, 0x43, 0x42, 0x62, 0x42, 0x67, 0x84, 0x72,
+    0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x72, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x54,
+    0x52, 0x54, 0x52, 0x54, 0x52, 0x54, 0x52, 0x55, 0x42, 0x52, 0x12, 0x42, 0x42, 0x24, 0x22, 0x24,
+    0x3C, 0x68, 0xB2, 0xE2, 0xE2, 0xE2, 0xE2, 0xE2, 0x70, 0x30, 0x03, 0x1C, 0x00, 0xE6, 0x00, 0x19,
+    0x80, 0x06, 0x60, 0x01, 0x98, 0x30, 0x6E, 0x0C, 0x1F, 0x83, 0x07, 0x60, 0xC1, 0x98, 0x30, 0x66,
+    0x0C, 0x19, 0xC7, 0x8E, 0x3F, 0xFF, 0x07, 0x8F, 0x80, 0x7B, 0xEF, 0xFF, 0xF9, 0xE0, 0xE1, 0xC7,
+    0xE1, 0xC7, 0xE1, 0xC7, 0x66, 0x59, 0x43, 0x42, 0x33, 0x93, 0xA2, 0xB2, 0x9A, 0x3A, 0x52, 0xB2,
+    0x9A, 0x3A, 0x52, 0xB3, 0xB2, 0xB4, 0x51, 0x49, 0x66, 0x10,
+};
+
+static const Font GEEK_MAGIC_SANS_30 = {GEEK_MAGIC_SANS_30_GLYPHS, GEEK_MAGIC_SANS_30_BITMAPS, 227, 30, 24};
@@ -0,0 +1,702 @@
+// This file is auto-generated by scripts/fontconv.py from fonts/geekmagic-sans-40.bdf.
+// Please do not edit manually.
+#pragma once
+
+#include "display/Font.h"
+
+// 227 glyphs, 7363 bitmap bytes (12834 decoded), line height 40
+static const FontGlyph GEEK_MAGIC_SANS_40_GLYPHS[] PROGMEM = {
+    {0, 0x0020, 0, 0, 0, 0, 9, 0},  // ' '
+    {0, 0x0021, 5, 24, 2, 8, 9, 0},  // '!'
+    {15, 0x0022, 10, 9, 2, 8, 14, 0},  // '"'
+    {27, 0x0023, 20, 24, 1, 8, 22, 1},  // '#'
+    {74, 0x0024, 15, 28, 2, 6, 19, 1},  // '$'
+    {118, 0x0025, 24, 24, 2, 8, 28, 0},  // '%'
+    {190, 0x0026, 22, 24, 2, 8, 25, 1},  // '&'
+    {240, 0x0027, 3, 9, 2, 8, 8, 0},  // '\''
+    {244, 0x0028, 8, 29, 1, 8, 10, 0},  // '('
+    {273, 0x0029, 8, 29, 1, 8, 10, 0},  // ')'
+    {302, 0x002A, 16, 15, 1, 6, 19, 1},  // '*'
+    {326, 0x002B, 16, 16, 2, 11, 19, 1},  // '+'
+    {343, 0x002C, 5, 8, 1, 28, 8, 0},  // ','
+    {348, 0x002D, 9, 3, 1, 22, 11, 1},  // '-'
+    {350, 0x002E, 4, 5, 3, 27, 9, 0},  // '.'
+    {353, 0x002F, 12, 24, 0, 8, 12, 1},  // '/'
+    {378, 0x0030, 15, 24, 2, 8, 19, 1},  // '0'
+    {411, 0x0031, 9, 24, 3, 8, 19, 1},  // '1'
+    {437, 0x0032, 15, 24, 2, 8, 19, 1},  // '2'
+    {463, 0x0033, 15, 24, 2, 8, 19, 1},  // '3'
+    {491, 0x0034, 17, 24, 1, 8, 19, 1},  // '4'
+    {528, 0x0035, 15, 24, 2, 8, 19, 1},  // '5'
+    {554, 0x0036, 15, 24, 2, 8, 19, 1},  // '6'
+    {587, 0x0037, 15, 24, 2, 8, 19, 1},  // '7'
+    {612, 0x0038, 15, 24, 2, 8, 19, 1},  // '8'
+    {649, 0x0039, 15, 24, 2, 8, 19, 1},  // '9'
+    {681, 0x003A, 4, 19, 3, 13, 9, 0},  // ':'
+    {691, 0x003B, 5, 23, 1, 13, 9, 0},  // ';'
+    {706, 0x003C, 15, 17, 2, 11, 19, 1},  // '<'
+    {723, 0x003D, 15, 10, 2, 15, 19, 1},  // '='
+    {730, 0x003E, 15, 17, 2, 11, 19, 1},  // '>'
+    {748, 0x003F, 13, 24, 1, 8, 15, 1},  // '?'
+    {773, 0x0040, 27, 27, 2, 8, 31, 1},  // '@'
+    {840, 0x0041, 22, 24, 0, 8, 22, 1},  // 'A'
+    {886, 0x0042, 17, 24, 3, 8, 22, 1},  // 'B'
+    {923, 0x0043, 18, 24, 2, 8, 21, 1},  // 'C'
+    {957, 0x0044, 20, 24, 3, 8, 25, 1},  // 'D'
+    {995, 0x0045, 14, 24, 3, 8, 19, 1},  // 'E'
+    {1018, 0x0046, 14, 24, 3, 8, 18, 1},  // 'F'
+    {1041, 0x0047, 20, 24, 2, 8, 25, 1},  // 'G'
+    {1080, 0x0048, 19, 24, 3, 8, 25, 1},  // 'H'
+    {1104, 0x0049, 3, 24, 3, 8, 9, 1},  // 'I'
+    {1107, 0x004A, 9, 30, -3, 8, 9, 1},  // 'J'
+    {1138, 0x004B, 18, 24, 3, 8, 21, 1},  // 'K'
+    {1185, 0x004C, 14, 24, 3, 8, 18, 1},  // 'L'
+    {1209, 0x004D, 25, 24, 3, 8, 31, 1},  // 'M'
+    {1271, 0x004E, 20, 24, 3, 8, 26, 1},  // 'N'
+    {1310, 0x004F, 22, 24, 2, 8, 26, 1},  // 'O'
+    {1352, 0x0050, 15, 24, 3, 8, 20, 1},  // 'P'
+    {1380, 0x0051, 22, 29, 2, 8, 26, 1},  // 'Q'
+    {1429, 0x0052, 17, 24, 3, 8, 21, 1},  // 'R'
+    {1472, 0x0053, 15, 24, 2, 8, 19, 1},  // 'S'
+    {1498, 0x0054, 19, 24, 0, 8, 19, 1},  // 'T'
+    {1533, 0x0055, 19, 24, 3, 8, 25, 1},  // 'U'
+    {1563, 0x0056, 20, 24, 0, 8, 20, 1},  // 'V'
+    {1608, 0x0057, 29, 24, 1, 8, 31, 1},  // 'W'
+    {1689, 0x0058, 20, 24, 0, 8, 20, 1},  // 'X'
+    {1734, 0x0059, 19, 24, 0, 8, 19, 1},  // 'Y'
+    {1776, 0x005A, 17, 24, 1, 8, 19, 1},  // 'Z'
+    {1801, 0x005B, 7, 29, 3, 8, 11, 0},  // '['
+    {1827, 0x005C, 11, 24, 1, 8, 12, 1},  // '\\'
+    {1851, 0x005D, 7, 29, 1, 8, 11, 0},  // ']'
+    {1877, 0x005E, 16, 15, 1, 8, 18, 1},  // '^'
+    {1904, 0x005F, 15, 2, -1, 35, 15, 1},  // '_'
+    {1906, 0x0060, 6, 5, 7, 6, 20, 0},  // '`'
+    {1910, 0x0061, 14, 19, 2, 13, 19, 1},  // 'a'
+    {1934, 0x0062, 16, 26, 3, 6, 21, 1},  // 'b'
+    {1972, 0x0063, 13, 19, 2, 13, 16, 1},  // 'c'
+    {1994, 0x0064, 16, 26, 2, 6, 21, 1},  // 'd'
+    {2031, 0x0065, 15, 19, 2, 13, 19, 1},  // 'e'
+    {2053, 0x0066, 13, 26, 0, 6, 12, 1},  // 'f'
+    {2080, 0x0067, 17, 27, 1, 13, 19, 1},  // 'g'
+    {2119, 0x0068, 15, 26, 3, 6, 21, 1},  // 'h'
+    {2149, 0x0069, 3, 26, 3, 6, 9, 1},  // 'i'
+    {2153, 0x006A, 8, 34, -2, 6, 9, 1},  // 'j'
+    {2185, 0x006B, 14, 26, 3, 6, 18, 1},  // 'k'
+    {2226, 0x006C, 3, 26, 3, 6, 9, 1},  // 'l'
+    {2230, 0x006D, 26, 19, 3, 13, 32, 1},  // 'm'
+    {2273, 0x006E, 15, 19, 3, 13, 21, 1},  // 'n'
+    {2296, 0x006F, 17, 19, 2, 13, 21, 1},  // 'o'
+    {2325, 0x0070, 16, 27, 3, 13, 21, 1},  // 'p'
+    {2363, 0x0071, 16, 27, 2, 13, 21, 1},  // 'q'
+    {2401, 0x0072, 10, 19, 3, 13, 14, 1},  // 'r'
+    {2422, 0x0073, 12, 19, 2, 13, 16, 1},  // 's'
+    {2442, 0x0074, 10, 23, 1, 9, 12, 1},  // 't'
+    {2465, 0x0075, 15, 19, 3, 13, 21, 1},  // 'u'
+    {2488, 0x0076, 17, 19, 0, 13, 17, 1},  // 'v'
+    {2524, 0x0077, 26, 19, 0, 13, 26, 0},  // 'w'
+    {2586, 0x0078, 16, 19, 1, 13, 18, 1},  // 'x'
+    {2619, 0x0079, 17, 27, 0, 13, 17, 1},  // 'y'
+    {2663, 0x007A, 14, 19, 1, 13, 16, 1},  // 'z'
+    {2682, 0x007B, 11, 29, 1, 8, 13, 1},  // '{'
+    {2711, 0x007C, 3, 34, 8, 6, 19, 1},  // '|'
+    {2715, 0x007D, 11, 29, 1, 8, 13, 1},  // '}'
+    {2745, 0x007E, 15, 4, 2, 18, 19, 1},  // '~'
+    {2751, 0x00A0, 0, 0, 0, 0, 9, 0},  // U+00A0
+    {2751, 0x00A1, 5, 25, 2, 13, 9, 0},  // U+00A1
+    {2767, 0x00A2, 13, 24, 3, 8, 19, 1},  // U+00A2
+    {2794, 0x00A3, 17, 24, 1, 8, 19, 1},  // U+00A3
+    {2819, 0x00A5, 17, 24, 1, 8, 19, 1},  // U+00A5
+    {2855, 0x00A7, 14, 26, 2, 6, 18, 1},  // U+00A7
+    {2890, 0x00A9, 24, 24, 2, 8, 28, 1},  // U+00A9
+    {2944, 0x00AB, 13, 14, 2, 16, 17, 0},  // U+00AB
+    {2967, 0x00B0, 11, 10, 2, 8, 15, 0},  // U+00B0
+    {2981, 0x00B1, 16, 20, 2, 11, 19, 1},  // U+00B1
+    {3002, 0x00B2, 10, 15, 1, 8, 12, 1},  // U+00B2
+    {3018, 0x00B3, 10, 15, 1, 8, 12, 1},  // U+00B3
+    {3034, 0x00B5, 15, 27, 3, 13, 21, 1},  // U+00B5
+    {3063, 0x00B7, 4, 5, 3, 18, 9, 0},  // U+00B7
+    {3066, 0x00BB, 13, 14, 2, 16, 17, 0},  // U+00BB
+    {3089, 0x00BF, 13, 25, 1, 13, 15, 1},  // U+00BF
+    {3115, 0x00C0, 22, 32, 0, 0, 22, 1},  // U+00C0
+    {3170, 0x00C1, 22, 32, 0, 0, 22, 1},  // U+00C1
+    {3225, 0x00C2, 22, 32, 0, 0, 22, 1},  // U+00C2
+    {3282, 0x00C3, 22, 31, 0, 1, 22, 1},  // U+00C3
+    {3338, 0x00C4, 22, 30, 0, 2, 22, 1},  // U+00C4
+    {3392, 0x00C5, 22, 30, 0, 2, 22, 1},  // U+00C5
+    {3449, 0x00C6, 28, 24, -1, 8, 30, 1},  // U+00C6
+    {3499, 0x00C7, 18, 32, 2, 8, 21, 1},  // U+00C7
+    {3543, 0x00C8, 14, 32, 3, 0, 19, 1},  // U+00C8
+    {3572, 0x00C9, 14, 32, 3, 0, 19, 1},  // U+00C9
+    {3601, 0x00CA, 14, 32, 3, 0, 19, 1},  // U+00CA
+    {3632, 0x00CB, 14, 30, 3, 2, 19, 1},  // U+00CB
+    {3662, 0x00CC, 6, 32, 1, 0, 9, 0},  // U+00CC
+    {3686, 0x00CD, 6, 32, 3, 0, 9, 0},  // U+00CD
+    {3710, 0x00CE, 10, 32, 0, 0, 9, 1},  // U+00CE
+    {3743, 0x00CF, 10, 30, 0, 2, 9, 1},  // U+00CF
+    {3775, 0x00D0, 22, 24, 1, 8, 25, 1},  // U+00D0
+    {3819, 0x00D1, 20, 31, 3, 1, 26, 1},  // U+00D1
+    {3868, 0x00D2, 22, 32, 2, 0, 26, 1},  // U+00D2
+    {3919, 0x00D3, 22, 32, 2, 0, 26, 1},  // U+00D3
+    {3970, 0x00D4, 22, 32, 2, 0, 26, 1},  // U+00D4
+    {4023, 0x00D5, 22, 31, 2, 1, 26, 1},  // U+00D5
+    {4075, 0x00D6, 22, 30, 2, 2, 26, 1},  // U+00D6
+    {4125, 0x00D7, 15, 15, 2, 11, 19, 1},  // U+00D7
+    {4153, 0x00D8, 22, 26, 2, 7, 26, 1},  // U+00D8
+    {4211, 0x00D9, 19, 32, 3, 0, 25, 1},  // U+00D9
+    {4250, 0x00DA, 19, 32, 3, 0, 25, 1},  // U+00DA
+    {4289, 0x00DB, 19, 32, 3, 0, 25, 1},  // U+00DB
+    {4328, 0x00DC, 19, 30, 3, 2, 25, 1},  // U+00DC
+    {4366, 0x00DD, 19, 32, 0, 0, 19, 1},  // U+00DD
+    {4417, 0x00DE, 16, 24, 3, 8, 21, 1},  // U+00DE
+    {4445, 0x00DF, 16, 26, 3, 6, 21, 1},  // U+00DF
+    {4490, 0x00E0, 14, 26, 2, 6, 19, 1},  // U+00E0
+    {4520, 0x00E1, 14, 26, 2, 6, 19, 1},  // U+00E1
+    {4550, 0x00E2, 14, 26, 2, 6, 19, 1},  // U+00E2
+    {4582, 0x00E3, 14, 25, 2, 7, 19, 1},  // U+00E3
+    {4615, 0x00E4, 14, 24, 2, 8, 19, 1},  // U+00E4
+    {4646, 0x00E5, 14, 28, 2, 4, 19, 1},  // U+00E5
+    {4681, 0x00E6, 25, 19, 2, 12, 29, 1},  // U+00E6
+    {4723, 0x00E7, 13, 27, 2, 13, 16, 1},  // U+00E7
+    {4753, 0x00E8, 15, 26, 2, 6, 19, 1},  // U+00E8
+    {4781, 0x00E9, 15, 26, 2, 6, 19, 1},  // U+00E9
+    {4809, 0x00EA, 15, 26, 2, 6, 19, 1},  // U+00EA
+    {4839, 0x00EB, 15, 24, 2, 8, 19, 1},  // U+00EB
+    {4868, 0x00EC, 6, 26, -1, 6, 9, 0},  // U+00EC
+    {4888, 0x00ED, 6, 26, 3, 6, 9, 0},  // U+00ED
+    {4908, 0x00EE, 10, 26, -1, 6, 9, 1},  // U+00EE
+    {4935, 0x00EF, 10, 24, 0, 8, 9, 1},  // U+00EF
+    {4961, 0x00F0, 16, 26, 2, 6, 20, 1},  // U+00F0
+    {4998, 0x00F1, 15, 25, 3, 7, 21, 1},  // U+00F1
+    {5030, 0x00F2, 17, 26, 2, 6, 21, 1},  // U+00F2
+    {5067, 0x00F3, 17, 26, 2, 6, 21, 1},  // U+00F3
+    {5102, 0x00F4, 17, 26, 2, 6, 21, 1},  // U+00F4
+    {5139, 0x00F5, 17, 25, 2, 7, 21, 1},  // U+00F5
+    {5177, 0x00F6, 17, 24, 2, 8, 21, 1},  // U+00F6
+    {5213, 0x00F7, 15, 16, 2, 12, 19, 1},  // U+00F7
+    {5227, 0x00F8, 17, 21, 2, 12, 21, 1},  // U+00F8
+    {5269, 0x00F9, 15, 26, 3, 6, 21, 1},  // U+00F9
+    {5298, 0x00FA, 15, 26, 3, 6, 21, 1},  // U+00FA
+    {5327, 0x00FB, 15, 26, 3, 6, 21, 1},  // U+00FB
+    {5358, 0x00FC, 15, 24, 3, 8, 21, 1},  // U+00FC
+    {5388, 0x00FD, 17, 34, 0, 6, 17, 1},  // U+00FD
+    {5438, 0x00FE, 16, 34, 3, 6, 21, 1},  // U+00FE
+    {5483, 0x00FF, 17, 32, 0, 8, 17, 1},  // U+00FF
+    {5534, 0x0391, 22, 24, 0, 8, 22, 1},  // U+0391
+    {5580, 0x0392, 17, 24, 3, 8, 22, 1},  // U+0392
+    {5617, 0x0393, 14, 24, 3, 8, 18, 1},  // U+0393
+    {5641, 0x0394, 17, 24, 1, 8, 19, 1},  // U+0394
+    {5682, 0x0395, 14, 24, 3, 8, 19, 1},  // U+0395
+    {5705, 0x0396, 17, 24, 1, 8, 19, 1},  // U+0396
+    {5730, 0x0397, 19, 24, 3, 8, 25, 1},  // U+0397
+    {5754, 0x0398, 22, 24, 2, 8, 26, 1},  // U+0398
+    {5797, 0x0399, 3, 24, 3, 8, 9, 1},  // U+0399
+    {5800, 0x039A, 18, 24, 3, 8, 21, 1},  // U+039A
+    {5847, 0x039B, 21, 24, 0, 8, 21, 1},  // U+039B
+    {5895, 0x039C, 25, 24, 3, 8, 31, 1},  // U+039C
+    {5957, 0x039D, 20, 24, 3, 8, 26, 1},  // U+039D
+    {5996, 0x039E, 17, 24, 1, 8, 19, 1},  // U+039E
+    {6013, 0x039F, 22, 24, 2, 8, 26, 1},  // U+039F
+    {6055, 0x03A0, 19, 24, 3, 8, 25, 1},  // U+03A0
+    {6079, 0x03A1, 15, 24, 3, 8, 20, 1},  // U+03A1
+    {6107, 0x03A3, 17, 24, 1, 8, 19, 1},  // U+03A3
+    {6133, 0x03A4, 19, 24, 0, 8, 19, 1},  // U+03A4
+    {6168, 0x03A5, 19, 24, 0, 8, 19, 1},  // U+03A5
+    {6210, 0x03A6, 23, 24, 2, 8, 27, 1},  // U+03A6
+    {6259, 0x03A7, 20, 24, 0, 8, 20, 1},  // U+03A7
+    {6304, 0x03A8, 23, 24, 2, 8, 27, 1},  // U+03A8
+    {6351, 0x03A9, 25, 24, 1, 8, 27, 1},  // U+03A9
+    {6403, 0x03B1, 19, 19, 2, 13, 21, 1},  // U+03B1
+    {6443, 0x03B2, 16, 34, 3, 6, 21, 1},  // U+03B2
+    {6493, 0x03B3, 17, 27, 0, 13, 17, 1},  // U+03B3
+    {6536, 0x03B4, 17, 26, 2, 6, 20, 1},  // U+03B4
+    {6573, 0x03B5, 14, 19, 1, 13, 16, 1},  // U+03B5
+    {6595, 0x03B6, 13, 32, 2, 6, 16, 1},  // U+03B6
+    {6628, 0x03B7, 15, 27, 3, 13, 21, 1},  // U+03B7
+    {6659, 0x03B8, 16, 26, 2, 6, 20, 1},  // U+03B8
+    {6696, 0x03B9, 8, 19, 3, 13, 12, 0},  // U+03B9
+    {6715, 0x03BA, 14, 19, 3, 13, 18, 0},  // U+03BA
+    {6749, 0x03BB, 18, 26, -1, 6, 18, 1},  // U+03BB
+    {6792, 0x03BC, 15, 27, 3, 13, 21, 1},  // U+03BC
+    {6821, 0x03BD, 17, 19, 0, 13, 18, 1},  // U+03BD
+    {6858, 0x03BE, 13, 32, 2, 6, 16, 1},  // U+03BE
+    {6891, 0x03BF, 17, 19, 2, 13, 21, 1},  // U+03BF
+    {6920, 0x03C0, 21, 19, 0, 13, 22, 1},  // U+03C0
+    {6957, 0x03C1, 16, 27, 3, 13, 21, 1},  // U+03C1
+    {6993, 0x03C2, 13, 25, 2, 13, 16, 1},  // U+03C2
+    {7020, 0x03C3, 18, 19, 2, 13, 21, 1},  // U+03C3
+    {7055, 0x03C4, 15, 19, 0, 13, 16, 1},  // U+03C4
+    {7074, 0x03C5, 16, 19, 3, 13, 21, 1},  // U+03C5
+    {7100, 0x03C6, 20, 27, 2, 13, 24, 1},  // U+03C6
+    {7155, 0x03C7, 19, 27, -1, 13, 19, 1},  // U+03C7
+    {7203, 0x03C8, 21, 34, 3, 6, 26, 1},  // U+03C8
+    {7271, 0x03C9, 22, 19, 2, 13, 26, 1},  // U+03C9
+    {7312, 0x2022, 7, 8, 3, 15, 13, 1},  // U+2022
+    {7317, 0x2026, 22, 5, 3, 27, 27, 0},  // U+2026
+    {7331, 0x20AC, 18, 24, 1, 8, 20, 1},  // U+20AC
+};
+
+static const uint8_t GEEK_MAGIC_SANS_40_BITMAPS[] PROGMEM = {
+    0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x38, 0xC4, 0x20, 0x00, 0xE7, 0x7D, 0xCE, 0xE1,
+    0xF8, 0x7E, 0x1D, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x80, 0x73, 0x52, 0xA3, 0x52, 0xA2,
+    0x53, 0xA2, 0x52, 0xB2, 0x52, 0xA3, 0x52, 0xA3, 0x52, 0x5F, 0x41, 0xF4, 0x62, 0x52, 0xA3, 0x52,
+    0xA3, 0x52, 0xA2, 0x53, 0xA2, 0x52, 0xB2, 0x52, 0x6F, 0x41, 0xF4, 0x52, 0x53, 0xA2, 0x53, 0xA2,
+    0x52, 0xB2, 0x52, 0xA3, 0x52, 0xA2, 0x53, 0xA2, 0x53, 0x70, 0x63, 0xC3, 0xC3, 0xA9, 0x4C, 0x24,
+    0x13, 0x23, 0x23, 0x23, 0x63, 0x33, 0x63, 0x33, 0x73, 0x23, 0x73, 0x23, 0x87, 0x96, 0xC5, 0xA7,
+    0x83, 0x23, 0x73, 0x33, 0x63, 0x33, 0x63, 0x33, 0x63, 0x33, 0x63, 0x23, 0x13, 0x33, 0x14, 0x1D,
+    0x48, 0xB3, 0xC3, 0xC3, 0xC3, 0x60, 0x3E, 0x00, 0x70, 0x7F, 0x00, 0x60, 0x63, 0x80, 0xE0, 0xE1,
+    0x80, 0xC0, 0xC1, 0x81, 0x80, 0xC1, 0xC3, 0x80, 0xC1, 0xC3, 0x00, 0xC1, 0xC7, 0x00, 0xC1, 0xC6,
+    0x00, 0xC1, 0x8E, 0x78, 0xC1, 0x8C, 0xFE, 0xE1, 0x9D, 0xC6, 0x63, 0x99, 0x87, 0x7F, 0x31, 0x83,
+    0x1E, 0x73, 0x83, 0x00, 0x63, 0x83, 0x00, 0xE3, 0x83, 0x00, 0xC3, 0x83, 0x01, 0xC3, 0x83, 0x01,
+    0x81, 0x83, 0x03, 0x01, 0x87, 0x07, 0x01, 0xC6, 0x06, 0x00, 0xFE, 0x0E, 0x00, 0x7C, 0x56, 0xF0,
+    0x9C, 0x34, 0x4A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3A, 0x36, 0x3B, 0x34, 0x4B, 0x42, 0x4D, 0x8F,
+    0x05, 0xF1, 0x6E, 0x97, 0x32, 0x43, 0x46, 0x32, 0x35, 0x45, 0x31, 0x37, 0x43, 0x32, 0x38, 0x42,
+    0x32, 0x39, 0x73, 0x3A, 0x63, 0x3B, 0x44, 0x49, 0x64, 0x46, 0x41, 0x44, 0xC4, 0x35, 0x78, 0x30,
+    0xFD, 0xB6, 0xDB, 0x60, 0x07, 0x0E, 0x0C, 0x1C, 0x38, 0x38, 0x38, 0x70, 0x70, 0x70, 0x70, 0x60,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x70, 0x70, 0x70, 0x70, 0x38, 0x38, 0x38, 0x1C, 0x1C, 0x0E,
+    0x07, 0xE0, 0x70, 0x30, 0x38, 0x1C, 0x1C, 0x1C, 0x0E, 0x0E, 0x0E, 0x0E, 0x06, 0x07, 0x07, 0x07,
+    0x07, 0x07, 0x06, 0x0E, 0x0E, 0x0E, 0x0E, 0x1C, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0xE0, 0x73, 0xD3,
+    0xD3, 0xD3, 0xD3, 0x73, 0x32, 0x43, 0x1F, 0xF1, 0x64, 0xC2, 0x12, 0xA3, 0x13, 0x83, 0x33, 0x64,
+    0x33, 0x63, 0x53, 0x71, 0x51, 0x40, 0x63, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x7F, 0xF2, 0x63,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x70, 0x3B, 0x9C, 0xE6, 0x33, 0x98, 0x0F, 0xC0, 0xEE, 0xFE,
+    0xE0, 0x93, 0x83, 0x93, 0x92, 0x93, 0x93, 0x92, 0x93, 0x93, 0x92, 0x93, 0x93, 0x83, 0x93, 0x92,
+    0x93, 0x93, 0x92, 0x93, 0x93, 0x92, 0x93, 0x93, 0x83, 0x90, 0x55, 0x89, 0x53, 0x53, 0x33, 0x73,
+    0x23, 0x73, 0x13, 0x92, 0x13, 0x96, 0x96, 0x96, 0x95, 0xA5, 0xA5, 0xA5, 0xA6, 0x96, 0x96, 0x96,
+    0x96, 0x93, 0x13, 0x73, 0x23, 0x73, 0x33, 0x53, 0x59, 0x86, 0x40, 0x63, 0x45, 0x36, 0x27, 0x13,
+    0x26, 0x33, 0x11, 0x43, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x46, 0x6B, 0x34, 0x54, 0x32, 0x83, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xB3, 0xB4, 0xA4, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xCF, 0xF0, 0x38,
+    0x5B, 0x34, 0x63, 0x31, 0x93, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0xB3, 0x68, 0x79, 0xC4, 0xD3, 0xD3,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB3, 0x12, 0x74, 0x2C, 0x49, 0x50, 0xB3, 0xD4, 0xC5, 0xB6, 0xB2,
+    0x13, 0xA3, 0x13, 0x93, 0x23, 0x92, 0x33, 0x83, 0x33, 0x73, 0x43, 0x63, 0x53, 0x63, 0x53, 0x53,
+    0x63, 0x43, 0x73, 0x43, 0x73, 0x33, 0x83, 0x3F, 0xF4, 0xB3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x30,
+    0x2B, 0x3C, 0x33, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xDA, 0x5B, 0xC5, 0xC3, 0xD3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xB3, 0xC3, 0x13, 0x64, 0x2C, 0x58, 0x50, 0x77, 0x69, 0x45, 0xA3, 0xB3, 0xB3,
+    0xC3, 0xC2, 0xC3, 0xC3, 0x35, 0x43, 0x19, 0x26, 0x44, 0x14, 0x86, 0x96, 0x96, 0xA5, 0xA5, 0xA2,
+    0x12, 0x93, 0x13, 0x83, 0x13, 0x73, 0x34, 0x44, 0x4A, 0x76, 0x40, 0x0F, 0xF0, 0xC3, 0xC3, 0xB3,
+    0xC3, 0xB3, 0xC3, 0xB4, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB3, 0xC3, 0xB4, 0xB3, 0xC3, 0xB3,
+    0xC3, 0xB3, 0xC3, 0x90, 0x47, 0x6B, 0x34, 0x54, 0x23, 0x73, 0x22, 0x92, 0x13, 0x93, 0x12, 0x92,
+    0x23, 0x73, 0x24, 0x53, 0x44, 0x33, 0x77, 0x87, 0x64, 0x25, 0x33, 0x64, 0x13, 0x87, 0x96, 0x95,
+    0xB4, 0xA6, 0x96, 0x93, 0x14, 0x54, 0x3B, 0x67, 0x40, 0x46, 0x7A, 0x44, 0x44, 0x33, 0x73, 0x13,
+    0x83, 0x13, 0x96, 0x95, 0xA5, 0xA6, 0x96, 0x97, 0x74, 0x14, 0x55, 0x29, 0x13, 0x45, 0x33, 0xC3,
+    0xC3, 0xB3, 0xC3, 0xB3, 0xB4, 0xA4, 0x49, 0x67, 0x70, 0xEE, 0xFE, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0xEE, 0xFE, 0xE0, 0x39, 0xDE, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3B, 0x9C, 0xE6,
+    0x73, 0x00, 0xE1, 0xC3, 0xA5, 0x94, 0x94, 0x94, 0x94, 0x94, 0xA3, 0xC4, 0xC5, 0xC6, 0xB6, 0xC5,
+    0xC5, 0xC3, 0xE1, 0x0F, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x01, 0xE3, 0xC4, 0xD4, 0xD4, 0xD4,
+    0xD4, 0xD4, 0xD3, 0xB4, 0x95, 0x76, 0x75, 0x85, 0x85, 0xA3, 0xC1, 0xE0, 0x28, 0x3B, 0x23, 0x63,
+    0xB3, 0xA3, 0xA3, 0xA3, 0xA3, 0x93, 0x94, 0x84, 0x83, 0x93, 0x93, 0xA2, 0xB2, 0xB2, 0xFF, 0x72,
+    0xA4, 0x94, 0x94, 0xA2, 0x70, 0xA9, 0xF1, 0xDC, 0x57, 0x59, 0x3C, 0x47, 0x3F, 0x03, 0x53, 0xF2,
+    0x24, 0x3F, 0x33, 0x32, 0x78, 0x52, 0x23, 0x69, 0x53, 0x12, 0x63, 0x52, 0x56, 0x53, 0x62, 0x65,
+    0x43, 0x72, 0x64, 0x53, 0x72, 0x64, 0x53, 0x72, 0x64, 0x53, 0x63, 0x55, 0x53, 0x63, 0x52, 0x12,
+    0x53, 0x63, 0x52, 0x13, 0x53, 0x45, 0x32, 0x23, 0x58, 0x27, 0x32, 0x75, 0x44, 0x53, 0xFA, 0x2F,
+    0xA3, 0xFA, 0x4F, 0x96, 0x64, 0xDE, 0xF0, 0x9A, 0xA2, 0xF4, 0x4F, 0x34, 0xF2, 0x6F, 0x16, 0xF1,
+    0x22, 0x2F, 0x03, 0x23, 0xE3, 0x32, 0xD3, 0x43, 0xC3, 0x43, 0xC2, 0x63, 0xA3, 0x63, 0xA3, 0x63,
+    0x93, 0x83, 0x8E, 0x7F, 0x16, 0x3A, 0x36, 0x2C, 0x25, 0x3C, 0x34, 0x3C, 0x33, 0x3E, 0x32, 0x3E,
+    0x32, 0x2F, 0x03, 0x13, 0xF1, 0x30, 0x0C, 0x5E, 0x33, 0x84, 0x23, 0xA3, 0x13, 0xA3, 0x13, 0xA3,
+    0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0x84, 0x2D, 0x4E, 0x33, 0x84, 0x23, 0xA3, 0x13, 0xB6,
+    0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xA3, 0x13, 0x85, 0x1E, 0x3C, 0x50, 0x88, 0x7D, 0x45, 0x62, 0x43,
+    0xE3, 0xE4, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03,
+    0xF1, 0x3F, 0x03, 0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x05, 0x72, 0x6C, 0x89, 0x20, 0x0C, 0x8F, 0x05,
+    0x38, 0x54, 0x3A, 0x43, 0x3B, 0x42, 0x3C, 0x41, 0x3D, 0x31, 0x3D, 0x31, 0x3E, 0x6E, 0x6E, 0x6E,
+    0x6E, 0x6E, 0x6E, 0x6D, 0x31, 0x3D, 0x31, 0x3D, 0x31, 0x3C, 0x32, 0x3B, 0x42, 0x3A, 0x43, 0x38,
+    0x54, 0xE6, 0xC8, 0x0F, 0xF1, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBD, 0x1D, 0x13, 0xB3,
+    0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBF, 0xD0, 0x0F, 0xF1, 0xB3, 0xB3, 0xB3, 0xB3,
+    0xB3, 0xB3, 0xB3, 0xB3, 0xBF, 0xF1, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+    0xB0, 0x99, 0x8E, 0x45, 0x73, 0x44, 0xF0, 0x4F, 0x13, 0xF1, 0x3F, 0x23, 0xF1, 0x3F, 0x23, 0xF2,
+    0x3F, 0x23, 0x9B, 0x9B, 0xF0, 0x5F, 0x05, 0xF0, 0x21, 0x3E, 0x21, 0x3E, 0x21, 0x4D, 0x22, 0x4C,
+    0x23, 0x4B, 0x24, 0x58, 0x35, 0xF0, 0x8A, 0x20, 0x03, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xDF, 0xFE, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3,
+    0x0F, 0xFF, 0xFC, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+    0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x17,
+    0x26, 0x30, 0x03, 0xB3, 0x13, 0xA3, 0x23, 0x93, 0x33, 0x83, 0x43, 0x73, 0x53, 0x63, 0x63, 0x54,
+    0x63, 0x44, 0x73, 0x34, 0x83, 0x24, 0x93, 0x14, 0xA3, 0x15, 0x99, 0x94, 0x33, 0x83, 0x44, 0x73,
+    0x54, 0x63, 0x63, 0x63, 0x73, 0x53, 0x74, 0x43, 0x84, 0x33, 0x93, 0x33, 0xA3, 0x23, 0xA4, 0x13,
+    0xB4, 0x03, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+    0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBF, 0xD0, 0x05, 0xF0, 0xAF, 0x0B, 0xDC, 0xD9, 0x12,
+    0xD2, 0x16, 0x13, 0xB3, 0x16, 0x13, 0xB2, 0x26, 0x23, 0x93, 0x26, 0x23, 0x93, 0x26, 0x32, 0x92,
+    0x36, 0x33, 0x73, 0x36, 0x33, 0x72, 0x46, 0x43, 0x53, 0x46, 0x43, 0x53, 0x46, 0x43, 0x52, 0x56,
+    0x53, 0x33, 0x56, 0x53, 0x33, 0x56, 0x63, 0x13, 0x66, 0x63, 0x13, 0x66, 0x63, 0x12, 0x76, 0x75,
+    0x76, 0x75, 0x76, 0x83, 0x86, 0x83, 0x83, 0x04, 0xD8, 0xC8, 0xC9, 0xBA, 0xA6, 0x13, 0xA6, 0x23,
+    0x96, 0x24, 0x86, 0x33, 0x86, 0x43, 0x76, 0x44, 0x66, 0x53, 0x66, 0x63, 0x56, 0x64, 0x46, 0x73,
+    0x46, 0x83, 0x36, 0x84, 0x26, 0x93, 0x26, 0xA3, 0x16, 0xAA, 0xB9, 0xC8, 0xC8, 0xD4, 0x78, 0xCC,
+    0x94, 0x64, 0x73, 0xA3, 0x53, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x13, 0xF1, 0x6F, 0x16,
+    0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x13, 0x13, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x33,
+    0xC3, 0x53, 0xA3, 0x65, 0x64, 0x9C, 0xC8, 0x70, 0x0B, 0x4D, 0x23, 0x65, 0x13, 0x87, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x83, 0x13, 0x65, 0x1C, 0x3A, 0x53, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0xC0, 0x78, 0xCC, 0x94, 0x64, 0x73, 0xA3, 0x53, 0xC3, 0x33, 0xE3, 0x23, 0xE3,
+    0x23, 0xE3, 0x13, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x13, 0x13,
+    0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x33, 0xC3, 0x53, 0xA3, 0x65, 0x64, 0x9C, 0xC8, 0xF4, 0x4F, 0x44,
+    0xF4, 0x4F, 0x44, 0xF4, 0x42, 0x0B, 0x6D, 0x43, 0x74, 0x33, 0x93, 0x23, 0x93, 0x23, 0xA3, 0x13,
+    0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0x93, 0x23, 0x93, 0x23, 0x74, 0x3D, 0x4B, 0x63, 0x54, 0x53,
+    0x63, 0x53, 0x73, 0x43, 0x73, 0x43, 0x83, 0x33, 0x84, 0x23, 0x93, 0x23, 0xA3, 0x13, 0xA7, 0xB3,
+    0x49, 0x4D, 0x14, 0x63, 0x23, 0xB3, 0xC3, 0xC3, 0xC3, 0xD3, 0xC4, 0xC6, 0xA7, 0xB6, 0xB6, 0xC4,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xB7, 0x74, 0x1D, 0x3A, 0x40, 0x0F, 0xF8, 0x83, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1,
+    0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x38, 0x03, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3,
+    0x12, 0xD2, 0x23, 0xB3, 0x33, 0x93, 0x44, 0x74, 0x6B, 0xA7, 0x60, 0x03, 0xE3, 0x12, 0xD3, 0x23,
+    0xC3, 0x23, 0xC3, 0x33, 0xA3, 0x43, 0xA3, 0x43, 0xA3, 0x53, 0x83, 0x63, 0x83, 0x63, 0x83, 0x73,
+    0x63, 0x83, 0x63, 0x83, 0x63, 0x93, 0x43, 0xA3, 0x43, 0xB2, 0x33, 0xC3, 0x23, 0xC3, 0x23, 0xD2,
+    0x22, 0xE6, 0xE6, 0xF0, 0x4F, 0x14, 0xF1, 0x48, 0x03, 0xA3, 0xA6, 0x94, 0xA6, 0x95, 0x96, 0x95,
+    0x93, 0x13, 0x82, 0x12, 0x83, 0x23, 0x73, 0x13, 0x73, 0x23, 0x73, 0x13, 0x73, 0x23, 0x72, 0x23,
+    0x73, 0x33, 0x53, 0x32, 0x63, 0x43, 0x53, 0x33, 0x53, 0x43, 0x53, 0x33, 0x53, 0x43, 0x52, 0x52,
+    0x53, 0x53, 0x33, 0x53, 0x33, 0x63, 0x33, 0x53, 0x33, 0x63, 0x32, 0x72, 0x33, 0x72, 0x23, 0x73,
+    0x22, 0x83, 0x13, 0x73, 0x13, 0x83, 0x12, 0x83, 0x13, 0x83, 0x12, 0x92, 0x13, 0x95, 0x92, 0x12,
+    0xA5, 0x95, 0xA4, 0xB4, 0xA4, 0xB4, 0xB3, 0xB3, 0x60, 0x13, 0xC3, 0x33, 0xA3, 0x44, 0x93, 0x53,
+    0x83, 0x73, 0x63, 0x83, 0x63, 0x93, 0x43, 0xB3, 0x23, 0xC3, 0x23, 0xD6, 0xF0, 0x4F, 0x14, 0xF1,
+    0x4F, 0x06, 0xD3, 0x23, 0xC3, 0x23, 0xB3, 0x43, 0x93, 0x54, 0x83, 0x63, 0x73, 0x83, 0x53, 0x94,
+    0x43, 0xA3, 0x33, 0xC3, 0x14, 0xC4, 0x03, 0xD3, 0x13, 0xB3, 0x23, 0xB3, 0x33, 0x93, 0x43, 0x93,
+    0x53, 0x73, 0x73, 0x53, 0x83, 0x53, 0x93, 0x33, 0xA3, 0x33, 0xB3, 0x13, 0xC3, 0x13, 0xD5, 0xE5,
+    0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0x80,
+    0x1F, 0x02, 0xF0, 0xE3, 0xD4, 0xC4, 0xD3, 0xD4, 0xC4, 0xD3, 0xD4, 0xC4, 0xD3, 0xD4, 0xD3, 0xD4,
+    0xC4, 0xD3, 0xD4, 0xC4, 0xD3, 0xD4, 0xC4, 0xDF, 0xF4, 0xFF, 0xFF, 0x87, 0x0E, 0x1C, 0x38, 0x70,
+    0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3,
+    0x87, 0xFF, 0xE0, 0x02, 0x93, 0x83, 0x92, 0x93, 0x83, 0x92, 0x93, 0x83, 0x92, 0x93, 0x92, 0x93,
+    0x83, 0x92, 0x93, 0x83, 0x92, 0x93, 0x83, 0x92, 0x93, 0x83, 0x93, 0xFF, 0xFC, 0x38, 0x70, 0xE1,
+    0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87,
+    0x0E, 0x1C, 0x3F, 0xFF, 0xE0, 0x72, 0xD3, 0xD4, 0xB2, 0x12, 0xB2, 0x13, 0x93, 0x22, 0x92, 0x33,
+    0x73, 0x42, 0x72, 0x53, 0x53, 0x62, 0x52, 0x73, 0x33, 0x82, 0x32, 0x93, 0x13, 0xA2, 0x13, 0xA3,
+    0x0F, 0xF0, 0xE1, 0xC3, 0x86, 0x0C, 0x47, 0x5B, 0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59,
+    0x2C, 0x14, 0x66, 0x86, 0x85, 0x95, 0x96, 0x78, 0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x03, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x26, 0x53, 0x19, 0x35, 0x54, 0x24, 0x83, 0x13, 0x93, 0x13,
+    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0x83, 0x14, 0x83, 0x12, 0x13, 0x44, 0x22,
+    0x29, 0x32, 0x36, 0x50, 0x57, 0x4A, 0x24, 0x51, 0x23, 0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xA3, 0xA3, 0xA3, 0xB3, 0xA3, 0xB4, 0x52, 0x3A, 0x57, 0x10, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD3, 0x55, 0x33, 0x39, 0x13, 0x24, 0x46, 0x13, 0x84, 0x13, 0x87, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+    0xA6, 0xA6, 0xA6, 0xA3, 0x13, 0x93, 0x13, 0x84, 0x24, 0x52, 0x12, 0x39, 0x22, 0x55, 0x42, 0x56,
+    0x79, 0x54, 0x43, 0x33, 0x73, 0x23, 0x86, 0x96, 0x96, 0x9F, 0xF6, 0xC3, 0xC3, 0xC3, 0xD3, 0xC4,
+    0xC4, 0x62, 0x4B, 0x68, 0x20, 0x76, 0x58, 0x53, 0x93, 0xA3, 0xA3, 0xA3, 0x89, 0x2B, 0x63, 0xA3,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0x60,
+    0x5C, 0x3E, 0x24, 0x44, 0x53, 0x73, 0x33, 0x83, 0x33, 0x83, 0x33, 0x83, 0x33, 0x83, 0x42, 0x82,
+    0x54, 0x53, 0x6A, 0x87, 0x93, 0xD3, 0xE3, 0xE3, 0xF0, 0xB6, 0xD2, 0x39, 0x31, 0x3B, 0x5C, 0x5C,
+    0x5C, 0x6A, 0x31, 0x47, 0x52, 0xD6, 0x95, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x36,
+    0x33, 0x19, 0x25, 0x63, 0x14, 0x86, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x93, 0x0C, 0x9F, 0xFF, 0xC0, 0x53, 0x53, 0x53, 0x53, 0xFE, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+    0x35, 0x35, 0x35, 0x35, 0x35, 0x34, 0x31, 0x71, 0x53, 0x03, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+    0xB3, 0x77, 0x64, 0x13, 0x54, 0x23, 0x53, 0x33, 0x43, 0x43, 0x33, 0x53, 0x23, 0x63, 0x13, 0x77,
+    0x78, 0x64, 0x13, 0x63, 0x33, 0x53, 0x43, 0x43, 0x44, 0x33, 0x53, 0x33, 0x63, 0x23, 0x64, 0x13,
+    0x77, 0x83, 0x0F, 0xFF, 0xFF, 0x30, 0x02, 0x45, 0x66, 0x32, 0x29, 0x2A, 0x15, 0x54, 0x12, 0x53,
+    0x14, 0x75, 0x76, 0x84, 0x86, 0x93, 0x86, 0x93, 0x86, 0x92, 0x96, 0x92, 0x96, 0x92, 0x96, 0x92,
+    0x96, 0x92, 0x96, 0x92, 0x96, 0x92, 0x96, 0x92, 0x96, 0x92, 0x96, 0x92, 0x96, 0x92, 0x96, 0x92,
+    0x93, 0x02, 0x46, 0x32, 0x29, 0x25, 0x63, 0x14, 0x87, 0x86, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x57, 0x8B, 0x54, 0x54, 0x34, 0x73, 0x33, 0x93,
+    0x22, 0xB2, 0x13, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x33, 0x73,
+    0x44, 0x54, 0x5B, 0x87, 0x50, 0x02, 0x45, 0x52, 0x29, 0x36, 0x44, 0x24, 0x83, 0x13, 0x93, 0x13,
+    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0x83, 0x14, 0x74, 0x16, 0x44, 0x23, 0x19,
+    0x33, 0x26, 0x53, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD0, 0x55, 0x42, 0x39, 0x22, 0x24,
+    0x43, 0x12, 0x13, 0x84, 0x13, 0x87, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0x13,
+    0x93, 0x13, 0x84, 0x24, 0x55, 0x39, 0x13, 0x56, 0x23, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD3, 0x02, 0x46, 0x28, 0x22, 0x45, 0x54, 0x63, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x70, 0x37, 0x3F, 0x05, 0x21, 0x39, 0x2A, 0x39, 0x3A, 0x49, 0x67,
+    0x78, 0x59, 0x49, 0x3A, 0x2A, 0x29, 0x56, 0xF0, 0x28, 0x30, 0x32, 0x82, 0x73, 0x73, 0x5F, 0x52,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x37, 0x75,
+    0x50, 0x03, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x87, 0x84, 0x13, 0x56, 0x1A, 0x22, 0x36, 0x42, 0x03, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x23, 0x93,
+    0x33, 0x73, 0x43, 0x73, 0x43, 0x73, 0x53, 0x53, 0x63, 0x53, 0x63, 0x53, 0x73, 0x33, 0x83, 0x33,
+    0x92, 0x32, 0xA3, 0x13, 0xA3, 0x13, 0xB2, 0x12, 0xC5, 0xC5, 0xD3, 0x70, 0xE0, 0x1E, 0x01, 0xDC,
+    0x07, 0x80, 0xE7, 0x01, 0xE0, 0x39, 0xC0, 0x7C, 0x0E, 0x30, 0x3F, 0x03, 0x0E, 0x0C, 0xC1, 0xC3,
+    0x83, 0x30, 0x70, 0xE1, 0xCE, 0x1C, 0x18, 0x73, 0x86, 0x06, 0x18, 0x63, 0x81, 0xCE, 0x1C, 0xE0,
+    0x73, 0x87, 0x38, 0x0C, 0xC0, 0xCC, 0x03, 0x30, 0x33, 0x00, 0xFC, 0x0F, 0xC0, 0x3E, 0x03, 0xF0,
+    0x07, 0x80, 0x78, 0x01, 0xE0, 0x1E, 0x00, 0x78, 0x07, 0x80, 0x04, 0x84, 0x13, 0x83, 0x33, 0x63,
+    0x44, 0x53, 0x53, 0x43, 0x73, 0x23, 0x84, 0x13, 0x96, 0xB4, 0xC4, 0xC4, 0xB6, 0x93, 0x23, 0x74,
+    0x24, 0x63, 0x43, 0x53, 0x63, 0x34, 0x64, 0x23, 0x83, 0x13, 0xA3, 0x03, 0xB3, 0x13, 0x93, 0x23,
+    0x93, 0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x52, 0x73, 0x53, 0x53, 0x63, 0x53, 0x73, 0x43, 0x73,
+    0x33, 0x83, 0x33, 0x93, 0x22, 0xA3, 0x13, 0xB2, 0x13, 0xB2, 0x12, 0xC5, 0xD4, 0xD3, 0xE3, 0xE2,
+    0xE3, 0xE3, 0xD3, 0xD4, 0x97, 0xA5, 0xC0, 0x1C, 0x2C, 0xB3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0xA3,
+    0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0xA3, 0xA4, 0xA3, 0xAF, 0xD0, 0x83, 0x65, 0x54, 0x64, 0x73, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x73, 0x55, 0x63, 0x86, 0x83, 0x93, 0x83, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x94, 0x85, 0x74, 0x0F, 0xFF, 0xFF, 0xFC, 0x03, 0x85, 0x84, 0x84, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x93, 0x86, 0x83, 0x56, 0x44, 0x73, 0x83, 0x83, 0x83,
+    0x83, 0x83, 0x83, 0x83, 0x74, 0x64, 0x55, 0x64, 0x70, 0x16, 0x7A, 0x44, 0x4A, 0x76, 0x10, 0x73,
+    0xBE, 0xE7, 0x00, 0x04, 0x23, 0x1C, 0xE7, 0x39, 0xCE, 0x73, 0x9C, 0xE7, 0x39, 0xCE, 0x70, 0x72,
+    0xB2, 0xB2, 0x97, 0x4A, 0x25, 0x24, 0x14, 0x93, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xB3, 0xA4, 0xA6, 0x14, 0x3A, 0x57, 0x82, 0xB2, 0xB2, 0x40, 0x77, 0x8B, 0x54, 0x52, 0x63, 0xD3,
+    0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xBD, 0x4D, 0x73, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xD3,
+    0xC5, 0xCF, 0xF4, 0x03, 0xB6, 0xB3, 0x13, 0x93, 0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x53, 0x53,
+    0x63, 0x53, 0x73, 0x33, 0x83, 0x33, 0x93, 0x13, 0xA3, 0x12, 0xC5, 0x8D, 0x4D, 0x93, 0xE3, 0xE3,
+    0x9D, 0x4D, 0x93, 0xE3, 0xE3, 0xE3, 0x70, 0x48, 0x4B, 0x23, 0x72, 0x22, 0xB3, 0xC3, 0xB4, 0xB6,
+    0x97, 0x54, 0x16, 0x32, 0x64, 0x13, 0x73, 0x13, 0x86, 0x83, 0x13, 0x72, 0x25, 0x43, 0x49, 0x76,
+    0xA6, 0xB3, 0xC3, 0xB3, 0xB2, 0x13, 0x64, 0x1C, 0x39, 0x40, 0x88, 0xEC, 0xA4, 0x84, 0x73, 0xC3,
+    0x53, 0xE3, 0x42, 0x66, 0x42, 0x32, 0x58, 0x52, 0x21, 0x54, 0x41, 0x61, 0x12, 0x52, 0xD4, 0x43,
+    0xD3, 0x53, 0xD3, 0x52, 0xF0, 0x25, 0x2F, 0x03, 0x43, 0xE3, 0x43, 0xD4, 0x52, 0xD4, 0x54, 0x41,
+    0x61, 0x22, 0x58, 0x52, 0x32, 0x65, 0x52, 0x43, 0xE3, 0x53, 0xC3, 0x74, 0x84, 0xAC, 0xE8, 0x80,
+    0x04, 0x18, 0x71, 0xC7, 0x0E, 0x70, 0xE7, 0x0E, 0x70, 0xE3, 0x8E, 0x1C, 0x70, 0xF1, 0xC3, 0x87,
+    0x0E, 0x1C, 0x38, 0x70, 0xE3, 0x82, 0x0C, 0x1F, 0x07, 0xF1, 0xC3, 0x60, 0x7C, 0x07, 0x80, 0xF8,
+    0x1B, 0x86, 0x3F, 0x83, 0xE0, 0x63, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x7F, 0xF2, 0x63, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xFF, 0x9F, 0x01, 0xF0, 0x10, 0x25, 0x39, 0x22, 0x42, 0x82, 0x82,
+    0x82, 0x82, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x7F, 0x50, 0x25, 0x39, 0x12, 0x52, 0x83, 0x72,
+    0x73, 0x36, 0x46, 0x92, 0x92, 0x82, 0x74, 0x6C, 0x26, 0x30, 0x03, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x89, 0x4F, 0x22, 0x51, 0x63, 0x5C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xEE, 0xFE, 0xE0, 0xC1, 0x07, 0x1C, 0x38, 0x70, 0xE1,
+    0xC3, 0x87, 0x0E, 0x3C, 0x38, 0xE1, 0xC7, 0x1C, 0x79, 0xC3, 0x9C, 0x39, 0xC3, 0x8E, 0x38, 0x60,
+    0x80, 0x63, 0xA4, 0x94, 0x94, 0x93, 0xFF, 0x72, 0xB2, 0xB2, 0xA3, 0x93, 0x93, 0x94, 0x83, 0x93,
+    0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xB3, 0x63, 0x2B, 0x38, 0x20, 0x63, 0xF5, 0x3F, 0x53, 0xF5,
+    0x2F, 0x62, 0xFF, 0xFF, 0xFB, 0x2F, 0x44, 0xF3, 0x4F, 0x26, 0xF1, 0x6F, 0x12, 0x22, 0xF0, 0x32,
+    0x3E, 0x33, 0x2D, 0x34, 0x3C, 0x34, 0x3C, 0x26, 0x3A, 0x36, 0x3A, 0x36, 0x39, 0x38, 0x38, 0xE7,
+    0xF1, 0x63, 0xA3, 0x62, 0xC2, 0x53, 0xC3, 0x43, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x22, 0xF0, 0x31,
+    0x3F, 0x13, 0xC3, 0xF3, 0x3F, 0x33, 0xF4, 0x2F, 0x42, 0xFF, 0xFF, 0xFC, 0x2F, 0x44, 0xF3, 0x4F,
+    0x26, 0xF1, 0x6F, 0x12, 0x22, 0xF0, 0x32, 0x3E, 0x33, 0x2D, 0x34, 0x3C, 0x34, 0x3C, 0x26, 0x3A,
+    0x36, 0x3A, 0x36, 0x39, 0x38, 0x38, 0xE7, 0xF1, 0x63, 0xA3, 0x62, 0xC2, 0x53, 0xC3, 0x43, 0xC3,
+    0x33, 0xE3, 0x23, 0xE3, 0x22, 0xF0, 0x31, 0x3F, 0x13, 0x94, 0xF2, 0x5F, 0x26, 0xF0, 0x32, 0x3D,
+    0x26, 0x2F, 0xFF, 0xFF, 0x72, 0xF4, 0x4F, 0x34, 0xF2, 0x6F, 0x16, 0xF1, 0x22, 0x2F, 0x03, 0x23,
+    0xE3, 0x32, 0xD3, 0x43, 0xC3, 0x43, 0xC2, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0x93, 0x83, 0x8E, 0x7F,
+    0x16, 0x3A, 0x36, 0x2C, 0x25, 0x3C, 0x34, 0x3C, 0x33, 0x3E, 0x32, 0x3E, 0x32, 0x2F, 0x03, 0x13,
+    0xF1, 0x30, 0x64, 0x52, 0xA7, 0x22, 0xB2, 0x27, 0xA2, 0x54, 0xFF, 0xFF, 0xF8, 0x2F, 0x44, 0xF3,
+    0x4F, 0x26, 0xF1, 0x6F, 0x12, 0x22, 0xF0, 0x32, 0x3E, 0x33, 0x2D, 0x34, 0x3C, 0x34, 0x3C, 0x26,
+    0x3A, 0x36, 0x3A, 0x36, 0x39, 0x38, 0x38, 0xE7, 0xF1, 0x63, 0xA3, 0x62, 0xC2, 0x53, 0xC3, 0x43,
+    0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x22, 0xF0, 0x31, 0x3F, 0x13, 0x72, 0x42, 0xD3, 0x43, 0xD2, 0x42,
+    0xFF, 0xFF, 0xF8, 0x2F, 0x44, 0xF3, 0x4F, 0x26, 0xF1, 0x6F, 0x12, 0x22, 0xF0, 0x32, 0x3E, 0x33,
+    0x2D, 0x34, 0x3C, 0x34, 0x3C, 0x26, 0x3A, 0x36, 0x3A, 0x36, 0x39, 0x38, 0x38, 0xE7, 0xF1, 0x63,
+    0xA3, 0x62, 0xC2, 0x53, 0xC3, 0x43, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x22, 0xF0, 0x31, 0x3F, 0x13,
+    0x94, 0xF2, 0x6F, 0x02, 0x42, 0xE2, 0x42, 0xE2, 0x42, 0xF0, 0x6F, 0x24, 0xF3, 0x4F, 0x34, 0xF2,
+    0x6F, 0x16, 0xF1, 0x22, 0x2F, 0x03, 0x23, 0xE3, 0x32, 0xD3, 0x43, 0xC3, 0x43, 0xC2, 0x63, 0xA3,
+    0x63, 0xA3, 0x63, 0x93, 0x83, 0x8E, 0x7F, 0x16, 0x3A, 0x36, 0x2C, 0x25, 0x3C, 0x34, 0x3C, 0x33,
+    0x3E, 0x32, 0x3E, 0x32, 0x2F, 0x03, 0x13, 0xF1, 0x30, 0xBF, 0x2B, 0xF2, 0xA3, 0x23, 0xF5, 0x32,
+    0x3F, 0x43, 0x33, 0xF4, 0x33, 0x3F, 0x33, 0x43, 0xF3, 0x34, 0x3F, 0x32, 0x53, 0xF2, 0x35, 0x3F,
+    0x22, 0x6C, 0x73, 0x6C, 0x73, 0x63, 0xF0, 0x37, 0x3F, 0x0D, 0xEE, 0xE3, 0x83, 0xD3, 0x93, 0xD3,
+    0x93, 0xC3, 0xA3, 0xC3, 0xA3, 0xB3, 0xB3, 0xB3, 0xBF, 0x1C, 0xD0, 0x88, 0x7D, 0x45, 0x62, 0x43,
+    0xE3, 0xE4, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03, 0xF0, 0x3F, 0x03,
+    0xF1, 0x3F, 0x03, 0xF0, 0x4F, 0x03, 0xF1, 0x3F, 0x05, 0x72, 0x6C, 0x89, 0xC2, 0xF1, 0x2F, 0x04,
+    0xF1, 0x3F, 0x13, 0xF0, 0x2C, 0x6C, 0x46, 0x33, 0xC3, 0xC3, 0xC2, 0xD2, 0xFF, 0xF2, 0xFF, 0x1B,
+    0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xD1, 0xD1, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+    0x3B, 0x3B, 0x3B, 0xFD, 0x83, 0xA3, 0xA3, 0xB2, 0xB2, 0xFF, 0xF4, 0xFF, 0x1B, 0x3B, 0x3B, 0x3B,
+    0x3B, 0x3B, 0x3B, 0x3B, 0xD1, 0xD1, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+    0xFD, 0x54, 0x95, 0x96, 0x73, 0x23, 0x52, 0x62, 0xFF, 0xEF, 0xF1, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+    0xB3, 0xB3, 0xBD, 0x1D, 0x13, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBF, 0xD0,
+    0x32, 0x42, 0x53, 0x43, 0x52, 0x42, 0xFF, 0xF0, 0xFF, 0x1B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B,
+    0x3B, 0xD1, 0xD1, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0xFD, 0xE1, 0xC3,
+    0x86, 0x0C, 0x00, 0x00, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E,
+    0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x1C, 0xE7, 0x18, 0xC0, 0x00, 0x00, 0xE3, 0x8E, 0x38, 0xE3,
+    0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0x34, 0x55,
+    0x56, 0x33, 0x23, 0x12, 0x62, 0xFF, 0x33, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x40, 0x12,
+    0x42, 0x13, 0x43, 0x12, 0x42, 0xFF, 0x43, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73,
+    0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x40, 0x2C,
+    0xAF, 0x07, 0x38, 0x56, 0x3A, 0x45, 0x3B, 0x44, 0x3C, 0x34, 0x3D, 0x33, 0x3D, 0x33, 0x3D, 0x42,
+    0x3E, 0x32, 0x3E, 0xF0, 0x7F, 0x07, 0x32, 0x3E, 0x32, 0x3E, 0x32, 0x3D, 0x33, 0x3D, 0x33, 0x3D,
+    0x33, 0x3C, 0x34, 0x3B, 0x44, 0x3A, 0x45, 0x38, 0x56, 0xE8, 0xB9, 0x54, 0x52, 0x87, 0x22, 0x92,
+    0x27, 0x82, 0x54, 0xFF, 0xFF, 0x64, 0xD8, 0xC8, 0xC9, 0xBA, 0xA6, 0x13, 0xA6, 0x23, 0x96, 0x24,
+    0x86, 0x33, 0x86, 0x43, 0x76, 0x44, 0x66, 0x53, 0x66, 0x63, 0x56, 0x64, 0x46, 0x73, 0x46, 0x83,
+    0x36, 0x84, 0x26, 0x93, 0x26, 0xA3, 0x16, 0xAA, 0xB9, 0xC8, 0xC8, 0xD4, 0x73, 0xF5, 0x3F, 0x53,
+    0xF5, 0x2F, 0x62, 0xFF, 0xFF, 0xF7, 0x8C, 0xC9, 0x46, 0x47, 0x3A, 0x35, 0x3C, 0x33, 0x3E, 0x32,
+    0x3E, 0x32, 0x3E, 0x31, 0x3F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1,
+    0x31, 0x3E, 0x32, 0x3E, 0x32, 0x3E, 0x33, 0x3C, 0x35, 0x3A, 0x36, 0x56, 0x49, 0xCC, 0x87, 0xC3,
+    0xF3, 0x3F, 0x33, 0xF4, 0x2F, 0x42, 0xFF, 0xFF, 0xF9, 0x8C, 0xC9, 0x46, 0x47, 0x3A, 0x35, 0x3C,
+    0x33, 0x3E, 0x32, 0x3E, 0x32, 0x3E, 0x31, 0x3F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1,
+    0x6F, 0x16, 0xF1, 0x31, 0x3E, 0x32, 0x3E, 0x32, 0x3E, 0x33, 0x3C, 0x35, 0x3A, 0x36, 0x56, 0x49,
+    0xCC, 0x87, 0x94, 0xF2, 0x5F, 0x26, 0xF0, 0x32, 0x3D, 0x26, 0x2F, 0xFF, 0xFF, 0x48, 0xCC, 0x94,
+    0x64, 0x73, 0xA3, 0x53, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x13, 0xF1, 0x6F, 0x16, 0xF1,
+    0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x13, 0x13, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x33, 0xC3,
+    0x53, 0xA3, 0x65, 0x64, 0x9C, 0xC8, 0x70, 0x74, 0x52, 0xA7, 0x22, 0xB2, 0x27, 0xA2, 0x54, 0xFF,
+    0xFF, 0xF4, 0x8C, 0xC9, 0x46, 0x47, 0x3A, 0x35, 0x3C, 0x33, 0x3E, 0x32, 0x3E, 0x32, 0x3E, 0x31,
+    0x3F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x31, 0x3E, 0x32, 0x3E,
+    0x32, 0x3E, 0x33, 0x3C, 0x35, 0x3A, 0x36, 0x56, 0x49, 0xCC, 0x87, 0x82, 0x42, 0xD3, 0x43, 0xD2,
+    0x42, 0xFF, 0xFF, 0xF4, 0x8C, 0xC9, 0x46, 0x47, 0x3A, 0x35, 0x3C, 0x33, 0x3E, 0x32, 0x3E, 0x32,
+    0x3E, 0x31, 0x3F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x31, 0x3E,
+    0x32, 0x3E, 0x32, 0x3E, 0x33, 0x3C, 0x35, 0x3A, 0x36, 0x56, 0x49, 0xCC, 0x87, 0x11, 0xB1, 0x13,
+    0x93, 0x13, 0x73, 0x33, 0x53, 0x53, 0x33, 0x73, 0x13, 0x95, 0xB3, 0xB5, 0x93, 0x13, 0x73, 0x33,
+    0x53, 0x53, 0x33, 0x73, 0x13, 0x93, 0x11, 0xB1, 0x10, 0xF3, 0x1A, 0x83, 0x36, 0xF0, 0x64, 0x65,
+    0x63, 0x94, 0x53, 0xA5, 0x33, 0xA3, 0x13, 0x23, 0x93, 0x23, 0x23, 0x92, 0x33, 0x13, 0x93, 0x46,
+    0x83, 0x56, 0x73, 0x66, 0x73, 0x66, 0x63, 0x76, 0x53, 0x86, 0x53, 0x86, 0x43, 0x93, 0x13, 0x23,
+    0x93, 0x23, 0x22, 0xA3, 0x23, 0x13, 0xA3, 0x35, 0xA3, 0x53, 0xA3, 0x65, 0x64, 0x6F, 0x06, 0x33,
+    0x89, 0x1F, 0x40, 0x53, 0xF2, 0x3F, 0x23, 0xF2, 0x2F, 0x32, 0xFF, 0xFF, 0x53, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x12,
+    0xD2, 0x23, 0xB3, 0x33, 0x93, 0x44, 0x74, 0x6B, 0xA7, 0x60, 0xA3, 0xF0, 0x3F, 0x03, 0xF1, 0x2F,
+    0x12, 0xFF, 0xFF, 0x73, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x12, 0xD2, 0x23, 0xB3, 0x33, 0x93, 0x44, 0x74, 0x6B, 0xA7,
+    0x60, 0x74, 0xE5, 0xE6, 0xC3, 0x23, 0xA2, 0x62, 0xFF, 0xFF, 0x23, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x12, 0xD2, 0x23,
+    0xB3, 0x33, 0x93, 0x44, 0x74, 0x6B, 0xA7, 0x60, 0x62, 0x42, 0xA3, 0x43, 0xA2, 0x42, 0xFF, 0xFF,
+    0x23, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD3, 0x12, 0xD2, 0x23, 0xB3, 0x33, 0x93, 0x44, 0x74, 0x6B, 0xA7, 0x60, 0xB3, 0xF0,
+    0x3F, 0x03, 0xF1, 0x2F, 0x12, 0xFF, 0xFF, 0x63, 0xD3, 0x13, 0xB3, 0x23, 0xB3, 0x33, 0x93, 0x43,
+    0x93, 0x53, 0x73, 0x73, 0x53, 0x83, 0x53, 0x93, 0x33, 0xA3, 0x33, 0xB3, 0x13, 0xC3, 0x13, 0xD5,
+    0xE5, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+    0x80, 0x03, 0xD3, 0xD3, 0xD3, 0xDB, 0x5E, 0x23, 0x75, 0x13, 0x97, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+    0xA6, 0x93, 0x13, 0x74, 0x2D, 0x3B, 0x53, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD0, 0x47, 0x7B, 0x43,
+    0x64, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x83, 0x23, 0x73, 0x33, 0x64, 0x33, 0x53, 0x53,
+    0x43, 0x63, 0x43, 0x63, 0x43, 0x63, 0x44, 0x53, 0x54, 0x43, 0x64, 0x33, 0x75, 0x13, 0x97, 0xA6,
+    0xA6, 0xB5, 0xB5, 0xA6, 0x22, 0x57, 0x2A, 0x13, 0x37, 0x30, 0x33, 0xC3, 0xC3, 0xC2, 0xD2, 0xFF,
+    0x77, 0x5B, 0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59, 0x2C, 0x14, 0x66, 0x86, 0x85, 0x95,
+    0x96, 0x78, 0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x93, 0xA3, 0xA3, 0xB2, 0xB2, 0xFF, 0x87, 0x5B,
+    0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59, 0x2C, 0x14, 0x66, 0x86, 0x85, 0x95, 0x96, 0x78,
+    0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x54, 0x95, 0x96, 0x73, 0x23, 0x52, 0x62, 0xFF, 0x47, 0x5B,
+    0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59, 0x2C, 0x14, 0x66, 0x86, 0x85, 0x95, 0x96, 0x78,
+    0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x34, 0x52, 0x27, 0x22, 0x32, 0x27, 0x22, 0x54, 0xFF, 0x47,
+    0x5B, 0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59, 0x2C, 0x14, 0x66, 0x86, 0x85, 0x95, 0x96,
+    0x78, 0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x42, 0x42, 0x53, 0x43, 0x52, 0x42, 0xFF, 0x47, 0x5B,
+    0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59, 0x2C, 0x14, 0x66, 0x86, 0x85, 0x95, 0x96, 0x78,
+    0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x64, 0x96, 0x72, 0x42, 0x62, 0x42, 0x62, 0x42, 0x76, 0x94,
+    0xFF, 0x67, 0x5B, 0x33, 0x53, 0xC3, 0xB3, 0xB3, 0xC2, 0xC2, 0x59, 0x2C, 0x14, 0x66, 0x86, 0x85,
+    0x95, 0x96, 0x78, 0x52, 0x12, 0x19, 0x22, 0x27, 0x32, 0x37, 0x65, 0x5B, 0x29, 0x42, 0x53, 0x13,
+    0x44, 0xB5, 0x63, 0xC4, 0x73, 0xB3, 0x83, 0xB3, 0x83, 0xB3, 0x83, 0x4F, 0x62, 0xF8, 0x14, 0x63,
+    0xB3, 0x83, 0xB3, 0x83, 0xB2, 0x93, 0xB2, 0x85, 0xA3, 0x75, 0xA4, 0x43, 0x24, 0x52, 0x29, 0x4A,
+    0x36, 0x87, 0x20, 0x57, 0x4A, 0x24, 0x51, 0x23, 0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xA3, 0xA3, 0xB3, 0xA3, 0xB4, 0x52, 0x3A, 0x57, 0x72, 0xB2, 0xA4, 0xB3, 0xB3, 0xA2, 0x76, 0x74,
+    0x50, 0x43, 0xD3, 0xD3, 0xD2, 0xE2, 0xFF, 0xA6, 0x79, 0x54, 0x43, 0x33, 0x73, 0x23, 0x86, 0x96,
+    0x96, 0x9F, 0xF6, 0xC3, 0xC3, 0xC3, 0xD3, 0xC4, 0xC4, 0x62, 0x4B, 0x68, 0x20, 0x93, 0xB3, 0xB3,
+    0xC2, 0xC2, 0xFF, 0xC6, 0x79, 0x54, 0x43, 0x33, 0x73, 0x23, 0x86, 0x96, 0x96, 0x9F, 0xF6, 0xC3,
+    0xC3, 0xC3, 0xD3, 0xC4, 0xC4, 0x62, 0x4B, 0x68, 0x20, 0x64, 0xA5, 0xA6, 0x83, 0x23, 0x62, 0x62,
+    0xFF, 0x76, 0x79, 0x54, 0x43, 0x33, 0x73, 0x23, 0x86, 0x96, 0x96, 0x9F, 0xF6, 0xC3, 0xC3, 0xC3,
+    0xD3, 0xC4, 0xC4, 0x62, 0x4B, 0x68, 0x20, 0x42, 0x42, 0x63, 0x43, 0x62, 0x42, 0xFF, 0x86, 0x79,
+    0x54, 0x43, 0x33, 0x73, 0x23, 0x86, 0x96, 0x96, 0x9F, 0xF6, 0xC3, 0xC3, 0xC3, 0xD3, 0xC4, 0xC4,
+    0x62, 0x4B, 0x68, 0x20, 0xE1, 0xC3, 0x86, 0x0C, 0x00, 0x07, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7,
+    0x1C, 0x71, 0xC7, 0x1C, 0x71, 0xC7, 0x1C, 0x70, 0x1C, 0xE7, 0x18, 0xC0, 0x00, 0x38, 0xE3, 0x8E,
+    0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x8E, 0x38, 0xE3, 0x80, 0x34, 0x55, 0x56, 0x33,
+    0x23, 0x12, 0x62, 0xF9, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x33, 0x12, 0x42, 0x13, 0x43, 0x12, 0x42, 0xF9, 0x37, 0x37,
+    0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37,
+    0x34, 0x51, 0x71, 0x64, 0x33, 0x79, 0x95, 0xA6, 0x84, 0x14, 0x73, 0x33, 0x71, 0x63, 0xE3, 0xD3,
+    0x66, 0x22, 0x4D, 0x24, 0x55, 0x13, 0x87, 0xA6, 0xA6, 0xB5, 0xB5, 0xB5, 0xA6, 0xA6, 0xA2, 0x23,
+    0x83, 0x34, 0x53, 0x5A, 0x86, 0x50, 0x34, 0x52, 0x37, 0x22, 0x42, 0x27, 0x32, 0x54, 0xFF, 0x32,
+    0x46, 0x32, 0x29, 0x25, 0x63, 0x14, 0x87, 0x86, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0x43, 0xF0, 0x3F, 0x03, 0xF0, 0x2F, 0x12, 0xFF, 0xF1, 0x78,
+    0xB5, 0x45, 0x43, 0x47, 0x33, 0x39, 0x32, 0x2B, 0x21, 0x3B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B, 0x6B,
+    0x31, 0x2B, 0x22, 0x39, 0x33, 0x37, 0x34, 0x45, 0x45, 0xB8, 0x75, 0x93, 0xD3, 0xD3, 0xE2, 0xE2,
+    0xFF, 0xF3, 0x78, 0xB5, 0x45, 0x43, 0x47, 0x33, 0x39, 0x32, 0x2B, 0x21, 0x3B, 0x6B, 0x6B, 0x6B,
+    0x6B, 0x6B, 0x6B, 0x31, 0x2B, 0x22, 0x39, 0x33, 0x37, 0x34, 0x45, 0x45, 0xB8, 0x75, 0x64, 0xC5,
+    0xC6, 0xA3, 0x23, 0x82, 0x62, 0xFF, 0xD7, 0x8B, 0x54, 0x54, 0x34, 0x73, 0x33, 0x93, 0x22, 0xB2,
+    0x13, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x33, 0x73, 0x44, 0x54,
+    0x5B, 0x87, 0x50, 0x44, 0x52, 0x57, 0x22, 0x62, 0x27, 0x52, 0x54, 0xFF, 0xD7, 0x8B, 0x54, 0x54,
+    0x34, 0x73, 0x33, 0x93, 0x22, 0xB2, 0x13, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB3, 0x12, 0xB2,
+    0x23, 0x93, 0x33, 0x73, 0x44, 0x54, 0x5B, 0x87, 0x50, 0x42, 0x42, 0x83, 0x43, 0x82, 0x42, 0xFF,
+    0xE7, 0x8B, 0x54, 0x54, 0x34, 0x73, 0x33, 0x93, 0x22, 0xB2, 0x13, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
+    0xB6, 0xB3, 0x12, 0xB2, 0x23, 0x93, 0x33, 0x73, 0x44, 0x54, 0x5B, 0x87, 0x50, 0x63, 0xC3, 0xC3,
+    0xC3, 0xFF, 0xF6, 0xFF, 0x0F, 0xFF, 0x63, 0xC3, 0xC3, 0xC3, 0x60, 0xE1, 0x77, 0x22, 0x4D, 0x34,
+    0x54, 0x34, 0x64, 0x33, 0x75, 0x22, 0x73, 0x12, 0x13, 0x63, 0x26, 0x53, 0x36, 0x53, 0x36, 0x43,
+    0x46, 0x33, 0x56, 0x33, 0x56, 0x23, 0x63, 0x12, 0x13, 0x72, 0x25, 0x73, 0x25, 0x63, 0x44, 0x54,
+    0x3D, 0x42, 0x27, 0x71, 0xE0, 0x33, 0xD3, 0xD3, 0xD2, 0xE2, 0xFF, 0x63, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x87, 0x84, 0x13, 0x56, 0x1A, 0x22,
+    0x36, 0x42, 0x93, 0xB3, 0xB3, 0xC2, 0xC2, 0xFF, 0x73, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x87, 0x84, 0x13, 0x56, 0x1A, 0x22, 0x36, 0x42, 0x54,
+    0xA5, 0xA6, 0x83, 0x23, 0x62, 0x62, 0xFF, 0x33, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x87, 0x84, 0x13, 0x56, 0x1A, 0x22, 0x36, 0x42, 0x42, 0x42,
+    0x63, 0x43, 0x62, 0x42, 0xFF, 0x33, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x87, 0x84, 0x13, 0x56, 0x1A, 0x22, 0x36, 0x42, 0xA3, 0xD3, 0xD3, 0xE2,
+    0xE2, 0xFF, 0xC3, 0xB3, 0x13, 0x93, 0x23, 0x93, 0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x52, 0x73,
+    0x53, 0x53, 0x63, 0x53, 0x73, 0x43, 0x73, 0x33, 0x83, 0x33, 0x93, 0x22, 0xA3, 0x13, 0xB2, 0x13,
+    0xB2, 0x12, 0xC5, 0xD4, 0xD3, 0xE3, 0xE2, 0xE3, 0xE3, 0xD3, 0xD4, 0x97, 0xA5, 0xC0, 0x03, 0xD3,
+    0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0x35, 0x53, 0x19, 0x36, 0x44, 0x24, 0x83, 0x13, 0x93, 0x13,
+    0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA7, 0x83, 0x14, 0x83, 0x16, 0x44, 0x23, 0x19,
+    0x33, 0x26, 0x53, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD0, 0x52, 0x42, 0x83, 0x43, 0x82,
+    0x42, 0xFF, 0x83, 0xB3, 0x13, 0x93, 0x23, 0x93, 0x23, 0x93, 0x33, 0x73, 0x43, 0x73, 0x52, 0x73,
+    0x53, 0x53, 0x63, 0x53, 0x73, 0x43, 0x73, 0x33, 0x83, 0x33, 0x93, 0x22, 0xA3, 0x13, 0xB2, 0x13,
+    0xB2, 0x12, 0xC5, 0xD4, 0xD3, 0xE3, 0xE2, 0xE3, 0xE3, 0xD3, 0xD4, 0x97, 0xA5, 0xC0, 0xA2, 0xF4,
+    0x4F, 0x34, 0xF2, 0x6F, 0x16, 0xF1, 0x22, 0x2F, 0x03, 0x23, 0xE3, 0x32, 0xD3, 0x43, 0xC3, 0x43,
+    0xC2, 0x63, 0xA3, 0x63, 0xA3, 0x63, 0x93, 0x83, 0x8E, 0x7F, 0x16, 0x3A, 0x36, 0x2C, 0x25, 0x3C,
+    0x34, 0x3C, 0x33, 0x3E, 0x32, 0x3E, 0x32, 0x2F, 0x03, 0x13, 0xF1, 0x30, 0x0C, 0x5E, 0x33, 0x84,
+    0x23, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0xA3, 0x13, 0x84, 0x2D, 0x4E,
+    0x33, 0x84, 0x23, 0xA3, 0x13, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xA3, 0x13, 0x85, 0x1E, 0x3C,
+    0x50, 0x0F, 0xF1, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3,
+    0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB0, 0x73, 0xE3, 0xD5, 0xC2, 0x12, 0xC2, 0x12,
+    0xB3, 0x13, 0xA3, 0x13, 0xA2, 0x32, 0x93, 0x33, 0x83, 0x33, 0x82, 0x52, 0x73, 0x53, 0x63, 0x53,
+    0x62, 0x72, 0x53, 0x73, 0x43, 0x73, 0x42, 0x83, 0x33, 0x93, 0x23, 0x93, 0x23, 0x93, 0x13, 0xB6,
+    0xBF, 0xF7, 0x0F, 0xF1, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBD, 0x1D, 0x13, 0xB3, 0xB3,
+    0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xB3, 0xBF, 0xD0, 0x1F, 0x02, 0xF0, 0xE3, 0xD4, 0xC4, 0xD3,
+    0xD4, 0xC4, 0xD3, 0xD4, 0xC4, 0xD3, 0xD4, 0xD3, 0xD4, 0xC4, 0xD3, 0xD4, 0xC4, 0xD3, 0xD4, 0xC4,
+    0xDF, 0xF4, 0x03, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xDF, 0xFE, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x78, 0xCC, 0x94, 0x64, 0x73, 0xA3,
+    0x53, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x13, 0xF1, 0x6F, 0x16, 0xF1, 0x63, 0xA3, 0x63,
+    0xA3, 0x6F, 0x16, 0xF1, 0x6F, 0x13, 0x13, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x33, 0xC3, 0x53, 0xA3,
+    0x65, 0x64, 0x9C, 0xC8, 0x70, 0x0F, 0xFF, 0xFC, 0x03, 0xB3, 0x13, 0xA3, 0x23, 0x93, 0x33, 0x83,
+    0x43, 0x73, 0x53, 0x63, 0x63, 0x54, 0x63, 0x44, 0x73, 0x34, 0x83, 0x24, 0x93, 0x14, 0xA3, 0x15,
+    0x99, 0x94, 0x33, 0x83, 0x44, 0x73, 0x54, 0x63, 0x63, 0x63, 0x73, 0x53, 0x74, 0x43, 0x84, 0x33,
+    0x93, 0x33, 0xA3, 0x23, 0xA4, 0x13, 0xB4, 0x93, 0xF2, 0x5F, 0x15, 0xF1, 0x21, 0x2F, 0x03, 0x13,
+    0xE3, 0x13, 0xE2, 0x23, 0xD3, 0x33, 0xC3, 0x33, 0xB3, 0x53, 0xA3, 0x53, 0xA3, 0x53, 0x93, 0x73,
+    0x83, 0x73, 0x83, 0x73, 0x73, 0x93, 0x63, 0x93, 0x53, 0xB3, 0x43, 0xB3, 0x43, 0xB3, 0x33, 0xD3,
+    0x23, 0xD3, 0x23, 0xD3, 0x13, 0xF0, 0x30, 0x05, 0xF0, 0xAF, 0x0B, 0xDC, 0xD9, 0x12, 0xD2, 0x16,
+    0x13, 0xB3, 0x16, 0x13, 0xB2, 0x26, 0x23, 0x93, 0x26, 0x23, 0x93, 0x26, 0x32, 0x92, 0x36, 0x33,
+    0x73, 0x36, 0x33, 0x72, 0x46, 0x43, 0x53, 0x46, 0x43, 0x53, 0x46, 0x43, 0x52, 0x56, 0x53, 0x33,
+    0x56, 0x53, 0x33, 0x56, 0x63, 0x13, 0x66, 0x63, 0x13, 0x66, 0x63, 0x12, 0x76, 0x75, 0x76, 0x75,
+    0x76, 0x83, 0x86, 0x83, 0x83, 0x04, 0xD8, 0xC8, 0xC9, 0xBA, 0xA6, 0x13, 0xA6, 0x23, 0x96, 0x24,
+    0x86, 0x33, 0x86, 0x43, 0x76, 0x44, 0x66, 0x53, 0x66, 0x63, 0x56, 0x64, 0x46, 0x73, 0x46, 0x83,
+    0x36, 0x84, 0x26, 0x93, 0x26, 0xA3, 0x16, 0xAA, 0xB9, 0xC8, 0xC8, 0xD4, 0x1F, 0x02, 0xF0, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF4, 0xD4, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF4, 0x78, 0xCC, 0x94,
+    0x64, 0x73, 0xA3, 0x53, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x13, 0xF1, 0x6F, 0x16, 0xF1,
+    0x6F, 0x16, 0xF1, 0x6F, 0x16, 0xF1, 0x6F, 0x13, 0x13, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x33, 0xC3,
+    0x53, 0xA3, 0x65, 0x64, 0x9C, 0xC8, 0x70, 0x0F, 0xFB, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6,
+    0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD6, 0xD3, 0x0B,
+    0x4D, 0x23, 0x65, 0x13, 0x87, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x83, 0x13, 0x65, 0x1C, 0x3A,
+    0x53, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC0, 0x0F, 0x11, 0xF1, 0x23, 0xE4,
+    0xE4, 0xE4, 0xE3, 0xF0, 0x3F, 0x03, 0xE4, 0xE4, 0xE3, 0xD3, 0xD4, 0xD3, 0xD3, 0xD3, 0xD4, 0xD3,
+    0xD3, 0xD4, 0xC4, 0xDF, 0xF4, 0x0F, 0xF8, 0x83, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+    0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13,
+    0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x38, 0x03, 0xD3, 0x13, 0xB3, 0x23, 0xB3, 0x33, 0x93,
+    0x43, 0x93, 0x53, 0x73, 0x73, 0x53, 0x83, 0x53, 0x93, 0x33, 0xA3, 0x33, 0xB3, 0x13, 0xC3, 0x13,
+    0xD5, 0xE5, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F, 0x13, 0xF1, 0x3F,
+    0x13, 0x80, 0xA3, 0xF5, 0x3F, 0x53, 0xF0, 0xD8, 0xF2, 0x54, 0x43, 0x44, 0x34, 0x53, 0x54, 0x23,
+    0x63, 0x63, 0x13, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73,
+    0x73, 0x13, 0x63, 0x63, 0x24, 0x53, 0x54, 0x35, 0x33, 0x35, 0x5F, 0x29, 0xBF, 0x13, 0xF5, 0x3F,
+    0x53, 0xF5, 0x3A, 0x13, 0xC3, 0x33, 0xA3, 0x44, 0x93, 0x53, 0x83, 0x73, 0x63, 0x83, 0x63, 0x93,
+    0x43, 0xB3, 0x23, 0xC3, 0x23, 0xD6, 0xF0, 0x4F, 0x14, 0xF1, 0x4F, 0x06, 0xD3, 0x23, 0xC3, 0x23,
+    0xB3, 0x43, 0x93, 0x54, 0x83, 0x63, 0x73, 0x83, 0x53, 0x94, 0x43, 0xA3, 0x33, 0xC3, 0x14, 0xC4,
+    0x03, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x76, 0x73,
+    0x76, 0x73, 0x76, 0x73, 0x76, 0x73, 0x73, 0x13, 0x63, 0x63, 0x24, 0x53, 0x54, 0x34, 0x43, 0x44,
+    0x5F, 0x28, 0xDF, 0x03, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3F, 0x53, 0xF5, 0x3A, 0x98,
+    0xED, 0xB4, 0x74, 0x93, 0xB3, 0x73, 0xD3, 0x53, 0xF0, 0x34, 0x3F, 0x03, 0x43, 0xF0, 0x33, 0x3F,
+    0x23, 0x23, 0xF2, 0x32, 0x3F, 0x23, 0x23, 0xF2, 0x32, 0x3F, 0x23, 0x23, 0xF2, 0x33, 0x3F, 0x03,
+    0x43, 0xF0, 0x34, 0x3F, 0x03, 0x53, 0xD3, 0x63, 0xD3, 0x73, 0xB3, 0x93, 0x93, 0xB3, 0x73, 0x6A,
+    0x5F, 0x55, 0xA0, 0x56, 0x33, 0x59, 0x23, 0x44, 0x43, 0x12, 0x43, 0x84, 0x43, 0x84, 0x33, 0xA3,
+    0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3, 0x33, 0xA3,
+    0x43, 0x93, 0x43, 0x84, 0x54, 0x52, 0x12, 0x69, 0x25, 0x55, 0x54, 0x47, 0x8A, 0x53, 0x54, 0x33,
+    0x83, 0x13, 0x93, 0x13, 0x93, 0x13, 0xA2, 0x13, 0x93, 0x13, 0x93, 0x13, 0x93, 0x13, 0x74, 0x23,
+    0x36, 0x43, 0x36, 0x43, 0x83, 0x23, 0x93, 0x13, 0xA6, 0xA6, 0xB5, 0xB5, 0xB5, 0xA6, 0xA6, 0x99,
+    0x64, 0x1E, 0x23, 0x18, 0x43, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD0, 0x03, 0xB3, 0x13,
+    0x93, 0x23, 0x93, 0x32, 0x93, 0x33, 0x73, 0x43, 0x73, 0x52, 0x72, 0x63, 0x53, 0x72, 0x53, 0x73,
+    0x42, 0x83, 0x33, 0x92, 0x33, 0x93, 0x22, 0xA3, 0x13, 0xB2, 0x13, 0xB5, 0xD4, 0xD4, 0xD3, 0xE3,
+    0xE3, 0xE2, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0x80, 0x67, 0x8C, 0x44, 0x53, 0x53, 0x81, 0x53, 0xE3,
+    0xE3, 0xF0, 0x4E, 0x4E, 0x5C, 0x78, 0x51, 0x46, 0x44, 0x44, 0x37, 0x42, 0x39, 0x31, 0x3B, 0x6B,
+    0x6B, 0x6B, 0x6B, 0x6B, 0x21, 0x3A, 0x32, 0x38, 0x43, 0x45, 0x45, 0xB8, 0x75, 0x57, 0x5B, 0x23,
+    0x62, 0x23, 0xB3, 0xB3, 0xB3, 0xC4, 0xB8, 0x68, 0x53, 0xA3, 0xB2, 0xB3, 0xC2, 0xC3, 0xB4, 0x63,
+    0x2C, 0x48, 0x20, 0x1C, 0x1C, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0xA3, 0x93, 0x93, 0xA3,
+    0xA2, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xB3, 0xA5, 0x98, 0x78, 0x86, 0xA3, 0xA3, 0xA3,
+    0xA2, 0xA3, 0xA2, 0x20, 0x02, 0x46, 0x32, 0x29, 0x25, 0x63, 0x14, 0x87, 0x86, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x93, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0xC3, 0xC3, 0x56, 0x8A, 0x54, 0x44, 0x43, 0x63, 0x33, 0x83, 0x23, 0x83, 0x22, 0xA2, 0x13,
+    0xA6, 0xA6, 0xA6, 0xAF, 0xF8, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA3, 0x12, 0xA2, 0x23, 0x83, 0x23,
+    0x83, 0x33, 0x63, 0x44, 0x44, 0x5A, 0x86, 0x50, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0x7F, 0x3F, 0xE0, 0x3F, 0x80, 0xEE, 0x07,
+    0x38, 0x38, 0xE1, 0xE3, 0x8F, 0x0E, 0x78, 0x39, 0xC0, 0xEE, 0x03, 0xFC, 0x0F, 0xF8, 0x3C, 0xF0,
+    0xE1, 0xC3, 0x83, 0x8E, 0x0F, 0x38, 0x1C, 0xE0, 0x3B, 0x80, 0xFE, 0x01, 0xC0, 0x15, 0xD6, 0xF1,
+    0x3F, 0x13, 0xF0, 0x3F, 0x12, 0xF1, 0x3F, 0x03, 0xF0, 0x3F, 0x04, 0xD5, 0xD6, 0xC2, 0x13, 0xB3,
+    0x22, 0xB2, 0x33, 0x93, 0x33, 0x93, 0x42, 0x83, 0x53, 0x73, 0x53, 0x72, 0x72, 0x63, 0x73, 0x53,
+    0x73, 0x43, 0x93, 0x33, 0x93, 0x23, 0xB7, 0xB4, 0x03, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
+    0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x89, 0x4F, 0x22, 0x51, 0x63, 0x5C, 0x3C, 0x3C,
+    0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x03, 0xB3, 0x12, 0xB3, 0x13, 0xA3, 0x13, 0xA2, 0x32, 0xA2, 0x33,
+    0x92, 0x33, 0x83, 0x42, 0x83, 0x43, 0x73, 0x43, 0x72, 0x62, 0x63, 0x63, 0x53, 0x63, 0x43, 0x82,
+    0x43, 0x83, 0x23, 0x93, 0x13, 0xB2, 0x13, 0xB5, 0xC4, 0x70, 0x1B, 0x2B, 0x54, 0x83, 0x93, 0x93,
+    0xA3, 0xA3, 0xA3, 0xA3, 0xB4, 0xA9, 0x58, 0x34, 0x83, 0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA4,
+    0xA5, 0x98, 0x78, 0x95, 0xA3, 0xB2, 0xB2, 0xA3, 0xA2, 0xA3, 0x10, 0x57, 0x8B, 0x54, 0x54, 0x34,
+    0x73, 0x33, 0x93, 0x22, 0xB2, 0x13, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB3, 0x12, 0xB2, 0x23,
+    0x93, 0x33, 0x73, 0x44, 0x54, 0x5B, 0x87, 0x50, 0x2F, 0xFA, 0x43, 0x82, 0x83, 0x82, 0x83, 0x82,
+    0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x82,
+    0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x73, 0x85, 0x53, 0x94, 0x10, 0x56, 0x8A, 0x54,
+    0x44, 0x33, 0x83, 0x22, 0x93, 0x13, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0x93,
+    0x13, 0x93, 0x15, 0x54, 0x22, 0x1A, 0x33, 0x26, 0x53, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3, 0xD3,
+    0xD0, 0x57, 0x4A, 0x24, 0x51, 0x23, 0xA3, 0x93, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3, 0xA3,
+    0xB3, 0xA5, 0x98, 0x78, 0x86, 0xA3, 0xA3, 0xA3, 0xA2, 0xA3, 0xA2, 0x20, 0x6C, 0x4E, 0x25, 0x43,
+    0x63, 0x73, 0x43, 0x93, 0x32, 0xA3, 0x23, 0xA3, 0x23, 0xB3, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xB3,
+    0x13, 0xB3, 0x13, 0xB2, 0x23, 0xA3, 0x33, 0x93, 0x34, 0x73, 0x54, 0x53, 0x7A, 0xA7, 0x60, 0x1F,
+    0xE5, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x4C, 0x3D,
+    0x79, 0x61, 0x03, 0x93, 0x13, 0xA2, 0x13, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6, 0xA6,
+    0xA6, 0xA6, 0xA2, 0x13, 0x93, 0x23, 0x83, 0x24, 0x54, 0x4B, 0x77, 0x50, 0x31, 0x75, 0x63, 0x58,
+    0x43, 0x43, 0x33, 0x33, 0x53, 0x43, 0x23, 0x52, 0x62, 0x13, 0x62, 0x66, 0x53, 0x66, 0x53, 0x66,
+    0x53, 0x66, 0x53, 0x66, 0x53, 0x66, 0x53, 0x66, 0x53, 0x66, 0x53, 0x53, 0x23, 0x43, 0x53, 0x24,
+    0x33, 0x43, 0x44, 0x23, 0x24, 0x6D, 0x99, 0xE3, 0xF2, 0x3F, 0x23, 0xF2, 0x3F, 0x23, 0xF2, 0x3F,
+    0x23, 0xF2, 0x39, 0x14, 0xA3, 0x25, 0x83, 0x53, 0x83, 0x63, 0x63, 0x73, 0x63, 0x83, 0x43, 0x93,
+    0x42, 0xB2, 0x33, 0xB3, 0x13, 0xC3, 0x13, 0xD5, 0xE5, 0xE4, 0xF0, 0x4F, 0x04, 0xE6, 0xC3, 0x13,
+    0xC3, 0x22, 0xB3, 0x33, 0xA3, 0x33, 0x93, 0x53, 0x83, 0x53, 0x73, 0x63, 0x73, 0x73, 0x53, 0x84,
+    0x34, 0x99, 0xB5, 0x92, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xA3, 0x62, 0x63,
+    0x13, 0x62, 0x63, 0x13, 0x62, 0x72, 0x13, 0x62, 0x72, 0x13, 0x62, 0x76, 0x62, 0x76, 0x62, 0x76,
+    0x62, 0x76, 0x62, 0x76, 0x62, 0x76, 0x62, 0x76, 0x62, 0x76, 0x62, 0x72, 0x13, 0x62, 0x63, 0x23,
+    0x52, 0x63, 0x24, 0x42, 0x44, 0x44, 0x32, 0x34, 0x6E, 0x99, 0xF1, 0x2F, 0x42, 0xF4, 0x2F, 0x42,
+    0xF4, 0x2F, 0x42, 0xF4, 0x2F, 0x42, 0xA0, 0x23, 0xC3, 0x33, 0xE3, 0x23, 0xE3, 0x23, 0xE3, 0x13,
+    0xF1, 0x6F, 0x16, 0xF1, 0x67, 0x27, 0x67, 0x27, 0x67, 0x27, 0x67, 0x27, 0x67, 0x27, 0x67, 0x27,
+    0x67, 0x27, 0x31, 0x26, 0x46, 0x22, 0x35, 0x45, 0x33, 0x33, 0x63, 0x34, 0x82, 0x86, 0x54, 0x54,
+    0x15, 0x1F, 0xFB, 0x24, 0x20, 0xE0, 0x70, 0x3B, 0x81, 0xC0, 0xEF, 0x07, 0x83, 0xF8, 0x1C, 0x0E,
+    0xE0, 0x70, 0x38, 0x97, 0x9B, 0x64, 0x53, 0x53, 0xE3, 0xF0, 0x3E, 0x3F, 0x03, 0xF0, 0x3C, 0xE4,
+    0xE7, 0x2F, 0x12, 0xF1, 0x2D, 0xD5, 0xD8, 0x3F, 0x03, 0xF0, 0x3F, 0x13, 0xF1, 0x3F, 0x05, 0x62,
+    0x7B, 0x97, 0x20,
+};
+
+static const Font GEEK_MAGIC_SANS_40 = {GEEK_MAGIC_SANS_40_GLYPHS, GEEK_MAGIC_SANS_40_BITMAPS, 227, 40, 32};
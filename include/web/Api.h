@@ -34,6 +34,26 @@ void handleGifUpload(Webserver* webserver);
 void handleListGifs(Webserver* webserver);
 void handlePlayGif(Webserver* webserver);
 void handleStopGif(Webserver* webserver);
+void handleGifStats(Webserver* webserver);
+void handleGifQueueList(Webserver* webserver);
+void handleGifQueueAdd(Webserver* webserver);
+void handleGifQueueClear(Webserver* webserver);
+void handleGifQueueSkip(Webserver* webserver);
+void handleGifSlotList(Webserver* webserver);
+void handleGifSlotUpload(Webserver* webserver);
+void handleGifSlotDelete(Webserver* webserver);
+void handleGifSeek(Webserver* webserver);
+void handleGifSpeed(Webserver* webserver);
+
+void handleTickerStart(Webserver* webserver);
+void handleTickerStop(Webserver* webserver);
+void handleTickerStatus(Webserver* webserver);
+void handleStatusBarShow(Webserver* webserver);
+void handleStatusBarHide(Webserver* webserver);
+void handleStatusBarStatus(Webserver* webserver);
+void handleOverlaySet(Webserver* webserver);
+void handleOverlayRemove(Webserver* webserver);
+void handleOverlayStatus(Webserver* webserver);
 
 void handleWifiScan(Webserver* webserver);
 void handleWifiConnect(Webserver* webserver);
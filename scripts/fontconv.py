@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""
+Bitmap font converter: BDF sources to compressed PROGMEM headers for display/Font
+
+Each font of fonts/fonts.json is read from its BDF source and written to include/display/fonts/<name>.h
+as a FontGlyph table sorted by codepoint plus the glyph bitmaps. Every size has a source of its own: the
+10 px one is drawn by hand, the larger ones are rasterized from an outline font by scripts/fontraster.py.
+An entry can instead enlarge a smaller source with "scale" (2, 3 or 4) through the Scale2x/Scale3x
+pixel-art filters, as a fallback for a size nobody has drawn or rasterized yet.
+Every bitmap is stored either as packed bits or as nibble runs, whichever is smaller:
+  - packed: width * height bits, row-major, most significant bit first
+  - runs: one nibble per run (high nibble first), runs alternate between background and ink starting
+    with background; 0..14 is a run followed by a colour switch, 15 is a run of 15 without a switch
+
+The generated headers are committed and the firmware build does not run this script; run it after
+editing fonts/, CI runs it with --check:
+  python3 scripts/fontconv.py                  regenerate every font of fonts/fonts.json
+  python3 scripts/fontconv.py --check          fail if a generated header is out of date
+"""
+import json
+import os
+import sys
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parents[1]
+MANIFEST_PATH = ROOT / "fonts" / "fonts.json"
+OUTPUT_DIR = ROOT / "include" / "display" / "fonts"
+
+# Must match display/Font.h (FONT_GLYPH_RLE, FONT_GLYPH_MAX_BYTES)
+GLYPH_RLE = 0x01
+MAX_GLYPH_BYTES = 160
+RUN_MAX = 15
+
+
+class Glyph:
+    def __init__(self, codepoint, advance, x_offset, y_offset, rows):
+        self.codepoint = codepoint
+        self.advance = advance
+        # Left edge from the pen position, bottom edge above the baseline (BDF convention)
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        # Rows top to bottom, each a list of 0/1 pixels
+        self.rows = rows
+
+    @property
+    def width(self):
+        return len(self.rows[0]) if self.rows else 0
+
+    @property
+    def height(self):
+        return len(self.rows)
+
+
+def parse_bdf(path):
+    """Glyphs with an encoding plus the font ascent and descent"""
+    ascent = descent = None
+    glyphs = []
+    lines = iter(Path(path).read_text(encoding="ascii").splitlines())
+    for line in lines:
+        key, _, value = line.partition(" ")
+        if key == "FONT_ASCENT":
+            ascent = int(value)
+        elif key == "FONT_DESCENT":
+            descent = int(value)
+        elif key == "STARTCHAR":
+            codepoint = advance = bbx = None
+            rows = []
+            for line in lines:
+                key, _, value = line.partition(" ")
+                if key == "ENCODING":
+                    codepoint = int(value.split()[0])
+                elif key == "DWIDTH":
+                    advance = int(value.split()[0])
+                elif key == "BBX":
+                    bbx = [int(part) for part in value.split()]
+                elif key == "BITMAP":
+                    for _ in range(bbx[1]):
+                        bits = int(next(lines), 16)
+                        digits = (bbx[0] + 7) // 8 * 8
+                        rows.append([(bits >> (digits - 1 - x)) & 1 for x in range(bbx[0])])
+                elif key == "ENDCHAR":
+                    break
+            if codepoint is None or codepoint < 0 or bbx is None:
+                continue
+            glyphs.append(Glyph(codepoint, advance, bbx[2], bbx[3], rows))
+    if ascent is None or descent is None:
+        raise ValueError(f"{path}: FONT_ASCENT and FONT_DESCENT are required")
+    return ascent, descent, glyphs
+
+
+def pixel(rows, x, y):
+    if 0 <= y < len(rows) and 0 <= x < len(rows[0]):
+        return rows[y][x]
+    return 0
+
+
+def scale2x(rows):
+    """Scale2x (EPX): every pixel becomes 2x2, corners follow matching neighbours"""
+    out = [[0] * (len(rows[0]) * 2) for _ in range(len(rows) * 2)]
+    for y, row in enumerate(rows):
+        for x, centre in enumerate(row):
+            up, down = pixel(rows, x, y - 1), pixel(rows, x, y + 1)
+            left, right = pixel(rows, x - 1, y), pixel(rows, x + 1, y)
+            smooth = up != down and left != right
+            out[2 * y][2 * x] = left if smooth and left == up else centre
+            out[2 * y][2 * x + 1] = right if smooth and up == right else centre
+            out[2 * y + 1][2 * x] = left if smooth and left == down else centre
+            out[2 * y + 1][2 * x + 1] = right if smooth and down == right else centre
+    return out
+
+
+def scale3x(rows):
+    """Scale3x: every pixel becomes 3x3, edges and corners follow matching neighbours"""
+    out = [[0] * (len(rows[0]) * 3) for _ in range(len(rows) * 3)]
+    for y, row in enumerate(rows):
+        for x, e in enumerate(row):
+            a, b, c = pixel(rows, x - 1, y - 1), pixel(rows, x, y - 1), pixel(rows, x + 1, y - 1)
+            d, f = pixel(rows, x - 1, y), pixel(rows, x + 1, y)
+            g, h, i = pixel(rows, x - 1, y + 1), pixel(rows, x, y + 1), pixel(rows, x + 1, y + 1)
+            block = [e] * 9
+            if b != h and d != f:
+                block[0] = d if d == b else e
+                block[1] = b if (d == b and e != c) or (b == f and e != a) else e
+                block[2] = f if b == f else e
+                block[3] = d if (d == b and e != g) or (d == h and e != a) else e
+                block[5] = f if (b == f and e != i) or (h == f and e != c) else e
+                block[6] = d if d == h else e
+                block[7] = h if (d == h and e != i) or (h == f and e != g) else e
+                block[8] = f if h == f else e
+            for k, value in enumerate(block):
+                out[3 * y + k // 3][3 * x + k % 3] = value
+    return out
+
+
+def scale_glyph(glyph, scale):
+    """Enlarge a glyph with the pixel-art filters, scale 4 is Scale2x applied twice"""
+    if scale == 1 or not glyph.rows:
+        return Glyph(glyph.codepoint, glyph.advance * scale, glyph.x_offset * scale, glyph.y_offset * scale,
+                     glyph.rows)
+    # One blank pixel around the glyph so the filters see its outline against the background
+    rows = [[0] * (glyph.width + 2)] + [[0] + row + [0] for row in glyph.rows] + [[0] * (glyph.width + 2)]
+    steps = {2: [scale2x], 3: [scale3x], 4: [scale2x, scale2x]}
+    if scale not in steps:
+        raise ValueError(f"scale {scale} is not supported (1, 2, 3 or 4)")
+    for step in steps[scale]:
+        rows = step(rows)
+    return trim(Glyph(glyph.codepoint, glyph.advance * scale, (glyph.x_offset - 1) * scale,
+                      (glyph.y_offset - 1) * scale, rows))
+
+
+def trim(glyph):
+    """Drop blank rows and columns around the ink"""
+    rows = glyph.rows
+    inked_rows = [y for y, row in enumerate(rows) if any(row)]
+    if not inked_rows:
+        return Glyph(glyph.codepoint, glyph.advance, 0, 0, [])
+    inked_cols = [x for x in range(len(rows[0])) if any(row[x] for row in rows)]
+    top, bottom = inked_rows[0], inked_rows[-1]
+    left, right = inked_cols[0], inked_cols[-1]
+    cropped = [row[left:right + 1] for row in rows[top:bottom + 1]]
+    return Glyph(glyph.codepoint, glyph.advance, glyph.x_offset + left, glyph.y_offset + (len(rows) - 1 - bottom),
+                 cropped)
+
+
+def pack_bits(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, bit in enumerate(bits):
+        if bit:
+            out[i // 8] |= 0x80 >> (i % 8)
+    return bytes(out)
+
+
+def encode_runs(bits):
+    nibbles = []
+    colour = 0
+    i = 0
+    while i < len(bits):
+        run = 0
+        while i < len(bits) and bits[i] == colour:
+            run += 1
+            i += 1
+        while run >= RUN_MAX:
+            nibbles.append(RUN_MAX)
+            run -= RUN_MAX
+        nibbles.append(run)
+        colour ^= 1
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[k] << 4) | nibbles[k + 1] for k in range(0, len(nibbles), 2))
+
+
+def encode(glyph):
+    """Smaller of packed bits and nibble runs, with the flag telling which"""
+    bits = [bit for row in glyph.rows for bit in row]
+    packed = pack_bits(bits)
+    runs = encode_runs(bits)
+    if len(runs) < len(packed):
+        return GLYPH_RLE, runs
+    return 0, packed
+
+
+def symbol_of(name):
+    """GeekMagicSans20 -> GEEK_MAGIC_SANS_20"""
+    out = ""
+    for i, ch in enumerate(name):
+        if i and (ch.isupper() or (ch.isdigit() and not name[i - 1].isdigit())):
+            out += "_"
+        out += ch.upper()
+    return out
+
+
+def in_ranges(codepoint, ranges):
+    return not ranges or any(low <= codepoint <= high for low, high in ranges)
+
+
+def convert(entry):
+    """Header text for one manifest entry and a one-line summary"""
+    source = ROOT / "fonts" / entry["source"]
+    scale = int(entry.get("scale", 1))
+    ranges = [tuple(int(part, 16) for part in span.split("-")) for span in entry.get("ranges", [])]
+    ascent, descent, glyphs = parse_bdf(source)
+    glyphs = sorted((g for g in glyphs if in_ranges(g.codepoint, ranges) and g.codepoint <= 0xFFFF),
+                    key=lambda g: g.codepoint)
+
+    symbol = symbol_of(entry["name"])
+    line_ascent = ascent * scale
+    table = []
+    data = bytearray()
+    raw_bytes = 0
+    for source_glyph in glyphs:
+        glyph = scale_glyph(source_glyph, scale)
+        stride = (glyph.width + 7) // 8
+        if stride * glyph.height > MAX_GLYPH_BYTES:
+            raise ValueError(f"{source}: U+{glyph.codepoint:04X} decodes to more than {MAX_GLYPH_BYTES} bytes")
+        flags, payload = encode(glyph) if glyph.rows else (0, b"")
+        top = line_ascent - (glyph.y_offset + glyph.height) if glyph.rows else 0
+        table.append(f"    {{{len(data)}, 0x{glyph.codepoint:04X}, {glyph.width}, {glyph.height}, {glyph.x_offset}, "
+                     f"{top}, {glyph.advance}, {flags}}},  // {describe(glyph.codepoint)}")
+        data += payload
+        raw_bytes += stride * glyph.height
+
+    hex_lines = []
+    for start in range(0, len(data), 16):
+        hex_lines.append("    " + ", ".join(f"0x{byte:02X}" for byte in data[start:start + 16]) + ",")
+
+    text = f"""// This file is auto-generated by scripts/fontconv.py from fonts/{entry["source"]}.
+// Please do not edit manually.
+#pragma once
+
+#include "display/Font.h"
+
+// {len(glyphs)} glyphs, {len(data)} bitmap bytes ({raw_bytes} decoded), line height {(ascent + descent) * scale}
+static const FontGlyph {symbol}_GLYPHS[] PROGMEM = {{
+{chr(10).join(table)}
+}};
+
+static const uint8_t {symbol}_BITMAPS[] PROGMEM = {{
+{chr(10).join(hex_lines)}
+}};
+
+static const Font {symbol} = {{{symbol}_GLYPHS, {symbol}_BITMAPS, {len(glyphs)}, {(ascent + descent) * scale}, \
+{line_ascent}}};
+"""
+    summary = f"{entry['name']}: {len(glyphs)} glyphs, {len(data)} of {raw_bytes} bitmap bytes"
+    return text, summary
+
+
+def describe(codepoint):
+    if codepoint in (0x5C, 0x27):
+        return "'\\" + chr(codepoint) + "'"
+    if 0x20 <= codepoint < 0x7F:
+        return f"'{chr(codepoint)}'"
+    return f"U+{codepoint:04X}"
+
+
+def generate(check=False):
+    """Write every out of date header, or with check only report them; returns the stale paths"""
+    manifest = json.loads(MANIFEST_PATH.read_text(encoding="utf-8"))
+    stale = []
+    for entry in manifest["fonts"]:
+        text, summary = convert(entry)
+        path = OUTPUT_DIR / f"{entry['name']}.h"
+        if path.exists() and path.read_text(encoding="utf-8") == text:
+            print(f"[fontconv] {summary}, no changes")
+            continue
+        stale.append(path)
+        if not check:
+            os.makedirs(OUTPUT_DIR, exist_ok=True)
+            path.write_text(text, encoding="utf-8")
+            print(f"[fontconv] {summary}, updated {path.relative_to(ROOT)}")
+    return stale
+
+
+if __name__ == "__main__":
+    if len(sys.argv) > 2 or (len(sys.argv) == 2 and sys.argv[1] != "--check"):
+        print(__doc__)
+        sys.exit(2)
+    check = len(sys.argv) == 2
+    outdated = generate(check)
+    for path in outdated if check else []:
+        print(f"[fontconv] out of date: {path.relative_to(ROOT)}")
+    sys.exit(1 if check and outdated else 0)
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+Outline font rasterizer: writes the per-size BDF sources of fonts/ read by scripts/fontconv.py
+
+Renders every codepoint of a charset BDF (the hand-drawn 10 px source by default, so all sizes cover
+the same characters) from a TrueType/OpenType font with FreeType monochrome hinting, at the largest
+pixel size whose ink still fits the requested line height. The BDF files are the committed sources,
+this script is only needed to add a size or change the outline font, and needs Pillow:
+  python3 scripts/fontraster.py OpenSans-Regular.ttf 20 fonts/geekmagic-sans-20.bdf
+  python3 scripts/fontraster.py OpenSans-Regular.ttf 20 out.bdf --charset fonts/geekmagic-sans.bdf
+"""
+import argparse
+import sys
+from pathlib import Path
+
+from PIL import Image, ImageDraw, ImageFont, features
+
+ROOT = Path(__file__).resolve().parents[1]
+DEFAULT_CHARSET = ROOT / "fonts" / "geekmagic-sans.bdf"
+
+
+def charset_of(path):
+    """Codepoints encoded in a BDF file"""
+    codepoints = []
+    for line in Path(path).read_text(encoding="ascii").splitlines():
+        key, _, value = line.partition(" ")
+        if key == "ENCODING" and int(value.split()[0]) >= 0:
+            codepoints.append(int(value.split()[0]))
+    return codepoints
+
+
+def ink_box(font, codepoint):
+    """Left, top, right, bottom of the ink relative to the pen on the baseline, None for blank glyphs"""
+    left, top, right, bottom = font.getbbox(chr(codepoint), mode="1", anchor="ls")
+    return (left, top, right, bottom) if right > left and bottom > top else None
+
+
+def fit_size(path, codepoints, line_height):
+    """Largest pixel size whose tallest ascender plus deepest descender fits the line, with its ascent"""
+    for size in range(line_height, 0, -1):
+        font = ImageFont.truetype(str(path), size)
+        boxes = [box for box in (ink_box(font, cp) for cp in codepoints) if box is not None]
+        ascent = max(-box[1] for box in boxes)
+        descent = max(box[3] for box in boxes)
+        if ascent + descent <= line_height:
+            return size, ascent
+    raise ValueError(f"{path}: no pixel size fits a {line_height} px line")
+
+
+def render(font, codepoint):
+    """Advance, BDF bounding box (width, height, x offset, bottom above baseline) and bitmap rows"""
+    advance = round(font.getlength(chr(codepoint), mode="1"))
+    box = ink_box(font, codepoint)
+    if box is None:
+        return advance, (0, 0, 0, 0), []
+    left, top, right, bottom = box
+    image = Image.new("1", (right - left, bottom - top), 0)
+    draw = ImageDraw.Draw(image)
+    draw.fontmode = "1"
+    draw.text((-left, -top), chr(codepoint), font=font, fill=1, anchor="ls")
+    rows = [[1 if image.getpixel((x, y)) else 0 for x in range(image.width)] for y in range(image.height)]
+
+    # The hinted outline can leave blank edges inside the reported box
+    while rows and not any(rows[0]):
+        rows.pop(0)
+        top += 1
+    while rows and not any(rows[-1]):
+        rows.pop()
+        bottom -= 1
+    while rows and not any(row[0] for row in rows):
+        rows = [row[1:] for row in rows]
+        left += 1
+    while rows and not any(row[-1] for row in rows):
+        rows = [row[:-1] for row in rows]
+    if not rows:
+        return advance, (0, 0, 0, 0), []
+    return advance, (len(rows[0]), len(rows), left, -bottom), rows
+
+
+def bdf_text(path, codepoints, line_height):
+    size, ascent = fit_size(path, codepoints, line_height)
+    font = ImageFont.truetype(str(path), size)
+    family, style = font.getname()
+    glyphs = [(cp, *render(font, cp)) for cp in codepoints]
+    width = max(bbx[0] for _, _, bbx, _ in glyphs)
+    height = max(bbx[1] for _, _, bbx, _ in glyphs)
+    average = round(sum(advance for _, advance, _, _ in glyphs) * 10 / len(glyphs))
+
+    out = [
+        "STARTFONT 2.1",
+        f"COMMENT {family} {style} rasterized at {size} px by scripts/fontraster.py, FreeType "
+        f"{features.version('freetype2')} monochrome hinting",
+        f"COMMENT Outlines from {Path(path).name}, see fonts/OpenSans-LICENSE.txt",
+        f"FONT -GeekMagic-Sans-Medium-R-Normal--{size}-{size * 10}-72-72-P-{average}-ISO10646-1",
+        f"SIZE {size} 72 72",
+        f"FONTBOUNDINGBOX {width} {height} 0 {ascent - line_height}",
+        "STARTPROPERTIES 4",
+        'FAMILY_NAME "GeekMagic Sans"',
+        f'COPYRIGHT "Outlines of {family}, Apache License 2.0"',
+        f"FONT_ASCENT {ascent}",
+        f"FONT_DESCENT {line_height - ascent}",
+        "ENDPROPERTIES",
+        f"CHARS {len(glyphs)}",
+    ]
+    for codepoint, advance, bbx, rows in glyphs:
+        out += [f"STARTCHAR uni{codepoint:04X}", f"ENCODING {codepoint}",
+                f"SWIDTH {round(advance * 1000 / size)} 0", f"DWIDTH {advance} 0",
+                "BBX " + " ".join(str(part) for part in bbx), "BITMAP"]
+        digits = (bbx[0] + 7) // 8 * 2
+        for row in rows:
+            bits = 0
+            for bit in row + [0] * (digits * 4 - len(row)):
+                bits = (bits << 1) | bit
+            out.append(f"{bits:0{digits}X}")
+        out.append("ENDCHAR")
+    out.append("ENDFONT")
+    return "\n".join(out) + "\n", size, ascent
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("font", type=Path, help="TrueType or OpenType outline font")
+    parser.add_argument("line_height", type=int, help="text line height in pixels")
+    parser.add_argument("output", type=Path, help="BDF file to write")
+    parser.add_argument("--charset", type=Path, default=DEFAULT_CHARSET, help="BDF file listing the codepoints")
+    args = parser.parse_args()
+
+    codepoints = charset_of(args.charset)
+    text, size, ascent = bdf_text(args.font, codepoints, args.line_height)
+    args.output.write_text(text, encoding="ascii")
+    print(f"[fontraster] {args.output}: {len(codepoints)} glyphs at {size} px, ascent {ascent}, "
+          f"descent {args.line_height - ascent}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""
+Memory budget report from the linker map
+
+Reads the GNU ld map of a firmware build and prints the IRAM, DRAM and flash bytes of every
+module (a source file of src/, or a library archive) against the budgets in memory_budget.json,
+so the cost of moving code into IRAM (HOT_PATH) is visible on every build.
+
+Runs after each esp12e build as a PlatformIO post script, or by hand on an existing map:
+  python3 scripts/memory_budget.py .pio/build/esp12e/firmware.map
+"""
+import json
+import os
+import re
+import sys
+from pathlib import Path
+
+BUDGET_PATH = Path(__file__).resolve().with_name("memory_budget.json")
+
+# Linker script regions of the ESP8266 core, everything else in the map (debug sections) is ignored
+REGIONS = {"iram1_0_seg": "iram", "dram0_0_seg": "dram", "irom0_0_seg": "flash"}
+KINDS = ("iram", "dram", "flash")
+TOP_MODULES = 15
+
+REGION_LINE = re.compile(r"^(\w+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+# " .text.name  0xADDR  0xSIZE object", the address part may also follow a long name on its own line
+INPUT_LINE = re.compile(r"^\s+(?:([.\w]\S*)\s+)?0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)\s+(\S.*)$")
+ARCHIVE_MEMBER = re.compile(r"(?:^|/)lib([^/()]+)\.a\(.+\)$")
+
+
+def module_of(obj):
+    """Source file under src/ for sketch objects, library name for archive members"""
+    obj = obj.strip().replace("\\", "/")
+    archive = ARCHIVE_MEMBER.search(obj)
+    if archive:
+        return archive.group(1)
+    if "/src/" in obj:
+        obj = obj.split("/src/", 1)[1]
+    return obj[:-2] if obj.endswith(".o") else obj
+
+
+def parse_map(text):
+    """Return (regions, usage): region sizes by kind, and bytes per module and kind"""
+    regions = {}
+    spans = []
+    usage = {}
+    in_memory_map = False
+
+    for line in text.splitlines():
+        if not in_memory_map:
+            match = REGION_LINE.match(line)
+            if match and match.group(1) in REGIONS:
+                kind = REGIONS[match.group(1)]
+                origin = int(match.group(2), 16)
+                length = int(match.group(3), 16)
+                regions[kind] = length
+                spans.append((origin, origin + length, kind))
+            in_memory_map = line.startswith("Linker script and memory map")
+            continue
+
+        match = INPUT_LINE.match(line)
+        if not match:
+            continue
+        address = int(match.group(2), 16)
+        size = int(match.group(3), 16)
+        if size == 0:
+            continue
+        kind = next((k for start, end, k in spans if start <= address < end), None)
+        if kind is None:
+            continue
+        module = usage.setdefault(module_of(match.group(4)), dict.fromkeys(KINDS, 0))
+        module[kind] += size
+
+    return regions, usage
+
+
+def load_budget():
+    try:
+        with open(BUDGET_PATH, encoding="utf-8") as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def report(map_path, out=sys.stdout):
+    """Print the report, return the list of budget overruns"""
+    try:
+        text = Path(map_path).read_text(encoding="utf-8", errors="replace")
+    except OSError:
+        print(f"[memory_budget] No linker map at {map_path}", file=out)
+        return []
+
+    regions, usage = parse_map(text)
+    budget = load_budget()
+    modules = budget.get("modules", {})
+    overruns = []
+
+    print("[memory_budget] region        used       size       free", file=out)
+    for kind in KINDS:
+        if kind not in regions:
+            continue
+        used = sum(module[kind] for module in usage.values())
+        free = regions[kind] - used
+        print(f"[memory_budget] {kind:<6} {used:>11} {regions[kind]:>10} {free:>10}", file=out)
+        headroom = budget.get("headroom", {}).get(kind)
+        if headroom is not None and free < headroom:
+            overruns.append(f"{kind} free {free} below the {headroom} byte headroom")
+
+    ranked = sorted(usage, key=lambda name: (-usage[name]["iram"], -sum(usage[name].values())))
+    shown = ranked[:TOP_MODULES] + [name for name in ranked[TOP_MODULES:] if name in modules]
+
+    print("[memory_budget] module                              iram     dram    flash  budget", file=out)
+    for name in shown:
+        sizes = usage[name]
+        notes = []
+        for kind, limit in modules.get(name, {}).items():
+            notes.append(f"{kind} {sizes.get(kind, 0)}/{limit}")
+            if sizes.get(kind, 0) > limit:
+                overruns.append(f"{name} {kind} {sizes[kind]} over its {limit} byte budget")
+        line = f"[memory_budget] {name[:34]:<34} {sizes['iram']:>6} {sizes['dram']:>8} {sizes['flash']:>8}  "
+        print((line + ", ".join(notes)).rstrip(), file=out)
+
+    for overrun in overruns:
+        print(f"[memory_budget] OVER BUDGET: {overrun}", file=out)
+
+    return overruns
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(2)
+    sys.exit(1 if report(sys.argv[1]) else 0)
+else:
+    from SCons.Script import DefaultEnvironment
+
+    env = DefaultEnvironment()
+    map_file = os.path.join(env.subst("$BUILD_DIR"), env.subst("${PROGNAME}.map"))
+    env.Append(LINKFLAGS=["-Wl,-Map," + map_file])
+
+    def _after_link(target, source, env):
+        report(map_file)
+
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", _after_link)
@@ -68,6 +68,13 @@ auto ConfigManager::load() -> bool {
     String ntp_server_cfg = doc["ntp_server"] | "";
 
     this->lcd_rotation = doc["lcd_rotation"] | lcd_rotation;
+    this->gif_row_skip = doc["gif_row_skip"] | gif_row_skip;
+    this->gif_rgb444 = doc["gif_rgb444"] | gif_rgb444;
+    this->gif_dither = doc["gif_dither"] | gif_dither;
+    this->gif_frame_drop = doc["gif_frame_drop"] | gif_frame_drop;
+    this->gif_native = doc["gif_native"] | gif_native;
+    this->gif_auto_scale = doc["gif_auto_scale"] | gif_auto_scale;
+    this->gif_interlace = doc["gif_interlace"] | gif_interlace;
 
     String nvs_ssid = secure.get("wifi_ssid", "");
     String nvs_password = secure.get("wifi_password", "");
@@ -192,6 +199,13 @@ auto ConfigManager::save() -> bool {
     secure.put("wifi_password", this->getPassword());
 
     doc["lcd_rotation"] = lcd_rotation;
+    doc["gif_row_skip"] = gif_row_skip;
+    doc["gif_rgb444"] = gif_rgb444;
+    doc["gif_dither"] = gif_dither;
+    doc["gif_frame_drop"] = gif_frame_drop;
+    doc["gif_native"] = gif_native;
+    doc["gif_auto_scale"] = gif_auto_scale;
+    doc["gif_interlace"] = gif_interlace;
     if (!this->ntp_server.empty()) {
         doc["ntp_server"] = this->ntp_server.c_str();
     }
@@ -0,0 +1,591 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "display/Compositor.h"
+#include "display/DisplayManager.h"
+#include "display/HotPath.h"
+#include "display/TextRaster.h"
+
+// Strip rows plus one scratch row text layers are rasterized into
+static constexpr size_t STRIP_PIXELS =
+    static_cast<size_t>(Compositor::STRIP_ROWS + 1) * static_cast<size_t>(Compositor::MAX_WIDTH);
+
+/**
+ * @brief Add a filled rectangle layer
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param color Fill colour (RGB565)
+ *
+ * @return Layer slot, -1 if the rectangle leaves the screen or does not fit the budget
+ */
+auto Compositor::addRect(int16_t xPos, int16_t yPos, int16_t width, int16_t height, uint16_t color) -> int {
+    Layer layer;
+    layer.kind = LayerKind::Rect;
+    layer.x = xPos;
+    layer.y = yPos;
+    layer.width = width;
+    layer.height = height;
+    layer.fgColor = toPanelOrder(color);
+
+    return addLayer(layer);
+}
+
+/**
+ * @brief Add a one line text layer, sized for a fixed number of characters so it can be updated
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param maxChars Characters the layer has room for, at most TEXT_MAX - 1
+ * @param text Initial text, cut to maxChars
+ * @param textSize Integer text size
+ * @param fgColor Text colour (RGB565)
+ * @param bgColor Background colour (RGB565)
+ * @param transparentBg true to leave the background out so only the glyphs cover what is under them
+ *
+ * @return Layer slot, -1 if the layer leaves the screen or does not fit the budget
+ */
+auto Compositor::addText(int16_t xPos, int16_t yPos, uint8_t maxChars, const char* text, uint8_t textSize,
+                         uint16_t fgColor, uint16_t bgColor, bool transparentBg) -> int {
+    if (maxChars == 0 || maxChars >= TEXT_MAX || textSize == 0 || text == nullptr) {
+        return -1;
+    }
+
+    Layer layer;
+    layer.kind = LayerKind::Text;
+    layer.keyed = transparentBg;
+    layer.x = xPos;
+    layer.y = yPos;
+    layer.width = static_cast<int16_t>(maxChars * TextRaster::CELL_W * textSize);
+    layer.height = static_cast<int16_t>(TextRaster::CELL_H * textSize);
+    layer.fgColor = toPanelOrder(fgColor);
+    layer.bgColor = toPanelOrder(bgColor);
+    layer.textSize = textSize;
+    strncpy(layer.text.data(), text, maxChars);
+
+    return addLayer(layer);
+}
+
+/**
+ * @brief Add an icon layer drawn from an RGB565 bitmap in flash
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param width Icon width
+ * @param height Icon height
+ * @param pixels PROGMEM bitmap of width x height RGB565 pixels, row by row, must outlive the layer
+ * @param keyColor Bitmap colour (RGB565) that is left transparent
+ *
+ * @return Layer slot, -1 if the icon leaves the screen or does not fit the budget
+ */
+auto Compositor::addIcon(int16_t xPos, int16_t yPos, int16_t width, int16_t height, const uint16_t* pixels,
+                         uint16_t keyColor) -> int {
+    if (pixels == nullptr) {
+        return -1;
+    }
+
+    Layer layer;
+    layer.kind = LayerKind::Icon;
+    layer.keyed = true;
+    layer.x = xPos;
+    layer.y = yPos;
+    layer.width = width;
+    layer.height = height;
+    layer.bgColor = keyColor;
+    layer.icon = pixels;
+
+    return addLayer(layer);
+}
+
+/**
+ * @brief Replace the text of a text layer, redrawn by the next flush()
+ *
+ * @param layer Layer slot
+ * @param text New text, cut to the characters the layer was made for
+ *
+ * @return false if the slot holds no text layer
+ */
+auto Compositor::setText(int layer, const char* text) -> bool {
+    Layer* target = shownLayer(layer);
+    if (target == nullptr || target->kind != LayerKind::Text || text == nullptr) {
+        return false;
+    }
+
+    const auto maxChars = static_cast<size_t>(target->width / (TextRaster::CELL_W * target->textSize));
+    std::array<char, TEXT_MAX> updated{};
+    strncpy(updated.data(), text, maxChars);
+    if (updated != target->text) {
+        target->text = updated;
+        target->dirty = true;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Change the colours of a rectangle or text layer, redrawn by the next flush()
+ *
+ * @param layer Layer slot
+ * @param fgColor Fill or text colour (RGB565)
+ * @param bgColor Text background colour (RGB565), unused by rectangles
+ *
+ * @return false if the slot holds no rectangle or text layer
+ */
+auto Compositor::setColors(int layer, uint16_t fgColor, uint16_t bgColor) -> bool {
+    Layer* target = shownLayer(layer);
+    if (target == nullptr || target->kind == LayerKind::Icon) {
+        return false;
+    }
+
+    target->fgColor = toPanelOrder(fgColor);
+    target->bgColor = toPanelOrder(bgColor);
+    target->dirty = true;
+
+    return true;
+}
+
+/**
+ * @brief Take a layer down, the next flush() puts back what is under it
+ *
+ * @param layer Layer slot
+ *
+ * @return false if the slot holds no layer
+ */
+auto Compositor::remove(int layer) -> bool {
+    Layer* target = shownLayer(layer);
+    if (target == nullptr) {
+        return false;
+    }
+
+    target->state = LayerState::Removed;
+    target->dirty = true;
+
+    return true;
+}
+
+/**
+ * @brief Take every layer down, restored by the next flush()
+ *
+ * @return void
+ */
+auto Compositor::clear() -> void {
+    for (int i = 0; i < MAX_LAYERS; ++i) {
+        remove(i);
+    }
+}
+
+/**
+ * @brief Note that the screen was filled behind the compositor's back
+ *
+ * Every backing now holds the fill colour and is known, every layer is redrawn by the next flush(),
+ * layers already taken down are simply dropped
+ *
+ * @param bgColor Colour the screen was filled with (RGB565)
+ *
+ * @return void
+ */
+auto Compositor::markCleared(uint16_t bgColor) -> void {
+    m_background = toPanelOrder(bgColor);
+
+    for (auto& layer : m_layers) {
+        if (layer.state == LayerState::Removed) {
+            release(layer);
+        } else if (layer.state == LayerState::Shown) {
+            std::fill_n(layer.backing, static_cast<size_t>(layer.width) * static_cast<size_t>(layer.height),
+                        m_background);
+            layer.known = true;
+            layer.dirty = true;
+        }
+    }
+}
+
+/**
+ * @brief Note that every row under the layers was just sent again through composeRow()
+ *
+ * Called once the GIF under the layers was replayed from a frame that repaints its whole canvas
+ *
+ * @return void
+ */
+auto Compositor::markBackingsKnown() -> void {
+    for (auto& layer : m_layers) {
+        if (layer.state != LayerState::Free) {
+            layer.known = true;
+        }
+    }
+}
+
+/**
+ * @brief Redraw the changed layers, one strip at a time
+ *
+ * Only strips that overlap a changed layer are composed: for each such layer the strip rows are
+ * rebuilt from its backing with every layer painted over them, then sent through one window.
+ * Called between frames, never while a GIF frame is being written
+ *
+ * @return void
+ */
+auto Compositor::flush() -> void {
+    if (!isDirty()) {
+        return;
+    }
+
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr) {
+        return;
+    }
+
+    auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
+    const int screenH = static_cast<int>(gfx->height());
+
+    DisplayManager::waitPanelIdle();
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    tft->startWrite();
+
+    for (int top = 0; top < screenH; top += STRIP_ROWS) {
+        const int bottom = std::min(top + STRIP_ROWS, screenH);
+        bool composed = false;
+
+        for (const auto& layer : m_layers) {
+            const int first = std::max<int>(top, layer.y);
+            const int last = std::min<int>(bottom, layer.y + layer.height);
+            if (!layer.dirty || first >= last) {
+                continue;
+            }
+
+            const auto width = static_cast<size_t>(layer.width);
+            for (int row = first; row < last; ++row) {
+                uint16_t* line = m_strip + static_cast<size_t>(row - first) * width;
+                std::copy_n(layer.backing + static_cast<size_t>(row - layer.y) * width, width, line);
+                mergeLayers(row, layer.x, line, layer.width);
+            }
+
+            const auto pixels = static_cast<uint32_t>(width) * static_cast<uint32_t>(last - first);
+            tft->writeAddrWindow(layer.x, static_cast<int16_t>(first), static_cast<uint16_t>(layer.width),
+                                 static_cast<uint16_t>(last - first));
+            DisplayManager::writePanelPixels(m_strip, pixels);
+
+            ++m_stats.pushes;
+            m_stats.bytes += PANEL_ADDR_WINDOW_BYTES + pixels * 2U;
+            composed = true;
+        }
+
+        if (composed) {
+            ++m_stats.strips;
+        }
+    }
+
+    tft->endWrite();
+    ++m_stats.flushes;
+
+    for (auto& layer : m_layers) {
+        layer.dirty = false;
+        if (layer.state == LayerState::Removed) {
+            release(layer);
+        }
+    }
+}
+
+/**
+ * @brief Merge the layers into a row segment about to be sent to the panel
+ *
+ * The segment's pixels under each layer are kept as its backing first, then the layers are
+ * painted over it. Rows no layer crosses are left alone
+ *
+ * @param yPos Panel row
+ * @param xStart Panel column of the first pixel
+ * @param pixels Segment in panel byte order (RGB565), changed in place
+ * @param len Number of pixels
+ *
+ * @return void
+ */
+auto HOT_PATH Compositor::composeRow(int yPos, int xStart, uint16_t* pixels, int len) -> void {
+    if (m_strip != nullptr && mergeLayers(yPos, xStart, pixels, len)) {
+        ++m_stats.composedRows;
+    }
+}
+
+/**
+ * @brief Check whether any layer is up, GIF lines then go through composeRow()
+ *
+ * @return true while a layer is shown or waits for flush() to take it down
+ */
+auto Compositor::isActive() const -> bool { return m_strip != nullptr; }
+
+/**
+ * @brief Check whether a layer changed since the last flush()
+ *
+ * @return true if flush() has something to redraw
+ */
+auto Compositor::isDirty() const -> bool {
+    for (const auto& layer : m_layers) {
+        if (layer.dirty) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Check whether a layer waiting for flush() would put back a guessed background
+ *
+ * @return true if a removed layer's backing still holds pixels no GIF line has refreshed
+ */
+auto Compositor::hasUnknownBacking() const -> bool {
+    for (const auto& layer : m_layers) {
+        if (layer.state == LayerState::Removed && !layer.known) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Count the layers shown
+ *
+ * @return Layers added and not removed
+ */
+auto Compositor::layerCount() const -> int {
+    int count = 0;
+    for (const auto& layer : m_layers) {
+        if (layer.state == LayerState::Shown) {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+/**
+ * @brief Heap held by the backings and the strip buffer
+ *
+ * @return Bytes allocated, 0 without layers
+ */
+auto Compositor::heapBytes() const -> uint32_t {
+    uint32_t bytes = m_strip != nullptr ? static_cast<uint32_t>(STRIP_PIXELS * sizeof(uint16_t)) : 0U;
+    for (const auto& layer : m_layers) {
+        if (layer.state != LayerState::Free) {
+            bytes += static_cast<uint32_t>(layer.width) * static_cast<uint32_t>(layer.height) * 2U;
+        }
+    }
+
+    return bytes;
+}
+
+/**
+ * @brief Get the composition and redraw counters
+ *
+ * @return Counters since boot
+ */
+auto Compositor::getStats() const -> const CompositorStats& { return m_stats; }
+
+/**
+ * @brief Give a layer a slot and a backing, the strip buffer comes with the first layer
+ *
+ * The backing starts as the last known screen colour and is not known yet: the frames drawn under
+ * the layer only replace the pixels they cover, a transparent or partial frame leaves the rest
+ *
+ * @param layer Layer to add, state and backing are filled in here
+ *
+ * @return Layer slot, -1 if the layer leaves the screen, no slot is free or the heap is short
+ */
+auto Compositor::addLayer(const Layer& layer) -> int {
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr || layer.x < 0 || layer.y < 0 || layer.width <= 0 || layer.height <= 0 ||
+        layer.x + layer.width > std::min<int>(gfx->width(), MAX_WIDTH) || layer.y + layer.height > gfx->height()) {
+        return -1;
+    }
+
+    int slot = 0;
+    while (slot < MAX_LAYERS && m_layers[static_cast<size_t>(slot)].state != LayerState::Free) {
+        ++slot;
+    }
+    if (slot == MAX_LAYERS) {
+        return -1;
+    }
+
+    const size_t pixels = static_cast<size_t>(layer.width) * static_cast<size_t>(layer.height);
+    const uint32_t stripBytes = m_strip == nullptr ? static_cast<uint32_t>(STRIP_PIXELS * sizeof(uint16_t)) : 0U;
+    const uint32_t backingBytes = heapBytes() - (m_strip != nullptr ? STRIP_PIXELS * sizeof(uint16_t) : 0U);
+    if (backingBytes + pixels * 2U > BUDGET_BYTES ||
+        EspClass::getMaxFreeBlockSize() < pixels * 2U + stripBytes + DISPLAY_HEAP_RESERVE) {
+        return -1;
+    }
+
+    if (m_strip == nullptr) {
+        m_strip = new (std::nothrow) uint16_t[STRIP_PIXELS];
+        if (m_strip == nullptr) {
+            return -1;
+        }
+    }
+
+    auto* backing = new (std::nothrow) uint16_t[pixels];
+    if (backing == nullptr) {
+        if (layerCount() == 0) {
+            delete[] m_strip;
+            m_strip = nullptr;
+        }
+
+        return -1;
+    }
+
+    std::fill_n(backing, pixels, m_background);
+    auto& added = m_layers[static_cast<size_t>(slot)];
+    added = layer;
+    added.state = LayerState::Shown;
+    added.dirty = true;
+    added.backing = backing;
+
+    return slot;
+}
+
+/**
+ * @brief Keep a row segment as the backing of the layers it crosses, then paint them over it
+ *
+ * Layers waiting to be taken down keep their backing fresh but are no longer painted
+ *
+ * @param yPos Panel row
+ * @param xStart Panel column of the first pixel
+ * @param pixels Segment in panel byte order, changed in place
+ * @param len Number of pixels
+ *
+ * @return true if a layer crosses the segment
+ */
+auto HOT_PATH Compositor::mergeLayers(int yPos, int xStart, uint16_t* pixels, int len) -> bool {
+    bool crossed = false;
+
+    for (auto& layer : m_layers) {
+        const int colStart = std::max<int>(xStart, layer.x);
+        const int colEnd = std::min<int>(xStart + len, layer.x + layer.width);
+        if (layer.state == LayerState::Free || yPos < layer.y || yPos >= layer.y + layer.height ||
+            colStart >= colEnd) {
+            continue;
+        }
+
+        const auto offset = static_cast<size_t>(yPos - layer.y) * static_cast<size_t>(layer.width);
+        std::copy(pixels + (colStart - xStart), pixels + (colEnd - xStart),
+                  layer.backing + offset + static_cast<size_t>(colStart - layer.x));
+        crossed = true;
+    }
+
+    if (!crossed) {
+        return false;
+    }
+
+    for (const auto& layer : m_layers) {
+        const int colStart = std::max<int>(xStart, layer.x);
+        const int colEnd = std::min<int>(xStart + len, layer.x + layer.width);
+        if (layer.state != LayerState::Shown || yPos < layer.y || yPos >= layer.y + layer.height ||
+            colStart >= colEnd) {
+            continue;
+        }
+
+        paintSpan(layer, yPos - layer.y, colStart - layer.x, colEnd - layer.x, pixels + (colStart - xStart));
+    }
+
+    return true;
+}
+
+/**
+ * @brief Paint part of one layer row over a line
+ *
+ * @param layer Layer to paint
+ * @param row Row inside the layer
+ * @param colStart First column inside the layer
+ * @param colEnd Column after the last one
+ * @param out Line pixels for colStart..colEnd, in panel byte order
+ *
+ * @return void
+ */
+auto HOT_PATH Compositor::paintSpan(const Layer& layer, int row, int colStart, int colEnd, uint16_t* out) -> void {
+    const auto count = static_cast<size_t>(colEnd - colStart);
+
+    switch (layer.kind) {
+        case LayerKind::Rect:
+            std::fill_n(out, count, layer.fgColor);
+            break;
+
+        case LayerKind::Text: {
+            uint16_t* scratch = m_strip + static_cast<size_t>(STRIP_ROWS) * MAX_WIDTH;
+            TextRaster::rasterizeRow(layer.text.data(), TEXT_MAX, layer.textSize, row, layer.fgColor, layer.bgColor,
+                                     scratch, colEnd);
+            for (size_t i = 0; i < count; ++i) {
+                const uint16_t pixel = scratch[static_cast<size_t>(colStart) + i];
+                if (!layer.keyed || pixel != layer.bgColor) {
+                    out[i] = pixel;
+                }
+            }
+            break;
+        }
+
+        case LayerKind::Icon: {
+            const uint16_t* src = layer.icon + static_cast<size_t>(row) * static_cast<size_t>(layer.width) +
+                                  static_cast<size_t>(colStart);
+            for (size_t i = 0; i < count; ++i) {
+                const auto pixel = static_cast<uint16_t>(pgm_read_word(src + i));
+                if (pixel != layer.bgColor) {
+                    out[i] = toPanelOrder(pixel);
+                }
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Free a layer's backing and its slot, and the strip buffer with the last layer
+ *
+ * @param layer Layer to drop
+ *
+ * @return void
+ */
+auto Compositor::release(Layer& layer) -> void {
+    delete[] layer.backing;
+    layer = Layer{};
+
+    for (const auto& other : m_layers) {
+        if (other.state != LayerState::Free) {
+            return;
+        }
+    }
+
+    delete[] m_strip;
+    m_strip = nullptr;
+}
+
+/**
+ * @brief Look up a shown layer by slot
+ *
+ * @param layer Layer slot
+ *
+ * @return The layer, nullptr for a bad slot or a layer not shown
+ */
+auto Compositor::shownLayer(int layer) -> Layer* {
+    if (layer < 0 || layer >= MAX_LAYERS || m_layers[static_cast<size_t>(layer)].state != LayerState::Shown) {
+        return nullptr;
+    }
+
+    return &m_layers[static_cast<size_t>(layer)];
+}
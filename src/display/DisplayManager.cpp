@@ -26,9 +26,20 @@
 #include "project_version.h"
 #include "display/DisplayManager.h"
 #include "config/ConfigManager.h"
+#include "display/Font.h"
 #include "display/Gif.h"
+#include "display/GifPlaylist.h"
+#include "display/GifTranscoder.h"
+#include "display/HotPath.h"
+#include "display/SpiBurstBus.h"
+#include "display/TextRaster.h"
 
 static Gif s_gif;
+static GifPlaylist s_playlist(s_gif);
+static ScrollTicker s_ticker;
+static OffscreenBand s_band;
+static Compositor s_compositor;
+static PanelColorMode s_panelColorMode = PanelColorMode::Rgb565;
 
 extern ConfigManager configManager;
 
@@ -39,104 +50,16 @@ static constexpr uint32_t LCD_HARDWARE_RESET_DELAY_MS = 120;
 static constexpr uint32_t LCD_BEGIN_DELAY_MS = 10;
 static constexpr int16_t DISPLAY_PADDING = 10;
 static constexpr int16_t DISPLAY_INFO_Y = 100;
+static constexpr int16_t STATUS_BAR_HEIGHT = 24;
+static constexpr uint8_t STATUS_BAR_TEXT_SIZE = 2;
 
-static constexpr int WRAP_MAX_CHARS = 128;
-static constexpr int WRAP_MAX_LINE_SLOTS = 10;
-
-/**
- * @brief Push the current line buffer into the output lines array
- *
- * @param outLines The output lines array
- * @param lineBuf The current line buffer
- * @param lineLen The current line length
- * @param lineCount The current line count
- * @param maxLines The maximum number of lines allowed
- *
- * @return void
- */
-static void wrapPushLine(std::array<std::array<char, WRAP_MAX_CHARS>, WRAP_MAX_LINE_SLOTS>& outLines,
-                         std::array<char, WRAP_MAX_CHARS>& lineBuf, int& lineLen, int& lineCount, int maxLines) {
-    if (lineCount >= maxLines) {
-        return;
-    }
-
-    lineBuf[lineLen] = '\0';
-    strncpy(outLines[lineCount].data(), lineBuf.data(), WRAP_MAX_CHARS - 1);
-    outLines[lineCount][WRAP_MAX_CHARS - 1] = '\0';
-    ++lineCount;
-
-    lineLen = 0;
-    lineBuf[0] = '\0';
-}
-
-/**
- * @brief Append a word to the current line buffer, wrapping if necessary
- *
- * @param outLines The output lines array
- * @param lineBuf The current line buffer
- * @param lineLen The current line length
- * @param wordBuf The word buffer to append
- * @param wordLen The word length
- * @param maxCharsPerLine The maximum characters per line
- * @param lineCount The current line count
- * @param maxLines The maximum number of lines allowed
- *
- * @return void
- */
-static void wrapAppendWord(std::array<std::array<char, WRAP_MAX_CHARS>, WRAP_MAX_LINE_SLOTS>& outLines,
-                           std::array<char, WRAP_MAX_CHARS>& lineBuf, int& lineLen,
-                           std::array<char, WRAP_MAX_CHARS>& wordBuf, int& wordLen, int maxCharsPerLine, int& lineCount,
-                           int maxLines) {
-    if (wordLen == 0) {
-        return;
-    }
-
-    if (wordLen > maxCharsPerLine) {
-        if (lineLen != 0) {
-            wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
-            if (lineCount >= maxLines) {
-                wordLen = 0;
-
-                return;
-            }
-        }
-        int copyLen = (wordLen > maxCharsPerLine) ? maxCharsPerLine : wordLen;
-        memcpy(lineBuf.data(), wordBuf.data(), static_cast<size_t>(copyLen));
-        lineLen = copyLen;
-        wordLen = 0;
-        wordBuf[0] = '\0';
-
-        return;
-    }
-    if (lineLen == 0) {
-        memcpy(lineBuf.data(), wordBuf.data(), static_cast<size_t>(wordLen));
-        lineLen = wordLen;
-        wordLen = 0;
-        wordBuf[0] = '\0';
-
-        return;
-    }
-    if ((lineLen + 1 + wordLen) <= maxCharsPerLine) {
-        lineBuf[lineLen] = ' ';
-        memcpy(lineBuf.data() + lineLen + 1, wordBuf.data(), static_cast<size_t>(wordLen));
-        lineLen += 1 + wordLen;
-        wordLen = 0;
-        wordBuf[0] = '\0';
-
-        return;
-    }
-    wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
-    if (lineCount >= maxLines) {
-        wordLen = 0;
-
-        return;
-    }
-
-    memcpy(lineBuf.data(), wordBuf.data(), static_cast<size_t>(wordLen));
-    lineLen = wordLen;
-    wordLen = 0;
-    wordBuf[0] = '\0';
-}
+// Send pre-swapped pixel data straight through the HSPI FIFO, DISPLAY_HWSPI_WRITES falls back to
+// Arduino_HWSPI::writeBytes
+#ifdef DISPLAY_HWSPI_WRITES
+static constexpr bool LCD_USE_SPI_BURST = false;
+#else
+static constexpr bool LCD_USE_SPI_BURST = true;
+#endif
 
 // Screen cmd
 static constexpr uint8_t ST7789_SLEEP_DELAY_MS = 120;
@@ -149,6 +72,9 @@ static constexpr uint8_t ST7789_TEARING_EFFECT = 0x35;
 static constexpr uint8_t ST7789_MEMORY_ACCESS_CONTROL = 0x36;
 static constexpr uint8_t ST7789_COLORMODE = 0x3A;
 static constexpr uint8_t ST7789_COLORMODE_RGB565 = 0x05;
+static constexpr uint8_t ST7789_COLORMODE_RGB444 = 0x03;
+static constexpr uint8_t ST7789_SCROLL_AREA = 0x33;
+static constexpr uint8_t ST7789_SCROLL_START = 0x37;
 
 static constexpr uint8_t ST7789_POWER_B7 = 0xB7;
 static constexpr uint8_t ST7789_POWER_BB = 0xBB;
@@ -233,6 +159,16 @@ static inline void ST7789_WriteCommand(uint8_t cmd) { g_lcdBus.writeCommand(cmd)
  */
 static inline void ST7789_WriteData(uint8_t data) { g_lcdBus.write(data); }
 
+/**
+ * @brief Write a 16-bit parameter to the ST7789, high byte first
+ *
+ * @return void
+ */
+static inline void ST7789_WriteData16(uint16_t data) {
+    ST7789_WriteData(static_cast<uint8_t>(data >> 8U));
+    ST7789_WriteData(static_cast<uint8_t>(data & 0xFFU));
+}
+
 /**
  * @brief Run a vendor-specific initialization sequence for the ST7789 panel
  *
@@ -279,6 +215,7 @@ static void lcdRunVendorInit() {
 
     ST7789_WriteCommand(ST7789_COLORMODE);
     ST7789_WriteData(ST7789_COLORMODE_RGB565);
+    s_panelColorMode = PanelColorMode::Rgb565;
 
     ST7789_WriteCommand(ST7789_POWER_B7);
     ST7789_WriteData(ST7789_B7_PARAM_DEFAULT);
@@ -380,6 +317,9 @@ static void lcdEnsureInit() {
     // is after reset "initializes" the SPI interface of the display, as CS is tied to GND?
     // ...strange that SPI_MODE0 will not work as the IC doesn't care about CLK's polarity
     g_lcdBus.begin((int32_t)LCD_SPI_HZ, (int8_t)LCD_SPI_MODE);
+    if (LCD_USE_SPI_BURST) {
+        SpiBurstBus::begin();
+    }
     lcdHardReset();
     lcdRunVendorInit();
     delay(LCD_BEGIN_DELAY_MS);
@@ -394,84 +334,17 @@ static void lcdEnsureInit() {
     Logger::info("Initialization completed", "DisplayManager");
 }
 
-/**
- * @brief Wrap text into lines fitting within max characters and lines
- *
- * @param text The input text to wrap
- * @param maxCharsPerLine Maximum characters allowed per line
- * @param maxLines Maximum number of lines allowed
- * @param outLines Output array to hold the wrapped lines
- *
- * @return The number of lines used
- */
-static auto lcdWrapTextToBuffer(const String& text, int maxCharsPerLine, int maxLines,
-                                std::array<std::array<char, WRAP_MAX_CHARS>, WRAP_MAX_LINE_SLOTS>& outLines) -> int {
-    int lineCount = 0;
-
-    for (auto& row : outLines) {
-        row[0] = '\0';
-    }
-
-    std::array<char, WRAP_MAX_CHARS> lineBuf{};
-    std::array<char, WRAP_MAX_CHARS> wordBuf{};
-    int lineLen = 0;
-    int wordLen = 0;
-
-    for (uint32_t i = 0; i < text.length(); ++i) {
-        char chr = text.charAt(i);
-
-        if (chr == '\r') {
-            continue;
-        }
-
-        if (chr == '\n') {
-            wrapAppendWord(outLines, lineBuf, lineLen, wordBuf, wordLen, maxCharsPerLine, lineCount, maxLines);
-            wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
-
-            if (lineCount >= maxLines) {
-                break;
-            }
-
-            continue;
-        }
-
-        if (chr == ' ' || chr == '\t') {
-            wrapAppendWord(outLines, lineBuf, lineLen, wordBuf, wordLen, maxCharsPerLine, lineCount, maxLines);
-
-            if (lineCount >= maxLines) {
-                break;
-            }
-
-            continue;
-        }
-
-        if (wordLen + 1 < WRAP_MAX_CHARS) {
-            wordBuf[wordLen++] = chr;
-            wordBuf[wordLen] = '\0';
-        }
-    }
-
-    wrapAppendWord(outLines, lineBuf, lineLen, wordBuf, wordLen, maxCharsPerLine, lineCount, maxLines);
-
-    if (lineLen != 0 && lineCount < maxLines) {
-        wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
-    }
-
-    if (lineCount == 0) {
-        outLines[0][0] = '\0';
-        lineCount = 1;
-    }
-
-    return lineCount;
-}
-
 /**
  * @brief Draw text on the display with simple word-wrapping
  *
+ * Text sizes with a generated font (UTF-8, proportional, FontEngine) are wrapped on their pixel
+ * widths, larger sizes fall back to the scaled 6x8 cell. Either way each wrapped line is composed
+ * in RAM and sent through one address window
+ *
  * @param startX Starting X coordinate in pixels
  * @param startY Starting Y coordinate in pixels
- * @param text The text to draw (can contain newlines)
- * @param textSize Font size multiplier (integer)
+ * @param text The text to draw, UTF-8 (can contain newlines)
+ * @param textSize Text size, 1 for 10 px lines
  * @param fgColor Foreground color (16-bit RGB565)
  * @param bgColor Background color (16-bit RGB565)
  * @param clearBg If true, clears the background rectangle before drawing
@@ -497,6 +370,28 @@ static void lcdDrawTextWrapped(int16_t startX, int16_t startY, const String& tex
         return;
     }
 
+    TextRaster::Lines lines{};
+    // Clearing the background pads every line to the right edge instead of a separate fill
+    const auto padWidth = static_cast<int16_t>(clearBg ? screenW - startX : 0);
+
+    const Font* font = FontEngine::forTextSize(textSize);
+    if (font != nullptr) {
+        const int maxLines = (screenH - startY) / font->lineHeight;
+        if (maxLines <= 0) {
+            Logger::warn("No space for text", "DisplayManager");
+
+            return;
+        }
+
+        const int lineCount = FontEngine::wrap(*font, text, screenW - startX, maxLines, lines);
+        for (int li = 0; li < lineCount; ++li) {
+            FontEngine::drawLine(*font, startX, static_cast<int16_t>(startY + li * font->lineHeight),
+                                 lines[li].data(), fgColor, bgColor, padWidth);
+        }
+
+        return;
+    }
+
     const auto charW = static_cast<int16_t>(6 * textSize);
     const auto charH = static_cast<int16_t>(8 * textSize);
     if (charW <= 0 || charH <= 0) {
@@ -513,25 +408,15 @@ static void lcdDrawTextWrapped(int16_t startX, int16_t startY, const String& tex
         return;
     }
 
-    if (maxLines > WRAP_MAX_LINE_SLOTS) {
-        maxLines = WRAP_MAX_LINE_SLOTS;
-    }
-
-    std::array<std::array<char, WRAP_MAX_CHARS>, WRAP_MAX_LINE_SLOTS> lines{};
-    int lineCount = lcdWrapTextToBuffer(text, maxCharsPerLine, maxLines, lines);
-
-    if (clearBg) {
-        const auto heightPixels = static_cast<int16_t>(static_cast<int>(lineCount) * static_cast<int>(charH));
-        g_lcd.fillRect(startX, startY, static_cast<int16_t>(screenW - startX), static_cast<int16_t>(heightPixels),
-                       bgColor);
+    if (maxLines > TextRaster::WRAP_MAX_LINES) {
+        maxLines = TextRaster::WRAP_MAX_LINES;
     }
 
-    g_lcd.setTextSize(textSize);
-    g_lcd.setTextColor(fgColor, bgColor);
+    int lineCount = TextRaster::wrap(text, maxCharsPerLine, maxLines, lines);
 
     for (int li = 0; li < lineCount; ++li) {
-        g_lcd.setCursor(startX, static_cast<int16_t>(startY + li * charH));
-        g_lcd.print(lines[li].data());
+        TextRaster::drawLine(startX, static_cast<int16_t>(startY + li * charH), lines[li].data(), textSize, fgColor,
+                             bgColor, padWidth);
     }
 }
 
@@ -552,6 +437,7 @@ auto DisplayManager::begin() -> void { lcdEnsureInit(); }
 auto DisplayManager::drawStartup(String currentIP) -> void {
     int constexpr rgbDelayMs = 1000;
 
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
     g_lcd.fillScreen(LCD_RED);
     delay(rgbDelayMs);
     g_lcd.fillScreen(LCD_GREEN);
@@ -589,8 +475,8 @@ auto DisplayManager::drawStartup(String currentIP) -> void {
  *
  * @param x Starting X coordinate in pixels
  * @param y Starting Y coordinate in pixels
- * @param text The text to draw (can contain newlines)
- * @param textSize Font size multiplier (integer)
+ * @param text The text to draw, UTF-8 (can contain newlines)
+ * @param textSize Text size, 1..4 use the generated fonts (10 px lines per step), larger the scaled 6x8 cell
  * @param fg Foreground color (16-bit RGB565)
  * @param bg Background color (16-bit RGB565)
  * @param clearBg If true, clears the background rectangle before drawing
@@ -599,6 +485,8 @@ auto DisplayManager::drawStartup(String currentIP) -> void {
  */
 void DisplayManager::drawTextWrapped(int16_t xPos, int16_t yPos, const String& text, uint8_t textSize, uint16_t fgColor,
                                      uint16_t bgColor, bool clearBg) {
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    s_gif.invalidatePanelRows();
     lcdDrawTextWrapped(xPos, yPos, text, textSize, fgColor, bgColor, clearBg);
 }
 
@@ -620,6 +508,8 @@ void DisplayManager::drawLoadingBar(float progress, int yPos, int barWidth, int
     auto barWidth16 = static_cast<int16_t>(barWidth);
     auto barHeight16 = static_cast<int16_t>(barHeight);
 
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    s_gif.invalidatePanelRows();
     g_lcd.fillRect(barXPos16, yPos16, barWidth16, barHeight16, bgColor);
 
     auto fillWidthF = static_cast<float>(barWidth) * progress;
@@ -632,73 +522,617 @@ void DisplayManager::drawLoadingBar(float progress, int yPos, int barWidth, int
 }
 
 /**
- * @brief Play a single GIF file in full screen mode (blocking)
+ * @brief Apply the GIF options from the configuration to the player
+ *
+ * @return void
+ */
+static void applyGifConfig() {
+    s_gif.setRowSkipEnabled(configManager.gif_row_skip);
+    s_gif.setRgb444Enabled(configManager.gif_rgb444);
+    s_gif.setDitherEnabled(configManager.gif_dither);
+    s_gif.setFrameDropEnabled(configManager.gif_frame_drop);
+    s_gif.setNativeEnabled(configManager.gif_native);
+    s_gif.setAutoScaleEnabled(configManager.gif_auto_scale);
+    s_gif.setInterlaceEnabled(configManager.gif_interlace);
+    s_gif.setCompositor(&s_compositor);
+}
+
+/**
+ * @brief Replay the GIF frame under overlays being taken down whose backing is only a guess
+ *
+ * A layer added during playback only learnt the pixels drawn since, a transparent or partial frame
+ * leaves the rest as the background colour. Without a frame index the guess is put back
+ *
+ * @return void
+ */
+static void restoreUnderOverlays() {
+    if (s_gif.isPlaying() && s_compositor.hasUnknownBacking()) {
+        (void)s_gif.redrawUnderOverlays();
+    }
+}
+
+/**
+ * @brief Play a single GIF file in full screen mode, replacing the queue
+ *
+ * Returns once the file is open, frames are then played from update()
  *
  * @param path Path to the GIF file on LittleFS
- * @param timeMs Duration to play the GIF in milliseconds (0 = play full GIF)
- * @return true if played successfully, false on error
+ * @param timeMs Maximum time to play the GIF in milliseconds (0 = loop until stopped)
+ * @return true if playback started, false on error
  */
 auto DisplayManager::playGifFullScreen(const String& path, uint32_t timeMs) -> bool {
-    // Ensure any currently playing GIF is stopped so we can start a new one
-    s_gif.stop();
+    s_ticker.end();
+    applyGifConfig();
 
-    if (!s_gif.begin()) {
-        return false;
-    }
+    GifQueueEntry entry;
+    entry.path = path;
+    entry.durationMs = timeMs;
+    entry.loops = timeMs == 0 ? 0 : 1;
+
+    return s_playlist.playNow(entry);
+}
+
+/**
+ * @brief Append a GIF to the playback queue, it starts once the entries before it are done
+ *
+ * @param entry Path on LittleFS and how long to play it
+ * @return true if queued, false if the queue is full
+ */
+auto DisplayManager::enqueueGif(const GifQueueEntry& entry) -> bool {
+    s_ticker.end();
+    applyGifConfig();
+
+    return s_playlist.enqueue(entry);
+}
+
+/**
+ * @brief End the current queue entry and start the next one
+ *
+ * @return true if another entry is playing
+ */
+auto DisplayManager::skipGif() -> bool { return s_playlist.skip(); }
+
+/**
+ * @brief Keep finished queue entries at the end of the queue instead of removing them
+ *
+ * @param enabled true to repeat the queue
+ */
+auto DisplayManager::setGifQueueRepeat(bool enabled) -> void { s_playlist.setRepeat(enabled); }
+
+/**
+ * @brief Get the GIF playback queue
+ *
+ * @return The playlist, entry 0 is the one playing
+ */
+auto DisplayManager::getGifPlaylist() -> const GifPlaylist& { return s_playlist; }
+
+/**
+ * @brief Jump to a frame of the GIF playing, using its frame index
+ *
+ * @param frame Frame number
+ * @return true if the frame is shown, false if nothing indexed is playing or the frame does not exist
+ */
+auto DisplayManager::seekGif(uint16_t frame) -> bool { return s_gif.seekToFrame(frame); }
+
+/**
+ * @brief Scale GIF playback speed, kept for the following files
+ *
+ * @param percent Speed in percent of the authored frame delays (50..400)
+ */
+auto DisplayManager::setGifSpeed(uint16_t percent) -> void { s_gif.setSpeed(percent); }
+
+/**
+ * @brief Get the position of GIF playback in the current file
+ *
+ * @return Next frame, frame count (0 without a frame index) and speed
+ */
+auto DisplayManager::getGifPosition() -> GifPosition { return s_gif.getPosition(); }
+
+/**
+ * @brief Get the scale of the GIF playing
+ *
+ * @return Enlargement and decimation factors, 1 and 1 when unscaled
+ */
+auto DisplayManager::getGifScale() -> GifScale { return s_gif.getScale(); }
+
+/**
+ * @brief Stop GIF playback and empty the queue
+ *
+ * @return true
+ */
+auto DisplayManager::stopGif() -> bool {
+    s_playlist.clear();
 
     DisplayManager::clearScreen();
 
-    s_gif.setLoopEnabled(timeMs == 0);
+    return true;
+}
+
+/**
+ * @brief Advance GIF playback and the queue, called from loop()
+ *
+ * Uploaded GIFs are converted in the background only while nothing plays, a running ticker
+ * scrolls by the rows due since the last call
+ *
+ * @return void
+ */
+auto DisplayManager::update() -> void {
+    s_playlist.update();
+    s_ticker.update();
+    s_compositor.flush();
+
+    if (configManager.gif_native) {
+        GifTranscoder::setAutoScaleEnabled(configManager.gif_auto_scale);
+        GifTranscoder::update(!s_gif.isPlaying() && !s_playlist.isActive());
+    }
+}
+
+/**
+ * @brief Clear the entire display to black
+ *
+ * @return void
+ */
+auto DisplayManager::clearScreen() -> void {
+    s_ticker.end();
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    s_gif.markPanelCleared();
+    g_lcd.fillScreen(LCD_BLACK);
+    s_compositor.markCleared(LCD_BLACK);
+}
+
+/**
+ * @brief Clear the display to black around a rectangle, leaving the rectangle untouched
+ *
+ * @param xPos Left edge of the kept rectangle
+ * @param yPos Top edge of the kept rectangle
+ * @param width Width of the kept rectangle
+ * @param height Height of the kept rectangle
+ *
+ * @return void
+ */
+auto DisplayManager::clearOutside(int16_t xPos, int16_t yPos, int16_t width, int16_t height) -> void {
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    s_gif.invalidatePanelRows();
+
+    const int16_t right = static_cast<int16_t>(xPos + width);
+    const int16_t bottom = static_cast<int16_t>(yPos + height);
+
+    if (yPos > 0) {
+        g_lcd.fillRect(0, 0, LCD_W, yPos, LCD_BLACK);
+    }
+    if (bottom < LCD_H) {
+        g_lcd.fillRect(0, bottom, LCD_W, static_cast<int16_t>(LCD_H - bottom), LCD_BLACK);
+    }
+    if (xPos > 0) {
+        g_lcd.fillRect(0, yPos, xPos, height, LCD_BLACK);
+    }
+    if (right < LCD_W) {
+        g_lcd.fillRect(right, yPos, static_cast<int16_t>(LCD_W - right), height, LCD_BLACK);
+    }
+
+    // Overlays were painted over, the GIF rows sent next refill their backings
+    s_compositor.markCleared(LCD_BLACK);
+}
+
+/**
+ * @brief Write pixels that are already in panel (big-endian RGB565) byte order
+ *
+ * Must be called inside an open address window, no byte swap is done on the way out
+ *
+ * @param data Pixel buffer in panel byte order
+ * @param len Number of pixels
+ *
+ * @return void
+ */
+auto HOT_PATH DisplayManager::writePanelPixels(const uint16_t* data, uint32_t len) -> void {
+    writePanelBytes(reinterpret_cast<const uint8_t*>(data), len * 2U);
+}
+
+/**
+ * @brief Start writing pixels in panel byte order and return while they are still being sent
+ *
+ * The buffer must stay untouched until waitPanelIdle() or the next panel write, without the
+ * FIFO burst bus this falls back to a blocking write
+ *
+ * @param data Pixel buffer in panel byte order
+ * @param len Number of pixels
+ *
+ * @return void
+ */
+auto HOT_PATH DisplayManager::writePanelPixelsAsync(const uint16_t* data, uint32_t len) -> void {
+    writePanelBytesAsync(reinterpret_cast<const uint8_t*>(data), len * 2U);
+}
+
+/**
+ * @brief Write raw pixel bytes in the current panel colour mode
+ *
+ * Must be called inside an open address window
+ *
+ * @param data Bytes in wire order
+ * @param len Number of bytes
+ *
+ * @return void
+ */
+auto HOT_PATH DisplayManager::writePanelBytes(const uint8_t* data, uint32_t len) -> void {
+    if (LCD_USE_SPI_BURST) {
+        SpiBurstBus::writeBytes(data, len);
+    } else {
+        g_lcdBus.writeBytes(const_cast<uint8_t*>(data), len);
+    }
+}
+
+/**
+ * @brief Start writing raw pixel bytes and return while they are still being sent
+ *
+ * Same buffer rules as writePanelPixelsAsync()
+ *
+ * @param data Bytes in wire order
+ * @param len Number of bytes
+ *
+ * @return void
+ */
+auto HOT_PATH DisplayManager::writePanelBytesAsync(const uint8_t* data, uint32_t len) -> void {
+    if (LCD_USE_SPI_BURST) {
+        SpiBurstBus::writeBytesAsync(data, len);
+    } else {
+        writePanelBytes(data, len);
+    }
+}
+
+/**
+ * @brief Switch the panel pixel format (COLMOD), only sends the command when the mode changes
+ *
+ * GRAM content is kept, only the format of later pixel writes changes
+ *
+ * @param mode RGB565 for UI drawing, RGB444 for packed GIF playback
+ *
+ * @return void
+ */
+auto DisplayManager::setPanelColorMode(PanelColorMode mode) -> void {
+    if (mode == s_panelColorMode) {
+        return;
+    }
+
+    waitPanelIdle();
+
+    g_lcdBus.beginWrite();
+    ST7789_WriteCommand(ST7789_COLORMODE);
+    ST7789_WriteData(mode == PanelColorMode::Rgb444 ? ST7789_COLORMODE_RGB444 : ST7789_COLORMODE_RGB565);
+    g_lcdBus.endWrite();
+
+    s_panelColorMode = mode;
+}
+
+/**
+ * @brief Get the pixel format the panel currently expects
+ *
+ * @return Current panel colour mode
+ */
+auto DisplayManager::getPanelColorMode() -> PanelColorMode { return s_panelColorMode; }
+
+/**
+ * @brief Block until the last asynchronous pixel write has left the SPI FIFO
+ *
+ * @return void
+ */
+auto HOT_PATH DisplayManager::waitPanelIdle() -> void {
+    if (LCD_USE_SPI_BURST) {
+        SpiBurstBus::waitIdle();
+    }
+}
+
+/**
+ * @brief Make a band of rows the panel's vertical scroll area (VSCRDEF)
+ *
+ * Rows above and below the band stay fixed, the band shows GRAM from the scroll start address
+ * on, wrapping inside the band. (0, PANEL_GRAM_ROWS) gives back the unscrolled layout
+ *
+ * @param top First row of the band
+ * @param height Rows in the band
+ *
+ * @return void
+ */
+auto DisplayManager::setPanelScrollArea(int16_t top, int16_t height) -> void {
+    waitPanelIdle();
+
+    g_lcdBus.beginWrite();
+    ST7789_WriteCommand(ST7789_SCROLL_AREA);
+    ST7789_WriteData16(static_cast<uint16_t>(top));
+    ST7789_WriteData16(static_cast<uint16_t>(height));
+    ST7789_WriteData16(static_cast<uint16_t>(PANEL_GRAM_ROWS - top - height));
+    g_lcdBus.endWrite();
+}
+
+/**
+ * @brief Set the GRAM row shown on the first line of the vertical scroll area (VSCSAD)
+ *
+ * @param line GRAM row inside the scroll area
+ *
+ * @return void
+ */
+auto DisplayManager::setPanelScrollStart(int16_t line) -> void {
+    waitPanelIdle();
+
+    g_lcdBus.beginWrite();
+    ST7789_WriteCommand(ST7789_SCROLL_START);
+    ST7789_WriteData16(static_cast<uint16_t>(line));
+    g_lcdBus.endWrite();
+}
+
+/**
+ * @brief Scroll text upwards through a band of the screen with the panel's hardware scroll
+ *
+ * GIF playback is stopped and an off-screen band or status bar is taken down, the band belongs
+ * to the ticker until stopTicker(), clearScreen() or the next GIF
+ *
+ * @param yPos First row of the band
+ * @param height Rows in the band
+ * @param text Text to scroll, wrapped on words
+ * @param textSize Font size multiplier (integer)
+ * @param fgColor Foreground color (16-bit RGB565)
+ * @param bgColor Background color (16-bit RGB565)
+ * @param rowsPerSecond Scroll speed in pixel rows per second
+ *
+ * @return true if the ticker runs, false if the band or text does not fit the screen
+ */
+auto DisplayManager::startTicker(int16_t yPos, int16_t height, const String& text, uint8_t textSize,
+                                 uint16_t fgColor, uint16_t bgColor, uint16_t rowsPerSecond) -> bool {
+    s_playlist.clear();
+    s_gif.invalidatePanelRows();
+    s_band.end();
+
+    return s_ticker.begin(DISPLAY_PADDING, yPos, height, text, textSize, fgColor, bgColor, rowsPerSecond);
+}
+
+/**
+ * @brief Stop the ticker and clear its band
+ *
+ * @return void
+ */
+auto DisplayManager::stopTicker() -> void { s_ticker.end(); }
+
+/**
+ * @brief Check whether a ticker is scrolling
+ *
+ * @return true while the ticker owns its band
+ */
+auto DisplayManager::isTickerActive() -> bool { return s_ticker.isActive(); }
+
+/**
+ * @brief Get the SPI cost of the ticker
+ *
+ * @return Bytes per tick so far and the cost of one full band redraw
+ */
+auto DisplayManager::getTickerStats() -> const ScrollTickerStats& { return s_ticker.getStats(); }
 
-    const bool started = s_gif.playOne(path);
-    if (!started) {
+/**
+ * @brief Reserve the bottom rows of the screen as a band that can show staged hidden GRAM rows
+ *
+ * A running ticker is stopped, both use the panel's vertical scroll
+ *
+ * @param height Rows in the band (1..80)
+ *
+ * @return true if the band is set up
+ */
+auto DisplayManager::beginOffscreenBand(int16_t height) -> bool {
+    s_ticker.end();
+
+    return s_band.begin(height);
+}
+
+/**
+ * @brief Release the off-screen band, the bottom rows show their own content again
+ *
+ * @return void
+ */
+auto DisplayManager::endOffscreenBand() -> void { s_band.end(); }
+
+/**
+ * @brief Render text into a slot of the off-screen band, see OffscreenBand::stageText()
+ *
+ * @param slot Slot to draw into, 0 is on screen
+ * @param text Text to draw
+ * @param textSize Font size multiplier (integer)
+ * @param fgColor Foreground color (16-bit RGB565)
+ * @param bgColor Background color (16-bit RGB565)
+ *
+ * @return true if drawn
+ */
+auto DisplayManager::stageOffscreenText(uint8_t slot, const String& text, uint8_t textSize, uint16_t fgColor,
+                                        uint16_t bgColor) -> bool {
+    return s_band.stageText(slot, DISPLAY_PADDING, text, textSize, fgColor, bgColor);
+}
+
+/**
+ * @brief Show a slot of the off-screen band with a single scroll start command
+ *
+ * @param slot Slot to show, 0 for the band's own rows
+ *
+ * @return true if shown
+ */
+auto DisplayManager::showOffscreenSlot(uint8_t slot) -> bool { return s_band.show(slot); }
+
+/**
+ * @brief Get the off-screen band, for its slots and counters
+ *
+ * @return The band
+ */
+auto DisplayManager::getOffscreenBand() -> const OffscreenBand& { return s_band; }
+
+/**
+ * @brief Show a status bar over the bottom of the screen, swapped in without a visible redraw
+ *
+ * The text is staged into a hidden slot other than the one shown, then revealed with one
+ * scroll start command. Whatever is drawn underneath (a GIF, the UI) keeps going and shows
+ * again with hideStatusBar()
+ *
+ * @param text Status text, one line
+ * @param fgColor Foreground color (16-bit RGB565)
+ * @param bgColor Background color (16-bit RGB565)
+ *
+ * @return true if shown, false if the screen rotation does not allow it
+ */
+auto DisplayManager::showStatusBar(const String& text, uint16_t fgColor, uint16_t bgColor) -> bool {
+    if (!s_band.isActive() && !beginOffscreenBand(STATUS_BAR_HEIGHT)) {
         return false;
     }
 
-    if (timeMs == 0) {
-        return true;
+    // Hidden slots take turns, the one on screen is never drawn into
+    const uint8_t hiddenSlots = static_cast<uint8_t>(s_band.slots() - 1U);
+    const auto next = static_cast<uint8_t>(s_band.shownSlot() % hiddenSlots + 1U);
+    if (hiddenSlots < 2 && s_band.shownSlot() == next) {
+        s_band.show(0);
     }
 
-    const uint32_t startMs = millis();
-    const uint32_t endMs = startMs + timeMs;
+    return s_band.stageText(next, DISPLAY_PADDING, text, STATUS_BAR_TEXT_SIZE, fgColor, bgColor) && s_band.show(next);
+}
+
+/**
+ * @brief Take the status bar down, the bottom rows show their own content again
+ *
+ * @return void
+ */
+auto DisplayManager::hideStatusBar() -> void { s_band.end(); }
 
-    while (s_gif.isPlaying() && static_cast<int32_t>(millis() - endMs) < 0) {
-        s_gif.update();
-        yield();
+/**
+ * @brief Put a filled rectangle over the screen, GIF frames are composed under it
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param width Width in pixels
+ * @param height Height in pixels
+ * @param color Fill color (16-bit RGB565)
+ *
+ * @return Layer id, -1 if the rectangle leaves the screen or the overlay budget is used up
+ */
+auto DisplayManager::addOverlayRect(int16_t xPos, int16_t yPos, int16_t width, int16_t height, uint16_t color)
+    -> int {
+    const int layer = s_compositor.addRect(xPos, yPos, width, height, color);
+    if (layer >= 0) {
+        // Every row is sent again so the layer learns what is under it
+        s_gif.invalidatePanelRows();
     }
 
-    if (s_gif.isPlaying()) {
-        s_gif.stop();
+    return layer;
+}
+
+/**
+ * @brief Put a line of text over the screen, GIF frames are composed under it
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param maxChars Characters the layer has room for, later updates are cut to it
+ * @param text Initial text
+ * @param textSize Font size multiplier (integer)
+ * @param fgColor Foreground color (16-bit RGB565)
+ * @param bgColor Background color (16-bit RGB565)
+ * @param transparentBg If true, only the glyphs cover what is under the layer
+ *
+ * @return Layer id, -1 if the text leaves the screen or the overlay budget is used up
+ */
+auto DisplayManager::addOverlayText(int16_t xPos, int16_t yPos, uint8_t maxChars, const String& text,
+                                    uint8_t textSize, uint16_t fgColor, uint16_t bgColor, bool transparentBg) -> int {
+    const int layer = s_compositor.addText(xPos, yPos, maxChars, text.c_str(), textSize, fgColor, bgColor,
+                                           transparentBg);
+    if (layer >= 0) {
+        s_gif.invalidatePanelRows();
     }
 
-    while (s_gif.isPlaying()) {
-        s_gif.update();
-        yield();
+    return layer;
+}
+
+/**
+ * @brief Put an icon over the screen, GIF frames are composed under it
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param width Icon width
+ * @param height Icon height
+ * @param pixels PROGMEM RGB565 bitmap, row by row
+ * @param keyColor Bitmap color left transparent
+ *
+ * @return Layer id, -1 if the icon leaves the screen or the overlay budget is used up
+ */
+auto DisplayManager::addOverlayIcon(int16_t xPos, int16_t yPos, int16_t width, int16_t height, const uint16_t* pixels,
+                                    uint16_t keyColor) -> int {
+    const int layer = s_compositor.addIcon(xPos, yPos, width, height, pixels, keyColor);
+    if (layer >= 0) {
+        s_gif.invalidatePanelRows();
     }
 
-    s_gif.setLoopEnabled(false);
+    return layer;
+}
 
-    return true;
+/**
+ * @brief Change the text of an overlay, redrawn from update() without touching the rest of the screen
+ *
+ * @param layer Layer id from addOverlayText()
+ * @param text New text
+ *
+ * @return false if the id is not a text overlay
+ */
+auto DisplayManager::setOverlayText(int layer, const String& text) -> bool {
+    return s_compositor.setText(layer, text.c_str());
 }
 
 /**
- * @brief Stop GIF playback if playing
+ * @brief Take an overlay down, update() puts back what is under it
  *
- * @return true
+ * @param layer Layer id
+ *
+ * @return false if the id is not shown
  */
-auto DisplayManager::stopGif() -> bool {
-    s_gif.stop();
+auto DisplayManager::removeOverlay(int layer) -> bool {
+    if (!s_compositor.remove(layer)) {
+        return false;
+    }
 
-    DisplayManager::clearScreen();
+    restoreUnderOverlays();
 
     return true;
 }
 
-auto DisplayManager::update() -> void { s_gif.update(); }
-
 /**
- * @brief Clear the entire display to black
+ * @brief Take every overlay down
  *
  * @return void
  */
-auto DisplayManager::clearScreen() -> void { g_lcd.fillScreen(LCD_BLACK); }
+auto DisplayManager::clearOverlays() -> void {
+    s_compositor.clear();
+    restoreUnderOverlays();
+}
+
+/**
+ * @brief Get the overlay compositor, for its layers and counters
+ *
+ * @return The compositor merging overlays into GIF frames
+ */
+auto DisplayManager::getCompositor() -> const Compositor& { return s_compositor; }
+
+/**
+ * @brief Get the CPU cycles spent waiting for panel writes to drain since boot
+ *
+ * @return Free-running cycle counter, compare two readings to get the time in between
+ */
+auto DisplayManager::getPanelWaitCycles() -> uint32_t { return SpiBurstBus::waitCycles(); }
+
+/**
+ * @brief Get the decode/transmit overlap counters of the GIF player
+ *
+ * @return Copy of the pipeline counters
+ */
+auto DisplayManager::getGifPipelineStats() -> GifPipelineStats { return s_gif.getPipelineStats(); }
+
+/**
+ * @brief Get the frame cost breakdown of the GIF playing
+ *
+ * @return Rolling window and counters of the current file
+ */
+auto DisplayManager::getGifFileTiming() -> const GifFrameStats& { return s_gif.getFileTiming(); }
+
+/**
+ * @brief Get the frame cost breakdown of every GIF played since boot
+ *
+ * @return Rolling window and counters of the session
+ */
+auto DisplayManager::getGifSessionTiming() -> const GifFrameStats& { return s_gif.getSessionTiming(); }
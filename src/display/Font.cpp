@@ -0,0 +1,520 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "display/DisplayManager.h"
+#include "display/Font.h"
+#include "display/fonts/GeekMagicSans10.h"
+#include "display/fonts/GeekMagicSans20.h"
+#include "display/fonts/GeekMagicSans30.h"
+#include "display/fonts/GeekMagicSans40.h"
+
+using WrapLine = std::array<char, TextRaster::WRAP_MAX_CHARS>;
+
+// Shown for malformed UTF-8 sequences
+static constexpr uint32_t UTF8_INVALID = 0xFFFD;
+static constexpr uint8_t RUN_CONTINUE = 15;
+
+// Fonts by textSize, one source per size in fonts/
+static const std::array<const Font*, 4> FONTS_BY_SIZE = {&GEEK_MAGIC_SANS_10, &GEEK_MAGIC_SANS_20,
+                                                         &GEEK_MAGIC_SANS_30, &GEEK_MAGIC_SANS_40};
+
+static CachedGlyph* s_cache = nullptr;
+static uint32_t s_cacheTick = 0;
+static GlyphCacheStats s_cacheStats;
+
+/**
+ * @brief Unpack a glyph bitmap from flash into rows of stride bytes
+ *
+ * @param font Font holding the bitmap
+ * @param entry Table entry of the glyph
+ * @param out Decoded glyph, metrics included
+ */
+static void decodeGlyph(const Font& font, const FontGlyph& entry, CachedGlyph& out) {
+    out.codepoint = entry.codepoint;
+    out.width = entry.width;
+    out.height = entry.height;
+    out.xOffset = entry.xOffset;
+    out.top = entry.top;
+    out.advance = entry.advance;
+    out.stride = static_cast<uint8_t>((entry.width + 7U) / 8U);
+    std::fill(out.bits.begin(), out.bits.end(), 0);
+
+    const uint32_t pixels = static_cast<uint32_t>(entry.width) * entry.height;
+    const uint8_t* src = font.bitmaps + entry.offset;
+    uint32_t pos = 0;
+    uint32_t nibble = 0;
+    bool ink = false;
+    while (pos < pixels) {
+        uint32_t run = 1;
+        bool set = false;
+        if ((entry.flags & FONT_GLYPH_RLE) != 0) {
+            const uint8_t byte = pgm_read_byte(src + nibble / 2U);
+            run = (nibble % 2U == 0) ? (byte >> 4U) : (byte & 0x0FU);
+            set = ink;
+            ink = (run == RUN_CONTINUE) ? ink : !ink;
+            ++nibble;
+        } else {
+            set = (pgm_read_byte(src + pos / 8U) & (0x80U >> (pos % 8U))) != 0;
+        }
+        for (const uint32_t end = std::min(pos + run, pixels); pos < end; ++pos) {
+            if (set) {
+                const uint32_t row = pos / entry.width;
+                const uint32_t col = pos % entry.width;
+                out.bits[row * out.stride + col / 8U] |= static_cast<uint8_t>(0x80U >> (col % 8U));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Get the font of an integer text size
+ *
+ * @param textSize Size as passed to drawTextWrapped (1 = 10 px lines)
+ *
+ * @return Font, nullptr for sizes without one (drawn with TextRaster)
+ */
+auto FontEngine::forTextSize(uint8_t textSize) -> const Font* {
+    if (textSize == 0 || textSize > FONTS_BY_SIZE.size()) {
+        return nullptr;
+    }
+
+    return FONTS_BY_SIZE[textSize - 1U];
+}
+
+/**
+ * @brief Decode the next codepoint of a UTF-8 string
+ *
+ * Overlong, truncated and out of range sequences decode to U+FFFD and consume their bytes up to the
+ * first one that cannot continue them
+ *
+ * @param text Position in the string, moved past the sequence
+ *
+ * @return Codepoint, 0 at the end of the string
+ */
+auto FontEngine::decodeUtf8(const char*& text) -> uint32_t {
+    const auto lead = static_cast<uint8_t>(*text);
+    if (lead == 0) {
+        return 0;
+    }
+    ++text;
+    if (lead < 0x80U) {
+        return lead;
+    }
+
+    int extra = 0;
+    uint32_t codepoint = 0;
+    uint32_t minimum = 0;
+    if ((lead & 0xE0U) == 0xC0U) {
+        extra = 1;
+        codepoint = lead & 0x1FU;
+        minimum = 0x80;
+    } else if ((lead & 0xF0U) == 0xE0U) {
+        extra = 2;
+        codepoint = lead & 0x0FU;
+        minimum = 0x800;
+    } else if ((lead & 0xF8U) == 0xF0U) {
+        extra = 3;
+        codepoint = lead & 0x07U;
+        minimum = 0x10000;
+    } else {
+        return UTF8_INVALID;
+    }
+
+    for (int i = 0; i < extra; ++i) {
+        const auto next = static_cast<uint8_t>(*text);
+        if ((next & 0xC0U) != 0x80U) {
+            return UTF8_INVALID;
+        }
+        codepoint = (codepoint << 6U) | (next & 0x3FU);
+        ++text;
+    }
+
+    if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+        return UTF8_INVALID;
+    }
+
+    return codepoint;
+}
+
+/**
+ * @brief Look a codepoint up in a font table
+ *
+ * @param font Font to search
+ * @param codepoint Codepoint to find
+ * @param out Table entry, copied out of flash
+ *
+ * @return true if the font has the glyph
+ */
+auto FontEngine::findGlyph(const Font& font, uint32_t codepoint, FontGlyph& out) -> bool {
+    int low = 0;
+    int high = static_cast<int>(font.glyphCount) - 1;
+    while (low <= high) {
+        const int mid = (low + high) / 2;
+        memcpy_P(&out, &font.glyphs[mid], sizeof(FontGlyph));
+        if (out.codepoint == codepoint) {
+            return true;
+        }
+        if (out.codepoint < codepoint) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Get a decoded glyph, from the cache when it was used recently
+ *
+ * A miss decodes the bitmap into the least recently used slot. Without a cache (not enough heap
+ * for it) the glyph is decoded into the caller's scratch instead
+ *
+ * @param font Font of the glyph
+ * @param codepoint Codepoint, drawn as REPLACEMENT when the font lacks it
+ * @param scratch Glyph storage used when the cache is not available
+ *
+ * @return Decoded glyph valid until the next lookup, nullptr if not even REPLACEMENT exists
+ */
+auto FontEngine::glyph(const Font& font, uint32_t codepoint, CachedGlyph& scratch) -> const CachedGlyph* {
+    if (s_cache == nullptr &&
+        EspClass::getMaxFreeBlockSize() >= sizeof(CachedGlyph) * CACHE_SLOTS + DISPLAY_HEAP_RESERVE) {
+        s_cache = new (std::nothrow) CachedGlyph[CACHE_SLOTS];
+    }
+
+    ++s_cacheTick;
+    CachedGlyph* victim = &scratch;
+    if (s_cache != nullptr) {
+        victim = &s_cache[0];
+        for (int i = 0; i < CACHE_SLOTS; ++i) {
+            CachedGlyph& slot = s_cache[i];
+            if (slot.font == &font && slot.codepoint == codepoint) {
+                slot.lastUse = s_cacheTick;
+                ++s_cacheStats.hits;
+
+                return &slot;
+            }
+            if (slot.lastUse < victim->lastUse) {
+                victim = &slot;
+            }
+        }
+    }
+
+    FontGlyph entry{};
+    if (!findGlyph(font, codepoint, entry)) {
+        // Missing glyphs share the cached REPLACEMENT
+        return (codepoint == REPLACEMENT) ? nullptr : glyph(font, REPLACEMENT, scratch);
+    }
+
+    if (victim == &scratch) {
+        ++s_cacheStats.uncached;
+    } else {
+        ++s_cacheStats.misses;
+        if (victim->font != nullptr) {
+            ++s_cacheStats.evictions;
+        }
+    }
+    decodeGlyph(font, entry, *victim);
+    victim->font = &font;
+    victim->lastUse = s_cacheTick;
+
+    return victim;
+}
+
+/**
+ * @brief Width of a piece of text
+ *
+ * @param font Font to measure with
+ * @param text UTF-8 text
+ * @param length Bytes to measure, a null character ends the text earlier
+ *
+ * @return Sum of the glyph advances in pixels
+ */
+auto FontEngine::measure(const Font& font, const char* text, size_t length) -> int {
+    int width = 0;
+    const char* end = text + length;
+    FontGlyph entry{};
+    while (text < end && *text != '\0') {
+        const uint32_t codepoint = decodeUtf8(text);
+        if (findGlyph(font, codepoint, entry) || findGlyph(font, REPLACEMENT, entry)) {
+            width += entry.advance;
+        }
+    }
+
+    return width;
+}
+
+/**
+ * @brief Push the current line buffer into the output lines array
+ *
+ * @param outLines The output lines array
+ * @param lineBuf The current line buffer
+ * @param lineLen The current line length in bytes
+ * @param lineWidth The current line width in pixels
+ * @param lineCount The current line count
+ *
+ * @return void
+ */
+static void wrapPushLine(TextRaster::Lines& outLines, WrapLine& lineBuf, int& lineLen, int& lineWidth,
+                         int& lineCount) {
+    lineBuf[lineLen] = '\0';
+    memcpy(outLines[lineCount].data(), lineBuf.data(), static_cast<size_t>(lineLen) + 1U);
+    ++lineCount;
+
+    lineLen = 0;
+    lineWidth = 0;
+}
+
+/**
+ * @brief Append a word to the current line, wrapping at the width and breaking words wider than a line
+ *
+ * @param font Font to measure with
+ * @param word Start of the word (UTF-8)
+ * @param wordLen Bytes of the word
+ * @param maxWidth Pixels available per line
+ * @param maxLines The maximum number of lines allowed
+ * @param outLines The output lines array
+ * @param lineBuf The current line buffer
+ * @param lineLen The current line length in bytes
+ * @param lineWidth The current line width in pixels
+ * @param lineCount The current line count
+ *
+ * @return void
+ */
+static void wrapAppendWord(const Font& font, const char* word, int wordLen, int maxWidth, int maxLines,
+                           TextRaster::Lines& outLines, WrapLine& lineBuf, int& lineLen, int& lineWidth,
+                           int& lineCount) {
+    const int spaceWidth = FontEngine::measure(font, " ", 1);
+    const char* end = word + wordLen;
+    while (word < end && lineCount < maxLines) {
+        const int wordWidth = FontEngine::measure(font, word, static_cast<size_t>(end - word));
+        const int gap = (lineLen != 0) ? 1 : 0;
+        const auto bytes = static_cast<int>(end - word);
+        if (lineWidth + gap * spaceWidth + wordWidth <= maxWidth &&
+            lineLen + gap + bytes < TextRaster::WRAP_MAX_CHARS) {
+            if (gap != 0) {
+                lineBuf[lineLen++] = ' ';
+            }
+            memcpy(lineBuf.data() + lineLen, word, static_cast<size_t>(bytes));
+            lineLen += bytes;
+            lineWidth += gap * spaceWidth + wordWidth;
+
+            return;
+        }
+        if (lineLen != 0) {
+            wrapPushLine(outLines, lineBuf, lineLen, lineWidth, lineCount);
+            continue;
+        }
+
+        // Wider than a whole line: take as many characters as fit, at least one
+        const char* cut = word;
+        while (cut < end) {
+            const char* next = cut;
+            FontEngine::decodeUtf8(next);
+            const int width = FontEngine::measure(font, word, static_cast<size_t>(next - word));
+            if (cut != word && (width > maxWidth || next - word >= TextRaster::WRAP_MAX_CHARS)) {
+                break;
+            }
+            cut = next;
+        }
+        memcpy(lineBuf.data(), word, static_cast<size_t>(cut - word));
+        lineLen = static_cast<int>(cut - word);
+        lineWidth = FontEngine::measure(font, word, static_cast<size_t>(lineLen));
+        word = cut;
+        if (word < end) {
+            wrapPushLine(outLines, lineBuf, lineLen, lineWidth, lineCount);
+        }
+    }
+}
+
+/**
+ * @brief Wrap UTF-8 text on words into lines no wider than a pixel width
+ *
+ * @param font Font to measure with
+ * @param text The input text to wrap
+ * @param maxWidth Pixels available per line
+ * @param maxLines Maximum number of lines allowed, at most WRAP_MAX_LINES
+ * @param outLines Output array to hold the wrapped lines
+ *
+ * @return The number of lines used
+ */
+auto FontEngine::wrap(const Font& font, const String& text, int maxWidth, int maxLines, TextRaster::Lines& outLines)
+    -> int {
+    for (auto& row : outLines) {
+        row[0] = '\0';
+    }
+    maxLines = std::min(maxLines, TextRaster::WRAP_MAX_LINES);
+
+    WrapLine lineBuf{};
+    int lineLen = 0;
+    int lineWidth = 0;
+    int lineCount = 0;
+    const char* pos = text.c_str();
+    while (*pos != '\0' && lineCount < maxLines) {
+        if (*pos == '\n') {
+            wrapPushLine(outLines, lineBuf, lineLen, lineWidth, lineCount);
+            ++pos;
+            continue;
+        }
+        if (*pos == ' ' || *pos == '\t' || *pos == '\r') {
+            ++pos;
+            continue;
+        }
+
+        const char* word = pos;
+        while (*pos != '\0' && *pos != ' ' && *pos != '\t' && *pos != '\r' && *pos != '\n') {
+            ++pos;
+        }
+        wrapAppendWord(font, word, static_cast<int>(pos - word), maxWidth, maxLines, outLines, lineBuf, lineLen,
+                       lineWidth, lineCount);
+    }
+
+    if (lineLen != 0 && lineCount < maxLines) {
+        wrapPushLine(outLines, lineBuf, lineLen, lineWidth, lineCount);
+    }
+
+    return std::max(lineCount, 1);
+}
+
+/**
+ * @brief Paint the glyphs of a text line into a band of rows
+ *
+ * @param font Font of the line
+ * @param text UTF-8 text of the line
+ * @param firstRow Line row of the first band row
+ * @param rows Rows in the band
+ * @param fgColor Glyph colour, in the byte order of the band
+ * @param band Band pixels, already filled with the background
+ * @param width Pixels per band row
+ */
+static void paintBand(const Font& font, const char* text, int firstRow, int rows, uint16_t fgColor, uint16_t* band,
+                      int width) {
+    CachedGlyph scratch;
+    int pen = 0;
+    while (*text != '\0' && pen < width) {
+        const CachedGlyph* glyph = FontEngine::glyph(font, FontEngine::decodeUtf8(text), scratch);
+        if (glyph == nullptr) {
+            continue;
+        }
+
+        const int rowStart = std::max(static_cast<int>(glyph->top), firstRow);
+        const int rowEnd = std::min(glyph->top + glyph->height, firstRow + rows);
+        const int left = pen + glyph->xOffset;
+        for (int row = rowStart; row < rowEnd; ++row) {
+            const uint8_t* bits = glyph->bits.data() + static_cast<size_t>(row - glyph->top) * glyph->stride;
+            uint16_t* out = band + static_cast<size_t>(row - firstRow) * static_cast<size_t>(width);
+            for (int col = 0; col < glyph->width; ++col) {
+                const int xPos = left + col;
+                if ((bits[col / 8] & (0x80U >> (col % 8))) != 0 && xPos >= 0 && xPos < width) {
+                    out[xPos] = fgColor;
+                }
+            }
+        }
+        pen += glyph->advance;
+    }
+}
+
+/**
+ * @brief Draw one line of UTF-8 text through a single address window
+ *
+ * The line is composed in RAM in bands of as many rows as fit STRIP_MAX_BYTES and the heap, one
+ * pixel row at a time when nothing can be allocated, all inside one window
+ *
+ * @param font Font of the line
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param text Characters of the line, null terminated
+ * @param fgColor Glyph colour (RGB565)
+ * @param bgColor Background colour (RGB565)
+ * @param minWidth Width to pad the line to with the background, 0 for the text only
+ *
+ * @return Bytes sent to the panel, 0 if nothing of the line is on screen
+ */
+auto FontEngine::drawLine(const Font& font, int16_t xPos, int16_t yPos, const char* text, uint16_t fgColor,
+                          uint16_t bgColor, int16_t minWidth) -> uint32_t {
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr || text == nullptr || xPos < 0 || yPos < 0) {
+        return 0;
+    }
+
+    const int textW = measure(font, text, strlen(text));
+    const int screenW = std::min<int>(gfx->width(), MAX_WIDTH);
+    const int width = std::min(std::max(textW, static_cast<int>(minWidth)), screenW - xPos);
+    const int height = std::min(static_cast<int>(font.lineHeight), static_cast<int>(gfx->height()) - yPos);
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    const uint16_t fg = toPanelOrder(fgColor);
+    const uint16_t bg = toPanelOrder(bgColor);
+    const auto rowBytes = static_cast<uint32_t>(width) * 2U;
+    int bandRows = std::min(height, static_cast<int>(STRIP_MAX_BYTES / rowBytes));
+
+    uint16_t* strip = nullptr;
+    if (bandRows > 1 && EspClass::getMaxFreeBlockSize() >= rowBytes * bandRows + DISPLAY_HEAP_RESERVE) {
+        strip = new (std::nothrow) uint16_t[static_cast<size_t>(width) * bandRows];
+    }
+    std::array<uint16_t, MAX_WIDTH> line{};
+    uint16_t* band = strip;
+    if (band == nullptr) {
+        band = line.data();
+        bandRows = 1;
+    }
+
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
+    tft->startWrite();
+    tft->writeAddrWindow(xPos, yPos, static_cast<uint16_t>(width), static_cast<uint16_t>(height));
+
+    for (int row = 0; row < height; row += bandRows) {
+        const int rows = std::min(bandRows, height - row);
+        const auto pixels = static_cast<uint32_t>(width) * static_cast<uint32_t>(rows);
+        std::fill_n(band, pixels, bg);
+        paintBand(font, text, row, rows, fg, band, width);
+        DisplayManager::writePanelPixels(band, pixels);
+    }
+
+    tft->endWrite();
+    delete[] strip;
+
+    return PANEL_ADDR_WINDOW_BYTES + static_cast<uint32_t>(width) * static_cast<uint32_t>(height) * 2U;
+}
+
+/**
+ * @brief Get the glyph cache counters
+ *
+ * @return Hits, misses, evictions and uncached decodes since the last releaseCache()
+ */
+auto FontEngine::getCacheStats() -> const GlyphCacheStats& { return s_cacheStats; }
+
+/**
+ * @brief Free the glyph cache and reset its counters, the next lookup allocates it again
+ *
+ * @return void
+ */
+auto FontEngine::releaseCache() -> void {
+    delete[] s_cache;
+    s_cache = nullptr;
+    s_cacheTick = 0;
+    s_cacheStats = GlyphCacheStats{};
+}
@@ -18,15 +18,174 @@
  */
 
 #include "display/Gif.h"
+#include "display/Compositor.h"
 #include "display/DisplayManager.h"
+#include "display/GifSlotStore.h"
+#include "display/HotPath.h"
 #include <Arduino_GFX_Library.h>
+#include <algorithm>
 #include <array>
+#include <new>
 static constexpr uint32_t GIF_MAX_MS_PER_FILE = 20000U;
 static constexpr uint8_t GIF_TARGET_FPS = 30U;
 static constexpr uint32_t GIF_FRAME_MS = 1000U / GIF_TARGET_FPS;
 
+// Scheduler: a frame is late past this margin, a backlog longer than the resync limit is abandoned
+// instead of fast-forwarded, and at least one frame is drawn after this many decode-only frames
+static constexpr uint32_t GIF_LATE_TOLERANCE_MS = 5U;
+static constexpr uint32_t GIF_RESYNC_MS = 1000U;
+static constexpr uint8_t GIF_MAX_CONSECUTIVE_DROPS = 3U;
+
+// Interlacing starts after this many drawn frames in a row each later than the one before, and
+// stops after this many on time frames whose full update would also fit their delay
+static constexpr uint8_t GIF_INTERLACE_ENTER_FRAMES = 3U;
+static constexpr uint8_t GIF_INTERLACE_EXIT_FRAMES = 10U;
+
+// Files up to this size are played from RAM when the largest free heap block leaves the reserve intact
+static constexpr uint32_t GIF_RAM_MAX_BYTES = 32U * 1024U;
+
+// Signature plus logical screen descriptor, enough to validate a file and read its canvas size
+static constexpr size_t GIF_HEADER_SIZE = 13;
+
+// Cost of opening one more address window, in pixel bytes that could be sent in the same time:
+// 11 command/parameter bytes plus the DC toggles and the three separate SPI transactions
+static constexpr int GIF_WINDOW_COST_BYTES = 36;
+
+// 2x2 ordered dither thresholds in quarter steps, indexed by (y & 1) * 2 + (x & 1)
+static constexpr std::array<uint8_t, 4> GIF_BAYER_2X2 = {0, 2, 3, 1};
+
 Gif* Gif::s_instance = nullptr;
 
+// Decoder state reserved in .bss at boot: starting playback never needs a large free heap block,
+// the decoder is constructed in place on begin() and destroyed in place when playback stops
+alignas(GifFrameDecoder) static std::array<uint8_t, sizeof(GifFrameDecoder)> s_decoderPool;
+static Gif* s_decoderOwner = nullptr;
+
+/**
+ * @brief Reduce a panel order RGB565 color to RGB444, rounding up by an ordered dither threshold
+ *
+ * @param color Color in panel (big-endian) byte order
+ * @param threshold Dither threshold in quarter steps of the dropped bits (0 truncates)
+ *
+ * @return 12-bit color, red in the top nibble
+ */
+static constexpr auto toRgb444(uint16_t color, uint8_t threshold) -> uint16_t {
+    const auto native = toPanelOrder(color);
+    const auto red = static_cast<uint32_t>((native >> 11U) & 0x1FU);
+    const auto green = static_cast<uint32_t>((native >> 5U) & 0x3FU);
+    const auto blue = static_cast<uint32_t>(native & 0x1FU);
+
+    // Red and blue drop one bit, green drops two
+    const auto red4 = std::min<uint32_t>(15U, (red + (threshold >> 1U)) >> 1U);
+    const auto green4 = std::min<uint32_t>(15U, (green + threshold) >> 2U);
+    const auto blue4 = std::min<uint32_t>(15U, (blue + (threshold >> 1U)) >> 1U);
+
+    return static_cast<uint16_t>((red4 << 8U) | (green4 << 4U) | blue4);
+}
+
+/**
+ * @brief Pack palette indices as RGB444, two pixels in three bytes
+ *
+ * An odd trailing pixel takes two bytes, the panel drops the half pixel when the next command starts
+ *
+ * @param indices Palette indices
+ * @param len Number of pixels
+ * @param evenPalette 12-bit palette for the first pixel of each pair
+ * @param oddPalette 12-bit palette for the second pixel of each pair
+ * @param out Output buffer, at least (len * 3 + 1) / 2 bytes
+ *
+ * @return Number of bytes written
+ */
+static auto HOT_PATH packIndicesRgb444(const uint8_t* indices, int len, const uint16_t* evenPalette,
+                                       const uint16_t* oddPalette, uint8_t* out) -> uint32_t {
+    uint8_t* dst = out;
+    int i = 0;
+
+    for (; i + 1 < len; i += 2) {
+        const uint16_t first = evenPalette[indices[i]];
+        const uint16_t second = oddPalette[indices[i + 1]];
+
+        dst[0] = static_cast<uint8_t>(first >> 4U);
+        dst[1] = static_cast<uint8_t>(((first & 0x0FU) << 4U) | (second >> 8U));
+        dst[2] = static_cast<uint8_t>(second);
+        dst += 3;
+    }
+
+    if (i < len) {
+        const uint16_t last = evenPalette[indices[i]];
+
+        dst[0] = static_cast<uint8_t>(last >> 4U);
+        dst[1] = static_cast<uint8_t>((last & 0x0FU) << 4U);
+        dst += 2;
+    }
+
+    return static_cast<uint32_t>(dst - out);
+}
+
+/**
+ * @brief Pack panel order RGB565 pixels as RGB444 in place, two pixels in three bytes
+ *
+ * Each pair is read before its three bytes are written, which never reaches a later pair
+ *
+ * @param pixels Pixels in panel byte order, overwritten with the packed bytes
+ * @param len Number of pixels
+ * @param xStart Panel column of the first pixel, selects the dither phase
+ * @param yPos Panel row, selects the dither phase
+ * @param dither true to apply the 2x2 ordered dither
+ *
+ * @return Number of bytes written
+ */
+static auto HOT_PATH packPixelsRgb444(uint16_t* pixels, int len, int xStart, int yPos, bool dither) -> uint32_t {
+    auto* dst = reinterpret_cast<uint8_t*>(pixels);
+    const auto rowPhase = static_cast<size_t>((yPos & 1) * 2);
+    const auto evenThreshold = dither ? GIF_BAYER_2X2[rowPhase + static_cast<size_t>(xStart & 1)] : 0U;
+    const auto oddThreshold = dither ? GIF_BAYER_2X2[rowPhase + static_cast<size_t>((xStart + 1) & 1)] : 0U;
+    uint32_t written = 0;
+    int i = 0;
+
+    for (; i + 1 < len; i += 2) {
+        const uint16_t first = toRgb444(pixels[i], static_cast<uint8_t>(evenThreshold));
+        const uint16_t second = toRgb444(pixels[i + 1], static_cast<uint8_t>(oddThreshold));
+
+        dst[written] = static_cast<uint8_t>(first >> 4U);
+        dst[written + 1U] = static_cast<uint8_t>(((first & 0x0FU) << 4U) | (second >> 8U));
+        dst[written + 2U] = static_cast<uint8_t>(second);
+        written += 3U;
+    }
+
+    if (i < len) {
+        const uint16_t last = toRgb444(pixels[i], static_cast<uint8_t>(evenThreshold));
+
+        dst[written] = static_cast<uint8_t>(last >> 4U);
+        dst[written + 1U] = static_cast<uint8_t>((last & 0x0FU) << 4U);
+        written += 2U;
+    }
+
+    return written;
+}
+
+/**
+ * @brief FNV-1a hash of a row segment, seeded with its position so moved content never matches
+ *
+ * @param pixels Pixels in panel byte order
+ * @param len Number of pixels
+ * @param xStart First column of the segment
+ *
+ * @return Non-zero 32-bit hash
+ */
+static auto HOT_PATH hashRowSegment(const uint16_t* pixels, int len, int xStart) -> uint32_t {
+    static constexpr uint32_t FNV_OFFSET = 2166136261U;
+    static constexpr uint32_t FNV_PRIME = 16777619U;
+
+    uint32_t hash = FNV_OFFSET ^ (static_cast<uint32_t>(xStart) << 16U) ^ static_cast<uint32_t>(len);
+
+    for (int i = 0; i < len; ++i) {
+        hash = (hash ^ pixels[i]) * FNV_PRIME;
+    }
+
+    return hash != 0 ? hash : 1U;
+}
+
 /**
  * @brief Construct a new Gif:: Gif object
  */
@@ -39,11 +198,47 @@ Gif::Gif() : m_gif(nullptr), m_playRequested(false), m_playing(false), m_loopEna
  */
 Gif::~Gif() {
     stop();
+    releaseDecoder();
+}
 
-    if (m_gif != nullptr) {
-        delete m_gif;
-        m_gif = nullptr;
+/**
+ * @brief Bytes reserved at boot for GIF playback: the decoder pool plus the player with its line
+ *        and read buffers, which lives in a static as well
+ *
+ * @return Reserved bytes
+ */
+auto Gif::reservedBytes() -> size_t { return sizeof(s_decoderPool) + sizeof(Gif); }
+
+/**
+ * @brief Pick the integer scale that makes a canvas fill as much of the panel as possible
+ *
+ * @param canvasW Canvas width from the GIF header
+ * @param canvasH Canvas height from the GIF header
+ * @param screenW Panel width
+ * @param screenH Panel height
+ *
+ * @return Largest enlargement that fits (up to SCALE_UP_MAX), or decimation for canvases up to
+ *         SCALE_DOWN_MAX times the panel size, unscaled otherwise
+ */
+auto Gif::autoScale(uint16_t canvasW, uint16_t canvasH, int screenW, int screenH) -> GifScale {
+    GifScale scale;
+
+    if (canvasW == 0 || canvasH == 0) {
+        return scale;
+    }
+
+    if (canvasW > screenW || canvasH > screenH) {
+        if (canvasW <= screenW * SCALE_DOWN_MAX && canvasH <= screenH * SCALE_DOWN_MAX) {
+            scale.down = SCALE_DOWN_MAX;
+        }
+
+        return scale;
     }
+
+    const int fit = std::min(screenW / canvasW, screenH / canvasH);
+    scale.up = static_cast<uint8_t>(std::min(fit, static_cast<int>(SCALE_UP_MAX)));
+
+    return scale;
 }
 
 /**
@@ -53,16 +248,35 @@ Gif::~Gif() {
  */
 auto Gif::begin() -> bool {
     if (m_gif == nullptr) {
-        m_gif = new AnimatedGIF();
+        if (s_decoderOwner != nullptr && s_decoderOwner != this) {
+            if (s_decoderOwner->m_playing) {
+                return false;
+            }
 
-        if (m_gif == nullptr) {
-            return false;
+            // An idle player only keeps its decoder until another one starts
+            s_decoderOwner->releaseDecoder();
         }
+
+        m_gif = new (s_decoderPool.data()) GifFrameDecoder();
+        s_decoderOwner = this;
     }
 
     return true;
 }
 
+/**
+ * @brief Destroy the decoder in its pool slot and hand the slot back
+ */
+auto Gif::releaseDecoder() -> void {
+    if (m_gif == nullptr) {
+        return;
+    }
+
+    m_gif->~GifFrameDecoder();
+    m_gif = nullptr;
+    s_decoderOwner = nullptr;
+}
+
 /**
  * @brief Open a GIF file from LittleFS
  *
@@ -76,6 +290,13 @@ auto Gif::gifOpenFile(const char* fname, int32_t* pSize) -> void* {
         return nullptr;
     }
 
+    // RAM copy or mapped slot, read by gifReadFile without touching LittleFS
+    if (s_instance->m_memData != nullptr) {
+        *pSize = s_instance->m_memSize;
+
+        return const_cast<uint8_t*>(s_instance->m_memData);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+
     String path(fname);
     if (!path.startsWith("/")) {
         path = "/" + path;
@@ -85,7 +306,10 @@ auto Gif::gifOpenFile(const char* fname, int32_t* pSize) -> void* {
         return nullptr;
     }
 
-    s_instance->m_file = LittleFS.open(path, "r");
+    s_instance->m_file = s_instance->takeFile(path);
+    s_instance->m_filePos = 0;
+    s_instance->m_readAheadLen = 0;
+
     if (!s_instance->m_file) {
         s_instance->m_fileInUse = false;
 
@@ -128,10 +352,17 @@ auto Gif::gifCloseFile(void* pHandle) -> void {
 auto Gif::gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
     auto* filePtr = reinterpret_cast<File*>(pFile->fHandle);
 
-    if (filePtr == nullptr || !(*filePtr)) {
+    if (filePtr == nullptr || s_instance == nullptr) {
+        return 0;
+    }
+
+    const bool inMemory = pFile->fHandle == s_instance->m_memData;
+    if (!inMemory && !(*filePtr)) {
         return 0;
     }
 
+    s_instance->m_decoderFile = pFile;
+
     int32_t bytesToRead = iLen;
     const int32_t remaining = pFile->iSize - pFile->iPos;
 
@@ -143,7 +374,17 @@ auto Gif::gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
         return 0;
     }
 
-    const auto bytesRead = static_cast<int32_t>(filePtr->read(pBuf, static_cast<size_t>(bytesToRead)));
+    // memcpy_P: mapped flash only supports aligned 32-bit reads, it works on RAM as well
+    if (inMemory) {
+        memcpy_P(pBuf, s_instance->m_memData + pFile->iPos, static_cast<size_t>(bytesToRead));
+        pFile->iPos += bytesToRead;
+
+        return bytesToRead;
+    }
+
+    const int32_t bytesRead = s_instance->m_readCacheEnabled
+                                  ? s_instance->readThrough(*filePtr, pFile->iPos, pBuf, bytesToRead)
+                                  : s_instance->readFile(*filePtr, pFile->iPos, pBuf, bytesToRead);
 
     if (bytesRead > 0) {
         pFile->iPos += bytesRead;
@@ -162,10 +403,16 @@ auto Gif::gifReadFile(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
 auto Gif::gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t {
     auto* filePtr = reinterpret_cast<File*>(pFile->fHandle);
 
-    if (filePtr == nullptr || !(*filePtr)) {
+    if (filePtr == nullptr || s_instance == nullptr) {
+        return 0;
+    }
+
+    if (pFile->fHandle != s_instance->m_memData && !(*filePtr)) {
         return 0;
     }
 
+    s_instance->m_decoderFile = pFile;
+
     if (iPosition < 0) {
         iPosition = 0;
     }
@@ -173,184 +420,641 @@ auto Gif::gifSeekFile(GIFFILE* pFile, int32_t iPosition) -> int32_t {
         iPosition = pFile->iSize - 1;
     }
 
+    // The file itself is only repositioned by the next read that misses the read-ahead window
     pFile->iPos = iPosition;
-    (void)filePtr->seek(static_cast<uint32_t>(iPosition), SeekSet);
 
     return iPosition;
 }
 
 /**
- * @brief Draw a frame of the GIF
+ * @brief Read straight from LittleFS, repositioning the file only when needed
  *
- * @note need to be refactored
+ * @param file The open file
+ * @param pos File offset to read from
+ * @param dst Destination buffer
+ * @param len Number of bytes to read
  *
- * @param pDraw Pointer to the GIFDRAW structure
+ * @return Number of bytes read
  */
-auto Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognitive-complexity)
-{
-    auto* gfx = DisplayManager::getGfx();
-    if (gfx == nullptr) {
-        return;
+auto Gif::readFile(File& file, int32_t pos, uint8_t* dst, int32_t len) -> int32_t {
+    if (m_filePos != pos) {
+        (void)file.seek(static_cast<uint32_t>(pos), SeekSet);
     }
 
-    auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
-    if (pDraw->y == 0) {
-        tft->startWrite();
-
-        if (s_instance != nullptr) {
-            s_instance->m_inFrameWrite = true;
-        }
-    }
+    const auto bytesRead = static_cast<int32_t>(file.read(dst, static_cast<size_t>(len)));
+    m_filePos = pos + std::max(bytesRead, 0);
 
-    const auto* palette565 = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
-    const auto* src = pDraw->pPixels;
+    ++m_stats.fileReadCalls;
+    m_stats.fileReadBytes += static_cast<uint32_t>(std::max(bytesRead, 0));
 
-    const auto rawY = static_cast<int>(pDraw->iY + pDraw->y);
-    const auto rawX = static_cast<int>(pDraw->iX);
-    const auto width = static_cast<int>(pDraw->iWidth);
+    return bytesRead;
+}
 
-    if (pDraw->y == 0 && s_instance != nullptr) {
-        if (!s_instance->m_centered) {
-            const auto screenW = static_cast<int>(gfx->width());
-            const auto screenH = static_cast<int>(gfx->height());
-            const auto gifW = static_cast<int>(pDraw->iWidth);
-            const auto gifH = static_cast<int>(pDraw->iHeight);
+/**
+ * @brief Serve a read from the read-ahead window, refilling it from LittleFS on a miss
+ *
+ * Reads at least as large as the window go straight to the caller's buffer and leave their tail in it
+ *
+ * @param file The open file
+ * @param pos File offset to read from
+ * @param dst Destination buffer
+ * @param len Number of bytes to read
+ *
+ * @return Number of bytes read
+ */
+auto Gif::readThrough(File& file, int32_t pos, uint8_t* dst, int32_t len) -> int32_t {
+    int32_t copied = 0;
 
-            const auto centerX = static_cast<int>((screenW - gifW) / 2);
-            const auto centerY = static_cast<int>((screenH - gifH) / 2);
+    while (copied < len) {
+        const int32_t offset = pos + copied;
+        const int32_t windowEnd = m_readAheadStart + m_readAheadLen;
 
-            s_instance->m_offsetX = static_cast<int16_t>(centerX - static_cast<int>(pDraw->iX));
-            s_instance->m_offsetY = static_cast<int16_t>(centerY - static_cast<int>(pDraw->iY));
-            s_instance->m_centered = true;
+        if (offset >= m_readAheadStart && offset < windowEnd) {
+            const int32_t chunk = std::min(len - copied, windowEnd - offset);
+            memcpy(dst + copied, m_readAhead.data() + (offset - m_readAheadStart), static_cast<size_t>(chunk));
+            copied += chunk;
+            continue;
         }
 
-        s_instance->m_curDisposal = pDraw->ucDisposalMethod;
-        s_instance->m_curHadTransparency = (pDraw->ucHasTransparency != 0);
-        s_instance->m_curX = static_cast<int16_t>(pDraw->iX + s_instance->m_offsetX);
-        s_instance->m_curY = static_cast<int16_t>(pDraw->iY + s_instance->m_offsetY);
-        s_instance->m_curW = static_cast<int16_t>(pDraw->iWidth);
-        s_instance->m_curH = static_cast<int16_t>(pDraw->iHeight);
-        s_instance->m_curBg = LCD_BLACK;
-    }
-
-    const auto xPos = static_cast<int>(rawX + (s_instance != nullptr ? s_instance->m_offsetX : 0));
-    const auto yPos = static_cast<int>(rawY + (s_instance != nullptr ? s_instance->m_offsetY : 0));
+        if (len - copied >= static_cast<int32_t>(READ_AHEAD_BYTES)) {
+            const int32_t bytesRead = std::max(readFile(file, offset, dst + copied, len - copied), 0);
 
-    if (yPos < 0 || yPos >= static_cast<int>(gfx->height())) {
-        return;
-    }
+            // Keep the tail, the decoder seeks back to whatever part of a big read it did not consume
+            const int32_t keep = std::min(bytesRead, static_cast<int32_t>(READ_AHEAD_BYTES));
+            memcpy(m_readAhead.data(), dst + copied + bytesRead - keep, static_cast<size_t>(keep));
+            m_readAheadStart = offset + bytesRead - keep;
+            m_readAheadLen = keep;
 
-    std::array<uint16_t, LINEBUF_MAX> localLineBuf{};
-    std::array<uint16_t, LINEBUF_MAX>* pLineBuf = (s_instance != nullptr) ? &s_instance->m_lineBuf : &localLineBuf;
-    auto& lineBuf = *pLineBuf;
-    const auto maxW = static_cast<int>(lineBuf.size());
-    const auto drawW = (width > maxW) ? maxW : width;
+            return copied + bytesRead;
+        }
 
-    int visStart = 0;
-    int visEnd = drawW;
+        const int32_t bytesRead = readFile(file, offset, m_readAhead.data(), static_cast<int32_t>(READ_AHEAD_BYTES));
+        if (bytesRead <= 0) {
+            break;
+        }
 
-    if (xPos < 0) {
-        visStart = -xPos;
+        m_readAheadStart = offset;
+        m_readAheadLen = bytesRead;
     }
 
-    if (xPos + visEnd > static_cast<int>(gfx->width())) {
-        visEnd = static_cast<int>(gfx->width() - xPos);
+    return copied;
+}
+
+/**
+ * @brief Get a handle on a file, reusing the preloaded one when it is the same path
+ *
+ * @param path The path to the GIF file
+ *
+ * @return The file, rewound, or an invalid File if it cannot be opened
+ */
+auto Gif::takeFile(const String& path) -> File {
+    if (m_nextFile && path == m_nextPath) {
+        File file = m_nextFile;
+        file.seek(0);
+        m_nextFile = File();
+        m_nextPath = "";
+
+        return file;
     }
 
-    if (visEnd <= visStart) {
-        return;
+    return LittleFS.open(path, "r");
+}
+
+/**
+ * @brief Copy a whole file to RAM if it fits the heap-dependent budget
+ *
+ * @param path The path to the GIF file
+ *
+ * @return true if m_ramData now holds the file
+ */
+auto Gif::loadIntoRam(const String& path) -> bool {
+    if (m_ramData != nullptr && path == m_ramPath) {
+        return true;
     }
 
-    const auto curStart = static_cast<int>(xPos + visStart);
-    const auto curEnd = static_cast<int>(xPos + visEnd);
+    releaseRam();
 
-    const auto screenW = static_cast<int>(gfx->width());
-    bool skipDraw = false;
+    const uint32_t maxBlock = EspClass::getMaxFreeBlockSize();
+    const uint32_t budget =
+        maxBlock > DISPLAY_HEAP_RESERVE ? std::min(maxBlock - DISPLAY_HEAP_RESERVE, GIF_RAM_MAX_BYTES) : 0U;
 
-    if (width <= 0) {
-        skipDraw = true;
+    File file = takeFile(path);
+    if (!file) {
+        return false;
     }
-    if (xPos >= screenW || (xPos + drawW) <= 0) {
-        skipDraw = true;
+
+    const auto size = static_cast<uint32_t>(file.size());
+    if (size == 0 || size > budget) {
+        // Too large: hand the handle back so the streamed open does not reopen the file, unless
+        // that would evict the preload of another file
+        if (m_nextFile) {
+            file.close();
+        } else {
+            m_nextFile = file;
+            m_nextPath = path;
+        }
+
+        return false;
     }
 
-    const bool endOfFrame = (pDraw->y == static_cast<int>(pDraw->iHeight - 1));
+    m_ramData = new (std::nothrow) uint8_t[size];
+    if (m_ramData == nullptr) {
+        file.close();
 
-    bool needClearLine = false;
-    int clearStart = 0;
-    int clearEnd = 0;
+        return false;
+    }
 
-    if (s_instance != nullptr && s_instance->m_havePrev &&
-        (s_instance->m_prevDisposal == 2 || s_instance->m_prevHadTransparency)) {
-        const auto prevTop = s_instance->m_prevY;
-        const auto prevBot =
-            static_cast<int>(static_cast<int32_t>(s_instance->m_prevY) + static_cast<int32_t>(s_instance->m_prevH) - 1);
+    m_filePos = 0;
+    if (readFile(file, 0, m_ramData, static_cast<int32_t>(size)) != static_cast<int32_t>(size)) {
+        file.close();
+        releaseRam();
 
-        if (yPos >= prevTop && yPos <= prevBot) {
-            needClearLine = true;
-            clearStart = s_instance->m_prevX;
-            clearEnd =
-                static_cast<int>(static_cast<int32_t>(s_instance->m_prevX) + static_cast<int32_t>(s_instance->m_prevW));
-        }
+        return false;
     }
 
-    const bool curValid = (!skipDraw);
+    file.close();
+    m_ramSize = static_cast<int32_t>(size);
+    m_ramPath = path;
 
-    if (needClearLine || curValid) {
-        const auto screenW2 = static_cast<int>(gfx->width());
-        int uStart = curValid ? curStart : clearStart;
-        int uEnd = curValid ? curEnd : clearEnd;
+    return true;
+}
 
-        if (needClearLine) {
-            if (clearStart < uStart) {
-                uStart = clearStart;
-            }
-            if (clearEnd > uEnd) {
-                uEnd = clearEnd;
-            }
-        }
+/**
+ * @brief Free the RAM copy of a file
+ *
+ * @return void
+ */
+auto Gif::releaseRam() -> void {
+    delete[] m_ramData;
+    m_ramData = nullptr;
+    m_ramSize = 0;
+    m_ramPath = "";
+}
 
-        if (uStart < 0) {
-            uStart = 0;
+/**
+ * @brief Open a file in the decoder on the cheapest read tier available
+ *
+ * Every tier goes through the I/O callbacks so the decoder position stays reachable for index rewinds
+ *
+ * @param path The path to the GIF file
+ *
+ * @return true if the decoder accepted the file
+ */
+auto Gif::openDecoder(const String& path) -> bool {
+    m_memData = nullptr;
+    m_memSize = 0;
+    m_decoderFile = nullptr;
+    m_palette444Source = nullptr;
+
+    if (path.startsWith(GIF_SLOT_PREFIX)) {
+        const GifSlot* slot = GifSlotStore::find(path.substring(strlen(GIF_SLOT_PREFIX)));
+        if (path == m_nextPath) {
+            m_nextPath = "";
         }
-        if (uEnd > screenW2) {
-            uEnd = screenW2;
+        if (slot == nullptr) {
+            return false;
         }
-        const auto uLen = static_cast<int>(uEnd - uStart);
-        if (uLen > 0) {
-            const auto fillBg = (s_instance != nullptr) ? s_instance->m_prevBg : static_cast<uint16_t>(0);
 
-            if (!curValid) {
-                for (int i = 0; i < uLen; i++) {
-                    lineBuf[static_cast<size_t>(i)] = fillBg;
-                }
+        // Zero copy: the callbacks read the mapped flash directly, LittleFS is not involved
+        m_memData = GifSlotStore::data(*slot);
+        m_memSize = static_cast<int32_t>(slot->size);
+        m_stats.readTier = GifReadTier::Flash;
+    } else if (m_readCacheEnabled && loadIntoRam(path)) {
+        m_memData = m_ramData;
+        m_memSize = m_ramSize;
+        m_stats.readTier = GifReadTier::Ram;
+    } else {
+        m_stats.readTier = m_readCacheEnabled ? GifReadTier::ReadAhead : GifReadTier::Direct;
+    }
 
-                tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
-                                     static_cast<uint16_t>(uLen), 1);
-                tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
+    return m_gif->open(path.c_str(), gifOpenFile, gifCloseFile, gifReadFile, gifSeekFile, gifDraw) > 0;
+}
 
-            } else {
-                if (pDraw->ucHasTransparency == 0) {
-                    for (int i = 0; i < uLen; i++) {
-                        lineBuf[static_cast<size_t>(i)] = fillBg;
-                    }
+/**
+ * @brief Pick up the frame index of the file just opened, if it has an up-to-date one
+ *
+ * @return void
+ */
+auto Gif::loadFrameIndex() -> void {
+    GifFrameEntry first{};
 
-                    const auto* const sPtr = src;
-                    const auto baseX = xPos - uStart;
+    m_frameNumber = 0;
+    m_indexed = m_decoderFile != nullptr &&
+                GifFrameIndex::load(m_currentPath, static_cast<uint32_t>(m_decoderFile->iSize), m_index, first);
+    m_firstFrameOffset = m_indexed ? first.offset : 0U;
+}
 
-                    for (int i = 0; i < drawW; ++i) {
-                        const auto dstIndex = baseX + i;
+/**
+ * @brief Move the decoder to a frame offset from the frame index
+ *
+ * Goes through the seek callback the decoder itself uses. This relies on one invariant shared by
+ * AnimatedGIF 2.x and display/GifDecoder: playFrame() reads the next frame from GIFFILE::iPos
+ * through the read callback and keeps no input buffered past it between frames, while the canvas
+ * and global palette parsed by open() stay as they are. AnimatedGIF only parses the header again
+ * for a frame read from offset 0, where it goes back by itself once iPos reaches the trailer, so a
+ * frame offset skips it; GifDecoder drops its input window at the start of every frame
+ *
+ * @param offset File offset of the frame's first block
+ *
+ * @return true if the decoder is now positioned at the offset
+ */
+auto Gif::seekDecoder(uint32_t offset) -> bool {
+    if (m_decoderFile == nullptr || offset == 0U || offset >= static_cast<uint32_t>(m_decoderFile->iSize)) {
+        return false;
+    }
+
+    return gifSeekFile(m_decoderFile, static_cast<int32_t>(offset)) == static_cast<int32_t>(offset);
+}
+
+/**
+ * @brief Close whatever the current file is played from, decoder or transcoded file
+ *
+ * @return void
+ */
+auto Gif::closeDecoder() -> void {
+    if (m_nativeActive) {
+        m_native.close();
+        m_nativeActive = false;
+
+        return;
+    }
+
+    m_gif->close();
+}
+
+/**
+ * @brief Draw the next frame of the transcoded file
+ *
+ * Rows hold only the spans that changed, already composed and in panel byte order: a frame whose
+ * rows are all full width runs through one address window, any other gets a window per span
+ *
+ * @param delayMs Receives the frame delay
+ *
+ * @return 1 if more frames follow, 0 after the last frame, -1 on a damaged file
+ */
+auto Gif::playNativeFrame(int* delayMs) -> int {
+    auto* gfx = DisplayManager::getGfx();
+    GifNativeFrame frame{};
+
+    if (gfx == nullptr || !m_native.readFrame(frame)) {
+        return -1;
+    }
+
+    *delayMs = frame.delayMs;
+
+    m_composite = m_compositor != nullptr && m_compositor->isActive();
+
+    const auto wanted = (m_rgb444Enabled && !m_composite) ? PanelColorMode::Rgb444 : PanelColorMode::Rgb565;
+    if (DisplayManager::getPanelColorMode() != wanted) {
+        DisplayManager::setPanelColorMode(wanted);
+    }
+    m_rgb444Active = wanted == PanelColorMode::Rgb444;
+
+    // Nothing below keeps the row hashes and clean spans of the decoder path up to date
+    invalidatePanelRows();
+
+    auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
+    const int screenW = static_cast<int>(gfx->width());
+    const int screenH = static_cast<int>(gfx->height());
+    const int left = frame.x + m_offsetX;
+    const int top = frame.y + m_offsetY;
+
+    const bool stream = (frame.flags & GIF_NATIVE_SOLID) != 0 && left >= 0 && top >= 0 &&
+                        left + frame.width <= screenW && top + frame.height <= screenH &&
+                        (!m_rgb444Active || (frame.width & 1U) == 0);
+
+    const uint32_t startCycles = EspClass::getCycleCount();
+    const uint32_t startIdle = DisplayManager::getPanelWaitCycles();
+
+    tft->startWrite();
+    if (stream) {
+        openWindow(tft, static_cast<int16_t>(left), static_cast<int16_t>(top), frame.width, frame.height);
+    }
+
+    bool intact = true;
+    for (uint16_t rowIndex = 0; rowIndex < frame.rowCount && intact; ++rowIndex) {
+        GifNativeRow row{};
+        intact = m_native.readRow(row);
+        const int yPos = row.y + m_offsetY;
+
+        for (uint16_t spanIndex = 0; spanIndex < row.spanCount && intact; ++spanIndex) {
+            // Streamed rows alternate buffers so the next one is read while the last one is on the wire
+            auto& lineBuf = (stream && m_useAltLineBuf) ? m_lineBufAlt : m_lineBuf;
+            m_useAltLineBuf = stream && !m_useAltLineBuf;
+
+            GifNativeSpan span{};
+            intact = m_native.readSpan(span, lineBuf.data(), lineBuf.size());
+            if (!intact) {
+                break;
+            }
+
+            if (stream) {
+                if (m_composite) {
+                    m_compositor->composeRow(yPos, left, lineBuf.data(), span.length);
+                }
+
+                uint32_t wireBytes = static_cast<uint32_t>(span.length) * 2U;
+                if (m_rgb444Active) {
+                    wireBytes = packPixelsRgb444(lineBuf.data(), span.length, left, yPos, m_ditherEnabled);
+                }
+                pushToPanel(reinterpret_cast<const uint8_t*>(lineBuf.data()), wireBytes, true);
+                continue;
+            }
+
+            const int xStart = std::max(span.x + m_offsetX, 0);
+            const int xEnd = std::min(span.x + m_offsetX + static_cast<int>(span.length), screenW);
+            if (yPos < 0 || yPos >= screenH || xEnd <= xStart) {
+                continue;
+            }
+
+            DisplayManager::waitPanelIdle();
+            openWindow(tft, static_cast<int16_t>(xStart), static_cast<int16_t>(yPos),
+                       static_cast<uint16_t>(xEnd - xStart), 1);
+            sendLine(lineBuf.data() + (xStart - span.x - m_offsetX), xEnd - xStart, xStart, yPos);
+        }
+
+        timedYield();
+    }
+
+    DisplayManager::waitPanelIdle();
+    tft->endWrite();
+    m_useAltLineBuf = false;
+
+    if (!intact) {
+        return -1;
+    }
+
+    const uint32_t frameCycles = EspClass::getCycleCount() - startCycles;
+    const uint32_t idleCycles = DisplayManager::getPanelWaitCycles() - startIdle;
+
+    ++m_stats.frames;
+    ++m_stats.nativeFrames;
+    if (stream) {
+        ++m_stats.streamedFrames;
+    }
+    m_stats.lastFrameCycles = frameCycles;
+    m_stats.lastIdleCycles = idleCycles;
+    m_stats.totalFrameCycles += frameCycles;
+    m_stats.totalIdleCycles += idleCycles;
+
+    return m_native.frameNumber() < m_native.header().frameCount ? 1 : 0;
+}
+
+/**
+ * @brief Draw a frame of the GIF
+ *
+ * @note need to be refactored
+ *
+ * @param pDraw Pointer to the GIFDRAW structure
+ */
+auto HOT_PATH Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognitive-complexity)
+{
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr) {
+        return;
+    }
+
+    if (s_instance != nullptr) {
+        if (pDraw->y == 0) {
+            s_instance->noteFrameCoverage(pDraw);
+        }
+
+        // Decode-only frame: the LZW stream still has to be walked, nothing reaches the panel
+        if (s_instance->m_skipDraw) {
+            return;
+        }
+    }
+
+    auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
+    if (pDraw->y == 0) {
+        if (s_instance != nullptr) {
+            s_instance->beginFrameColorMode(pDraw);
+        }
+
+        tft->startWrite();
+
+        if (s_instance != nullptr) {
+            s_instance->m_inFrameWrite = true;
+            s_instance->m_frameStartCycles = EspClass::getCycleCount();
+            s_instance->m_frameStartIdle = DisplayManager::getPanelWaitCycles();
+            s_instance->m_frameSkippedRows = 0;
+            s_instance->m_frameSkippedBytes = 0;
+        }
+    }
+
+    const auto* palette565 = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
+    const auto* src = pDraw->pPixels;
+
+    const auto rawY = static_cast<int>(pDraw->iY + pDraw->y);
+    const auto rawX = static_cast<int>(pDraw->iX);
+    const auto width = static_cast<int>(pDraw->iWidth);
+
+    if (pDraw->y == 0 && s_instance != nullptr) {
+        if (!s_instance->m_centered) {
+            const auto screenW = static_cast<int>(gfx->width());
+            const auto screenH = static_cast<int>(gfx->height());
+            const auto gifW = s_instance->toScreen(pDraw->iX + pDraw->iWidth) - s_instance->toScreen(pDraw->iX);
+            const auto gifH = s_instance->toScreen(pDraw->iY + pDraw->iHeight) - s_instance->toScreen(pDraw->iY);
+
+            const auto centerX = static_cast<int>((screenW - gifW) / 2);
+            const auto centerY = static_cast<int>((screenH - gifH) / 2);
+
+            s_instance->m_offsetX = static_cast<int16_t>(centerX - s_instance->toScreen(pDraw->iX));
+            s_instance->m_offsetY = static_cast<int16_t>(centerY - s_instance->toScreen(pDraw->iY));
+            s_instance->m_centered = true;
+        }
+
+        // Frame rectangle on the panel, scaled like its pixels
+        const int left = s_instance->toScreen(pDraw->iX);
+        const int top = s_instance->toScreen(pDraw->iY);
+
+        s_instance->m_curDisposal = pDraw->ucDisposalMethod;
+        s_instance->m_curHadTransparency = (pDraw->ucHasTransparency != 0);
+        s_instance->m_curX = static_cast<int16_t>(left + s_instance->m_offsetX);
+        s_instance->m_curY = static_cast<int16_t>(top + s_instance->m_offsetY);
+        s_instance->m_curW = static_cast<int16_t>(s_instance->toScreen(pDraw->iX + pDraw->iWidth) - left);
+        s_instance->m_curH = static_cast<int16_t>(s_instance->toScreen(pDraw->iY + pDraw->iHeight) - top);
+        s_instance->m_curBg = toPanelOrder(LCD_BLACK);
+
+        s_instance->m_streamNextY = 0;
+        s_instance->m_streamWindowStale = false;
+        s_instance->m_frameStream =
+            s_instance->canStreamFrame(pDraw, static_cast<int>(gfx->width()), static_cast<int>(gfx->height()));
+
+        if (s_instance->m_frameStream) {
+            openWindow(tft, s_instance->m_curX, s_instance->m_curY, static_cast<uint16_t>(s_instance->m_curW),
+                       static_cast<uint16_t>(s_instance->m_curH));
+        }
+    }
+
+    const bool endOfFrame = (pDraw->y == static_cast<int>(pDraw->iHeight - 1));
+
+    if (s_instance != nullptr && (s_instance->m_scale.up != 1 || s_instance->m_scale.down != 1)) {
+        s_instance->drawScaledLine(tft, pDraw);
+
+        if (endOfFrame) {
+            s_instance->finishFrame(tft);
+        }
+
+        return;
+    }
+
+    if (s_instance != nullptr && s_instance->m_frameStream && s_instance->streamFrameLine(tft, pDraw)) {
+        timedYield();
+
+        if (endOfFrame) {
+            s_instance->finishFrame(tft);
+        }
+
+        return;
+    }
+
+    // The per-line path reuses m_lineBuf and sends commands, so the last streamed line must be out
+    DisplayManager::waitPanelIdle();
+
+    const auto xPos = static_cast<int>(rawX + (s_instance != nullptr ? s_instance->m_offsetX : 0));
+    const auto yPos = static_cast<int>(rawY + (s_instance != nullptr ? s_instance->m_offsetY : 0));
+
+    if (s_instance != nullptr && s_instance->skipInterlacedRow(yPos)) {
+        if (endOfFrame) {
+            s_instance->finishFrame(tft);
+        }
+
+        return;
+    }
+
+    // Rows clipped off the panel still close the frame they end (oversized canvases)
+    if (yPos < 0 || yPos >= static_cast<int>(gfx->height())) {
+        if (endOfFrame && s_instance != nullptr) {
+            s_instance->finishFrame(tft);
+        }
+
+        return;
+    }
+
+    std::array<uint16_t, LINEBUF_MAX> localLineBuf{};
+    std::array<uint16_t, LINEBUF_MAX>* pLineBuf = (s_instance != nullptr) ? &s_instance->m_lineBuf : &localLineBuf;
+    auto& lineBuf = *pLineBuf;
+    const auto maxW = static_cast<int>(lineBuf.size());
+    const auto drawW = (width > maxW) ? maxW : width;
+
+    int visStart = 0;
+    int visEnd = drawW;
+
+    if (xPos < 0) {
+        visStart = -xPos;
+    }
+
+    if (xPos + visEnd > static_cast<int>(gfx->width())) {
+        visEnd = static_cast<int>(gfx->width() - xPos);
+    }
+
+    if (visEnd <= visStart) {
+        if (endOfFrame && s_instance != nullptr) {
+            s_instance->finishFrame(tft);
+        }
+
+        return;
+    }
+
+    const auto curStart = static_cast<int>(xPos + visStart);
+    const auto curEnd = static_cast<int>(xPos + visEnd);
+
+    const auto screenW = static_cast<int>(gfx->width());
+    bool skipDraw = false;
+
+    if (width <= 0) {
+        skipDraw = true;
+    }
+    if (xPos >= screenW || (xPos + drawW) <= 0) {
+        skipDraw = true;
+    }
+
+    bool needClearLine = false;
+    int clearStart = 0;
+    int clearEnd = 0;
+
+    if (s_instance != nullptr && s_instance->m_havePrev &&
+        (s_instance->m_prevDisposal == 2 || s_instance->m_prevHadTransparency)) {
+        const auto prevTop = s_instance->m_prevY;
+        const auto prevBot =
+            static_cast<int>(static_cast<int32_t>(s_instance->m_prevY) + static_cast<int32_t>(s_instance->m_prevH) - 1);
+
+        if (yPos >= prevTop && yPos <= prevBot) {
+            needClearLine = true;
+            clearStart = s_instance->m_prevX;
+            clearEnd =
+                static_cast<int>(static_cast<int32_t>(s_instance->m_prevX) + static_cast<int32_t>(s_instance->m_prevW));
+        }
+    }
+
+    const bool curValid = (!skipDraw);
+
+    if (needClearLine || curValid) {
+        const auto screenW2 = static_cast<int>(gfx->width());
+        int uStart = curValid ? curStart : clearStart;
+        int uEnd = curValid ? curEnd : clearEnd;
+
+        if (needClearLine) {
+            if (clearStart < uStart) {
+                uStart = clearStart;
+            }
+            if (clearEnd > uEnd) {
+                uEnd = clearEnd;
+            }
+        }
+
+        if (uStart < 0) {
+            uStart = 0;
+        }
+        if (uEnd > screenW2) {
+            uEnd = screenW2;
+        }
+        const auto uLen = static_cast<int>(uEnd - uStart);
+        if (uLen > 0) {
+            const auto fillBg = (s_instance != nullptr) ? s_instance->m_prevBg : static_cast<uint16_t>(0);
+
+            if (!curValid) {
+                for (int i = 0; i < uLen; i++) {
+                    lineBuf[static_cast<size_t>(i)] = fillBg;
+                }
+
+                if (s_instance == nullptr || !s_instance->skipUnchangedRow(yPos, uStart, lineBuf.data(), uLen)) {
+                    openWindow(tft, static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
+                               static_cast<uint16_t>(uLen), 1);
+                    sendLine(lineBuf.data(), uLen, uStart, yPos);
+                }
+                if (s_instance != nullptr) {
+                    s_instance->noteRowWrite(yPos, uStart, uEnd, true);
+                }
+
+            } else {
+                if (pDraw->ucHasTransparency == 0) {
+                    for (int i = 0; i < uLen; i++) {
+                        lineBuf[static_cast<size_t>(i)] = fillBg;
+                    }
+
+                    const auto* const sPtr = src;
+                    const auto baseX = xPos - uStart;
+
+                    for (int i = 0; i < drawW; ++i) {
+                        const auto dstIndex = baseX + i;
 
                         if (dstIndex >= 0 && dstIndex < uLen) {
                             lineBuf[static_cast<size_t>(dstIndex)] = palette565[static_cast<uint8_t>(sPtr[i])];
                         }
                     }
 
-                    tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
-                                         static_cast<uint16_t>(uLen), 1);
-                    tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
+                    if (s_instance == nullptr || !s_instance->skipUnchangedRow(yPos, uStart, lineBuf.data(), uLen)) {
+                        openWindow(tft, static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
+                                   static_cast<uint16_t>(uLen), 1);
+                        sendLine(lineBuf.data(), uLen, uStart, yPos);
+                    }
+                    if (s_instance != nullptr) {
+                        s_instance->noteRowWrite(yPos, uStart, uEnd, false);
+                    }
 
-                    yield();
+                    timedYield();
                 } else {
                     if (needClearLine) {
                         for (int i = 0; i < uLen; i++) {
@@ -373,42 +1077,76 @@ auto Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognit
                             }
                         }
 
-                        tft->writeAddrWindow(static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
-                                             static_cast<uint16_t>(uLen), 1);
-                        tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()), static_cast<uint32_t>(uLen));
+                        if (s_instance == nullptr ||
+                            !s_instance->skipUnchangedRow(yPos, uStart, lineBuf.data(), uLen)) {
+                            openWindow(tft, static_cast<int16_t>(uStart), static_cast<int16_t>(yPos),
+                                       static_cast<uint16_t>(uLen), 1);
+                            sendLine(lineBuf.data(), uLen, uStart, yPos);
+                        }
+                        if (s_instance != nullptr) {
+                            s_instance->noteRowWrite(yPos, uStart, uEnd, false);
+                        }
 
-                        yield();
-                        yield();
+                        timedYield();
+                        timedYield();
                     } else {
                         const auto transparentIndex = static_cast<uint8_t>(pDraw->ucTransparent);
                         const auto* const sPtr = src + visStart;
+                        const auto visLen = static_cast<int>(visEnd - visStart);
+                        const auto baseX = static_cast<int>(xPos + visStart);
+                        const bool coalesce = (s_instance != nullptr) && s_instance->m_gapCoalesceEnabled;
                         int idx = 0;
+                        int winStart = 0;
+                        int winLen = 0;
+
+                        // Gaps may only be filled where the panel is known to show the background, looked up
+                        // before this row changes anything
+                        const CleanSpan clean = (s_instance != nullptr) ? s_instance->cleanSpanOf(yPos) : CleanSpan{};
+
+                        // Runs only overwrite part of the row, its hash no longer describes the panel
+                        if (s_instance != nullptr) {
+                            s_instance->forgetRow(yPos);
+                        }
 
-                        while (idx < (visEnd - visStart)) {
-                            while (idx < (visEnd - visStart) && sPtr[idx] == transparentIndex) {
+                        while (idx < visLen) {
+                            const int gapStart = idx;
+
+                            while (idx < visLen && sPtr[idx] == transparentIndex) {
                                 idx++;
                             }
 
-                            if (idx >= (visEnd - visStart)) {
+                            if (idx >= visLen) {
                                 break;
                             }
 
-                            int runLen = 0;
-
-                            while (idx < (visEnd - visStart) && sPtr[idx] != transparentIndex) {
-                                lineBuf[static_cast<size_t>(runLen)] = palette565[static_cast<uint8_t>(sPtr[idx])];
-                                ++runLen;
-                                ++idx;
+                            if (winLen > 0) {
+                                const int gapLen = idx - gapStart;
+                                const bool gapIsBg = (baseX + gapStart) >= static_cast<int>(clean.start) &&
+                                                     (baseX + idx) <= static_cast<int>(clean.end);
+
+                                // Merge when the extra background pixels cost less than another window
+                                if (coalesce && gapIsBg && gapLen * 2 <= GIF_WINDOW_COST_BYTES) {
+                                    for (int i = 0; i < gapLen; ++i) {
+                                        lineBuf[static_cast<size_t>(winLen++)] = fillBg;
+                                    }
+                                } else {
+                                    writeRunWindow(tft, lineBuf.data(), baseX + winStart, yPos, winLen);
+                                    winLen = 0;
+                                }
                             }
 
-                            const auto dstX = static_cast<int>(xPos + visStart + (idx - runLen));
+                            if (winLen == 0) {
+                                winStart = idx;
+                            }
 
-                            tft->writeAddrWindow(static_cast<int16_t>(dstX), static_cast<int16_t>(yPos),
-                                                 static_cast<uint16_t>(runLen), 1);
-                            tft->writePixels(reinterpret_cast<uint16_t*>(lineBuf.data()),
-                                             static_cast<uint32_t>(runLen));
+                            while (idx < visLen && sPtr[idx] != transparentIndex) {
+                                lineBuf[static_cast<size_t>(winLen++)] = palette565[static_cast<uint8_t>(sPtr[idx])];
+                                ++idx;
+                            }
+                        }
 
-                            yield();
+                        if (winLen > 0) {
+                            writeRunWindow(tft, lineBuf.data(), baseX + winStart, yPos, winLen);
                         }
                     }
                 }
@@ -416,63 +1154,923 @@ auto Gif::gifDraw(GIFDRAW* pDraw) -> void  // NOLINT(readability-function-cognit
         }
     }
 
-    if (endOfFrame) {
-        if (s_instance != nullptr && s_instance->m_inFrameWrite) {
-            tft->endWrite();
-            s_instance->m_inFrameWrite = false;
-        }
+    if (endOfFrame && s_instance != nullptr) {
+        s_instance->finishFrame(tft);
+    }
+}
 
-        if (s_instance != nullptr) {
-            s_instance->m_havePrev = true;
-            s_instance->m_prevDisposal = s_instance->m_curDisposal;
-            s_instance->m_prevHadTransparency = s_instance->m_curHadTransparency;
-            s_instance->m_prevX = s_instance->m_curX;
-            s_instance->m_prevY = s_instance->m_curY;
-            s_instance->m_prevW = s_instance->m_curW;
-            s_instance->m_prevH = s_instance->m_curH;
-            s_instance->m_prevBg = s_instance->m_curBg;
+/**
+ * @brief Check whether the current frame can be streamed through a single address window
+ *
+ * The frame has to be opaque, unscaled, fully on screen, fit in the line buffer and cover any area
+ * the previous frame asked to be cleared, otherwise the per-line path handles it
+ *
+ * @param pDraw Pointer to the GIFDRAW structure of the first line
+ * @param screenW Screen width in pixels
+ * @param screenH Screen height in pixels
+ *
+ * @return true if the frame can be pushed as one RAMWR stream
+ */
+auto Gif::canStreamFrame(const GIFDRAW* pDraw, int screenW, int screenH) const -> bool {
+    if (!m_frameStreamEnabled || pDraw->ucHasTransparency != 0 || m_scale.up != 1 || m_scale.down != 1) {
+        return false;
+    }
+
+    const auto left = static_cast<int>(m_curX);
+    const auto top = static_cast<int>(m_curY);
+    const auto right = left + static_cast<int>(m_curW);
+    const auto bottom = top + static_cast<int>(m_curH);
+
+    if (m_curW <= 0 || m_curH <= 0 || static_cast<size_t>(m_curW) > LINEBUF_MAX) {
+        return false;
+    }
+
+    // Packed RGB444 rows must end on a whole pixel pair to run on into the next row
+    if (m_rgb444Active && (m_curW & 1) != 0) {
+        return false;
+    }
+
+    if (left < 0 || top < 0 || right > screenW || bottom > screenH) {
+        return false;
+    }
+
+    if (m_havePrev && (m_prevDisposal == 2 || m_prevHadTransparency)) {
+        const auto prevRight = static_cast<int>(m_prevX) + static_cast<int>(m_prevW);
+        const auto prevBottom = static_cast<int>(m_prevY) + static_cast<int>(m_prevH);
+
+        if (m_prevX < left || m_prevY < top || prevRight > right || prevBottom > bottom) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Push one decoded line into the address window opened for the whole frame
+ *
+ * @param tft Pointer to the panel driver
+ * @param pDraw Pointer to the GIFDRAW structure
+ *
+ * @return true if the line was sent, false if the frame must fall back to the per-line path
+ */
+auto HOT_PATH Gif::streamFrameLine(Arduino_TFT* tft, const GIFDRAW* pDraw) -> bool {
+    if (pDraw->y != m_streamNextY) {
+        // Interlaced frames deliver rows out of order, finish them line by line
+        m_frameStream = false;
+
+        return false;
+    }
+
+    const auto* palette565 = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
+    const auto* src = pDraw->pPixels;
+    const auto width = static_cast<size_t>(m_curW);
+    const auto screenY = static_cast<int>(m_curY) + pDraw->y;
+
+    // Left out this frame: the panel keeps the row (and its hash stays valid), the window moves on
+    if (skipInterlacedRow(screenY)) {
+        ++m_streamNextY;
+        m_streamWindowStale = true;
+
+        return true;
+    }
+
+    // The previous line may still be draining from the other buffer while this one is decoded
+    auto& lineBuf = m_useAltLineBuf ? m_lineBufAlt : m_lineBuf;
+    m_useAltLineBuf = !m_useAltLineBuf;
+
+    uint32_t wireBytes = 0;
+
+    if (m_rgb444Active) {
+        const size_t rowPhase = m_ditherEnabled ? static_cast<size_t>((screenY & 1) * 2) : 0U;
+        const size_t evenPhase = m_ditherEnabled ? rowPhase + static_cast<size_t>(m_curX & 1) : 0U;
+        const size_t oddPhase = m_ditherEnabled ? rowPhase + static_cast<size_t>((m_curX + 1) & 1) : 0U;
+        auto* bytes = reinterpret_cast<uint8_t*>(lineBuf.data());
+
+        wireBytes = packIndicesRgb444(src, static_cast<int>(width), m_palette444[evenPhase].data(),
+                                      m_palette444[oddPhase].data(), bytes);
+
+        // Keep the hash independent of whatever the pad byte held before
+        if ((wireBytes & 1U) != 0) {
+            bytes[wireBytes] = 0;
+        }
+    } else {
+        for (size_t i = 0; i < width; ++i) {
+            lineBuf[i] = palette565[src[i]];
+        }
+
+        wireBytes = static_cast<uint32_t>(width) * 2U;
+    }
+
+    ++m_streamNextY;
+
+    if (skipUnchangedRow(screenY, m_curX, lineBuf.data(), static_cast<int>((wireBytes + 1U) / 2U), wireBytes)) {
+        // The panel window keeps advancing by itself, so the next sent row needs a fresh one
+        m_streamWindowStale = true;
+
+        return true;
+    }
+
+    if (m_streamWindowStale) {
+        DisplayManager::waitPanelIdle();
+        openWindow(tft, m_curX, static_cast<int16_t>(screenY), static_cast<uint16_t>(m_curW),
+                   static_cast<uint16_t>(m_curH - pDraw->y));
+        m_streamWindowStale = false;
+    }
+
+    // Hashed as decoded, the layers painted over it do not change what the GIF row holds
+    if (m_composite) {
+        m_compositor->composeRow(screenY, m_curX, lineBuf.data(), static_cast<int>(width));
+    }
+
+    pushToPanel(reinterpret_cast<const uint8_t*>(lineBuf.data()), wireBytes, true);
+    noteRowWrite(screenY, m_curX, m_curX + m_curW, false);
+
+    return true;
+}
+
+/**
+ * @brief Map a canvas coordinate to the panel, before centring
+ *
+ * Decimation keeps the even lines and columns, so a rectangle edge rounds up to the first one kept
+ *
+ * @param canvasPos Canvas column or row
+ *
+ * @return Panel column or row relative to the scaled canvas origin
+ */
+auto HOT_PATH Gif::toScreen(int canvasPos) const -> int {
+    if (m_scale.down > 1) {
+        return (canvasPos + m_scale.down - 1) / m_scale.down;
+    }
+
+    return canvasPos * m_scale.up;
+}
+
+/**
+ * @brief Get the decoded pixel shown at a panel column of a scaled frame
+ *
+ * @param pDraw Pointer to the GIFDRAW structure
+ * @param screenX Panel column inside the frame rectangle
+ *
+ * @return Index into the line pixels
+ */
+auto HOT_PATH Gif::sourceColumn(const GIFDRAW* pDraw, int screenX) const -> int {
+    const int scaledX = screenX - m_offsetX;
+    const int canvasX = m_scale.down > 1 ? scaledX * m_scale.down : scaledX / m_scale.up;
+
+    return canvasX - pDraw->iX;
+}
+
+/**
+ * @brief Draw one decoded line of a scaled GIF
+ *
+ * Enlarged lines are expanded horizontally once and repeated through a window as tall as the
+ * scale; decimated files drop every other line here and every other pixel while expanding
+ * Composition follows the unscaled per-line path, on the scaled rectangles
+ *
+ * @param tft Pointer to the panel driver
+ * @param pDraw Pointer to the GIFDRAW structure
+ */
+auto HOT_PATH Gif::drawScaledLine(Arduino_TFT* tft, const GIFDRAW* pDraw) -> void {
+    const int canvasY = pDraw->iY + pDraw->y;
+    if (canvasY % m_scale.down != 0 || skipInterlacedRow(canvasY / m_scale.down)) {
+        return;
+    }
+
+    DisplayManager::waitPanelIdle();
+
+    const auto* palette565 = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
+    const auto screenW = static_cast<int>(std::min<size_t>(DisplayManager::getGfx()->width(), LINEBUF_MAX));
+    const int yTop = toScreen(canvasY) + m_offsetY;
+    const int curStart = std::max(static_cast<int>(m_curX), 0);
+    const int curEnd = std::min(m_curX + m_curW, screenW);
+    const bool transparent = pDraw->ucHasTransparency != 0;
+    const auto transparentIndex = static_cast<uint8_t>(pDraw->ucTransparent);
+
+    const bool needClearLine = m_havePrev && (m_prevDisposal == 2 || m_prevHadTransparency) && yTop >= m_prevY &&
+                               yTop < m_prevY + m_prevH;
+
+    if (!transparent || needClearLine) {
+        int uStart = curStart;
+        int uEnd = curEnd;
+        if (needClearLine) {
+            uStart = std::min(uStart, std::max(static_cast<int>(m_prevX), 0));
+            uEnd = std::max(uEnd, std::min(m_prevX + m_prevW, screenW));
+        }
+        if (uEnd <= uStart) {
+            return;
+        }
+
+        for (int x = uStart; x < uEnd; ++x) {
+            uint16_t color = m_prevBg;
+
+            if (x >= curStart && x < curEnd) {
+                const uint8_t idx = pDraw->pPixels[sourceColumn(pDraw, x)];
+                if (!transparent || idx != transparentIndex) {
+                    color = palette565[idx];
+                }
+            }
+
+            m_lineBuf[static_cast<size_t>(x - uStart)] = color;
+        }
+
+        writeScaledRows(tft, uStart, yTop, uEnd - uStart);
+
+        return;
+    }
+
+    // Transparent frame over content that stays: one window per opaque run
+    int x = curStart;
+    while (x < curEnd) {
+        while (x < curEnd && pDraw->pPixels[sourceColumn(pDraw, x)] == transparentIndex) {
+            ++x;
+        }
+
+        const int runStart = x;
+        while (x < curEnd) {
+            const uint8_t idx = pDraw->pPixels[sourceColumn(pDraw, x)];
+            if (idx == transparentIndex) {
+                break;
+            }
+            m_lineBuf[static_cast<size_t>(x - runStart)] = palette565[idx];
+            ++x;
+        }
+
+        if (x > runStart) {
+            writeScaledRows(tft, runStart, yTop, x - runStart);
+        }
+    }
+}
+
+/**
+ * @brief Send the expanded line in m_lineBuf to as many panel rows as the scale enlarges it to
+ *
+ * The rows share one address window unless packed RGB444 rows would end on half a pixel pair
+ *
+ * @param tft Pointer to the panel driver
+ * @param xStart First panel column
+ * @param yTop First panel row
+ * @param len Number of pixels
+ */
+auto HOT_PATH Gif::writeScaledRows(Arduino_TFT* tft, int xStart, int yTop, int len) -> void {
+    const auto screenH = static_cast<int>(DisplayManager::getGfx()->height());
+    const int first = std::max(yTop, 0);
+    const int last = std::min(yTop + static_cast<int>(m_scale.up), screenH);
+    if (last <= first) {
+        return;
+    }
+
+    const bool oneWindow = !m_rgb444Active || (len & 1) == 0;
+    if (oneWindow) {
+        openWindow(tft, static_cast<int16_t>(xStart), static_cast<int16_t>(first), static_cast<uint16_t>(len),
+                   static_cast<uint16_t>(last - first));
+    }
+
+    for (int yPos = first; yPos < last; ++yPos) {
+        if (!oneWindow) {
+            openWindow(tft, static_cast<int16_t>(xStart), static_cast<int16_t>(yPos), static_cast<uint16_t>(len), 1);
+        }
+
+        // Packing to RGB444 and layers happen in place, every row is sent from an untouched copy
+        if (m_rgb444Active || m_composite) {
+            std::copy_n(m_lineBuf.begin(), len, m_lineBufAlt.begin());
+            sendLine(m_lineBufAlt.data(), len, xStart, yPos);
+        } else {
+            sendLine(m_lineBuf.data(), len, xStart, yPos);
+        }
+
+        // Rows are not hashed here, and only content is written as far as the clean spans know
+        forgetRow(yPos);
+        noteRowWrite(yPos, xStart, xStart + len, false);
+    }
+
+    timedYield();
+}
+
+/**
+ * @brief Close the frame write session and remember the frame for the next disposal
+ *
+ * @param tft Pointer to the panel driver
+ */
+auto Gif::finishFrame(Arduino_TFT* tft) -> void {
+    DisplayManager::waitPanelIdle();
+
+    if (m_inFrameWrite) {
+        tft->endWrite();
+        m_inFrameWrite = false;
+
+        const uint32_t frameCycles = EspClass::getCycleCount() - m_frameStartCycles;
+        const uint32_t idleCycles = DisplayManager::getPanelWaitCycles() - m_frameStartIdle;
+
+        ++m_stats.frames;
+        if (m_frameStream) {
+            ++m_stats.streamedFrames;
+        }
+        m_stats.lastFrameCycles = frameCycles;
+        m_stats.lastIdleCycles = idleCycles;
+        m_stats.totalFrameCycles += frameCycles;
+        m_stats.totalIdleCycles += idleCycles;
+        m_stats.lastSkippedRows = m_frameSkippedRows;
+        m_stats.lastSkippedBytes = m_frameSkippedBytes;
+        m_stats.totalSkippedRows += m_frameSkippedRows;
+        m_stats.totalSkippedBytes += m_frameSkippedBytes;
+    }
+
+    m_frameStream = false;
+    m_useAltLineBuf = false;
+
+    m_havePrev = true;
+    m_prevDisposal = m_curDisposal;
+    m_prevHadTransparency = m_curHadTransparency;
+    m_prevX = m_curX;
+    m_prevY = m_curY;
+    m_prevW = m_curW;
+    m_prevH = m_curH;
+    m_prevBg = m_curBg;
+}
+
+/**
+ * @brief Check a row segment against what was last written to that panel row
+ *
+ * When it differs (or skipping is off) the new hash is remembered and the caller must send the row
+ *
+ * @param screenY Panel row
+ * @param xStart First column of the segment
+ * @param pixels Segment pixels in panel byte order (or packed RGB444 bytes read as 16-bit words)
+ * @param len Number of 16-bit words in pixels
+ * @param wireBytes Bytes the row takes on the wire, 0 to derive it from len pixels
+ *
+ * @return true if the panel already shows this segment and the SPI transfer can be skipped
+ */
+auto HOT_PATH Gif::skipUnchangedRow(int screenY, int xStart, const uint16_t* pixels, int len, uint32_t wireBytes)
+    -> bool {
+    if (!m_rowSkipEnabled || screenY < 0 || static_cast<size_t>(screenY) >= TRACKED_ROWS) {
+        return false;
+    }
+
+    const uint32_t hash = hashRowSegment(pixels, len, xStart);
+    auto& stored = m_rowHash[static_cast<size_t>(screenY)];
+
+    if (stored == hash) {
+        ++m_frameSkippedRows;
+        m_frameSkippedBytes += wireBytes != 0 ? wireBytes : lineWireBytes(len);
+
+        return true;
+    }
+
+    stored = hash;
+
+    return false;
+}
+
+/**
+ * @brief Send one opaque run (with any merged gaps) of a transparent row through its own window
+ *
+ * @param tft Pointer to the panel driver
+ * @param pixels Run pixels in panel byte order, packed in place in RGB444 mode
+ * @param xStart First panel column of the run
+ * @param yPos Panel row
+ * @param len Number of pixels
+ */
+auto HOT_PATH Gif::writeRunWindow(Arduino_TFT* tft, uint16_t* pixels, int xStart, int yPos, int len) -> void {
+    openWindow(tft, static_cast<int16_t>(xStart), static_cast<int16_t>(yPos), static_cast<uint16_t>(len), 1);
+    sendLine(pixels, len, xStart, yPos);
+
+    if (s_instance != nullptr) {
+        s_instance->noteRowWrite(yPos, xStart, xStart + len, false);
+    }
+
+    timedYield();
+}
+
+/**
+ * @brief Send one line of panel order RGB565 pixels in the current panel colour mode
+ *
+ * @param pixels Pixels in panel byte order, packed in place in RGB444 mode
+ * @param len Number of pixels
+ * @param xStart Panel column of the first pixel
+ * @param yPos Panel row
+ */
+auto HOT_PATH Gif::sendLine(uint16_t* pixels, int len, int xStart, int yPos) -> void {
+    if (s_instance != nullptr && s_instance->m_composite) {
+        s_instance->m_compositor->composeRow(yPos, xStart, pixels, len);
+    }
+
+    if (s_instance != nullptr && s_instance->m_rgb444Active) {
+        const uint32_t bytes = packPixelsRgb444(pixels, len, xStart, yPos, s_instance->m_ditherEnabled);
+        pushToPanel(reinterpret_cast<const uint8_t*>(pixels), bytes, false);
+
+        return;
+    }
+
+    pushToPanel(reinterpret_cast<const uint8_t*>(pixels), static_cast<uint32_t>(len) * 2U, false);
+}
+
+/**
+ * @brief Open a panel address window, counted with its SPI time in the frame cost
+ *
+ * @param tft Panel driver
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param width Window width
+ * @param height Window height
+ */
+auto HOT_PATH Gif::openWindow(Arduino_TFT* tft, int16_t xPos, int16_t yPos, uint16_t width, uint16_t height) -> void {
+    const uint32_t startUs = micros();
+    tft->writeAddrWindow(xPos, yPos, width, height);
+
+    if (s_instance != nullptr) {
+        s_instance->m_frameSpiUs += micros() - startUs;
+        ++s_instance->m_frameWindows;
+    }
+}
+
+/**
+ * @brief Write bytes to the open panel window, counted with their SPI time in the frame cost
+ *
+ * @param data Bytes in wire order
+ * @param len Number of bytes
+ * @param async true to return while the bytes are still being sent (same rules as writePanelBytesAsync)
+ */
+auto HOT_PATH Gif::pushToPanel(const uint8_t* data, uint32_t len, bool async) -> void {
+    const uint32_t startUs = micros();
+    if (async) {
+        DisplayManager::writePanelBytesAsync(data, len);
+    } else {
+        DisplayManager::writePanelBytes(data, len);
+    }
+
+    if (s_instance != nullptr) {
+        s_instance->m_frameSpiUs += micros() - startUs;
+        s_instance->m_frameBytes += len;
+    }
+}
+
+/**
+ * @brief Let background tasks run, the time they take is counted in the frame cost
+ */
+auto HOT_PATH Gif::timedYield() -> void {
+    const uint32_t startUs = micros();
+    yield();
+
+    if (s_instance != nullptr) {
+        s_instance->m_frameYieldUs += micros() - startUs;
+    }
+}
+
+/**
+ * @brief Roll the cost of the frame just played into the file and session windows
+ *
+ * Dropped frames are only counted, their delays are part of the one the next drawn frame is
+ * compared against
+ *
+ * @param workUs Time spent in the decoder (or the native player) for this frame
+ * @param yieldInWorkUs Part of the yield time that was spent inside that work
+ * @param lateMs How far past its deadline the frame was started
+ */
+auto Gif::recordFrameTiming(uint32_t workUs, uint32_t yieldInWorkUs, uint32_t lateMs) -> void {
+    GifFrameSample sample;
+    sample.spiUs = m_frameSpiUs;
+    sample.yieldUs = m_frameYieldUs;
+    sample.decodeUs = workUs > m_frameSpiUs + yieldInWorkUs ? workUs - m_frameSpiUs - yieldInWorkUs : 0U;
+    sample.bytes = m_frameBytes;
+    sample.windows = m_frameWindows;
+    sample.lateMs = static_cast<uint16_t>(std::min<uint32_t>(lateMs, UINT16_MAX));
+
+    const uint32_t now = millis();
+    sample.intervalMs = static_cast<uint16_t>(std::min<uint32_t>(now - m_lastDrawnMs, UINT16_MAX));
+    sample.delayMs = static_cast<uint16_t>(std::min<uint32_t>(m_delaySinceDrawnMs, UINT16_MAX));
+    m_lastDrawnMs = now;
+    m_delaySinceDrawnMs = 0;
+
+    const bool late = lateMs > GIF_LATE_TOLERANCE_MS;
+    m_fileTiming.record(sample, late);
+    m_sessionTiming.record(sample, late);
+}
+
+/**
+ * @brief Get the number of bytes a line of pixels takes on the wire in the current colour mode
+ *
+ * @param len Number of pixels
+ *
+ * @return Bytes sent for the line
+ */
+auto HOT_PATH Gif::lineWireBytes(int len) const -> uint32_t {
+    const auto pixels = static_cast<uint32_t>(len);
+
+    return m_rgb444Active ? (pixels * 3U + 1U) / 2U : pixels * 2U;
+}
+
+/**
+ * @brief Switch between full and interlaced updates after a drawn frame
+ *
+ * Lateness that grows from frame to frame means drawing costs more than the delays allow, a
+ * backlog from a single stall shrinks instead and does not count. Only files made of full opaque
+ * frames are interlaced: a row left out of a partial frame would never be repainted
+ *
+ * @param lateMs How late the frame reached the panel
+ * @param workUs Time spent decoding and sending the frame
+ */
+auto Gif::adaptQuality(uint32_t lateMs, uint32_t workUs) -> void {
+    if (!m_interlaceEnabled || !m_fullFramesOnly) {
+        m_interlaced = false;
+        m_qualityStreak = 0;
+    } else if (m_interlaced) {
+        ++m_stats.interlacedFrames;
+        m_stats.degradedMs += m_lastDelayMs;
+        m_interlacePhase ^= 1U;
+
+        // Half the rows were sent, a full update costs about twice as much
+        const bool headroom =
+            lateMs <= GIF_LATE_TOLERANCE_MS && static_cast<uint64_t>(workUs) * 2U <= m_lastDelayMs * 1000ULL;
+        m_qualityStreak = headroom ? m_qualityStreak + 1U : 0U;
+
+        if (m_qualityStreak >= GIF_INTERLACE_EXIT_FRAMES) {
+            m_interlaced = false;
+            m_qualityStreak = 0;
+        }
+    } else {
+        const bool fallingBehind = lateMs > GIF_LATE_TOLERANCE_MS && lateMs > m_prevLateMs;
+        m_qualityStreak = fallingBehind ? m_qualityStreak + 1U : 0U;
+
+        if (m_qualityStreak >= GIF_INTERLACE_ENTER_FRAMES) {
+            m_interlaced = true;
+            m_qualityStreak = 0;
+        }
+    }
+
+    m_prevLateMs = lateMs;
+    m_stats.interlaced = m_interlaced;
+}
+
+/**
+ * @brief Check whether a row is left out of the current frame by interlacing
+ *
+ * @param row Panel row (decoded line for scaled files)
+ *
+ * @return true if the row has the parity not sent this frame
+ */
+auto HOT_PATH Gif::skipInterlacedRow(int row) const -> bool {
+    return m_interlaced && static_cast<uint8_t>(row & 1) != m_interlacePhase;
+}
+
+/**
+ * @brief Track whether the file so far only has full canvas opaque frames
+ *
+ * Only such frames fully repaint what an undrawn frame would have left, so a decode-only frame
+ * requested by the scheduler is cancelled (and never requested again for this file) otherwise
+ *
+ * @param pDraw Pointer to the GIFDRAW structure of the first line
+ */
+auto Gif::noteFrameCoverage(const GIFDRAW* pDraw) -> void {
+    const bool fullFrame = pDraw->ucHasTransparency == 0 && pDraw->iX == 0 && pDraw->iY == 0 &&
+                           pDraw->iWidth == m_gif->getCanvasWidth() && pDraw->iHeight == m_gif->getCanvasHeight();
+
+    if (!fullFrame) {
+        m_fullFramesOnly = false;
+        m_skipDraw = false;
+    }
+}
+
+/**
+ * @brief Put the panel in the colour mode used for this frame and prepare its RGB444 palettes
+ *
+ * The 12-bit tables are converted once per palette change: frames drawn with the global palette
+ * of the file reuse them until the file or the dither setting changes, a local palette is
+ * converted for its own frame. Frames stay RGB565 while overlay layers are up, layers are merged
+ * into RGB565 lines
+ *
+ * @param pDraw Pointer to the GIFDRAW structure of the first line
+ */
+auto Gif::beginFrameColorMode(const GIFDRAW* pDraw) -> void {
+    m_composite = m_compositor != nullptr && m_compositor->isActive();
+
+    const auto wanted = (m_rgb444Enabled && !m_composite) ? PanelColorMode::Rgb444 : PanelColorMode::Rgb565;
+
+    if (DisplayManager::getPanelColorMode() != wanted) {
+        DisplayManager::setPanelColorMode(wanted);
+
+        // Hashes were taken in the other pixel format
+        m_rowHash.fill(0);
+    }
+
+    m_rgb444Active = wanted == PanelColorMode::Rgb444;
+    if (!m_rgb444Active) {
+        return;
+    }
+
+    const auto* palette565 = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
+    const bool global = pDraw->ucIsGlobalPalette != 0;
+
+    if (global && palette565 == m_palette444Source && m_ditherEnabled == m_palette444Dither) {
+        return;
+    }
+
+    m_palette444Source = global ? palette565 : nullptr;
+    m_palette444Dither = m_ditherEnabled;
+    ++m_stats.rgb444PaletteBuilds;
+
+    const size_t phases = m_ditherEnabled ? DITHER_PHASES : 1U;
+
+    for (size_t phase = 0; phase < phases; ++phase) {
+        auto& table = m_palette444[phase];
+
+        for (size_t i = 0; i < PALETTE_SIZE; ++i) {
+            table[i] = toRgb444(palette565[i], GIF_BAYER_2X2[phase]);
         }
     }
 }
 
 /**
- * @brief Play a single GIF file
+ * @brief Get the columns of a panel row known to show the background colour
+ *
+ * @param screenY Panel row
+ *
+ * @return Known background span, empty for rows outside the tracked area
+ */
+auto HOT_PATH Gif::cleanSpanOf(int screenY) const -> CleanSpan {
+    if (screenY < 0 || static_cast<size_t>(screenY) >= TRACKED_ROWS) {
+        return CleanSpan{};
+    }
+
+    return m_cleanSpans[static_cast<size_t>(screenY)];
+}
+
+/**
+ * @brief Update the known background span of a row after a segment was written to it
+ *
+ * Content writes cut the span down to its larger remaining side, background fills grow it when
+ * they touch it
+ *
+ * @param screenY Panel row
+ * @param xStart First column written
+ * @param xEnd Column after the last one written
+ * @param background true if the segment was filled with the background colour
+ */
+auto HOT_PATH Gif::noteRowWrite(int screenY, int xStart, int xEnd, bool background) -> void {
+    if (screenY < 0 || static_cast<size_t>(screenY) >= TRACKED_ROWS) {
+        return;
+    }
+
+    xStart = std::max(xStart, 0);
+    xEnd = std::min(xEnd, static_cast<int>(TRACKED_COLS));
+    if (xEnd <= xStart) {
+        return;
+    }
+
+    auto& span = m_cleanSpans[static_cast<size_t>(screenY)];
+    int cleanStart = span.start;
+    int cleanEnd = span.end;
+
+    if (background) {
+        if (cleanEnd <= cleanStart || xEnd < cleanStart || xStart > cleanEnd) {
+            if ((xEnd - xStart) > (cleanEnd - cleanStart)) {
+                cleanStart = xStart;
+                cleanEnd = xEnd;
+            }
+        } else {
+            cleanStart = std::min(cleanStart, xStart);
+            cleanEnd = std::max(cleanEnd, xEnd);
+        }
+    } else if (xStart < cleanEnd && xEnd > cleanStart) {
+        if ((xStart - cleanStart) >= (cleanEnd - xEnd)) {
+            cleanEnd = xStart;
+        } else {
+            cleanStart = xEnd;
+        }
+    }
+
+    span.start = static_cast<uint8_t>(cleanStart);
+    span.end = static_cast<uint8_t>(std::max(cleanStart, cleanEnd));
+}
+
+/**
+ * @brief Mark a panel row as unknown after a write that is not tracked by its hash
+ *
+ * @param screenY Panel row
+ */
+auto HOT_PATH Gif::forgetRow(int screenY) -> void {
+    if (screenY >= 0 && static_cast<size_t>(screenY) < TRACKED_ROWS) {
+        m_rowHash[static_cast<size_t>(screenY)] = 0;
+    }
+}
+
+/**
+ * @brief Forget everything known about the panel rows, to be called whenever something else draws on it
+ *
+ * @return void
+ */
+auto Gif::invalidatePanelRows() -> void {
+    m_rowHash.fill(0);
+    m_cleanSpans.fill(CleanSpan{});
+}
+
+/**
+ * @brief Record that the whole panel was just filled with the background colour
+ *
+ * @return void
+ */
+auto Gif::markPanelCleared() -> void {
+    m_rowHash.fill(0);
+    m_cleanSpans.fill(CleanSpan{0, static_cast<uint8_t>(TRACKED_COLS)});
+}
+
+/**
+ * @brief Play a single GIF file
+ *
+ * With keepSchedule the first frame is due when the last frame of the previous file ends, so
+ * back-to-back files play without a gap (unless that deadline is long past)
+ *
+ * @param path The path to the GIF file
+ * @param keepSchedule true to continue the frame deadlines of the previous file
+ *
+ * @return true if playback started successfully false otherwise
+ */
+auto Gif::playOne(const String& path, bool keepSchedule) -> bool {
+    if (m_gif == nullptr) {
+        if (!begin()) {
+            return false;
+        }
+    }
+
+    if (m_playing) {
+        closeDecoder();
+        m_playing = false;
+    }
+
+    m_offsetX = 0;
+    m_offsetY = 0;
+    m_centered = false;
+    m_scale = GifScale{};
+
+    const auto* gfx = DisplayManager::getGfx();
+    const int screenW = gfx != nullptr ? static_cast<int>(gfx->width()) : 0;
+    const int screenH = gfx != nullptr ? static_cast<int>(gfx->height()) : 0;
+
+    bool native = m_nativeEnabled && !path.startsWith(GIF_SLOT_PREFIX) && m_native.open(path);
+    if (native && m_autoScaleEnabled) {
+        // Transcoded frames are stored at canvas size, a file that gets scaled is decoded instead
+        const GifScale scale = autoScale(m_native.header().width, m_native.header().height, screenW, screenH);
+        if (scale.up != 1 || scale.down != 1) {
+            m_native.close();
+            native = false;
+        }
+    }
+
+    if (native) {
+        // Transcoded frames are centred on the first GIF frame, exactly like gifDraw() does
+        const GifNativeHeader& header = m_native.header();
+
+        m_offsetX = static_cast<int16_t>((screenW - header.firstWidth) / 2 - header.firstX);
+        m_offsetY = static_cast<int16_t>((screenH - header.firstHeight) / 2 - header.firstY);
+        m_centered = true;
+        m_nativeActive = true;
+        m_decoderFile = nullptr;
+        m_indexed = false;
+        m_frameNumber = 0;
+
+        if (path == m_nextPath) {
+            m_nextFile.close();
+            m_nextFile = File();
+            m_nextPath = "";
+        }
+    } else {
+        // The decoder converts each palette once when it is read, straight into panel byte order
+        m_gif->begin(GIF_PALETTE_RGB565_BE);
+
+        if (!openDecoder(path)) {
+            return false;
+        }
+
+        if (m_autoScaleEnabled) {
+            m_scale = autoScale(static_cast<uint16_t>(m_gif->getCanvasWidth()),
+                                static_cast<uint16_t>(m_gif->getCanvasHeight()), screenW, screenH);
+        }
+    }
+
+    m_currentPath = path;
+    if (!m_nativeActive) {
+        loadFrameIndex();
+    }
+
+    m_stopRequested = false;
+    m_playRequested = true;
+    m_playing = true;
+    m_startMs = millis();
+    if (!keepSchedule || static_cast<int32_t>(m_startMs - m_nextDueMs) > static_cast<int32_t>(GIF_RESYNC_MS)) {
+        m_nextDueMs = m_startMs;
+    }
+    m_lastDelayMs = 0;
+    m_skipDraw = false;
+    // Transcoded frames are deltas, none of them can be left out
+    m_fullFramesOnly = !m_nativeActive;
+    m_consecutiveDrops = 0;
+    m_interlaced = false;
+    m_interlacePhase = 0;
+    m_qualityStreak = 0;
+    m_prevLateMs = 0;
+    m_stats.interlaced = false;
+    m_fileTiming.reset();
+    m_lastDrawnMs = m_nextDueMs;
+    m_delaySinceDrawnMs = 0;
+
+    return true;
+}
+
+/**
+ * @brief Open a file that will be played next and check its header while the current one plays
+ *
+ * The handle is kept and reused when playOne() opens the same path, replacing any earlier preload
+ * Slot paths (slot:name) have no handle, only their header is read from mapped flash
  *
  * @param path The path to the GIF file
  *
- * @return true if playback started successfully false otherwise
+ * @return true if the file exists and starts with a GIF header false otherwise
  */
-auto Gif::playOne(const String& path) -> bool {
-    if (m_gif == nullptr) {
-        if (!begin()) {
+auto Gif::preload(const String& path) -> bool {
+    m_nextFile.close();
+    m_nextFile = File();
+    m_nextPath = "";
+    m_nextCanvas = GifCanvas{};
+
+    std::array<uint8_t, GIF_HEADER_SIZE> header{};
+
+    if (path.startsWith(GIF_SLOT_PREFIX)) {
+        const GifSlot* slot = GifSlotStore::find(path.substring(strlen(GIF_SLOT_PREFIX)));
+        if (slot == nullptr || slot->size < GIF_HEADER_SIZE) {
             return false;
         }
-    }
 
-    m_offsetX = 0;
-    m_offsetY = 0;
-    m_centered = false;
+        // Mapped flash needs aligned 32-bit reads, memcpy_P takes care of it
+        memcpy_P(header.data(), GifSlotStore::data(*slot), header.size());
+        if (memcmp(header.data(), "GIF8", 4) != 0) {
+            return false;
+        }
 
-    m_gif->begin(GIF_PALETTE_RGB565_LE);
+        m_nextCanvas.width = static_cast<uint16_t>(header[6] | (header[7] << 8U));
+        m_nextCanvas.height = static_cast<uint16_t>(header[8] | (header[9] << 8U));
+        m_nextPath = path;
+
+        return true;
+    }
 
-    if (m_gif->open(path.c_str(), gifOpenFile, gifCloseFile, gifReadFile, gifSeekFile, gifDraw) <= 0) {
+    File file = LittleFS.open(path, "r");
+    if (!file) {
         return false;
     }
 
-    m_currentPath = path;
+    if (file.read(header.data(), header.size()) != header.size() || memcmp(header.data(), "GIF8", 4) != 0) {
+        file.close();
 
-    m_stopRequested = false;
-    m_playRequested = true;
-    m_playing = true;
-    m_delayMsFromGif = 0;
-    m_targetMs = 0;
-    m_lastFrameMs = millis();
-    m_startMs = millis();
-    m_frameCount = 0;
+        return false;
+    }
+
+    m_nextCanvas.width = static_cast<uint16_t>(header[6] | (header[7] << 8U));
+    m_nextCanvas.height = static_cast<uint16_t>(header[8] | (header[9] << 8U));
+    m_nextFile = file;
+    m_nextPath = path;
 
     return true;
 }
 
+/**
+ * @brief Check whether a path is the one currently preloaded
+ *
+ * @param path The path to the GIF file
+ *
+ * @return true if playOne(path) will reuse the preloaded handle
+ */
+auto Gif::isPreloaded(const String& path) const -> bool {
+    return (m_nextFile || m_nextPath.startsWith(GIF_SLOT_PREFIX)) && m_nextPath == path;
+}
+
+/**
+ * @brief Get the size the preloaded file will cover on the panel
+ *
+ * @return Canvas width and height from its header, scaled when automatic scaling applies, both 0
+ *         when nothing is preloaded
+ */
+auto Gif::getPreloadedCanvas() const -> GifCanvas {
+    const auto* gfx = DisplayManager::getGfx();
+    if (!m_autoScaleEnabled || gfx == nullptr) {
+        return m_nextCanvas;
+    }
+
+    const GifScale scale = autoScale(m_nextCanvas.width, m_nextCanvas.height, gfx->width(), gfx->height());
+    GifCanvas canvas;
+    canvas.width = static_cast<uint16_t>((m_nextCanvas.width * scale.up + scale.down - 1) / scale.down);
+    canvas.height = static_cast<uint16_t>((m_nextCanvas.height * scale.up + scale.down - 1) / scale.down);
+
+    return canvas;
+}
+
+/**
+ * @brief Get the time at which the next frame is due on the panel
+ *
+ * @return Deadline in millis() time, right after playOne() this is when the first frame shows
+ */
+auto Gif::getNextFrameDueMs() const -> uint32_t { return m_nextDueMs; }
+
 /**
  * @brief Update the GIF playback, should be called regularly
  *
@@ -484,135 +2082,137 @@ auto Gif::update() -> void {
     }
 
     if (m_stopRequested) {
-        m_gif->close();
+        closeDecoder();
         m_playing = false;
         m_playRequested = false;
         m_stopRequested = false;
 
         // Important to release resources
-        delete m_gif;
-        m_gif = nullptr;
+        releaseDecoder();
+        m_decoderFile = nullptr;
+        m_indexed = false;
 
         return;
     }
 
     const uint32_t now = millis();
-    if (m_targetMs > 0) {
-        if ((now - m_lastFrameMs) < m_targetMs) {
-            return;
-        }
+    auto lateMs = static_cast<int32_t>(now - m_nextDueMs);
+    if (lateMs < 0) {
+        return;
     }
 
-    int delayMsFromGif = 0;
-    const int result = m_gif->playFrame(false, &delayMsFromGif, nullptr);
-    m_frameCount++;
-    m_lastFrameMs = now;
-
-    // Let background tasks run
-    yield();
-
-    if (result <= 0) {
-        if (m_loopEnabled && !m_stopRequested && !m_currentPath.isEmpty()) {
-            m_gif->close();
-            if (m_gif->open(m_currentPath.c_str(), gifOpenFile, gifCloseFile, gifReadFile, gifSeekFile, gifDraw) <= 0) {
-                m_playing = false;
-                m_playRequested = false;
+    // After a long stall (upload, blocking request) restart the schedule rather than race through it
+    if (static_cast<uint32_t>(lateMs) > GIF_RESYNC_MS) {
+        m_nextDueMs = now;
+        lateMs = 0;
+        ++m_stats.resyncs;
+    }
 
-                return;
-            }
+    // Frame N + 1 is already due as well: decode this one without drawing it
+    m_skipDraw = m_frameDropEnabled && m_fullFramesOnly && m_lastDelayMs > 0 &&
+                 static_cast<uint32_t>(lateMs) >= m_lastDelayMs && m_consecutiveDrops < GIF_MAX_CONSECUTIVE_DROPS;
 
-            m_delayMsFromGif = 0;
-            m_targetMs = 0;
-            m_lastFrameMs = millis();
-            m_startMs = millis();
-            m_frameCount = 0;
+    m_frameSpiUs = 0;
+    m_frameYieldUs = 0;
+    m_frameBytes = 0;
+    m_frameWindows = 0;
+    m_delaySinceDrawnMs += m_lastDelayMs;
 
-            return;
+    int delayMsFromGif = 0;
+    const uint32_t workStartUs = micros();
+    const int result =
+        m_nativeActive ? playNativeFrame(&delayMsFromGif) : m_gif->playFrame(false, &delayMsFromGif, nullptr);
+    const uint32_t workUs = micros() - workStartUs;
+    const uint32_t yieldInWorkUs = m_frameYieldUs;
+    const bool drawn = !m_skipDraw;
+    ++m_frameNumber;
+
+    if (m_skipDraw) {
+        m_skipDraw = false;
+        ++m_consecutiveDrops;
+        ++m_stats.droppedFrames;
+        m_fileTiming.recordDrop();
+        m_sessionTiming.recordDrop();
+    } else {
+        m_consecutiveDrops = 0;
+        m_stats.lastLateMs = static_cast<uint32_t>(lateMs);
+        m_stats.maxLateMs = std::max(m_stats.maxLateMs, m_stats.lastLateMs);
+        m_stats.totalLateMs += m_stats.lastLateMs;
+        if (m_stats.lastLateMs > GIF_LATE_TOLERANCE_MS) {
+            ++m_stats.lateFrames;
         }
+    }
 
-        m_gif->close();
-        m_playing = false;
-        m_playRequested = false;
+    // The next deadline follows from this one, never from when decoding happened to finish
+    // Authored delays are floored at 30 fps, then scaled by the playback speed
+    const uint32_t authoredMs = std::max(GIF_FRAME_MS, static_cast<uint32_t>(std::max(delayMsFromGif, 0)));
+    m_lastDelayMs = std::max(1U, authoredMs * 100U / m_speedPercent);
+    m_nextDueMs += m_lastDelayMs;
 
-        return;
+    if (drawn && result >= 0) {
+        adaptQuality(static_cast<uint32_t>(lateMs), workUs);
     }
 
-    uint32_t targetMs = GIF_FRAME_MS;
-    if (delayMsFromGif > 0 && static_cast<uint32_t>(delayMsFromGif) > targetMs) {
-        targetMs = static_cast<uint32_t>(delayMsFromGif);
+    // Let background tasks run
+    timedYield();
+
+    if (drawn && result >= 0) {
+        recordFrameTiming(workUs, yieldInWorkUs, static_cast<uint32_t>(lateMs));
     }
 
-    m_targetMs = targetMs;
+    const bool playAgain = result == 0 && m_loopEnabled && !m_stopRequested && !m_currentPath.isEmpty() &&
+                           (m_playsLeft == 0 || --m_playsLeft > 0);
 
-    if ((millis() - m_startMs) > GIF_MAX_MS_PER_FILE) {
-        m_gif->close();
+    if (result < 0 || (result == 0 && !playAgain)) {
+        closeDecoder();
         m_playing = false;
         m_playRequested = false;
 
         return;
     }
-}
-
-/**
- * @brief Play all GIF files from the /gifs directory in LittleFS
- *
- * @return true if playback was successful false otherwise
- */
-auto Gif::playAllFromLittleFS() -> bool {
-    if (m_playing) {
-        return false;
-    }
-
-    m_playing = true;
-    m_stopRequested = false;
-
-    if (m_gif == nullptr) {
-        begin();
-    }
-
-    if (!LittleFS.begin()) {
-        return false;
-    }
-
-    m_gif->begin(LITTLE_ENDIAN_PIXELS);
 
-    Dir dir = LittleFS.openDir("/gifs");
+    if (result == 0) {
+        // The loop restarts on the same schedule, the last frame keeps its full delay
+        m_startMs = millis();
+        m_frameNumber = 0;
 
-    while (dir.next()) {
-        String name = dir.fileName();
-        String lname = name;
-        lname.toLowerCase();
-
-        if (!lname.endsWith(".gif")) {
-            continue;
-        }
+        if (m_nativeActive) {
+            if (!m_native.rewind()) {
+                closeDecoder();
+                m_playing = false;
+                m_playRequested = false;
+            }
 
-        if (m_stopRequested) {
-            break;
+            return;
         }
 
-        playOne(String("/gifs/") + name);
+        // Indexed: jump back to the first frame, the header and palette are not read or parsed again
+        if (m_indexed && seekDecoder(m_firstFrameOffset)) {
+            ++m_stats.indexRewinds;
 
-        while (m_playing && !m_stopRequested) {
-            update();
-            yield();
+            return;
         }
 
-        if (m_stopRequested) {
-            break;
-        }
+        m_gif->close();
+        if (!openDecoder(m_currentPath)) {
+            m_playing = false;
+            m_playRequested = false;
 
-        if (!m_loopEnabled) {
-            break;
+            return;
         }
+
+        return;
     }
 
-    LittleFS.end();
-    m_playing = false;
-    m_stopRequested = false;
-    m_loopEnabled = false;
+    // The cap is in authored time, a file slowed down by setSpeed() still plays its whole loop
+    const uint64_t authoredElapsedMs = static_cast<uint64_t>(millis() - m_startMs) * m_speedPercent / 100U;
+    if (authoredElapsedMs > GIF_MAX_MS_PER_FILE) {
+        closeDecoder();
+        m_playing = false;
+        m_playRequested = false;
 
-    return true;
+        return;
+    }
 }
 
 /**
@@ -625,11 +2225,12 @@ auto Gif::stop() -> void {
     // If the GIF object exists, close and free it
     if (m_gif != nullptr) {
         // Attempt to close the animated GIF stream
-        m_gif->close();
+        closeDecoder();
 
-        // Release the AnimatedGIF instance
-        delete m_gif;
-        m_gif = nullptr;
+        // Hand the decoder slot back to the pool
+        releaseDecoder();
+        m_decoderFile = nullptr;
+        m_indexed = false;
     }
 
     // Close underlying file if still open
@@ -638,6 +2239,12 @@ auto Gif::stop() -> void {
         m_fileInUse = false;
     }
 
+    m_nextFile.close();
+    m_nextFile = File();
+    m_nextPath = "";
+
+    releaseRam();
+
     // Reset playback flags
     m_playing = false;
     m_playRequested = false;
@@ -651,9 +2258,284 @@ auto Gif::stop() -> void {
  */
 auto Gif::isPlaying() const -> bool { return m_playing; }
 
+/**
+ * @brief Jump to a frame of the current file using its frame index
+ *
+ * Frames only redraw their own rectangle, so decoding restarts at the closest earlier frame that
+ * repaints the whole canvas and the frames up to the target are drawn back to back
+ *
+ * @param frame Frame number, below the frame count of the index
+ *
+ * A transcoded file is replayed from its first frame instead
+ *
+ * @return true if the target frame is on screen, false if the file has no index or the frame does not exist
+ */
+auto Gif::seekToFrame(uint16_t frame) -> bool {
+    // Transcoded frames are deltas from the first one, replaying them is cheap
+    if (m_nativeActive) {
+        if (!m_playing || frame >= m_native.header().frameCount || !m_native.rewind()) {
+            return false;
+        }
+
+        m_frameNumber = 0;
+        while (m_frameNumber < frame) {
+            int delayMs = 0;
+            if (playNativeFrame(&delayMs) < 0) {
+                return false;
+            }
+            ++m_frameNumber;
+            timedYield();
+        }
+
+        m_nextDueMs = millis();
+        m_startMs = m_nextDueMs;
+        m_consecutiveDrops = 0;
+
+        return true;
+    }
+
+    if (!m_playing || m_gif == nullptr || !m_indexed || m_decoderFile == nullptr || frame >= m_index.frameCount) {
+        return false;
+    }
+
+    File sidecar = LittleFS.open(GifFrameIndex::sidecarPath(m_currentPath), "r");
+    if (!sidecar) {
+        return false;
+    }
+
+    GifFrameEntry entry{};
+    uint16_t start = frame;
+    bool found = false;
+    while (GifFrameIndex::readEntry(sidecar, start, entry)) {
+        if (start == 0 || (entry.flags & (GIF_FRAME_FULL_CANVAS | GIF_FRAME_TRANSPARENT)) == GIF_FRAME_FULL_CANVAS) {
+            found = true;
+            break;
+        }
+        --start;
+    }
+    sidecar.close();
+
+    if (!found) {
+        return false;
+    }
+
+    if (!seekDecoder(entry.offset)) {
+        return false;
+    }
+    m_frameNumber = start;
+    m_skipDraw = false;
+
+    while (m_frameNumber < frame) {
+        int delayMs = 0;
+        if (m_gif->playFrame(false, &delayMs, nullptr) < 0) {
+            return false;
+        }
+        ++m_frameNumber;
+        timedYield();
+    }
+
+    // The target frame is decoded by the next update(), right away
+    m_nextDueMs = millis();
+    m_startMs = m_nextDueMs;
+    m_consecutiveDrops = 0;
+
+    return true;
+}
+
+/**
+ * @brief Replay the current frame so the overlay backings hold what is on screen
+ *
+ * Decoding restarts at the last frame that repaints the whole canvas like seekToFrame(), with every
+ * row sent again through the compositor; the frame due next is drawn by the next update(), before
+ * the compositor is flushed
+ *
+ * @return true if the frames were replayed, false without a compositor, playback or frame index
+ */
+auto Gif::redrawUnderOverlays() -> bool {
+    if (m_compositor == nullptr || !m_playing) {
+        return false;
+    }
+
+    invalidatePanelRows();
+    if (!seekToFrame(m_frameNumber)) {
+        return false;
+    }
+    m_compositor->markBackingsKnown();
+
+    return true;
+}
+
+/**
+ * @brief Scale the playback speed, applied from the next frame
+ *
+ * @param percent Speed in percent of the authored frame delays, clamped to 50..400
+ *
+ * @return void
+ */
+auto Gif::setSpeed(uint16_t percent) -> void {
+    m_speedPercent = std::min(std::max(percent, SPEED_MIN_PERCENT), SPEED_MAX_PERCENT);
+}
+
+/**
+ * @brief Get the playback position in the current file
+ *
+ * @return Next frame to decode, frame count from the index or transcoded file (0 without either) and speed
+ */
+auto Gif::getPosition() const -> GifPosition {
+    GifPosition position;
+    position.frame = m_frameNumber;
+    if (m_nativeActive) {
+        position.frameCount = m_native.header().frameCount;
+    } else {
+        position.frameCount = m_indexed ? m_index.frameCount : 0U;
+    }
+    position.speedPercent = m_speedPercent;
+
+    return position;
+}
+
 /**
  * @brief Enable or disable looping of GIF playback
  *
  * @param enabled true to enable looping false to disable
  */
-auto Gif::setLoopEnabled(bool enabled) -> void { m_loopEnabled = enabled; }
+auto Gif::setLoopEnabled(bool enabled) -> void {
+    m_loopEnabled = enabled;
+    m_playsLeft = 0;
+}
+
+/**
+ * @brief Set how many times the next file is played before playback ends
+ *
+ * @param plays Number of plays, 0 to loop until stopped
+ */
+auto Gif::setPlayCount(uint16_t plays) -> void {
+    m_loopEnabled = plays != 1;
+    m_playsLeft = plays;
+}
+
+/**
+ * @brief Enable or disable streaming opaque frames through a single address window
+ *
+ * @param enabled true to use the frame fast path, false to always draw line by line
+ */
+auto Gif::setFrameStreamingEnabled(bool enabled) -> void { m_frameStreamEnabled = enabled; }
+
+/**
+ * @brief Enable or disable skipping rows the panel already shows
+ *
+ * @param enabled true to compare each row with the previous content before sending it
+ */
+auto Gif::setRowSkipEnabled(bool enabled) -> void {
+    m_rowSkipEnabled = enabled;
+    m_rowHash.fill(0);
+}
+
+/**
+ * @brief Enable or disable merging opaque runs across short transparent gaps
+ *
+ * Gaps are only merged over columns known to show the background, see noteRowWrite()
+ *
+ * @param enabled true to let the window cost model merge runs
+ */
+auto Gif::setGapCoalescingEnabled(bool enabled) -> void { m_gapCoalesceEnabled = enabled; }
+
+/**
+ * @brief Enable or disable RGB444 playback, taking effect at the next frame
+ *
+ * @param enabled true to send 12-bit pixels (1.5 bytes each) instead of RGB565
+ */
+auto Gif::setRgb444Enabled(bool enabled) -> void { m_rgb444Enabled = enabled; }
+
+/**
+ * @brief Enable or disable the 2x2 ordered dither applied when reducing colours to RGB444
+ *
+ * @param enabled true to dither, false to truncate
+ */
+auto Gif::setDitherEnabled(bool enabled) -> void { m_ditherEnabled = enabled; }
+
+/**
+ * @brief Allow the scheduler to decode frames without drawing them when playback falls behind
+ *
+ * @param enabled true to catch up by dropping frames, false to show every frame late
+ */
+auto Gif::setFrameDropEnabled(bool enabled) -> void { m_frameDropEnabled = enabled; }
+
+/**
+ * @brief Enable or disable the RAM and read-ahead tiers in front of LittleFS
+ *
+ * @param enabled true to cache file data, false to pass every decoder read to LittleFS
+ */
+auto Gif::setReadCacheEnabled(bool enabled) -> void { m_readCacheEnabled = enabled; }
+
+/**
+ * @brief Enable or disable interlaced updates while playback falls behind
+ *
+ * @param enabled true to send every other row when frames cannot be drawn within their delays
+ */
+auto Gif::setInterlaceEnabled(bool enabled) -> void {
+    m_interlaceEnabled = enabled;
+    if (!enabled) {
+        m_interlaced = false;
+        m_stats.interlaced = false;
+    }
+}
+
+/**
+ * @brief Enable or disable playing the transcoded file of a GIF when it has one
+ *
+ * @param enabled true to prefer the transcoded file, applied from the next playOne()
+ */
+auto Gif::setNativeEnabled(bool enabled) -> void { m_nativeEnabled = enabled; }
+
+/**
+ * @brief Enable or disable picking an integer scale from the canvas size of each file
+ *
+ * Canvases that fit at least twice are enlarged up to 3x, canvases up to twice the panel size
+ * are decimated to half, anything else plays unscaled
+ *
+ * @param enabled true to scale automatically, applied from the next playOne()
+ */
+auto Gif::setAutoScaleEnabled(bool enabled) -> void { m_autoScaleEnabled = enabled; }
+
+/**
+ * @brief Merge overlay layers into every line sent to the panel
+ *
+ * @param compositor Compositor holding the layers, nullptr to send lines as decoded
+ */
+auto Gif::setCompositor(Compositor* compositor) -> void { m_compositor = compositor; }
+
+/**
+ * @brief Get the scale of the file playing
+ *
+ * @return Enlargement and decimation factors, 1 and 1 when unscaled
+ */
+auto Gif::getScale() const -> GifScale { return m_scale; }
+
+/**
+ * @brief Check whether the last frame was sent in RGB444
+ *
+ * @return true if the panel is driven in RGB444 by the GIF player
+ */
+auto Gif::isRgb444Active() const -> bool { return m_rgb444Active; }
+
+/**
+ * @brief Get the decode/transmit overlap counters since boot
+ *
+ * @return Pipeline counters
+ */
+auto Gif::getPipelineStats() const -> const GifPipelineStats& { return m_stats; }
+
+/**
+ * @brief Get the frame cost breakdown of the file playing, reset when a file starts
+ *
+ * @return Rolling window and counters of the current file
+ */
+auto Gif::getFileTiming() const -> const GifFrameStats& { return m_fileTiming; }
+
+/**
+ * @brief Get the frame cost breakdown of every file played since boot
+ *
+ * @return Rolling window and counters of the session
+ */
+auto Gif::getSessionTiming() const -> const GifFrameStats& { return m_sessionTiming; }
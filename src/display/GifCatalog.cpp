@@ -0,0 +1,676 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "display/GifCatalog.h"
+#include "display/GifFrameIndex.h"
+
+#include <cstring>
+
+static constexpr uint32_t CATALOG_MAGIC = 0x54414347;  // "GCAT"
+static constexpr uint16_t CATALOG_VERSION = 1;
+static constexpr const char* CATALOG_TMP_PATH = "/gifidx/catalog.tmp";
+static constexpr uint16_t MAX_BUCKETS = 0x8000;
+static constexpr uint16_t NO_BUCKET = UINT16_MAX;
+
+static constexpr uint8_t BUCKET_FREE = 0;
+static constexpr uint8_t BUCKET_USED = 1;
+static constexpr uint8_t BUCKET_DELETED = 2;
+
+static constexpr uint32_t FNV_OFFSET = 2166136261U;
+static constexpr uint32_t FNV_PRIME = 16777619U;
+static constexpr size_t HASH_CHUNK_BYTES = 256;
+static constexpr size_t GIF_SCREEN_BYTES = 10;
+
+// Indexed by GIF_CATALOG_DIR_*
+static constexpr std::array<const char*, 2> CATALOG_DIRS = {"/gif", "/gifs"};
+
+static_assert(sizeof(GifCatalogEntry) == 52, "catalogue buckets are read by offset");
+static_assert(sizeof(GifCatalogHeader) == 16, "catalogue buckets follow a fixed size header");
+
+/**
+ * @brief Continue a 32-bit FNV-1a hash
+ *
+ * @param hash Hash so far, FNV_OFFSET to start
+ * @param data Bytes to add
+ * @param len Number of bytes
+ *
+ * @return Updated hash
+ */
+static auto fnv1a(uint32_t hash, const void* data, size_t len) -> uint32_t {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+
+    return hash;
+}
+
+/**
+ * @brief Hash of a catalogue key, picks the first bucket probed
+ *
+ * @param dir GIF_CATALOG_DIR_*
+ * @param name File name
+ *
+ * @return Key hash
+ */
+static auto keyHash(uint8_t dir, const char* name) -> uint32_t {
+    return fnv1a(fnv1a(FNV_OFFSET, &dir, 1), name, strlen(name));
+}
+
+/**
+ * @brief Contribution of one file to the catalogue stamp
+ *
+ * @param dir GIF_CATALOG_DIR_*
+ * @param name File name
+ * @param size File size
+ *
+ * @return Stamp term, the stamp is the sum of the terms of all files
+ */
+static auto stampTerm(uint8_t dir, const char* name, uint32_t size) -> uint32_t {
+    return fnv1a(keyHash(dir, name), &size, sizeof(size));
+}
+
+/**
+ * @brief Check if a directory entry belongs in the catalogue
+ *
+ * @param name File name
+ *
+ * @return true for .gif files whose name fits an entry
+ */
+static auto isCatalogName(const String& name) -> bool {
+    return (name.endsWith(".gif") || name.endsWith(".GIF")) && name.length() < sizeof(GifCatalogEntry::name) &&
+           name.indexOf('/') < 0;
+}
+
+/**
+ * @brief Split a LittleFS GIF path into catalogue directory and file name
+ *
+ * @param gifPath Path such as /gif/cat.gif
+ * @param dir Receives GIF_CATALOG_DIR_*
+ * @param name Receives the file name
+ *
+ * @return true if the path is in a catalogued directory
+ */
+static auto splitPath(const String& gifPath, uint8_t& dir, String& name) -> bool {
+    for (uint8_t i = 0; i < CATALOG_DIRS.size(); ++i) {
+        const String prefix = String(CATALOG_DIRS[i]) + "/";
+
+        if (gifPath.startsWith(prefix)) {
+            dir = i;
+            name = gifPath.substring(prefix.length());
+
+            return isCatalogName(name);
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Byte offset of a bucket in the catalogue file
+ *
+ * @param bucket Bucket number
+ *
+ * @return Offset from the start of the file
+ */
+static auto bucketOffset(uint16_t bucket) -> uint32_t {
+    return sizeof(GifCatalogHeader) + static_cast<uint32_t>(bucket) * sizeof(GifCatalogEntry);
+}
+
+/**
+ * @brief Read one bucket
+ *
+ * @param table Catalogue file
+ * @param bucket Bucket number
+ * @param entry Receives the bucket
+ *
+ * @return true if the bucket was read
+ */
+static auto readBucket(File& table, uint16_t bucket, GifCatalogEntry& entry) -> bool {
+    return table.seek(bucketOffset(bucket), SeekSet) &&
+           table.read(reinterpret_cast<uint8_t*>(&entry), sizeof(entry)) == sizeof(entry);
+}
+
+/**
+ * @brief Write one bucket
+ *
+ * @param table Catalogue file opened for update
+ * @param bucket Bucket number
+ * @param entry Bucket content
+ *
+ * @return true if the bucket was written
+ */
+static auto writeBucket(File& table, uint16_t bucket, const GifCatalogEntry& entry) -> bool {
+    return table.seek(bucketOffset(bucket), SeekSet) &&
+           table.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry)) == sizeof(entry);
+}
+
+/**
+ * @brief Read and validate the catalogue header
+ *
+ * @param table Catalogue file
+ * @param header Receives the header
+ *
+ * @return true if the header belongs to a complete catalogue
+ */
+static auto readHeader(File& table, GifCatalogHeader& header) -> bool {
+    if (!table || !table.seek(0, SeekSet) ||
+        table.read(reinterpret_cast<uint8_t*>(&header), sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+
+    return header.magic == CATALOG_MAGIC && header.version == CATALOG_VERSION &&
+           header.buckets >= GifCatalog::MIN_BUCKETS && (header.buckets & (header.buckets - 1U)) == 0;
+}
+
+/**
+ * @brief Mark the catalogue complete and write its header
+ *
+ * @param table Catalogue file opened for update
+ * @param header Header to write, magic and version are set here
+ *
+ * @return true if the header was written
+ */
+static auto writeHeader(File& table, GifCatalogHeader& header) -> bool {
+    header.magic = CATALOG_MAGIC;
+    header.version = CATALOG_VERSION;
+
+    return table.seek(0, SeekSet) &&
+           table.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+}
+
+/**
+ * @brief Write an empty table, its header stays invalid until writeHeader()
+ *
+ * @param path Catalogue file to create
+ * @param buckets Number of buckets, a power of two
+ *
+ * @return true if the file was written
+ */
+static auto createTable(const char* path, uint16_t buckets) -> bool {
+    File table = LittleFS.open(path, "w");
+    if (!table) {
+        return false;
+    }
+
+    GifCatalogHeader header{};
+    header.buckets = buckets;
+    bool written = table.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+
+    const GifCatalogEntry empty{};
+    for (uint16_t i = 0; written && i < buckets; ++i) {
+        written = table.write(reinterpret_cast<const uint8_t*>(&empty), sizeof(empty)) == sizeof(empty);
+    }
+
+    table.close();
+
+    return written;
+}
+
+/**
+ * @brief Table size for a number of files, at most half full after a build
+ *
+ * @param files Number of files
+ *
+ * @return Number of buckets
+ */
+static auto bucketsFor(uint32_t files) -> uint16_t {
+    uint32_t buckets = GifCatalog::MIN_BUCKETS;
+
+    while (buckets < files * 2U && buckets < MAX_BUCKETS) {
+        buckets *= 2U;
+    }
+
+    return static_cast<uint16_t>(buckets);
+}
+
+/**
+ * @brief Linear probe for a key
+ *
+ * @param table Catalogue file
+ * @param header Catalogue header
+ * @param dir GIF_CATALOG_DIR_*
+ * @param name File name
+ * @param entry Receives the entry found, or the bucket the key would go in
+ * @param slot Receives the bucket of the entry, or where to insert it (NO_BUCKET when full)
+ *
+ * @return true if the key is catalogued
+ */
+static auto probe(File& table, const GifCatalogHeader& header, uint8_t dir, const char* name, GifCatalogEntry& entry,
+                  uint16_t& slot) -> bool {
+    const auto mask = static_cast<uint16_t>(header.buckets - 1U);
+    auto bucket = static_cast<uint16_t>(keyHash(dir, name) & mask);
+    slot = NO_BUCKET;
+
+    for (uint16_t step = 0; step < header.buckets; ++step) {
+        GifCatalogEntry current{};
+        if (!readBucket(table, bucket, current)) {
+            return false;
+        }
+
+        if (current.state == BUCKET_USED && current.dir == dir &&
+            strncmp(current.name.data(), name, current.name.size()) == 0) {
+            entry = current;
+            slot = bucket;
+
+            return true;
+        }
+
+        if (current.state != BUCKET_USED && slot == NO_BUCKET) {
+            entry = current;
+            slot = bucket;
+        }
+
+        if (current.state == BUCKET_FREE) {
+            return false;
+        }
+
+        bucket = static_cast<uint16_t>((bucket + 1U) & mask);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Insert or replace an entry, header counters and stamp follow
+ *
+ * @param table Catalogue file opened for update
+ * @param header Catalogue header, written back by the caller
+ * @param entry Entry to store
+ *
+ * @return true if the entry was written
+ */
+static auto place(File& table, GifCatalogHeader& header, GifCatalogEntry entry) -> bool {
+    GifCatalogEntry previous{};
+    uint16_t slot = NO_BUCKET;
+
+    if (probe(table, header, entry.dir, entry.name.data(), previous, slot)) {
+        header.stamp -= stampTerm(previous.dir, previous.name.data(), previous.size);
+    } else if (slot == NO_BUCKET) {
+        return false;
+    } else {
+        if (previous.state == BUCKET_DELETED) {
+            --header.tombstones;
+        }
+        ++header.count;
+    }
+
+    entry.state = BUCKET_USED;
+    header.stamp += stampTerm(entry.dir, entry.name.data(), entry.size);
+
+    return writeBucket(table, slot, entry);
+}
+
+/**
+ * @brief Read a GIF once to fill its catalogue entry
+ *
+ * Size and content hash come from the file, dimensions from its screen descriptor, frame count
+ * and duration from its frame index (built here when missing)
+ *
+ * @param dir GIF_CATALOG_DIR_*
+ * @param name File name, must pass isCatalogName()
+ * @param entry Receives the entry
+ *
+ * @return true if the file could be read
+ */
+static auto describe(uint8_t dir, const String& name, GifCatalogEntry& entry) -> bool {
+    const String gifPath = String(CATALOG_DIRS[dir]) + "/" + name;
+    File file = LittleFS.open(gifPath, "r");
+    if (!file) {
+        return false;
+    }
+
+    entry = GifCatalogEntry{};
+    memcpy(entry.name.data(), name.c_str(), name.length());
+    entry.dir = dir;
+    entry.size = static_cast<uint32_t>(file.size());
+    entry.hash = FNV_OFFSET;
+
+    std::array<uint8_t, HASH_CHUNK_BYTES> chunk{};
+    bool first = true;
+    size_t got = 0;
+
+    while ((got = file.read(chunk.data(), chunk.size())) > 0) {
+        if (first && got >= GIF_SCREEN_BYTES && memcmp(chunk.data(), "GIF8", 4) == 0) {
+            entry.width = static_cast<uint16_t>(chunk[6] | (chunk[7] << 8U));
+            entry.height = static_cast<uint16_t>(chunk[8] | (chunk[9] << 8U));
+        }
+        first = false;
+        entry.hash = fnv1a(entry.hash, chunk.data(), got);
+        yield();
+    }
+
+    file.close();
+
+    GifFrameIndexHeader index{};
+    GifFrameEntry firstFrame{};
+    if (GifFrameIndex::ensure(gifPath) && GifFrameIndex::load(gifPath, entry.size, index, firstFrame)) {
+        entry.frameCount = index.frameCount;
+        entry.durationMs = index.durationMs;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Walk the catalogued directories, names and sizes only
+ *
+ * @param files Receives the number of catalogued files
+ *
+ * @return Stamp a catalogue of exactly these files carries
+ */
+static auto directoryStamp(uint32_t& files) -> uint32_t {
+    uint32_t stamp = 0;
+    files = 0;
+
+    for (uint8_t i = 0; i < CATALOG_DIRS.size(); ++i) {
+        Dir dir = LittleFS.openDir(CATALOG_DIRS[i]);
+
+        while (dir.next()) {
+            const String name = dir.fileName();
+            if (isCatalogName(name)) {
+                stamp += stampTerm(i, name.c_str(), static_cast<uint32_t>(dir.fileSize()));
+                ++files;
+            }
+        }
+    }
+
+    return stamp;
+}
+
+/**
+ * @brief Copy every entry into a table of another size
+ *
+ * @param buckets New number of buckets
+ *
+ * @return true if the catalogue was replaced
+ */
+static auto rehash(uint16_t buckets) -> bool {
+    File old = LittleFS.open(GifCatalog::PATH, "r");
+    GifCatalogHeader oldHeader{};
+
+    if (!readHeader(old, oldHeader) || !createTable(CATALOG_TMP_PATH, buckets)) {
+        old.close();
+
+        return false;
+    }
+
+    File table = LittleFS.open(CATALOG_TMP_PATH, "r+");
+    GifCatalogHeader header{};
+    header.buckets = buckets;
+    bool copied = static_cast<bool>(table);
+
+    for (uint16_t i = 0; copied && i < oldHeader.buckets; ++i) {
+        GifCatalogEntry entry{};
+        copied = readBucket(old, i, entry) && (entry.state != BUCKET_USED || place(table, header, entry));
+    }
+
+    copied = copied && writeHeader(table, header);
+    old.close();
+    table.close();
+
+    if (!copied) {
+        LittleFS.remove(CATALOG_TMP_PATH);
+
+        return false;
+    }
+
+    LittleFS.remove(GifCatalog::PATH);
+
+    return LittleFS.rename(CATALOG_TMP_PATH, GifCatalog::PATH);
+}
+
+/**
+ * @brief Check the catalogue against the directories, rebuild it when missing or stale
+ *
+ * Only names and sizes are walked, files are read again only when a rebuild is needed
+ *
+ * @return true if a valid catalogue exists afterwards
+ */
+auto GifCatalog::begin() -> bool {
+    uint32_t files = 0;
+    const uint32_t stamp = directoryStamp(files);
+
+    File table = LittleFS.open(PATH, "r");
+    GifCatalogHeader header{};
+    const bool valid = readHeader(table, header);
+    table.close();
+
+    if (valid && header.count == files && header.stamp == stamp) {
+        return true;
+    }
+
+    return rebuild();
+}
+
+/**
+ * @brief Catalogue every GIF in /gif and /gifs from scratch
+ *
+ * @return true if the catalogue was written
+ */
+auto GifCatalog::rebuild() -> bool {
+    uint32_t files = 0;
+    (void)directoryStamp(files);
+
+    const uint16_t buckets = bucketsFor(files);
+    if (!createTable(PATH, buckets)) {
+        return false;
+    }
+
+    File table = LittleFS.open(PATH, "r+");
+    if (!table) {
+        return false;
+    }
+
+    GifCatalogHeader header{};
+    header.buckets = buckets;
+    bool placed = true;
+
+    for (uint8_t i = 0; placed && i < CATALOG_DIRS.size(); ++i) {
+        Dir dir = LittleFS.openDir(CATALOG_DIRS[i]);
+
+        while (placed && dir.next()) {
+            const String name = dir.fileName();
+            GifCatalogEntry entry{};
+
+            if (isCatalogName(name) && describe(i, name, entry)) {
+                placed = place(table, header, entry);
+            }
+        }
+    }
+
+    placed = placed && writeHeader(table, header);
+    table.close();
+
+    return placed;
+}
+
+/**
+ * @brief Look a GIF up by file name, /gifs first like playback always did
+ *
+ * @param name File name without directory
+ * @param entry Receives the entry
+ *
+ * @return true if the GIF is catalogued
+ */
+auto GifCatalog::find(const String& name, GifCatalogEntry& entry) -> bool {
+    if (!isCatalogName(name)) {
+        return false;
+    }
+
+    File table = LittleFS.open(PATH, "r");
+    GifCatalogHeader header{};
+    if (!readHeader(table, header)) {
+        return false;
+    }
+
+    uint16_t slot = NO_BUCKET;
+    const bool found = probe(table, header, GIF_CATALOG_DIR_GIFS, name.c_str(), entry, slot) ||
+                       probe(table, header, GIF_CATALOG_DIR_GIF, name.c_str(), entry, slot);
+    table.close();
+
+    return found;
+}
+
+/**
+ * @brief Get the LittleFS path of a catalogued GIF
+ *
+ * @param entry Catalogue entry
+ *
+ * @return Path such as /gif/cat.gif
+ */
+auto GifCatalog::path(const GifCatalogEntry& entry) -> String {
+    return String(CATALOG_DIRS[entry.dir < CATALOG_DIRS.size() ? entry.dir : GIF_CATALOG_DIR_GIF]) + "/" +
+           entry.name.data();
+}
+
+/**
+ * @brief Add or refresh the entry of a GIF that was just written
+ *
+ * @param gifPath Path of the GIF in /gif or /gifs
+ *
+ * @return true if the catalogue holds the GIF afterwards
+ */
+auto GifCatalog::upsert(const String& gifPath) -> bool {
+    uint8_t dir = 0;
+    String name;
+    GifCatalogEntry entry{};
+
+    if (!splitPath(gifPath, dir, name) || !describe(dir, name, entry)) {
+        return false;
+    }
+
+    File table = LittleFS.open(PATH, "r+");
+    GifCatalogHeader header{};
+    if (!readHeader(table, header)) {
+        table.close();
+
+        return rebuild();
+    }
+
+    // Keep probes short: grow (and drop tombstones) before the table gets three quarters full
+    if ((header.count + header.tombstones + 1U) * 4U > header.buckets * 3U) {
+        table.close();
+
+        if (!rehash(bucketsFor(header.count + 1U))) {
+            return rebuild();
+        }
+
+        table = LittleFS.open(PATH, "r+");
+        if (!readHeader(table, header)) {
+            table.close();
+
+            return rebuild();
+        }
+    }
+
+    const bool placed = place(table, header, entry) && writeHeader(table, header);
+    table.close();
+
+    return placed;
+}
+
+/**
+ * @brief Drop the entry of a GIF that was deleted
+ *
+ * @param gifPath Path of the GIF in /gif or /gifs
+ *
+ * @return true if an entry was removed
+ */
+auto GifCatalog::remove(const String& gifPath) -> bool {
+    uint8_t dir = 0;
+    String name;
+
+    if (!splitPath(gifPath, dir, name)) {
+        return false;
+    }
+
+    File table = LittleFS.open(PATH, "r+");
+    GifCatalogHeader header{};
+    GifCatalogEntry entry{};
+    uint16_t slot = NO_BUCKET;
+
+    if (!readHeader(table, header) || !probe(table, header, dir, name.c_str(), entry, slot)) {
+        table.close();
+
+        return false;
+    }
+
+    header.stamp -= stampTerm(entry.dir, entry.name.data(), entry.size);
+    --header.count;
+    ++header.tombstones;
+    entry.state = BUCKET_DELETED;
+
+    const bool removed = writeBucket(table, slot, entry) && writeHeader(table, header);
+    table.close();
+
+    return removed;
+}
+
+/**
+ * @brief Start walking every catalogued GIF, in bucket order
+ *
+ * @param cursor Receives the open catalogue
+ *
+ * @return true if the catalogue is valid
+ */
+auto GifCatalog::openCursor(GifCatalogCursor& cursor) -> bool {
+    GifCatalogHeader header{};
+
+    cursor.file = LittleFS.open(PATH, "r");
+    cursor.bucket = 0;
+    cursor.buckets = 0;
+
+    if (!readHeader(cursor.file, header)) {
+        cursor.file.close();
+
+        return false;
+    }
+
+    cursor.buckets = header.buckets;
+
+    return true;
+}
+
+/**
+ * @brief Get the next catalogued GIF, buckets are read sequentially
+ *
+ * @param cursor Cursor from openCursor()
+ * @param entry Receives the entry
+ *
+ * @return false once every bucket was read, the catalogue is closed then
+ */
+auto GifCatalog::next(GifCatalogCursor& cursor, GifCatalogEntry& entry) -> bool {
+    while (cursor.bucket < cursor.buckets) {
+        ++cursor.bucket;
+
+        if (cursor.file.read(reinterpret_cast<uint8_t*>(&entry), sizeof(entry)) != sizeof(entry)) {
+            break;
+        }
+
+        if (entry.state == BUCKET_USED) {
+            return true;
+        }
+    }
+
+    cursor.bucket = cursor.buckets;
+    cursor.file.close();
+
+    return false;
+}
@@ -0,0 +1,511 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+
+#include "display/GifDecoder.h"
+#include "display/HotPath.h"
+
+static constexpr int BLOCK_EXTENSION = 0x21;
+static constexpr int BLOCK_IMAGE = 0x2C;
+static constexpr int BLOCK_TRAILER = 0x3B;
+static constexpr int LABEL_GRAPHIC_CONTROL = 0xF9;
+static constexpr uint8_t FLAG_COLOR_TABLE = 0x80;
+static constexpr uint8_t FLAG_INTERLACED = 0x40;
+static constexpr int MIN_CODE_BITS = 2;
+static constexpr int MAX_CODE_BITS = 12;
+
+/**
+ * @brief Map the index of a stored row of an interlaced frame to its row in the image
+ *
+ * Rows are stored in four passes: every 8th row from 0, every 8th from 4, every 4th from 2 and
+ * every 2nd from 1
+ *
+ * @param index Stored row index
+ * @param height Frame height
+ *
+ * @return Image row
+ */
+static auto interlacedRow(int index, int height) -> int {
+    const int pass1 = (height + 7) / 8;
+    if (index < pass1) {
+        return index * 8;
+    }
+    index -= pass1;
+
+    const int pass2 = (height + 3) / 8;
+    if (index < pass2) {
+        return 4 + index * 8;
+    }
+    index -= pass2;
+
+    const int pass3 = (height + 1) / 4;
+    if (index < pass3) {
+        return 2 + index * 4;
+    }
+
+    return 1 + (index - pass3) * 2;
+}
+
+/**
+ * @brief Select the palette byte order
+ *
+ * @param paletteType GIF_PALETTE_RGB565_LE or GIF_PALETTE_RGB565_BE
+ */
+auto GifDecoder::begin(uint8_t paletteType) -> void { m_bigEndian = paletteType == GIF_PALETTE_RGB565_BE; }
+
+/**
+ * @brief Open a GIF file and read its header and global palette
+ *
+ * @param name File name handed to the open callback
+ * @param openFile Open callback
+ * @param closeFile Close callback
+ * @param readFile Read callback, reads at GIFFILE::iPos
+ * @param seekFile Seek callback
+ * @param draw Called once per decoded line
+ *
+ * @return 1 on success, 0 if the file cannot be opened or is not a GIF
+ */
+auto GifDecoder::open(const char* name, GIF_OPEN_CALLBACK* openFile, GIF_CLOSE_CALLBACK* closeFile,
+                      GIF_READ_CALLBACK* readFile, GIF_SEEK_CALLBACK* seekFile, GIF_DRAW_CALLBACK* draw) -> int {
+    m_file = GIFFILE{};
+    m_closeFile = closeFile;
+    m_readFile = readFile;
+    m_seekFile = seekFile;
+    m_draw = draw;
+    m_inputPos = 0;
+    m_inputLen = 0;
+
+    m_file.fHandle = openFile(name, &m_file.iSize);
+    if (m_file.fHandle == nullptr) {
+        return 0;
+    }
+
+    std::array<uint8_t, 13> header{};
+    if (!readBytes(header.data(), static_cast<int32_t>(header.size())) || header[0] != 'G' || header[1] != 'I' ||
+        header[2] != 'F') {
+        close();
+        return 0;
+    }
+
+    m_canvasW = static_cast<uint16_t>(header[6] | (header[7] << 8));
+    m_canvasH = static_cast<uint16_t>(header[8] | (header[9] << 8));
+    m_background = header[11];
+    m_hasGlobalPalette = (header[10] & FLAG_COLOR_TABLE) != 0;
+    if (m_hasGlobalPalette && !readPalette(m_globalPalette.data(), 2 << (header[10] & 7))) {
+        close();
+        return 0;
+    }
+
+    // Leave the file at the first block, playFrame() starts from there
+    m_seekFile(&m_file, consumedPos());
+    m_inputPos = 0;
+    m_inputLen = 0;
+
+    return 1;
+}
+
+/**
+ * @brief Close the file
+ */
+auto GifDecoder::close() -> void {
+    if (m_closeFile != nullptr && m_file.fHandle != nullptr) {
+        m_closeFile(m_file.fHandle);
+    }
+    m_file.fHandle = nullptr;
+}
+
+/**
+ * @brief Decode the next frame, handing each line to the draw callback
+ *
+ * @param sync Unused, frames are always decoded in full before returning
+ * @param delayMs Receives the frame delay
+ * @param user Passed to the draw callback as GIFDRAW::pUser
+ *
+ * @return 1 if more frames follow, 0 for the last frame, -1 if no frame could be decoded
+ */
+auto GifDecoder::playFrame(bool sync, int* delayMs, void* user) -> int {
+    (void)sync;
+    if (delayMs != nullptr) {
+        *delayMs = 0;
+    }
+    if (m_file.fHandle == nullptr) {
+        return -1;
+    }
+
+    // The player may have moved the file (index rewinds, seeks), read on from wherever it is now
+    m_inputPos = 0;
+    m_inputLen = 0;
+
+    GIFDRAW draw{};
+    draw.pUser = user;
+    draw.ucBackground = m_background;
+    int delay = 0;
+
+    for (;;) {
+        const int block = readByte();
+        if (block == BLOCK_EXTENSION) {
+            const int label = readByte();
+            if (label == LABEL_GRAPHIC_CONTROL) {
+                // Block size 4, packed fields, delay in 1/100 s, transparent index, terminator
+                std::array<uint8_t, 6> gce{};
+                if (!readBytes(gce.data(), static_cast<int32_t>(gce.size())) || gce[0] != 4 || gce[5] != 0) {
+                    return -1;
+                }
+                draw.ucDisposalMethod = static_cast<uint8_t>((gce[1] >> 2) & 7);
+                draw.ucHasTransparency = static_cast<uint8_t>(gce[1] & 1);
+                draw.ucTransparent = gce[4];
+                delay = (gce[2] | (gce[3] << 8)) * 10;
+            } else if (label < 0 || !skipSubBlocks()) {
+                return -1;
+            }
+            continue;
+        }
+        if (block != BLOCK_IMAGE) {
+            return -1;
+        }
+
+        std::array<uint8_t, 9> desc{};
+        if (!readBytes(desc.data(), static_cast<int32_t>(desc.size()))) {
+            return -1;
+        }
+        draw.iX = desc[0] | (desc[1] << 8);
+        draw.iY = desc[2] | (desc[3] << 8);
+        draw.iWidth = desc[4] | (desc[5] << 8);
+        draw.iHeight = desc[6] | (desc[7] << 8);
+        if (draw.iWidth > MAX_WIDTH) {
+            return -1;
+        }
+
+        if ((desc[8] & FLAG_COLOR_TABLE) != 0) {
+            if (!readPalette(m_localPalette.data(), 2 << (desc[8] & 7))) {
+                return -1;
+            }
+            draw.pPalette = m_localPalette.data();
+            draw.ucIsGlobalPalette = 0;
+        } else {
+            draw.pPalette = m_globalPalette.data();
+            draw.ucIsGlobalPalette = 1;
+        }
+
+        if (!decodeImage(draw, (desc[8] & FLAG_INTERLACED) != 0)) {
+            return -1;
+        }
+        break;
+    }
+
+    if (delayMs != nullptr) {
+        *delayMs = delay;
+    }
+
+    // Peek at the next block, the file is left in front of it
+    const int next = readByte();
+    m_seekFile(&m_file, consumedPos() - (next >= 0 ? 1 : 0));
+    m_inputPos = 0;
+    m_inputLen = 0;
+
+    return next < 0 || next == BLOCK_TRAILER ? 0 : 1;
+}
+
+/**
+ * @brief Width of the logical screen
+ */
+auto GifDecoder::getCanvasWidth() const -> int { return m_canvasW; }
+
+/**
+ * @brief Height of the logical screen
+ */
+auto GifDecoder::getCanvasHeight() const -> int { return m_canvasH; }
+
+/**
+ * @brief Refill the input buffer from the current file position
+ *
+ * @return false at the end of the file
+ */
+auto HOT_PATH GifDecoder::fill() -> bool {
+    const int32_t got = m_readFile(&m_file, m_input.data(), static_cast<int32_t>(m_input.size()));
+    m_inputPos = 0;
+    m_inputLen = std::max<int32_t>(got, 0);
+
+    return m_inputLen > 0;
+}
+
+/**
+ * @brief Read one byte
+ *
+ * @return The byte, or -1 at the end of the file
+ */
+auto HOT_PATH GifDecoder::readByte() -> int {
+    if (m_inputPos >= m_inputLen && !fill()) {
+        return -1;
+    }
+
+    return m_input[static_cast<size_t>(m_inputPos++)];
+}
+
+/**
+ * @brief Read a run of bytes
+ *
+ * @param dst Destination, may be nullptr to skip the bytes
+ * @param len Number of bytes
+ *
+ * @return false if the file ends first
+ */
+auto GifDecoder::readBytes(uint8_t* dst, int32_t len) -> bool {
+    while (len > 0) {
+        if (m_inputPos >= m_inputLen && !fill()) {
+            return false;
+        }
+        const int32_t n = std::min(len, m_inputLen - m_inputPos);
+        if (dst != nullptr) {
+            std::copy_n(m_input.data() + m_inputPos, n, dst);
+            dst += n;
+        }
+        m_inputPos += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Skip a run of bytes
+ *
+ * @param len Number of bytes
+ *
+ * @return false if the file ends first
+ */
+auto GifDecoder::skipBytes(int32_t len) -> bool { return readBytes(nullptr, len); }
+
+/**
+ * @brief Skip data sub-blocks up to and including their terminator
+ *
+ * @return false if the file ends first
+ */
+auto GifDecoder::skipSubBlocks() -> bool {
+    for (;;) {
+        const int len = readByte();
+        if (len <= 0) {
+            return len == 0;
+        }
+        if (!skipBytes(len)) {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Read the next byte of image data, crossing sub-block boundaries
+ *
+ * @return The byte, or -1 once the terminator or the end of the file is reached
+ */
+auto HOT_PATH GifDecoder::dataByte() -> int {
+    if (m_blockLeft == 0) {
+        const int len = readByte();
+        if (len <= 0) {
+            m_dataEnded = true;
+            return -1;
+        }
+        m_blockLeft = static_cast<uint8_t>(len);
+    }
+    --m_blockLeft;
+
+    return readByte();
+}
+
+/**
+ * @brief Read a colour table and convert it to RGB565 in the selected byte order
+ *
+ * @param palette Destination, 256 entries
+ * @param entries Number of colours in the file
+ *
+ * @return false if the file ends first
+ */
+auto GifDecoder::readPalette(uint16_t* palette, int entries) -> bool {
+    std::array<uint8_t, 3> rgb{};
+    for (int i = 0; i < entries; ++i) {
+        if (!readBytes(rgb.data(), static_cast<int32_t>(rgb.size()))) {
+            return false;
+        }
+        auto color = static_cast<uint16_t>(((rgb[0] & 0xF8U) << 8U) | ((rgb[1] & 0xFCU) << 3U) | (rgb[2] >> 3U));
+        if (m_bigEndian) {
+            color = static_cast<uint16_t>((color >> 8U) | (color << 8U));
+        }
+        palette[i] = color;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Decode the LZW image data of one frame line by line
+ *
+ * Damaged or truncated data still completes the frame: the missing pixels are sent as the
+ * transparent index (or 0), so the draw callback always sees every row once
+ *
+ * @param draw Line description, filled in by the caller up to the row fields
+ * @param interlaced Rows are stored in interlaced order
+ *
+ * @return false if the data is not valid LZW
+ */
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+auto HOT_PATH GifDecoder::decodeImage(GIFDRAW& draw, bool interlaced) -> bool {
+    const int minBits = readByte();
+    if (minBits < MIN_CODE_BITS || minBits >= MAX_CODE_BITS) {
+        return false;
+    }
+
+    m_blockLeft = 0;
+    m_dataEnded = false;
+    if (draw.iWidth == 0 || draw.iHeight == 0) {
+        return skipSubBlocks();
+    }
+
+    const auto clear = static_cast<uint16_t>(1U << static_cast<unsigned>(minBits));
+    const auto endOfInfo = static_cast<uint16_t>(clear + 1U);
+    for (uint16_t code = 0; code < clear; ++code) {
+        m_suffix[code] = static_cast<uint8_t>(code);
+    }
+
+    const int width = draw.iWidth;
+    const int height = draw.iHeight;
+    int codeBits = minBits + 1;
+    auto next = static_cast<uint16_t>(endOfInfo + 1U);
+    int prev = -1;
+    uint8_t first = 0;
+    uint32_t bits = 0;
+    int bitCount = 0;
+    int col = 0;
+    int row = 0;
+
+    while (row < height) {
+        while (bitCount < codeBits) {
+            int byte = -1;
+            // Common case straight from the buffer, sub-block and refill handling only at the edges
+            if (m_blockLeft > 0 && m_inputPos < m_inputLen) {
+                --m_blockLeft;
+                byte = m_input[static_cast<size_t>(m_inputPos++)];
+            } else {
+                byte = dataByte();
+            }
+            if (byte < 0) {
+                break;
+            }
+            bits |= static_cast<uint32_t>(byte) << static_cast<unsigned>(bitCount);
+            bitCount += 8;
+        }
+        if (bitCount < codeBits) {
+            break;
+        }
+
+        const auto code = static_cast<uint16_t>(bits & ((1U << static_cast<unsigned>(codeBits)) - 1U));
+        bits >>= static_cast<unsigned>(codeBits);
+        bitCount -= codeBits;
+
+        if (code == clear) {
+            codeBits = minBits + 1;
+            next = static_cast<uint16_t>(endOfInfo + 1U);
+            prev = -1;
+            continue;
+        }
+        if (code == endOfInfo) {
+            break;
+        }
+
+        size_t depth = 0;
+        if (prev < 0) {
+            if (code > clear) {
+                break;
+            }
+            first = static_cast<uint8_t>(code);
+            m_stack[depth++] = first;
+        } else {
+            if (code > next) {
+                break;
+            }
+            uint16_t cur = code;
+            // KwKwK: the code being defined right now is the previous string plus its own first index
+            if (code == next) {
+                m_stack[depth++] = first;
+                cur = static_cast<uint16_t>(prev);
+            }
+            while (cur >= clear) {
+                m_stack[depth++] = m_suffix[cur];
+                cur = m_prefix[cur];
+            }
+            first = static_cast<uint8_t>(cur);
+            m_stack[depth++] = first;
+
+            if (next < MAX_CODES) {
+                m_prefix[next] = static_cast<uint16_t>(prev);
+                m_suffix[next] = first;
+                ++next;
+                if (next == (1U << static_cast<unsigned>(codeBits)) && codeBits < MAX_CODE_BITS) {
+                    ++codeBits;
+                }
+            }
+        }
+        prev = code;
+
+        while (depth > 0 && row < height) {
+            const int run = std::min(static_cast<int>(depth), width - col);
+            for (int i = 0; i < run; ++i) {
+                m_line[static_cast<size_t>(col++)] = m_stack[--depth];
+            }
+            if (col == width) {
+                emitRow(draw, interlaced ? interlacedRow(row, height) : row);
+                ++row;
+                col = 0;
+            }
+        }
+    }
+
+    // Truncated data: finish the frame so the callback sees every row
+    if (row < height) {
+        const uint8_t pad = draw.ucHasTransparency != 0 ? draw.ucTransparent : 0;
+        std::fill(m_line.begin() + col, m_line.begin() + width, pad);
+        for (; row < height; ++row) {
+            emitRow(draw, interlaced ? interlacedRow(row, height) : row);
+            std::fill_n(m_line.begin(), width, pad);
+        }
+    }
+
+    if (!m_dataEnded) {
+        (void)skipBytes(m_blockLeft);
+        (void)skipSubBlocks();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Hand the current line to the draw callback
+ *
+ * @param draw Line description
+ * @param row Image row of the line
+ */
+auto HOT_PATH GifDecoder::emitRow(GIFDRAW& draw, int row) -> void {
+    draw.y = row;
+    draw.pPixels = m_line.data();
+    m_draw(&draw);
+}
+
+/**
+ * @brief File offset of the next byte not yet consumed from the input buffer
+ */
+auto GifDecoder::consumedPos() const -> int32_t { return m_file.iPos - (m_inputLen - m_inputPos); }
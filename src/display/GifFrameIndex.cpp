@@ -0,0 +1,371 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "display/GifFrameIndex.h"
+#include "display/GifSlotStore.h"
+
+#include <array>
+#include <cstring>
+
+static constexpr uint32_t INDEX_MAGIC = 0x58444947;  // "GIDX"
+static constexpr uint16_t INDEX_VERSION = 1;
+static constexpr size_t SCAN_BUFFER_BYTES = 256;
+static constexpr size_t GIF_HEADER_BYTES = 13;
+static constexpr size_t GIF_DESCRIPTOR_BYTES = 9;
+static constexpr uint16_t GIF_DELAY_UNIT_MS = 10;
+
+static constexpr uint8_t GIF_EXTENSION = 0x21;
+static constexpr uint8_t GIF_IMAGE = 0x2C;
+static constexpr uint8_t GIF_TRAILER = 0x3B;
+static constexpr uint8_t GIF_GRAPHIC_CONTROL = 0xF9;
+static constexpr uint8_t GIF_COLOR_TABLE_FLAG = 0x80;
+static constexpr uint8_t GIF_COLOR_TABLE_BITS = 0x07;
+
+static_assert(sizeof(GifFrameEntry) == 16, "sidecar entries are read by offset");
+static_assert(sizeof(GifFrameIndexHeader) == 16, "sidecar entries follow a fixed size header");
+
+/**
+ * @brief GIF being scanned, either a LittleFS file read through a small buffer or a mapped slot
+ */
+struct GifScanSource {
+    File file;
+    const uint8_t* mapped;
+    uint32_t size;
+    uint32_t bufStart;
+    uint32_t bufLen;
+    std::array<uint8_t, SCAN_BUFFER_BYTES> buf;
+};
+
+/**
+ * @brief Sidecar header followed by the first frame, read together when a GIF is opened
+ */
+struct GifFrameIndexHead {
+    GifFrameIndexHeader header;
+    GifFrameEntry first;
+};
+
+/**
+ * @brief Open the GIF behind a playback path for scanning
+ *
+ * @param gifPath LittleFS path or slot:<name>
+ * @param src Receives the source
+ *
+ * @return true if the GIF exists
+ */
+static auto openSource(const String& gifPath, GifScanSource& src) -> bool {
+    src.mapped = nullptr;
+    src.bufStart = 0;
+    src.bufLen = 0;
+
+    if (gifPath.startsWith(GIF_SLOT_PREFIX)) {
+        const GifSlot* slot = GifSlotStore::find(gifPath.substring(strlen(GIF_SLOT_PREFIX)));
+        if (slot == nullptr) {
+            return false;
+        }
+
+        src.mapped = GifSlotStore::data(*slot);
+        src.size = slot->size;
+
+        return true;
+    }
+
+    src.file = LittleFS.open(gifPath, "r");
+    src.size = src.file ? static_cast<uint32_t>(src.file.size()) : 0U;
+
+    return static_cast<bool>(src.file);
+}
+
+/**
+ * @brief Read bytes of the GIF being scanned
+ *
+ * @param src Scan source
+ * @param pos Offset in the GIF
+ * @param dst Destination buffer
+ * @param len Number of bytes, all of them must be inside the file
+ *
+ * @return true if all bytes were read
+ */
+static auto scanRead(GifScanSource& src, uint32_t pos, uint8_t* dst, size_t len) -> bool {
+    if (pos > src.size || len > src.size - pos) {
+        return false;
+    }
+
+    if (src.mapped != nullptr) {
+        memcpy_P(dst, src.mapped + pos, len);
+
+        return true;
+    }
+
+    for (size_t i = 0; i < len; ++i) {
+        const uint32_t offset = pos + static_cast<uint32_t>(i);
+
+        if (offset < src.bufStart || offset >= src.bufStart + src.bufLen) {
+            (void)src.file.seek(offset, SeekSet);
+            src.bufStart = offset;
+            src.bufLen = static_cast<uint32_t>(src.file.read(src.buf.data(), src.buf.size()));
+            if (src.bufLen == 0) {
+                return false;
+            }
+        }
+
+        dst[i] = src.buf[offset - src.bufStart];
+    }
+
+    return true;
+}
+
+/**
+ * @brief Skip a chain of data sub-blocks, only their length bytes are read
+ *
+ * @param src Scan source
+ * @param pos Offset of the first length byte, moved past the terminator
+ *
+ * @return true if the terminator was found inside the file
+ */
+static auto skipSubBlocks(GifScanSource& src, uint32_t& pos) -> bool {
+    uint8_t len = 0;
+
+    do {
+        if (!scanRead(src, pos, &len, 1)) {
+            return false;
+        }
+        pos += 1U + len;
+    } while (len != 0);
+
+    return true;
+}
+
+/**
+ * @brief Size in bytes of a colour table announced by a packed field
+ *
+ * @param packed Packed field of the screen or image descriptor
+ *
+ * @return Table size, 0 when the table is absent
+ */
+static auto colorTableBytes(uint8_t packed) -> uint32_t {
+    return (packed & GIF_COLOR_TABLE_FLAG) != 0 ? 3U << ((packed & GIF_COLOR_TABLE_BITS) + 1U) : 0U;
+}
+
+/**
+ * @brief Get the sidecar path of a GIF
+ *
+ * @param gifPath LittleFS path or slot:<name>
+ *
+ * @return Path of the index file under /gifidx
+ */
+auto GifFrameIndex::sidecarPath(const String& gifPath) -> String {
+    if (gifPath.startsWith(GIF_SLOT_PREFIX)) {
+        return "/gifidx/slot/" + gifPath.substring(strlen(GIF_SLOT_PREFIX)) + ".idx";
+    }
+
+    return "/gifidx" + gifPath + ".idx";
+}
+
+/**
+ * @brief Scan a GIF and write its frame index
+ *
+ * The header is written last, an interrupted build leaves a sidecar that load() rejects
+ *
+ * @param gifPath LittleFS path or slot:<name>
+ *
+ * @return true if the GIF was valid and the sidecar written
+ */
+auto GifFrameIndex::build(const String& gifPath) -> bool {  // NOLINT(readability-function-cognitive-complexity)
+    GifScanSource src;
+    std::array<uint8_t, GIF_HEADER_BYTES> screen{};
+
+    if (!openSource(gifPath, src)) {
+        return false;
+    }
+
+    if (!scanRead(src, 0, screen.data(), screen.size()) || memcmp(screen.data(), "GIF8", 4) != 0) {
+        src.file.close();
+
+        return false;
+    }
+
+    const String path = sidecarPath(gifPath);
+    File out = LittleFS.open(path, "w");
+    if (!out) {
+        src.file.close();
+
+        return false;
+    }
+
+    const auto canvasW = static_cast<uint16_t>(screen[6] | (screen[7] << 8U));
+    const auto canvasH = static_cast<uint16_t>(screen[8] | (screen[9] << 8U));
+
+    GifFrameIndexHeader header{};
+    (void)out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+
+    uint32_t pos = GIF_HEADER_BYTES + colorTableBytes(screen[10]);
+    GifFrameEntry entry{};
+    entry.offset = pos;
+    bool valid = true;
+
+    while (header.frameCount < UINT16_MAX) {
+        uint8_t block = 0;
+        if (!scanRead(src, pos, &block, 1) || block == GIF_TRAILER) {
+            break;
+        }
+
+        if (block == GIF_EXTENSION) {
+            // label, block size, packed, delay (2), transparent index
+            std::array<uint8_t, 6> ext{};
+            if (scanRead(src, pos + 1U, ext.data(), ext.size()) && ext[0] == GIF_GRAPHIC_CONTROL && ext[1] == 4U) {
+                entry.delayMs = static_cast<uint16_t>((ext[3] | (ext[4] << 8U)) * GIF_DELAY_UNIT_MS);
+                entry.flags = (ext[2] & 0x01U) != 0 ? GIF_FRAME_TRANSPARENT : 0U;
+            }
+
+            pos += 2U;
+            if (!skipSubBlocks(src, pos)) {
+                break;
+            }
+            continue;
+        }
+
+        std::array<uint8_t, GIF_DESCRIPTOR_BYTES> desc{};
+        if (block != GIF_IMAGE || !scanRead(src, pos + 1U, desc.data(), desc.size())) {
+            valid = false;
+            break;
+        }
+
+        entry.x = static_cast<uint16_t>(desc[0] | (desc[1] << 8U));
+        entry.y = static_cast<uint16_t>(desc[2] | (desc[3] << 8U));
+        entry.width = static_cast<uint16_t>(desc[4] | (desc[5] << 8U));
+        entry.height = static_cast<uint16_t>(desc[6] | (desc[7] << 8U));
+        if (entry.x == 0 && entry.y == 0 && entry.width == canvasW && entry.height == canvasH) {
+            entry.flags |= GIF_FRAME_FULL_CANVAS;
+        }
+
+        // Descriptor, local colour table and the LZW minimum code size precede the image data
+        pos += 1U + GIF_DESCRIPTOR_BYTES + colorTableBytes(desc[8]) + 1U;
+        if (!skipSubBlocks(src, pos)) {
+            break;
+        }
+
+        (void)out.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry));
+        ++header.frameCount;
+        header.durationMs += entry.delayMs;
+
+        entry = GifFrameEntry{};
+        entry.offset = pos;
+    }
+
+    src.file.close();
+
+    if (!valid || header.frameCount == 0) {
+        out.close();
+        LittleFS.remove(path);
+
+        return false;
+    }
+
+    header.magic = INDEX_MAGIC;
+    header.version = INDEX_VERSION;
+    header.gifSize = src.size;
+    (void)out.seek(0, SeekSet);
+    const bool written = out.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)) == sizeof(header);
+    out.close();
+
+    return written;
+}
+
+/**
+ * @brief Build the index of a GIF unless an up-to-date one exists
+ *
+ * @param gifPath LittleFS path or slot:<name>
+ *
+ * @return true if a valid index exists afterwards
+ */
+auto GifFrameIndex::ensure(const String& gifPath) -> bool {
+    GifScanSource src;
+    if (!openSource(gifPath, src)) {
+        return false;
+    }
+    src.file.close();
+
+    GifFrameIndexHeader header{};
+    GifFrameEntry first{};
+
+    return load(gifPath, src.size, header, first) || build(gifPath);
+}
+
+/**
+ * @brief Read the index header and first frame of a GIF
+ *
+ * @param gifPath LittleFS path or slot:<name>
+ * @param gifSize Size of the GIF as opened, a sidecar built for another size is stale
+ * @param header Receives the header
+ * @param first Receives the first frame entry
+ *
+ * @return true if a valid index for this GIF exists
+ */
+auto GifFrameIndex::load(const String& gifPath, uint32_t gifSize, GifFrameIndexHeader& header, GifFrameEntry& first)
+    -> bool {
+    File sidecar = LittleFS.open(sidecarPath(gifPath), "r");
+    if (!sidecar) {
+        return false;
+    }
+
+    GifFrameIndexHead head{};
+    const bool complete = sidecar.read(reinterpret_cast<uint8_t*>(&head), sizeof(head)) == sizeof(head);
+    sidecar.close();
+
+    if (!complete || head.header.magic != INDEX_MAGIC || head.header.version != INDEX_VERSION ||
+        head.header.gifSize != gifSize || head.header.frameCount == 0) {
+        return false;
+    }
+
+    header = head.header;
+    first = head.first;
+
+    return true;
+}
+
+/**
+ * @brief Read one frame entry from an open sidecar
+ *
+ * @param sidecar Sidecar opened for reading
+ * @param frame Frame number, below the header frame count
+ * @param entry Receives the entry
+ *
+ * @return true if the entry was read
+ */
+auto GifFrameIndex::readEntry(File& sidecar, uint16_t frame, GifFrameEntry& entry) -> bool {
+    const uint32_t offset = sizeof(GifFrameIndexHeader) + static_cast<uint32_t>(frame) * sizeof(GifFrameEntry);
+
+    return sidecar.seek(offset, SeekSet) &&
+           sidecar.read(reinterpret_cast<uint8_t*>(&entry), sizeof(entry)) == sizeof(entry);
+}
+
+/**
+ * @brief Delete the index of a GIF
+ *
+ * @param gifPath LittleFS path or slot:<name>
+ *
+ * @return void
+ */
+auto GifFrameIndex::remove(const String& gifPath) -> void {
+    const String path = sidecarPath(gifPath);
+
+    if (LittleFS.exists(path)) {
+        LittleFS.remove(path);
+    }
+}
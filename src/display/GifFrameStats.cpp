@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "display/GifFrameStats.h"
+
+/**
+ * @brief Read one metric out of a sample
+ *
+ * @param sample The frame sample
+ * @param metric Which value to read
+ *
+ * @return The value, widened to 32 bits
+ */
+static auto metricOf(const GifFrameSample& sample, GifFrameMetric metric) -> uint32_t {
+    switch (metric) {
+        case GifFrameMetric::DecodeUs:
+            return sample.decodeUs;
+        case GifFrameMetric::SpiUs:
+            return sample.spiUs;
+        case GifFrameMetric::YieldUs:
+            return sample.yieldUs;
+        case GifFrameMetric::Bytes:
+            return sample.bytes;
+        case GifFrameMetric::Windows:
+            return sample.windows;
+        case GifFrameMetric::IntervalMs:
+            return sample.intervalMs;
+        case GifFrameMetric::DelayMs:
+            return sample.delayMs;
+        case GifFrameMetric::LateMs:
+            return sample.lateMs;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Forget every sample and counter
+ */
+auto GifFrameStats::reset() -> void {
+    m_next = 0;
+    m_count = 0;
+    m_frames = 0;
+    m_lateFrames = 0;
+    m_droppedFrames = 0;
+}
+
+/**
+ * @brief Add a drawn frame, replacing the oldest one once the window is full
+ *
+ * @param sample Cost of the frame
+ * @param late true when it reached the panel past the lateness tolerance
+ */
+auto GifFrameStats::record(const GifFrameSample& sample, bool late) -> void {
+    m_samples[m_next] = sample;
+    m_next = (m_next + 1U) % WINDOW;
+    m_count = std::min(m_count + 1U, WINDOW);
+
+    ++m_frames;
+    if (late) {
+        ++m_lateFrames;
+    }
+}
+
+/**
+ * @brief Count a frame that was decoded without being drawn
+ */
+auto GifFrameStats::recordDrop() -> void { ++m_droppedFrames; }
+
+/**
+ * @brief Mean and 95th percentile (nearest rank) of a metric over the frames in the window
+ *
+ * @param metric Which value to summarize
+ *
+ * @return Both 0 when no frame was recorded
+ */
+auto GifFrameStats::summarize(GifFrameMetric metric) const -> GifMetricSummary {
+    GifMetricSummary summary;
+    if (m_count == 0) {
+        return summary;
+    }
+
+    std::array<uint32_t, WINDOW> values{};
+    uint64_t sum = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        values[i] = metricOf(m_samples[i], metric);
+        sum += values[i];
+    }
+
+    const size_t rank = (m_count * 95U + 99U) / 100U - 1U;
+    std::nth_element(values.data(), values.data() + rank, values.data() + m_count);
+
+    summary.avg = static_cast<uint32_t>(sum / m_count);
+    summary.p95 = values[rank];
+
+    return summary;
+}
+
+/**
+ * @brief Frame rate matching the mean of a millisecond metric over the window
+ *
+ * @param metric IntervalMs for the achieved rate, DelayMs for the rate the file asks for
+ *
+ * @return Frames per second, 0 when nothing was recorded
+ */
+auto GifFrameStats::fps(GifFrameMetric metric) const -> float {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        sum += metricOf(m_samples[i], metric);
+    }
+
+    return sum > 0 ? static_cast<float>(m_count) * 1000.0F / static_cast<float>(sum) : 0.0F;
+}
+
+/**
+ * @brief Get the number of frames in the window
+ *
+ * @return Up to WINDOW
+ */
+auto GifFrameStats::samples() const -> size_t { return m_count; }
+
+/**
+ * @brief Get the number of drawn frames since the last reset
+ *
+ * @return Frame count
+ */
+auto GifFrameStats::frames() const -> uint32_t { return m_frames; }
+
+/**
+ * @brief Get the number of drawn frames that were late since the last reset
+ *
+ * @return Frame count
+ */
+auto GifFrameStats::lateFrames() const -> uint32_t { return m_lateFrames; }
+
+/**
+ * @brief Get the number of frames decoded without being drawn since the last reset
+ *
+ * @return Frame count
+ */
+auto GifFrameStats::droppedFrames() const -> uint32_t { return m_droppedFrames; }
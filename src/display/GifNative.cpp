@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "display/GifNative.h"
+
+#include <algorithm>
+#include <cstring>
+
+static_assert(sizeof(GifNativeHeader) == 24, "frames follow a fixed size header");
+static_assert(sizeof(GifNativeFrame) == 20, "frame records are read as a whole");
+static_assert(sizeof(GifNativeRow) == 4 && sizeof(GifNativeSpan) == 4, "rows and spans are read as a whole");
+
+/**
+ * @brief Get the native animation path of a GIF
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return Path of the transcoded file under /gifidx
+ */
+auto GifNative::path(const String& gifPath) -> String { return "/gifidx" + gifPath + ".gma"; }
+
+/**
+ * @brief Check whether a GIF has a transcoded file, without validating it
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return true if the file exists
+ */
+auto GifNative::exists(const String& gifPath) -> bool { return LittleFS.exists(path(gifPath)); }
+
+/**
+ * @brief Delete the transcoded file of a GIF
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return void
+ */
+auto GifNative::remove(const String& gifPath) -> void {
+    const String nativePath = path(gifPath);
+
+    if (LittleFS.exists(nativePath)) {
+        LittleFS.remove(nativePath);
+    }
+}
+
+/**
+ * @brief Open the transcoded file of a GIF, positioned on its first frame
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return true if a complete transcoded file for this version of the GIF exists
+ */
+auto GifNative::open(const String& gifPath) -> bool {
+    close();
+
+    File gif = LittleFS.open(gifPath, "r");
+    if (!gif) {
+        return false;
+    }
+    const auto gifSize = static_cast<uint32_t>(gif.size());
+    gif.close();
+
+    m_file = LittleFS.open(path(gifPath), "r");
+    if (!m_file) {
+        return false;
+    }
+
+    if (!read(&m_header, sizeof(m_header)) || m_header.magic != MAGIC || m_header.version != VERSION ||
+        m_header.gifSize != gifSize || m_header.frameCount == 0) {
+        close();
+
+        return false;
+    }
+
+    m_frameNumber = 0;
+
+    return true;
+}
+
+/**
+ * @brief Close the transcoded file
+ *
+ * @return void
+ */
+auto GifNative::close() -> void {
+    m_file.close();
+    m_file = File();
+    m_header = GifNativeHeader{};
+    m_frameNumber = 0;
+    m_bufPos = 0;
+    m_bufLen = 0;
+}
+
+/**
+ * @brief Check whether a transcoded file is open
+ *
+ * @return true between a successful open() and close()
+ */
+auto GifNative::isOpen() const -> bool { return static_cast<bool>(m_file); }
+
+/**
+ * @brief Get the header of the open file
+ *
+ * @return Header, zeroed when nothing is open
+ */
+auto GifNative::header() const -> const GifNativeHeader& { return m_header; }
+
+/**
+ * @brief Get the number of the next frame readFrame() returns
+ *
+ * @return Frame number from 0
+ */
+auto GifNative::frameNumber() const -> uint16_t { return m_frameNumber; }
+
+/**
+ * @brief Go back to the first frame
+ *
+ * @return true if the file could be repositioned
+ */
+auto GifNative::rewind() -> bool {
+    m_bufPos = 0;
+    m_bufLen = 0;
+    m_frameNumber = 0;
+
+    return m_file.seek(sizeof(GifNativeHeader), SeekSet);
+}
+
+/**
+ * @brief Read the next frame record, its rows have to be read before the following frame
+ *
+ * @param frame Receives the record
+ *
+ * @return false past the last frame or on a truncated file
+ */
+auto GifNative::readFrame(GifNativeFrame& frame) -> bool {
+    if (m_frameNumber >= m_header.frameCount || !read(&frame, sizeof(frame))) {
+        return false;
+    }
+
+    ++m_frameNumber;
+
+    return true;
+}
+
+/**
+ * @brief Read the next row of the current frame
+ *
+ * @param row Receives the row, its spans have to be read next
+ *
+ * @return true if the row was read
+ */
+auto GifNative::readRow(GifNativeRow& row) -> bool { return read(&row, sizeof(row)); }
+
+/**
+ * @brief Read the next span of the current row and expand its RLE packets
+ *
+ * @param span Receives the span position and length
+ * @param pixels Receives the pixels in panel byte order
+ * @param capacity Number of pixels that fit in the buffer
+ *
+ * @return true if the span was read and fits in the buffer
+ */
+auto GifNative::readSpan(GifNativeSpan& span, uint16_t* pixels, size_t capacity) -> bool {
+    if (!read(&span, sizeof(span)) || span.length > capacity) {
+        return false;
+    }
+
+    size_t filled = 0;
+    while (filled < span.length) {
+        uint8_t packet = 0;
+        if (!read(&packet, 1)) {
+            return false;
+        }
+
+        const size_t count = (packet & GIF_NATIVE_COUNT_MASK) + 1U;
+        if (filled + count > span.length) {
+            return false;
+        }
+
+        if ((packet & GIF_NATIVE_RUN) != 0) {
+            uint16_t pixel = 0;
+            if (!read(&pixel, sizeof(pixel))) {
+                return false;
+            }
+            std::fill_n(pixels + filled, count, pixel);
+        } else if (!read(pixels + filled, count * sizeof(uint16_t))) {
+            return false;
+        }
+
+        filled += count;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Read bytes through the read buffer, rows are small and read one after the other
+ *
+ * @param dst Destination
+ * @param len Number of bytes
+ *
+ * @return true if all bytes were read
+ */
+auto GifNative::read(void* dst, size_t len) -> bool {
+    auto* out = static_cast<uint8_t*>(dst);
+
+    while (len > 0) {
+        if (m_bufPos == m_bufLen) {
+            m_bufPos = 0;
+            m_bufLen = m_file.read(m_buf.data(), m_buf.size());
+            if (m_bufLen == 0) {
+                return false;
+            }
+        }
+
+        const size_t chunk = std::min(len, m_bufLen - m_bufPos);
+        memcpy(out, m_buf.data() + m_bufPos, chunk);
+        m_bufPos += chunk;
+        out += chunk;
+        len -= chunk;
+    }
+
+    return true;
+}
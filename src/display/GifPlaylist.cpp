@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "display/DisplayManager.h"
+#include "display/GifPlaylist.h"
+
+/**
+ * @brief Construct a playlist driving the given player
+ *
+ * @param gif The GIF player the queue is played on
+ */
+GifPlaylist::GifPlaylist(Gif& gif) : m_gif(gif) {}
+
+/**
+ * @brief Append an entry, it starts from update() once the entries before it are done
+ *
+ * @param entry The file and how long to play it
+ *
+ * @return true if queued false if the queue is full
+ */
+auto GifPlaylist::enqueue(const GifQueueEntry& entry) -> bool {
+    if (m_count >= QUEUE_MAX) {
+        return false;
+    }
+
+    m_entries[m_count++] = entry;
+
+    return true;
+}
+
+/**
+ * @brief Replace the queue with a single entry and start it right away
+ *
+ * @param entry The file and how long to play it
+ *
+ * @return true if playback started false if the file could not be opened
+ */
+auto GifPlaylist::playNow(const GifQueueEntry& entry) -> bool {
+    clear();
+    m_entries[0] = entry;
+    m_count = 1;
+
+    return startFront(false);
+}
+
+/**
+ * @brief End the current entry now and start the next one
+ *
+ * @return true if another entry is playing false if the queue ran out
+ */
+auto GifPlaylist::skip() -> bool {
+    if (m_count == 0) {
+        return false;
+    }
+
+    advance(false);
+
+    return m_active;
+}
+
+/**
+ * @brief Stop playback and empty the queue
+ *
+ * @return void
+ */
+auto GifPlaylist::clear() -> void {
+    m_gif.stop();
+
+    for (size_t i = 0; i < m_count; ++i) {
+        m_entries[i] = GifQueueEntry{};
+    }
+
+    m_count = 0;
+    m_active = false;
+    m_canvas = GifCanvas{};
+    m_preloadPath = "";
+}
+
+/**
+ * @brief Play due frames and move through the queue, should be called regularly
+ *
+ * @return void
+ */
+auto GifPlaylist::update() -> void {
+    if (m_count > 0 && !m_active) {
+        startFront(false);
+    }
+
+    m_gif.update();
+
+    if (m_count == 0 || !m_active) {
+        return;
+    }
+
+    if (!m_gif.isPlaying()) {
+        advance(true);
+
+        return;
+    }
+
+    const GifQueueEntry& front = m_entries[0];
+    const auto playedMs = static_cast<int32_t>(millis() - m_entryStartMs);
+    if (front.durationMs > 0 && playedMs >= static_cast<int32_t>(front.durationMs)) {
+        advance(true);
+
+        return;
+    }
+
+    // One attempt per upcoming entry, a file that fails here is dropped when its turn comes
+    const GifQueueEntry* next = nextEntry();
+    if (next != nullptr && next->path != m_preloadPath) {
+        m_preloadPath = next->path;
+        m_gif.preload(next->path);
+    }
+}
+
+/**
+ * @brief Play the whole queue again and again instead of consuming it
+ *
+ * @param enabled true to move finished entries to the back of the queue
+ */
+auto GifPlaylist::setRepeat(bool enabled) -> void { m_repeat = enabled; }
+
+/**
+ * @brief Check whether finished entries go back to the end of the queue
+ *
+ * @return true if repeating
+ */
+auto GifPlaylist::isRepeat() const -> bool { return m_repeat; }
+
+/**
+ * @brief Check whether the front entry is playing
+ *
+ * @return true while an entry is on screen
+ */
+auto GifPlaylist::isActive() const -> bool { return m_active; }
+
+/**
+ * @brief Number of queued entries, the playing one included
+ *
+ * @return Entry count
+ */
+auto GifPlaylist::size() const -> size_t { return m_count; }
+
+/**
+ * @brief Get a queued entry, index 0 is the one playing
+ *
+ * @param index Position in the queue, must be below size()
+ *
+ * @return The entry
+ */
+auto GifPlaylist::entryAt(size_t index) const -> const GifQueueEntry& { return m_entries[index]; }
+
+/**
+ * @brief Start the front entry, dropping entries that cannot be opened
+ *
+ * The screen is cleared when it holds no GIF yet, otherwise only the border the previous (larger)
+ * canvas leaves uncovered is cleared, so the last frame stays up until the new first frame lands
+ *
+ * @param keepSchedule true to show the first frame when the previous file's last delay ends
+ *
+ * @return true if an entry is playing
+ */
+auto GifPlaylist::startFront(bool keepSchedule) -> bool {
+    while (m_count > 0) {
+        const GifQueueEntry& entry = m_entries[0];
+
+        // No scan here: uploads and catalogue rebuilds write the frame index, playOne() only loads it
+        if (m_gif.isPreloaded(entry.path) || m_gif.preload(entry.path)) {
+            const GifCanvas canvas = m_gif.getPreloadedCanvas();
+
+            if (m_canvas.width == 0 || m_canvas.height == 0) {
+                DisplayManager::clearScreen();
+            } else if (canvas.width < m_canvas.width || canvas.height < m_canvas.height) {
+                auto* gfx = DisplayManager::getGfx();
+                const auto screenW = static_cast<int16_t>(gfx != nullptr ? gfx->width() : 0);
+                const auto screenH = static_cast<int16_t>(gfx != nullptr ? gfx->height() : 0);
+                const auto width = static_cast<int16_t>(std::min<int>(canvas.width, screenW));
+                const auto height = static_cast<int16_t>(std::min<int>(canvas.height, screenH));
+
+                DisplayManager::clearOutside(static_cast<int16_t>((screenW - width) / 2),
+                                             static_cast<int16_t>((screenH - height) / 2), width, height);
+            }
+
+            m_gif.setPlayCount(entry.loops);
+
+            if (m_gif.playOne(entry.path, keepSchedule)) {
+                m_canvas = canvas;
+                m_entryStartMs = m_gif.getNextFrameDueMs();
+                m_active = true;
+                m_preloadPath = "";
+
+                return true;
+            }
+        }
+
+        // Unreadable files leave the queue even when repeating
+        dropFront();
+    }
+
+    m_active = false;
+
+    return false;
+}
+
+/**
+ * @brief Retire the front entry and start the next one, if any
+ *
+ * When the queue runs out the last frame stays on screen
+ *
+ * @param keepSchedule true to continue the frame deadlines into the next file
+ *
+ * @return void
+ */
+auto GifPlaylist::advance(bool keepSchedule) -> void {
+    if (m_repeat) {
+        std::rotate(m_entries.begin(), m_entries.begin() + 1, m_entries.begin() + static_cast<ptrdiff_t>(m_count));
+    } else {
+        dropFront();
+    }
+
+    if (m_count == 0) {
+        m_gif.stop();
+        m_active = false;
+
+        return;
+    }
+
+    startFront(keepSchedule);
+}
+
+/**
+ * @brief Remove the front entry
+ *
+ * @return void
+ */
+auto GifPlaylist::dropFront() -> void {
+    if (m_count == 0) {
+        return;
+    }
+
+    std::move(m_entries.begin() + 1, m_entries.begin() + static_cast<ptrdiff_t>(m_count), m_entries.begin());
+    m_entries[--m_count] = GifQueueEntry{};
+}
+
+/**
+ * @brief Get the entry that plays after the current one
+ *
+ * @return The next entry or nullptr when the queue ends with the current one
+ */
+auto GifPlaylist::nextEntry() const -> const GifQueueEntry* {
+    if (m_count > 1) {
+        return &m_entries[1];
+    }
+
+    return m_repeat && m_count == 1 ? &m_entries[0] : nullptr;
+}
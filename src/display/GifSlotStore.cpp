@@ -0,0 +1,439 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "display/GifSlotStore.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+
+#ifdef GIF_SLOT_STORE
+// Region reserved by ld/eagle.flash.4m2m.gifslots.ld, as memory-mapped addresses
+extern "C" uint32_t _GIF_SLOTS_start;
+extern "C" uint32_t _GIF_SLOTS_end;
+#endif
+
+// The first megabyte of flash is readable through the cache at this address
+static constexpr uintptr_t FLASH_MAP_BASE = 0x40200000;
+static constexpr uint32_t SLOT_TABLE_MAGIC = 0x534C4947;  // "GILS"
+static constexpr uint16_t SLOT_TABLE_VERSION = 1;
+static constexpr size_t WRITE_CHUNK_BYTES = 256;
+
+struct GifSlotTable {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    std::array<GifSlot, GifSlotStore::SLOT_MAX> slots;
+};
+
+static_assert(sizeof(GifSlotTable) % sizeof(uint32_t) == 0, "flash writes are word sized");
+static_assert(sizeof(GifSlotTable) <= GifSlotStore::SECTOR_BYTES, "slot table must fit its sector");
+
+struct GifSlotWrite {
+    bool active;
+    GifSlot slot;
+    uint32_t limit;
+    uint32_t flushed;
+    size_t staged;
+};
+
+static uint32_t s_base = 0;
+static uint32_t s_size = 0;
+static const uint8_t* s_mapped = nullptr;
+static GifSlotTable s_table{};
+static GifSlotWrite s_write{};
+alignas(uint32_t) static std::array<uint8_t, WRITE_CHUNK_BYTES> s_chunk{};
+
+/**
+ * @brief Rewrite the table sector from the RAM copy
+ *
+ * @return true if the sector was erased and written
+ */
+static auto saveTable() -> bool {
+    s_table.magic = SLOT_TABLE_MAGIC;
+    s_table.version = SLOT_TABLE_VERSION;
+
+    return ESP.flashEraseSector(s_base / GifSlotStore::SECTOR_BYTES) &&
+           ESP.flashWrite(s_base, reinterpret_cast<uint32_t*>(&s_table), sizeof(s_table));
+}
+
+/**
+ * @brief Check whether a slot table entry is usable in the current region
+ *
+ * @param slot Entry read from flash
+ *
+ * @return true if the entry has a terminated name and lies inside the data area
+ */
+static auto isValidSlot(const GifSlot& slot) -> bool {
+    const uint32_t dataStart = s_base + GifSlotStore::SECTOR_BYTES;
+
+    return slot.name[0] != '\0' && memchr(slot.name.data(), '\0', slot.name.size()) != nullptr &&
+           slot.offset >= dataStart && slot.offset % GifSlotStore::SECTOR_BYTES == 0 && slot.size > 0 &&
+           slot.size <= s_base + s_size - slot.offset;
+}
+
+/**
+ * @brief Compare two slots by flash offset
+ *
+ * @param lhs First slot
+ * @param rhs Second slot
+ *
+ * @return true if lhs is stored before rhs
+ */
+static auto slotBefore(const GifSlot& lhs, const GifSlot& rhs) -> bool { return lhs.offset < rhs.offset; }
+
+/**
+ * @brief Order slots by flash offset so free gaps can be found in one pass
+ *
+ * @return void
+ */
+static auto sortSlots() -> void { std::sort(s_table.slots.begin(), s_table.slots.begin() + s_table.count, slotBefore); }
+
+/**
+ * @brief Remove an entry from the RAM copy of the table, keeping the others ordered
+ *
+ * @param slot Entry of the table
+ *
+ * @return void
+ */
+static auto dropEntry(const GifSlot& slot) -> void {
+    const auto index = static_cast<size_t>(&slot - s_table.slots.data());
+    std::copy(s_table.slots.begin() + static_cast<ptrdiff_t>(index) + 1,
+              s_table.slots.begin() + s_table.count, s_table.slots.begin() + static_cast<ptrdiff_t>(index));
+    --s_table.count;
+    s_table.slots[s_table.count] = GifSlot{};
+}
+
+/**
+ * @brief Program the staged bytes, erasing each sector when the write enters it
+ *
+ * @return true if the chunk was written
+ */
+static auto flushChunk() -> bool {
+    if (s_write.staged == 0) {
+        return true;
+    }
+
+    // Pad the tail to a whole word, 0xFF leaves erased flash untouched
+    const size_t padded = (s_write.staged + sizeof(uint32_t) - 1U) & ~(sizeof(uint32_t) - 1U);
+    std::fill(s_chunk.begin() + static_cast<ptrdiff_t>(s_write.staged),
+              s_chunk.begin() + static_cast<ptrdiff_t>(padded), 0xFF);
+
+    const uint32_t address = s_write.slot.offset + s_write.flushed;
+    const uint32_t lastByte = address + static_cast<uint32_t>(padded) - 1U;
+    const uint32_t firstSector = (address + GifSlotStore::SECTOR_BYTES - 1U) / GifSlotStore::SECTOR_BYTES;
+    for (uint32_t sector = firstSector; sector <= lastByte / GifSlotStore::SECTOR_BYTES; ++sector) {
+        if (!ESP.flashEraseSector(sector)) {
+            return false;
+        }
+    }
+
+    if (!ESP.flashWrite(address, reinterpret_cast<uint32_t*>(s_chunk.data()), padded)) {
+        return false;
+    }
+
+    s_write.flushed += static_cast<uint32_t>(s_write.staged);
+    s_write.staged = 0;
+
+    return true;
+}
+
+/**
+ * @brief Attach the region reserved by the gifslots linker script
+ *
+ * @return true if the region exists in this build
+ */
+auto GifSlotStore::begin() -> bool {
+#ifdef GIF_SLOT_STORE
+    const auto start = reinterpret_cast<uintptr_t>(&_GIF_SLOTS_start);
+    const auto end = reinterpret_cast<uintptr_t>(&_GIF_SLOTS_end);
+
+    return begin(static_cast<uint32_t>(start - FLASH_MAP_BASE), static_cast<uint32_t>(end - start),
+                 reinterpret_cast<const uint8_t*>(start));
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Attach a flash region and load its slot table
+ *
+ * An unformatted region reads as an empty table, the table sector is only written on the first change
+ *
+ * @param flashOffset Sector-aligned flash offset of the region
+ * @param size Size of the region in bytes, at least two sectors
+ * @param mapped Address at which the region is readable through the flash cache
+ *
+ * @return true if the region is usable
+ */
+auto GifSlotStore::begin(uint32_t flashOffset, uint32_t size, const uint8_t* mapped) -> bool {
+    s_mapped = nullptr;
+    s_write = GifSlotWrite{};
+    s_table = GifSlotTable{};
+
+    if (mapped == nullptr || flashOffset % SECTOR_BYTES != 0 || size < 2U * SECTOR_BYTES) {
+        return false;
+    }
+
+    s_base = flashOffset;
+    s_size = size - size % SECTOR_BYTES;
+
+    if (!ESP.flashRead(s_base, reinterpret_cast<uint32_t*>(&s_table), sizeof(s_table))) {
+        return false;
+    }
+
+    if (s_table.magic != SLOT_TABLE_MAGIC || s_table.version != SLOT_TABLE_VERSION) {
+        s_table = GifSlotTable{};
+    }
+
+    s_mapped = mapped;
+
+    // Drop entries that do not fit this region (table written by a different layout)
+    size_t kept = 0;
+    for (size_t i = 0; i < std::min<size_t>(s_table.count, SLOT_MAX); ++i) {
+        if (isValidSlot(s_table.slots[i])) {
+            s_table.slots[kept++] = s_table.slots[i];
+        }
+    }
+    s_table.count = static_cast<uint16_t>(kept);
+    sortSlots();
+
+    return true;
+}
+
+/**
+ * @brief Check whether the store has a region attached
+ *
+ * @return true if slots can be read and written
+ */
+auto GifSlotStore::isAvailable() -> bool { return s_mapped != nullptr; }
+
+/**
+ * @brief Get the number of stored GIFs
+ *
+ * @return Number of slots in use
+ */
+auto GifSlotStore::count() -> size_t { return s_table.count; }
+
+/**
+ * @brief Get a slot by index, ordered by flash offset
+ *
+ * @param index Index below count()
+ *
+ * @return The slot entry
+ */
+auto GifSlotStore::slotAt(size_t index) -> const GifSlot& { return s_table.slots[index]; }
+
+/**
+ * @brief Find a slot by name
+ *
+ * @param name Slot name
+ *
+ * @return The slot entry or nullptr if there is none
+ */
+auto GifSlotStore::find(const String& name) -> const GifSlot* {
+    for (size_t i = 0; i < s_table.count; ++i) {
+        if (strcmp(s_table.slots[i].name.data(), name.c_str()) == 0) {
+            return &s_table.slots[i];
+        }
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Get the memory-mapped address of a slot
+ *
+ * @param slot Slot entry from this store
+ *
+ * @return Pointer into mapped flash, only readable with 32-bit aligned accesses
+ */
+auto GifSlotStore::data(const GifSlot& slot) -> const uint8_t* { return s_mapped + (slot.offset - s_base); }
+
+/**
+ * @brief Get the space available for GIF data
+ *
+ * @return Region size without the table sector, 0 when unavailable
+ */
+auto GifSlotStore::capacity() -> uint32_t { return isAvailable() ? s_size - SECTOR_BYTES : 0U; }
+
+/**
+ * @brief Find the largest free gap between slots
+ *
+ * @param gapStart Receives the flash offset of the gap
+ *
+ * @return Size of the gap in bytes
+ */
+static auto findLargestGap(uint32_t& gapStart) -> uint32_t {
+    uint32_t cursor = s_base + GifSlotStore::SECTOR_BYTES;
+    uint32_t best = 0;
+    gapStart = cursor;
+
+    for (size_t i = 0; i <= s_table.count; ++i) {
+        const uint32_t next = i < s_table.count ? s_table.slots[i].offset : s_base + s_size;
+        if (next > cursor && next - cursor > best) {
+            best = next - cursor;
+            gapStart = cursor;
+        }
+        if (i < s_table.count) {
+            const uint32_t end = s_table.slots[i].offset + s_table.slots[i].size;
+            cursor = std::max(cursor, (end + GifSlotStore::SECTOR_BYTES - 1U) & ~(GifSlotStore::SECTOR_BYTES - 1U));
+        }
+    }
+
+    return best;
+}
+
+/**
+ * @brief Get the largest GIF that can currently be written
+ *
+ * @return Size in bytes of the largest free gap
+ */
+auto GifSlotStore::largestFree() -> uint32_t {
+    if (!isAvailable()) {
+        return 0;
+    }
+
+    uint32_t gapStart = 0;
+
+    return findLargestGap(gapStart);
+}
+
+/**
+ * @brief Start writing a GIF into the largest free gap
+ *
+ * An existing slot with the same name stays in the table and readable until endWrite() replaces it,
+ * so a failed or aborted upload keeps the previous GIF
+ *
+ * @param name Slot name, 1 to 23 characters
+ *
+ * @return true if a write was started
+ */
+auto GifSlotStore::beginWrite(const String& name) -> bool {
+    if (!isAvailable() || s_write.active || name.isEmpty() || name.length() >= sizeof(GifSlot::name)) {
+        return false;
+    }
+
+    if (s_table.count >= SLOT_MAX && find(name) == nullptr) {
+        return false;
+    }
+
+    s_write = GifSlotWrite{};
+    const uint32_t gap = findLargestGap(s_write.slot.offset);
+    if (gap == 0) {
+        return false;
+    }
+
+    strncpy(s_write.slot.name.data(), name.c_str(), s_write.slot.name.size() - 1U);
+    s_write.limit = gap;
+    s_write.active = true;
+
+    return true;
+}
+
+/**
+ * @brief Append data to the GIF being written
+ *
+ * @param data Bytes to append
+ * @param len Number of bytes
+ *
+ * @return true if the data fits and was written, the write is aborted otherwise
+ */
+auto GifSlotStore::write(const uint8_t* data, size_t len) -> bool {
+    if (!s_write.active) {
+        return false;
+    }
+
+    if (len > s_write.limit - s_write.flushed - s_write.staged) {
+        abortWrite();
+
+        return false;
+    }
+
+    while (len > 0) {
+        const size_t chunk = std::min(len, s_chunk.size() - s_write.staged);
+        memcpy(s_chunk.data() + s_write.staged, data, chunk);
+        s_write.staged += chunk;
+        data += chunk;
+        len -= chunk;
+
+        if (s_write.staged == s_chunk.size() && !flushChunk()) {
+            abortWrite();
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Finish the GIF being written and record it in the slot table
+ *
+ * A slot with the same name is dropped in the same table write
+ *
+ * @return true if the slot was stored
+ */
+auto GifSlotStore::endWrite() -> bool {
+    if (!s_write.active) {
+        return false;
+    }
+
+    if (!flushChunk() || s_write.flushed == 0) {
+        abortWrite();
+
+        return false;
+    }
+
+    s_write.slot.size = s_write.flushed;
+    const GifSlot* replaced = find(String(s_write.slot.name.data()));
+    if (replaced != nullptr) {
+        dropEntry(*replaced);
+    }
+    s_table.slots[s_table.count++] = s_write.slot;
+    sortSlots();
+    s_write = GifSlotWrite{};
+
+    return saveTable();
+}
+
+/**
+ * @brief Drop the GIF being written, its sectors stay free
+ *
+ * @return void
+ */
+auto GifSlotStore::abortWrite() -> void { s_write = GifSlotWrite{}; }
+
+/**
+ * @brief Delete a slot, its data is left in place and overwritten by later writes
+ *
+ * @param name Slot name
+ *
+ * @return true if the slot existed and the table was saved
+ */
+auto GifSlotStore::remove(const String& name) -> bool {
+    const GifSlot* slot = find(name);
+    if (slot == nullptr) {
+        return false;
+    }
+
+    dropEntry(*slot);
+
+    return saveTable();
+}
@@ -0,0 +1,793 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "display/GifTranscoder.h"
+#include "display/DisplayManager.h"
+#include "display/Gif.h"
+#include "display/GifDecoder.h"
+#include "display/GifNative.h"
+#include "display/GifSlotStore.h"
+
+#include <AnimatedGIF.h>
+#include <LittleFS.h>
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+// Widest and tallest canvas converted, larger GIFs keep playing through the decoder
+static constexpr uint16_t TRANSCODE_MAX_SIDE = 240;
+
+// Unchanged pixels are tracked per block of a row, a block counts as unchanged when its hash is
+static constexpr uint16_t TRANSCODE_BLOCK_PX = 24;
+
+// Unchanged pixels between two changed runs are sent again when that is cheaper than another
+// address window (see GIF_WINDOW_COST_BYTES in Gif.cpp)
+static constexpr int TRANSCODE_MERGE_GAP_PX = 18;
+
+// Wait before retrying a conversion the heap had no room for
+static constexpr uint32_t TRANSCODE_RETRY_MS = 5000U;
+
+static constexpr size_t TRANSCODE_OUT_BYTES = 512;
+static constexpr size_t RLE_MAX_COUNT = GIF_NATIVE_COUNT_MASK + 1U;
+static constexpr size_t RLE_MIN_RUN = 3;
+
+// Panel background (LCD_BLACK), identical in either byte order
+static constexpr uint16_t TRANSCODE_BACKGROUND = 0x0000;
+static constexpr uint8_t GIF_DISPOSE_BACKGROUND = 2;
+
+static constexpr uint32_t FNV_OFFSET = 2166136261U;
+static constexpr uint32_t FNV_PRIME = 16777619U;
+
+// Per pixel state of the row being composed
+static constexpr uint8_t PIXEL_UNTOUCHED = 0;
+static constexpr uint8_t PIXEL_CHANGED = 1;
+static constexpr uint8_t PIXEL_UNCHANGED = 2;
+
+/**
+ * @brief Everything a conversion needs, allocated only while one runs
+ */
+struct GifTranscodeJob {
+    GifFrameDecoder decoder;
+    File gif;
+    File out;
+    String gifPath;
+    bool failed = false;
+
+    uint16_t canvasW = 0;
+    uint16_t canvasH = 0;
+    uint16_t blocksPerRow = 0;
+    uint32_t* blockHashes = nullptr;
+
+    GifNativeHeader header{};
+    GifNativeFrame frame{};
+    uint32_t frameStart = 0;
+    uint32_t written = 0;
+    bool inFrame = false;
+    bool solid = true;
+    int lastRowY = -1;
+    int minX = 0;
+    int maxX = 0;
+    int minY = 0;
+    int maxY = 0;
+
+    // Disposal state of the previous frame, applied exactly like Gif::gifDraw() does
+    bool havePrev = false;
+    uint8_t prevDisposal = 0;
+    bool prevTransparent = false;
+    int prevX = 0;
+    int prevY = 0;
+    int prevW = 0;
+    int prevH = 0;
+    uint8_t curDisposal = 0;
+    bool curTransparent = false;
+    int curX = 0;
+    int curY = 0;
+    int curW = 0;
+    int curH = 0;
+
+    std::array<uint16_t, TRANSCODE_MAX_SIDE> row{};
+    std::array<uint8_t, TRANSCODE_MAX_SIDE> state{};
+    std::array<GifNativeSpan, TRANSCODE_MAX_SIDE / 2U + 1U> spans{};
+    std::array<uint8_t, TRANSCODE_OUT_BYTES> outBuf{};
+    size_t outLen = 0;
+};
+
+enum class TranscodeStart : uint8_t { Started, Retry, Skip };
+
+static std::array<String, GifTranscoder::QUEUE_MAX> s_queue;
+static size_t s_count = 0;
+static GifTranscodeJob* s_job = nullptr;
+static uint32_t s_retryAtMs = 0;
+static bool s_autoScale = false;
+
+/**
+ * @brief Path the conversion is written to, renamed once complete
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return Temporary path next to the native file
+ */
+static auto tempPath(const String& gifPath) -> String { return GifNative::path(gifPath) + ".tmp"; }
+
+/**
+ * @brief Open the GIF for the conversion decoder
+ *
+ * @param fname The filename to open
+ * @param pSize Pointer to store the size of the file
+ *
+ * @return Handle to the opened file
+ */
+static auto transcodeOpen(const char* fname, int32_t* pSize) -> void* {
+    if (s_job == nullptr) {
+        return nullptr;
+    }
+
+    s_job->gif = LittleFS.open(fname, "r");
+    if (!s_job->gif) {
+        return nullptr;
+    }
+
+    *pSize = static_cast<int32_t>(s_job->gif.size());
+
+    return &s_job->gif;
+}
+
+/**
+ * @brief Close the GIF of the conversion decoder
+ *
+ * @param pHandle Handle from transcodeOpen()
+ */
+static void transcodeClose(void* pHandle) { static_cast<File*>(pHandle)->close(); }
+
+/**
+ * @brief Read from the GIF of the conversion decoder
+ *
+ * @param pFile Pointer to the GIFFILE structure
+ * @param pBuf Buffer to read data into
+ * @param iLen Number of bytes to read
+ *
+ * @return Number of bytes read
+ */
+static auto transcodeRead(GIFFILE* pFile, uint8_t* pBuf, int32_t iLen) -> int32_t {
+    auto* file = static_cast<File*>(pFile->fHandle);
+    const int32_t len = std::min(iLen, pFile->iSize - pFile->iPos);
+
+    if (file == nullptr || len <= 0) {
+        return 0;
+    }
+
+    if (file->position() != static_cast<size_t>(pFile->iPos)) {
+        (void)file->seek(static_cast<uint32_t>(pFile->iPos), SeekSet);
+    }
+
+    const auto got = static_cast<int32_t>(file->read(pBuf, static_cast<size_t>(len)));
+    pFile->iPos += got;
+
+    return got;
+}
+
+/**
+ * @brief Move the read position of the conversion decoder
+ *
+ * @param pFile Pointer to the GIFFILE structure
+ * @param iPosition New position
+ *
+ * @return Position after the seek
+ */
+static auto transcodeSeek(GIFFILE* pFile, int32_t iPosition) -> int32_t {
+    pFile->iPos = std::max(0, std::min(iPosition, pFile->iSize));
+
+    return pFile->iPos;
+}
+
+/**
+ * @brief Append bytes to the native file through the output buffer
+ *
+ * @param job Running conversion
+ * @param data Bytes to append
+ * @param len Number of bytes
+ */
+static void put(GifTranscodeJob& job, const void* data, size_t len) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    job.written += static_cast<uint32_t>(len);
+
+    while (len > 0) {
+        if (job.outLen == job.outBuf.size()) {
+            job.failed |= job.out.write(job.outBuf.data(), job.outLen) != job.outLen;
+            job.outLen = 0;
+        }
+
+        const size_t chunk = std::min(len, job.outBuf.size() - job.outLen);
+        memcpy(job.outBuf.data() + job.outLen, bytes, chunk);
+        job.outLen += chunk;
+        bytes += chunk;
+        len -= chunk;
+    }
+}
+
+/**
+ * @brief Write out whatever the output buffer holds
+ *
+ * @param job Running conversion
+ */
+static void flush(GifTranscodeJob& job) {
+    if (job.outLen > 0) {
+        job.failed |= job.out.write(job.outBuf.data(), job.outLen) != job.outLen;
+        job.outLen = 0;
+    }
+}
+
+/**
+ * @brief Append pixels as RLE packets: runs of three or more equal pixels, literals otherwise
+ *
+ * @param job Running conversion
+ * @param pixels Pixels in panel byte order
+ * @param len Number of pixels
+ */
+static void putRle(GifTranscodeJob& job, const uint16_t* pixels, size_t len) {
+    size_t pos = 0;
+
+    while (pos < len) {
+        size_t run = 1;
+        while (pos + run < len && run < RLE_MAX_COUNT && pixels[pos + run] == pixels[pos]) {
+            ++run;
+        }
+
+        if (run >= RLE_MIN_RUN) {
+            const auto packet = static_cast<uint8_t>(GIF_NATIVE_RUN | (run - 1U));
+            put(job, &packet, 1);
+            put(job, &pixels[pos], sizeof(uint16_t));
+            pos += run;
+            continue;
+        }
+
+        size_t end = pos;
+        while (end < len && end - pos < RLE_MAX_COUNT) {
+            if (end + 2U < len && pixels[end] == pixels[end + 1U] && pixels[end] == pixels[end + 2U]) {
+                break;
+            }
+            ++end;
+        }
+
+        const auto packet = static_cast<uint8_t>(end - pos - 1U);
+        put(job, &packet, 1);
+        put(job, &pixels[pos], (end - pos) * sizeof(uint16_t));
+        pos = end;
+    }
+}
+
+/**
+ * @brief Hash of a block of pixels, never 0 which marks a block whose content is unknown
+ *
+ * @param pixels First pixel of the block
+ * @param len Number of pixels
+ *
+ * @return Block hash
+ */
+static auto hashBlock(const uint16_t* pixels, size_t len) -> uint32_t {
+    uint32_t hash = FNV_OFFSET;
+
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ pixels[i]) * FNV_PRIME;
+    }
+
+    return hash != 0 ? hash : 1U;
+}
+
+/**
+ * @brief Start the record of the frame whose first line just arrived
+ *
+ * @param job Running conversion
+ */
+static void beginFrame(GifTranscodeJob& job) {
+    job.inFrame = true;
+    job.frame = GifNativeFrame{};
+    job.frameStart = job.written;
+    job.solid = true;
+    job.lastRowY = -1;
+    job.minX = job.canvasW;
+    job.maxX = 0;
+    job.minY = job.canvasH;
+    job.maxY = 0;
+
+    // Patched with the real counts once the frame is complete
+    put(job, &job.frame, sizeof(job.frame));
+}
+
+/**
+ * @brief Drop the pixels of blocks the panel already shows, remember the blocks this row changes
+ *
+ * @param job Running conversion
+ * @param canvasY Canvas row being composed
+ */
+static void markUnchangedBlocks(GifTranscodeJob& job, int canvasY) {
+    uint32_t* hashes = job.blockHashes + static_cast<size_t>(canvasY) * job.blocksPerRow;
+
+    for (uint16_t block = 0; block < job.blocksPerRow; ++block) {
+        const size_t start = static_cast<size_t>(block) * TRANSCODE_BLOCK_PX;
+        const size_t end = std::min<size_t>(start + TRANSCODE_BLOCK_PX, job.canvasW);
+        size_t changed = 0;
+
+        for (size_t x = start; x < end; ++x) {
+            changed += job.state[x] == PIXEL_CHANGED ? 1U : 0U;
+        }
+
+        if (changed == 0) {
+            continue;
+        }
+
+        // A partly written block no longer matches any hash, the next full write has to be sent
+        if (changed < end - start) {
+            hashes[block] = 0;
+            continue;
+        }
+
+        const uint32_t hash = hashBlock(&job.row[start], end - start);
+        if (hashes[block] == hash) {
+            std::fill(&job.state[start], &job.state[start] + (end - start), PIXEL_UNCHANGED);
+        } else {
+            hashes[block] = hash;
+        }
+    }
+}
+
+/**
+ * @brief Write the changed spans of a composed row
+ *
+ * @param job Running conversion
+ * @param canvasY Canvas row
+ */
+static void emitRow(GifTranscodeJob& job, int canvasY) {
+    const int width = job.canvasW;
+    size_t spanCount = 0;
+    int x = 0;
+
+    while (x < width) {
+        while (x < width && job.state[static_cast<size_t>(x)] != PIXEL_CHANGED) {
+            ++x;
+        }
+        if (x >= width) {
+            break;
+        }
+
+        const int start = x;
+        while (x < width) {
+            if (job.state[static_cast<size_t>(x)] == PIXEL_CHANGED) {
+                ++x;
+                continue;
+            }
+
+            // Unchanged pixels are known, a short stretch of them is cheaper to resend than a new window
+            int gapEnd = x;
+            while (gapEnd < width && job.state[static_cast<size_t>(gapEnd)] == PIXEL_UNCHANGED) {
+                ++gapEnd;
+            }
+            if (gapEnd < width && job.state[static_cast<size_t>(gapEnd)] == PIXEL_CHANGED &&
+                gapEnd - x <= TRANSCODE_MERGE_GAP_PX) {
+                x = gapEnd;
+                continue;
+            }
+            break;
+        }
+
+        job.spans[spanCount].x = static_cast<uint16_t>(start);
+        job.spans[spanCount].length = static_cast<uint16_t>(x - start);
+        ++spanCount;
+    }
+
+    if (spanCount == 0) {
+        return;
+    }
+
+    const GifNativeRow row{static_cast<uint16_t>(canvasY), static_cast<uint16_t>(spanCount)};
+    put(job, &row, sizeof(row));
+
+    for (size_t i = 0; i < spanCount; ++i) {
+        const GifNativeSpan& span = job.spans[i];
+        put(job, &span, sizeof(span));
+        putRle(job, &job.row[span.x], span.length);
+    }
+
+    // Solid frames are one full width span per row, on consecutive rows
+    const GifNativeSpan& first = job.spans[0];
+    job.solid = job.solid && spanCount == 1 &&
+                (job.lastRowY < 0 ||
+                 (canvasY == job.lastRowY + 1 && first.x == job.minX && first.x + first.length == job.maxX));
+    job.lastRowY = canvasY;
+    job.minX = std::min(job.minX, static_cast<int>(first.x));
+    job.maxX = std::max(job.maxX, static_cast<int>(job.spans[spanCount - 1U].x + job.spans[spanCount - 1U].length));
+    job.minY = std::min(job.minY, canvasY);
+    job.maxY = std::max(job.maxY, canvasY + 1);
+    ++job.frame.rowCount;
+}
+
+/**
+ * @brief Compose one decoded line like the GIF player draws it and store what it changes
+ *
+ * @param pDraw Pointer to the GIFDRAW structure, pUser is the running conversion
+ */
+static void transcodeDraw(GIFDRAW* pDraw) {
+    auto* job = static_cast<GifTranscodeJob*>(pDraw->pUser);
+    if (job == nullptr || job->failed) {
+        return;
+    }
+
+    if (pDraw->y == 0) {
+        beginFrame(*job);
+
+        job->curDisposal = pDraw->ucDisposalMethod;
+        job->curTransparent = pDraw->ucHasTransparency != 0;
+        job->curX = pDraw->iX;
+        job->curY = pDraw->iY;
+        job->curW = pDraw->iWidth;
+        job->curH = pDraw->iHeight;
+
+        if (job->header.frameCount == 0) {
+            job->header.firstX = static_cast<uint16_t>(pDraw->iX);
+            job->header.firstY = static_cast<uint16_t>(pDraw->iY);
+            job->header.firstWidth = static_cast<uint16_t>(pDraw->iWidth);
+            job->header.firstHeight = static_cast<uint16_t>(pDraw->iHeight);
+        }
+    }
+
+    const int canvasY = pDraw->iY + pDraw->y;
+    const int width = job->canvasW;
+    if (canvasY < 0 || canvasY >= job->canvasH) {
+        return;
+    }
+
+    job->state.fill(PIXEL_UNTOUCHED);
+
+    // Rows of the previous frame's rectangle start from the background when it asked for that
+    // (or was transparent), and opaque frames repaint their whole span
+    const bool clearLine = job->havePrev &&
+                           (job->prevDisposal == GIF_DISPOSE_BACKGROUND || job->prevTransparent) &&
+                           canvasY >= job->prevY && canvasY < job->prevY + job->prevH;
+
+    if (!job->curTransparent || clearLine) {
+        int start = pDraw->iX;
+        int end = pDraw->iX + pDraw->iWidth;
+        if (clearLine) {
+            start = std::min(start, job->prevX);
+            end = std::max(end, job->prevX + job->prevW);
+        }
+
+        for (int x = std::max(start, 0); x < std::min(end, width); ++x) {
+            job->row[static_cast<size_t>(x)] = TRANSCODE_BACKGROUND;
+            job->state[static_cast<size_t>(x)] = PIXEL_CHANGED;
+        }
+    }
+
+    const auto* palette = reinterpret_cast<const uint16_t*>(pDraw->pPalette);
+    for (int i = 0; i < pDraw->iWidth; ++i) {
+        const int x = pDraw->iX + i;
+        const uint8_t index = pDraw->pPixels[i];
+
+        if (x >= 0 && x < width && (!job->curTransparent || index != pDraw->ucTransparent)) {
+            job->row[static_cast<size_t>(x)] = palette[index];
+            job->state[static_cast<size_t>(x)] = PIXEL_CHANGED;
+        }
+    }
+
+    markUnchangedBlocks(*job, canvasY);
+    emitRow(*job, canvasY);
+}
+
+/**
+ * @brief Complete the record of the frame just decoded
+ *
+ * @param job Running conversion
+ * @param delayMs Frame delay reported by the decoder
+ */
+static void finishFrame(GifTranscodeJob& job, int delayMs) {
+    const bool drawn = job.inFrame;
+    if (!drawn) {
+        beginFrame(job);
+    }
+
+    job.frame.delayMs = static_cast<uint16_t>(std::min(std::max(delayMs, 0), static_cast<int>(UINT16_MAX)));
+    job.frame.bytes = job.written - job.frameStart - static_cast<uint32_t>(sizeof(GifNativeFrame));
+    if (job.frame.rowCount > 0) {
+        job.frame.x = static_cast<uint16_t>(job.minX);
+        job.frame.y = static_cast<uint16_t>(job.minY);
+        job.frame.width = static_cast<uint16_t>(job.maxX - job.minX);
+        job.frame.height = static_cast<uint16_t>(job.maxY - job.minY);
+        job.frame.flags = job.solid ? GIF_NATIVE_SOLID : 0U;
+    }
+
+    flush(job);
+    job.failed |= !job.out.seek(job.frameStart, SeekSet) ||
+                  job.out.write(reinterpret_cast<const uint8_t*>(&job.frame), sizeof(job.frame)) != sizeof(job.frame) ||
+                  !job.out.seek(0, SeekEnd);
+
+    if (drawn) {
+        job.havePrev = true;
+        job.prevDisposal = job.curDisposal;
+        job.prevTransparent = job.curTransparent;
+        job.prevX = job.curX;
+        job.prevY = job.curY;
+        job.prevW = job.curW;
+        job.prevH = job.curH;
+    }
+
+    job.inFrame = false;
+    ++job.header.frameCount;
+}
+
+/**
+ * @brief Free the running conversion, its temporary file is deleted unless it was renamed
+ *
+ * @return void
+ */
+static void endJob() {
+    if (s_job == nullptr) {
+        return;
+    }
+
+    s_job->decoder.close();
+    s_job->gif.close();
+    s_job->out.close();
+
+    const String tmp = tempPath(s_job->gifPath);
+    if (LittleFS.exists(tmp)) {
+        LittleFS.remove(tmp);
+    }
+
+    delete[] s_job->blockHashes;
+    delete s_job;
+    s_job = nullptr;
+}
+
+/**
+ * @brief Remove the first queued GIF
+ *
+ * @return void
+ */
+static void dropFront() {
+    for (size_t i = 1; i < s_count; ++i) {
+        s_queue[i - 1U] = s_queue[i];
+    }
+
+    if (s_count > 0) {
+        s_queue[--s_count] = "";
+    }
+}
+
+/**
+ * @brief Open the first queued GIF and the file it is converted to
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return Started, Retry when the heap is short, Skip when the GIF cannot be converted
+ */
+static auto startJob(const String& gifPath) -> TranscodeStart {
+    if (EspClass::getMaxFreeBlockSize() < sizeof(GifTranscodeJob) + DISPLAY_HEAP_RESERVE) {
+        return TranscodeStart::Retry;
+    }
+
+    s_job = new (std::nothrow) GifTranscodeJob();
+    if (s_job == nullptr) {
+        return TranscodeStart::Retry;
+    }
+
+    s_job->gifPath = gifPath;
+    s_job->decoder.begin(GIF_PALETTE_RGB565_BE);
+
+    if (s_job->decoder.open(gifPath.c_str(), transcodeOpen, transcodeClose, transcodeRead, transcodeSeek,
+                            transcodeDraw) == 0) {
+        endJob();
+
+        return TranscodeStart::Skip;
+    }
+
+    s_job->canvasW = static_cast<uint16_t>(s_job->decoder.getCanvasWidth());
+    s_job->canvasH = static_cast<uint16_t>(s_job->decoder.getCanvasHeight());
+    if (s_job->canvasW == 0 || s_job->canvasH == 0 || s_job->canvasW > TRANSCODE_MAX_SIDE ||
+        s_job->canvasH > TRANSCODE_MAX_SIDE) {
+        endJob();
+
+        return TranscodeStart::Skip;
+    }
+
+    // Native files are played unscaled, the player decodes GIFs it scales
+    const auto* gfx = DisplayManager::getGfx();
+    if (s_autoScale && gfx != nullptr) {
+        const GifScale scale = Gif::autoScale(s_job->canvasW, s_job->canvasH, gfx->width(), gfx->height());
+        if (scale.up != 1 || scale.down != 1) {
+            endJob();
+
+            return TranscodeStart::Skip;
+        }
+    }
+
+    s_job->blocksPerRow = static_cast<uint16_t>((s_job->canvasW + TRANSCODE_BLOCK_PX - 1U) / TRANSCODE_BLOCK_PX);
+    const size_t hashCount = static_cast<size_t>(s_job->blocksPerRow) * s_job->canvasH;
+
+    if (EspClass::getMaxFreeBlockSize() < hashCount * sizeof(uint32_t) + DISPLAY_HEAP_RESERVE) {
+        endJob();
+
+        return TranscodeStart::Retry;
+    }
+
+    s_job->blockHashes = new (std::nothrow) uint32_t[hashCount]();
+    s_job->out = LittleFS.open(tempPath(gifPath), "w");
+    if (s_job->blockHashes == nullptr || !s_job->out) {
+        endJob();
+
+        return TranscodeStart::Retry;
+    }
+
+    s_job->header.width = s_job->canvasW;
+    s_job->header.height = s_job->canvasH;
+    s_job->header.gifSize = static_cast<uint32_t>(s_job->gif.size());
+
+    // Written again, valid, once every frame is in
+    put(*s_job, &s_job->header, sizeof(s_job->header));
+
+    return TranscodeStart::Started;
+}
+
+/**
+ * @brief Write the final header and move the complete file in place
+ *
+ * @return true if the native file is ready to play
+ */
+static auto completeJob() -> bool {
+    GifTranscodeJob& job = *s_job;
+
+    job.header.magic = GifNative::MAGIC;
+    job.header.version = GifNative::VERSION;
+    flush(job);
+
+    const bool written =
+        !job.failed && job.header.frameCount > 0 && job.out.seek(0, SeekSet) &&
+        job.out.write(reinterpret_cast<const uint8_t*>(&job.header), sizeof(job.header)) == sizeof(job.header);
+    job.out.close();
+
+    if (!written) {
+        return false;
+    }
+
+    GifNative::remove(job.gifPath);
+
+    return LittleFS.rename(tempPath(job.gifPath), GifNative::path(job.gifPath));
+}
+
+/**
+ * @brief Queue a GIF for conversion, a GIF already queued keeps its place
+ *
+ * @param gifPath LittleFS path of the GIF, slot GIFs are not converted
+ *
+ * @return true if the GIF is queued
+ */
+auto GifTranscoder::enqueue(const String& gifPath) -> bool {
+    if (gifPath.isEmpty() || gifPath.startsWith(GIF_SLOT_PREFIX)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < s_count; ++i) {
+        if (s_queue[i] == gifPath) {
+            return true;
+        }
+    }
+
+    if (s_count >= QUEUE_MAX) {
+        return false;
+    }
+
+    s_queue[s_count++] = gifPath;
+
+    return true;
+}
+
+/**
+ * @brief Forget a GIF that is being replaced or deleted, stopping its conversion if it runs
+ *
+ * @param gifPath LittleFS path of the GIF
+ *
+ * @return void
+ */
+auto GifTranscoder::cancel(const String& gifPath) -> void {
+    if (s_job != nullptr && s_job->gifPath == gifPath) {
+        endJob();
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < s_count; ++i) {
+        if (s_queue[i] != gifPath) {
+            s_queue[kept++] = s_queue[i];
+        }
+    }
+
+    for (size_t i = kept; i < s_count; ++i) {
+        s_queue[i] = "";
+    }
+    s_count = kept;
+}
+
+/**
+ * @brief Convert one more frame of the first queued GIF, called from the main loop
+ *
+ * @param idle true when no GIF is playing; otherwise a running conversion is abandoned and
+ *             started again from the beginning on a later idle call
+ *
+ * @return void
+ */
+auto GifTranscoder::update(bool idle) -> void {
+    if (!idle) {
+        endJob();
+
+        return;
+    }
+
+    if (s_job == nullptr) {
+        if (s_count == 0 || static_cast<int32_t>(millis() - s_retryAtMs) < 0) {
+            return;
+        }
+
+        const TranscodeStart start = startJob(s_queue[0]);
+        if (start == TranscodeStart::Retry) {
+            s_retryAtMs = millis() + TRANSCODE_RETRY_MS;
+        } else if (start == TranscodeStart::Skip) {
+            dropFront();
+        }
+
+        return;
+    }
+
+    int delayMs = 0;
+    const int result = s_job->decoder.playFrame(false, &delayMs, s_job);
+
+    if (result >= 0) {
+        finishFrame(*s_job, delayMs);
+    }
+
+    if (result < 0 || s_job->failed) {
+        endJob();
+        dropFront();
+    } else if (result == 0) {
+        (void)completeJob();
+        endJob();
+        dropFront();
+    }
+
+    yield();
+}
+
+/**
+ * @brief Skip GIFs the player enlarges or decimates, their native file would never be played
+ *
+ * @param enabled true when the player scales automatically (see Gif::setAutoScaleEnabled)
+ *
+ * @return void
+ */
+auto GifTranscoder::setAutoScaleEnabled(bool enabled) -> void { s_autoScale = enabled; }
+
+/**
+ * @brief Get the number of GIFs waiting for conversion, the one being converted included
+ *
+ * @return Queue length
+ */
+auto GifTranscoder::pending() -> size_t { return s_count; }
+
+/**
+ * @brief Check whether a conversion is in progress
+ *
+ * @return true while a GIF is being converted
+ */
+auto GifTranscoder::isRunning() -> bool { return s_job != nullptr; }
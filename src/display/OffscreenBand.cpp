@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <array>
+
+#include "display/DisplayManager.h"
+#include "display/OffscreenBand.h"
+#include "display/TextRaster.h"
+
+// Bytes on the wire for VSCSAD + 2
+static constexpr uint32_t SCROLL_START_BYTES = 3;
+
+/**
+ * @brief Reserve the bottom rows of the screen as a band with hidden slots behind it
+ *
+ * Slot 0 is shown, the screen looks the same as before
+ *
+ * @param height Rows in the band, at most the hidden rows (80) so at least one hidden slot exists
+ *
+ * @return true if the band is set up, false on a bad height or a rotated screen
+ */
+auto OffscreenBand::begin(int16_t height) -> bool {
+    end();
+
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr || (gfx->getRotation() & 3U) != 0) {
+        return false;
+    }
+
+    const auto screenH = static_cast<int16_t>(gfx->height());
+    const auto hidden = static_cast<int16_t>(DisplayManager::PANEL_GRAM_ROWS - screenH);
+    if (height <= 0 || height > hidden || height > screenH) {
+        return false;
+    }
+
+    m_top = static_cast<int16_t>(screenH - height);
+    m_height = height;
+    m_width = static_cast<int16_t>(std::min<int>(gfx->width(), MAX_WIDTH));
+    m_slots = static_cast<uint8_t>(1 + hidden / height);
+    m_shown = 0;
+    m_stats = OffscreenBandStats{};
+
+    DisplayManager::setPanelScrollArea(m_top, static_cast<int16_t>(DisplayManager::PANEL_GRAM_ROWS - m_top));
+    DisplayManager::setPanelScrollStart(m_top);
+    m_active = true;
+
+    return true;
+}
+
+/**
+ * @brief Give the panel back its unscrolled layout, the band shows its own rows again
+ *
+ * @return void
+ */
+auto OffscreenBand::end() -> void {
+    if (!m_active) {
+        return;
+    }
+
+    m_active = false;
+    DisplayManager::setPanelScrollArea(0, DisplayManager::PANEL_GRAM_ROWS);
+    DisplayManager::setPanelScrollStart(0);
+}
+
+/**
+ * @brief Render text into a slot, vertically centred, in one address window
+ *
+ * Staging the slot on screen draws over what is shown, stage a hidden slot and show() it to swap
+ * without a visible redraw
+ *
+ * @param slot Slot to draw into
+ * @param xPos Left edge of the text
+ * @param text Text, wrapped on words, lines that do not fit the band are dropped
+ * @param textSize Integer text size
+ * @param fgColor Text colour (RGB565)
+ * @param bgColor Background colour (RGB565)
+ *
+ * @return true if drawn, false without a band, on a bad slot or no room for text
+ */
+auto OffscreenBand::stageText(uint8_t slot, int16_t xPos, const String& text, uint8_t textSize, uint16_t fgColor,
+                              uint16_t bgColor) -> bool {
+    if (!m_active || slot >= m_slots || textSize == 0 || xPos < 0) {
+        return false;
+    }
+
+    const int charW = TextRaster::CELL_W * textSize;
+    const int lineH = TextRaster::CELL_H * textSize;
+    const int maxChars = std::min((m_width - xPos) / charW, TextRaster::WRAP_MAX_CHARS - 1);
+    if (maxChars <= 0) {
+        return false;
+    }
+
+    TextRaster::Lines lines{};
+    const int maxLines = std::max(1, std::min(m_height / lineH, TextRaster::WRAP_MAX_LINES));
+    const int lineCount = TextRaster::wrap(text, maxChars, maxLines, lines);
+    const int textTop = std::max(0, (m_height - lineCount * lineH) / 2);
+
+    const uint16_t fg = toPanelOrder(fgColor);
+    const uint16_t bg = toPanelOrder(bgColor);
+    std::array<uint16_t, MAX_WIDTH> line{};
+
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    auto* tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+    tft->startWrite();
+    tft->writeAddrWindow(0, slotRow(slot), static_cast<uint16_t>(m_width), static_cast<uint16_t>(m_height));
+    for (int row = 0; row < m_height; ++row) {
+        const int textRow = row - textTop;
+        const int index = textRow >= 0 ? textRow / lineH : lineCount;
+
+        std::fill_n(line.data(), xPos, bg);
+        if (index < lineCount) {
+            TextRaster::rasterizeRow(lines[index].data(), TextRaster::WRAP_MAX_CHARS, textSize, textRow % lineH, fg,
+                                     bg, line.data() + xPos, m_width - xPos);
+        } else {
+            std::fill_n(line.data() + xPos, m_width - xPos, bg);
+        }
+        DisplayManager::writePanelPixels(line.data(), static_cast<uint32_t>(m_width));
+    }
+    tft->endWrite();
+
+    m_stats.stagedBytes +=
+        PANEL_ADDR_WINDOW_BYTES + static_cast<uint32_t>(m_width) * static_cast<uint32_t>(m_height) * 2U;
+
+    return true;
+}
+
+/**
+ * @brief Show a slot in the band by moving the scroll start address
+ *
+ * @param slot Slot to show, 0 for the band's own rows
+ *
+ * @return true if shown, false without a band or on a bad slot
+ */
+auto OffscreenBand::show(uint8_t slot) -> bool {
+    if (!m_active || slot >= m_slots) {
+        return false;
+    }
+
+    DisplayManager::setPanelScrollStart(slotRow(slot));
+    m_shown = slot;
+    ++m_stats.swaps;
+    m_stats.swapBytes += SCROLL_START_BYTES;
+
+    return true;
+}
+
+/**
+ * @brief Get the number of slots, the on-screen one included
+ *
+ * @return Slots of the band, 0 when inactive
+ */
+auto OffscreenBand::slots() const -> uint8_t { return m_active ? m_slots : 0; }
+
+/**
+ * @brief Get the slot the band shows
+ *
+ * @return Slot number, 0 for the band's own rows
+ */
+auto OffscreenBand::shownSlot() const -> uint8_t { return m_shown; }
+
+/**
+ * @brief Get the first GRAM row of a slot, for drawing into it with an address window
+ *
+ * @param slot Slot number
+ *
+ * @return GRAM row, slot 0 is the top of the band on screen and slot 1 the first hidden row
+ */
+auto OffscreenBand::slotRow(uint8_t slot) const -> int16_t { return static_cast<int16_t>(m_top + m_height * slot); }
+
+/**
+ * @brief Get the first screen row of the band
+ *
+ * @return Screen row
+ */
+auto OffscreenBand::top() const -> int16_t { return m_top; }
+
+/**
+ * @brief Check whether the band owns the panel's vertical scroll
+ *
+ * @return true between begin() and end()
+ */
+auto OffscreenBand::isActive() const -> bool { return m_active; }
+
+/**
+ * @brief Get the staging and swap counters since begin()
+ *
+ * @return Counters
+ */
+auto OffscreenBand::getStats() const -> const OffscreenBandStats& { return m_stats; }
@@ -0,0 +1,238 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+
+#include "display/DisplayManager.h"
+#include "display/ScrollTicker.h"
+
+// Bytes on the wire for VSCSAD + 2
+static constexpr uint32_t SCROLL_START_BYTES = 3;
+
+/**
+ * @brief Wrap the text into the band, clear it and hand it to the panel's vertical scroll
+ *
+ * The band starts empty, the text enters from the bottom edge
+ *
+ * @param xPos Left edge of the text inside the band
+ * @param top First screen row of the band
+ * @param height Rows in the band
+ * @param text Text to scroll, wrapped on words like drawTextWrapped
+ * @param textSize Integer text size
+ * @param fgColor Text colour (RGB565)
+ * @param bgColor Band colour (RGB565)
+ * @param rowsPerSecond Scroll speed in pixel rows per second, 1..MAX_ROWS_PER_SECOND
+ *
+ * @return true if the ticker runs, false on a band outside the screen, a rotated screen or no room for text
+ */
+auto ScrollTicker::begin(int16_t xPos, int16_t top, int16_t height, const String& text, uint8_t textSize,
+                         uint16_t fgColor, uint16_t bgColor, uint16_t rowsPerSecond) -> bool {
+    end();
+
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr || (gfx->getRotation() & 3U) != 0 || textSize == 0) {
+        return false;
+    }
+
+    m_width = static_cast<int16_t>(std::min<int>(gfx->width(), MAX_WIDTH));
+    const int charW = TextRaster::CELL_W * textSize;
+    const int maxChars = std::min((m_width - xPos) / charW, TextRaster::WRAP_MAX_CHARS - 1);
+    if (xPos < 0 || top < 0 || height <= 0 || top + height > gfx->height() || maxChars <= 0) {
+        return false;
+    }
+
+    TextRaster::Lines lines{};
+    const int lineCount = TextRaster::wrap(text, maxChars, TextRaster::WRAP_MAX_LINES, lines);
+
+    m_lines = "";
+    for (int i = 0; i < lineCount; ++i) {
+        m_lineStart[i] = static_cast<uint16_t>(m_lines.length());
+        m_lines += lines[i].data();
+    }
+    m_lineStart[lineCount] = static_cast<uint16_t>(m_lines.length());
+    m_lineCount = static_cast<uint8_t>(lineCount);
+
+    m_xPos = xPos;
+    m_top = top;
+    m_height = height;
+    m_textSize = textSize;
+    m_fgColor = toPanelOrder(fgColor);
+    m_bgColor = toPanelOrder(bgColor);
+    m_rowsPerSecond = std::min<uint16_t>(std::max<uint16_t>(rowsPerSecond, 1), MAX_ROWS_PER_SECOND);
+    m_contentRows = static_cast<uint32_t>(lineCount * TextRaster::CELL_H * textSize + height);
+    m_offset = 0;
+    m_nextRow = 0;
+    m_pendingRows = 0;
+    m_lastMs = millis();
+
+    m_stats = ScrollTickerStats{};
+    m_stats.redrawBytes = PANEL_ADDR_WINDOW_BYTES + static_cast<uint32_t>(m_width) * static_cast<uint32_t>(height) * 2U;
+
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    fillBand();
+    DisplayManager::setPanelScrollArea(top, height);
+    DisplayManager::setPanelScrollStart(top);
+    m_active = true;
+
+    return true;
+}
+
+/**
+ * @brief Stop scrolling, give the panel back its unscrolled layout and clear the band
+ *
+ * @return void
+ */
+auto ScrollTicker::end() -> void {
+    if (!m_active) {
+        return;
+    }
+
+    m_active = false;
+    DisplayManager::setPanelScrollArea(0, DisplayManager::PANEL_GRAM_ROWS);
+    DisplayManager::setPanelScrollStart(0);
+    fillBand();
+    m_lines = "";
+}
+
+/**
+ * @brief Scroll by as many rows as the speed allows since the last call, called from loop()
+ *
+ * @return void
+ */
+auto ScrollTicker::update() -> void {
+    if (!m_active) {
+        return;
+    }
+
+    const uint32_t nowMs = millis();
+    m_pendingRows += (nowMs - m_lastMs) * m_rowsPerSecond;
+    m_lastMs = nowMs;
+
+    const uint32_t rows = m_pendingRows / 1000U;
+    m_pendingRows %= 1000U;
+    if (rows > 0) {
+        scroll(static_cast<uint16_t>(std::min<uint32_t>(rows, static_cast<uint32_t>(m_height))));
+    }
+}
+
+/**
+ * @brief Move the band up by a number of rows
+ *
+ * The rows entering at the bottom are written over the GRAM rows leaving at the top, in one
+ * window, or two when they wrap around the end of the band, then the start address moves
+ *
+ * @param rows Rows to scroll, at most the band height
+ *
+ * @return void
+ */
+auto ScrollTicker::scroll(uint16_t rows) -> void {
+    if (!m_active || rows == 0) {
+        return;
+    }
+
+    rows = std::min<uint16_t>(rows, static_cast<uint16_t>(m_height));
+
+    auto* tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+    std::array<uint16_t, MAX_WIDTH> line{};
+    uint32_t bytes = 0;
+
+    tft->startWrite();
+    for (uint16_t written = 0; written < rows;) {
+        const auto run = std::min<uint16_t>(static_cast<uint16_t>(rows - written),
+                                            static_cast<uint16_t>(m_height - m_offset));
+        tft->writeAddrWindow(0, static_cast<int16_t>(m_top + m_offset), static_cast<uint16_t>(m_width), run);
+        bytes += PANEL_ADDR_WINDOW_BYTES;
+
+        for (uint16_t i = 0; i < run; ++i) {
+            renderRow(m_nextRow, line.data());
+            DisplayManager::writePanelPixels(line.data(), static_cast<uint32_t>(m_width));
+            bytes += static_cast<uint32_t>(m_width) * 2U;
+            m_nextRow = (m_nextRow + 1U) % m_contentRows;
+        }
+
+        m_offset = static_cast<uint16_t>((m_offset + run) % m_height);
+        written = static_cast<uint16_t>(written + run);
+    }
+    tft->endWrite();
+
+    DisplayManager::setPanelScrollStart(static_cast<int16_t>(m_top + m_offset));
+    bytes += SCROLL_START_BYTES;
+
+    ++m_stats.ticks;
+    m_stats.rows += rows;
+    m_stats.bytes += bytes;
+    m_stats.lastTickBytes = bytes;
+}
+
+/**
+ * @brief Check whether the ticker owns its band
+ *
+ * @return true between begin() and end()
+ */
+auto ScrollTicker::isActive() const -> bool { return m_active; }
+
+/**
+ * @brief Get the SPI cost of the ticker since begin()
+ *
+ * @return Tick counters and the cost of a full band redraw
+ */
+auto ScrollTicker::getStats() const -> const ScrollTickerStats& { return m_stats; }
+
+/**
+ * @brief Render one row of the looping text content in panel byte order
+ *
+ * @param row Content row, text lines first then the blank gap
+ * @param out Line buffer of m_width pixels
+ *
+ * @return void
+ */
+auto ScrollTicker::renderRow(uint32_t row, uint16_t* out) const -> void {
+    const uint32_t lineH = static_cast<uint32_t>(TextRaster::CELL_H) * m_textSize;
+    const uint32_t lineIndex = row / lineH;
+
+    std::fill_n(out, m_xPos, m_bgColor);
+    if (lineIndex >= m_lineCount) {
+        std::fill_n(out + m_xPos, m_width - m_xPos, m_bgColor);
+
+        return;
+    }
+
+    const char* text = m_lines.c_str() + m_lineStart[lineIndex];
+    const auto length = static_cast<size_t>(m_lineStart[lineIndex + 1] - m_lineStart[lineIndex]);
+    TextRaster::rasterizeRow(text, length, m_textSize, static_cast<int>(row % lineH), m_fgColor, m_bgColor,
+                             out + m_xPos, m_width - m_xPos);
+}
+
+/**
+ * @brief Paint the whole band in its background colour through one window
+ *
+ * @return void
+ */
+auto ScrollTicker::fillBand() -> void {
+    auto* tft = reinterpret_cast<Arduino_TFT*>(DisplayManager::getGfx());
+    std::array<uint16_t, MAX_WIDTH> line{};
+    std::fill_n(line.data(), m_width, m_bgColor);
+
+    tft->startWrite();
+    tft->writeAddrWindow(0, m_top, static_cast<uint16_t>(m_width), static_cast<uint16_t>(m_height));
+    for (int16_t row = 0; row < m_height; ++row) {
+        DisplayManager::writePanelPixels(line.data(), static_cast<uint32_t>(m_width));
+    }
+    tft->endWrite();
+}
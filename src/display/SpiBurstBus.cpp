@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <esp8266_peri.h>
+#include <ets_sys.h>
+#include <array>
+#include <cstring>
+
+#include "display/HotPath.h"
+#include "display/SpiBurstBus.h"
+
+// Refill the FIFO from the SPI transfer-done interrupt, SPI_BURST_POLLED leaves it to pump()/waitIdle()
+#ifdef SPI_BURST_POLLED
+static constexpr bool SPI_BURST_USE_ISR = false;
+#else
+static constexpr bool SPI_BURST_USE_ISR = true;
+#endif
+
+static constexpr uint32_t FIFO_WORDS = SpiBurstBus::FIFO_BYTES / sizeof(uint32_t);
+static constexpr uint32_t BITS_PER_BYTE = 8;
+
+static const uint8_t* volatile s_pending = nullptr;
+static volatile uint32_t s_pendingLen = 0;
+static uint32_t s_waitCycles = 0;
+
+/**
+ * @brief Program the number of MOSI bits for the next transfer
+ *
+ * Arduino_HWSPI changes the bit count for its own writes, so it is set again for every burst
+ *
+ * @param bits Number of bits to send (1..512)
+ *
+ * @return void
+ */
+static inline void IRAM_ATTR spiSetMosiBits(uint32_t bits) {
+    const uint32_t mask = ~((SPIMMOSI << SPILMOSI) | (SPIMMISO << SPILMISO));
+    const uint32_t value = bits - 1U;
+
+    SPI1U1 = (SPI1U1 & mask) | (value << SPILMOSI) | (value << SPILMISO);
+}
+
+/**
+ * @brief Load up to 64 bytes into SPI1W0..W15 and start the transfer
+ *
+ * @param data Bytes to send, in wire order
+ * @param len Number of bytes available
+ *
+ * @return Number of bytes queued
+ */
+static auto IRAM_ATTR spiLoadBurst(const uint8_t* data, uint32_t len) -> uint32_t {
+    volatile uint32_t* fifo = &SPI1W0;
+    const uint32_t chunk = (len > SpiBurstBus::FIFO_BYTES) ? SpiBurstBus::FIFO_BYTES : len;
+    const uint32_t words = (chunk + sizeof(uint32_t) - 1U) / sizeof(uint32_t);
+
+    spiSetMosiBits(chunk * BITS_PER_BYTE);
+
+    if ((reinterpret_cast<uintptr_t>(data) & (sizeof(uint32_t) - 1U)) == 0 && chunk == words * sizeof(uint32_t)) {
+        const auto* src = reinterpret_cast<const uint32_t*>(data);
+
+        for (uint32_t i = 0; i < words; ++i) {
+            fifo[i] = src[i];
+        }
+    } else {
+        std::array<uint32_t, FIFO_WORDS> staging{};
+        memcpy(staging.data(), data, chunk);
+
+        for (uint32_t i = 0; i < words; ++i) {
+            fifo[i] = staging[i];
+        }
+    }
+
+    SPI1S &= ~SPISTRIS;
+    SPI1CMD |= SPIBUSY;
+
+    return chunk;
+}
+
+/**
+ * @brief Mask the SPI interrupt while the queue is touched outside the ISR
+ *
+ * @return void
+ */
+static inline void HOT_PATH spiLock() {
+    if (SPI_BURST_USE_ISR) {
+        ETS_SPI_INTR_DISABLE();
+    }
+}
+
+/**
+ * @brief Unmask the SPI interrupt
+ *
+ * @return void
+ */
+static inline void HOT_PATH spiUnlock() {
+    if (SPI_BURST_USE_ISR) {
+        ETS_SPI_INTR_ENABLE();
+    }
+}
+
+/**
+ * @brief Start the next burst of the queued buffer if the FIFO is free
+ *
+ * Shared by the interrupt handler and the polling path, callers outside the ISR must mask the SPI interrupt
+ *
+ * @return void
+ */
+static inline void IRAM_ATTR spiRefill() {
+    if ((SPI1CMD & SPIBUSY) != 0) {
+        return;
+    }
+
+    if (s_pendingLen == 0) {
+        SPI1S &= ~SPISTRIE;
+
+        return;
+    }
+
+    const uint32_t sent = spiLoadBurst(s_pending, s_pendingLen);
+    s_pending += sent;
+    s_pendingLen -= sent;
+}
+
+/**
+ * @brief SPI interrupt handler, refills the FIFO when HSPI reports transfer done
+ *
+ * @param arg Unused
+ *
+ * @return void
+ */
+static void IRAM_ATTR spiBurstIsr(void* arg) {
+    (void)arg;
+
+    if ((SPIIR & (1U << SPII1)) == 0) {
+        return;
+    }
+
+    SPI1S &= ~SPISTRIS;
+    spiRefill();
+}
+
+/**
+ * @brief Attach the HSPI transfer-done interrupt used by writeBytesAsync()
+ *
+ * @return void
+ */
+auto SpiBurstBus::begin() -> void {
+    if (SPI_BURST_USE_ISR) {
+        ETS_SPI_INTR_ATTACH(spiBurstIsr, nullptr);
+        ETS_SPI_INTR_ENABLE();
+    }
+}
+
+/**
+ * @brief Refill the FIFO from the calling context, for use between decoder steps
+ *
+ * @return void
+ */
+auto HOT_PATH SpiBurstBus::pump() -> void {
+    if (s_pendingLen == 0) {
+        return;
+    }
+
+    spiLock();
+    spiRefill();
+    spiUnlock();
+}
+
+/**
+ * @brief Check whether the queued buffer has completely left the FIFO
+ *
+ * @return true if no transfer is pending or running
+ */
+auto HOT_PATH SpiBurstBus::isIdle() -> bool { return s_pendingLen == 0 && (SPI1CMD & SPIBUSY) == 0; }
+
+/**
+ * @brief Busy-wait until the queued buffer and the current burst have left the FIFO
+ *
+ * Time spent here is CPU time the decoder could not overlap with the transfer, it is
+ * accumulated and reported by waitCycles()
+ *
+ * @return void
+ */
+auto HOT_PATH SpiBurstBus::waitIdle() -> void {
+    if (isIdle()) {
+        return;
+    }
+
+    const uint32_t start = EspClass::getCycleCount();
+
+    while (!isIdle()) {
+        pump();
+    }
+
+    s_waitCycles += EspClass::getCycleCount() - start;
+}
+
+/**
+ * @brief Total CPU cycles spent waiting for the FIFO since boot (wraps)
+ *
+ * @return Cycle count
+ */
+auto SpiBurstBus::waitCycles() -> uint32_t { return s_waitCycles; }
+
+/**
+ * @brief Queue a buffer and return once its first burst is on the wire
+ *
+ * @param data Bytes to send, in wire order, must stay valid until the bus is idle again
+ * @param len Number of bytes to send
+ *
+ * @return void
+ */
+auto HOT_PATH SpiBurstBus::writeBytesAsync(const uint8_t* data, uint32_t len) -> void {
+    waitIdle();
+
+    if (len == 0) {
+        return;
+    }
+
+    spiLock();
+
+    const uint32_t sent = spiLoadBurst(data, len);
+    s_pending = data + sent;
+    s_pendingLen = len - sent;
+
+    if (SPI_BURST_USE_ISR && s_pendingLen != 0) {
+        SPI1S |= SPISTRIE;
+    }
+
+    spiUnlock();
+}
+
+/**
+ * @brief Send a byte buffer through the HSPI FIFO in 64-byte bursts
+ *
+ * The call returns once the last burst has been shifted out so DC can be toggled safely
+ *
+ * @param data Bytes to send, in wire order
+ * @param len Number of bytes to send
+ *
+ * @return void
+ */
+auto HOT_PATH SpiBurstBus::writeBytes(const uint8_t* data, uint32_t len) -> void {
+    writeBytesAsync(data, len);
+    waitIdle();
+}
@@ -0,0 +1,430 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "display/DisplayManager.h"
+#include "display/TextRaster.h"
+
+using WrapLine = std::array<char, TextRaster::WRAP_MAX_CHARS>;
+
+static constexpr char GLYPH_FIRST = 0x20;
+static constexpr char GLYPH_LAST = 0x7E;
+static constexpr int GLYPH_COLUMNS = 5;
+static constexpr int GLYPH_ROWS = 7;
+
+// Printable ASCII, five columns per glyph, bit 0 is the top row
+static const uint8_t GLYPHS[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+    0x00, 0x00, 0x5F, 0x00, 0x00,  // '!'
+    0x00, 0x07, 0x00, 0x07, 0x00,  // '"'
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  // '#'
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  // '$'
+    0x23, 0x13, 0x08, 0x64, 0x62,  // '%'
+    0x36, 0x49, 0x55, 0x22, 0x50,  // '&'
+    0x00, 0x05, 0x03, 0x00, 0x00,  // '\''
+    0x00, 0x1C, 0x22, 0x41, 0x00,  // '('
+    0x00, 0x41, 0x22, 0x1C, 0x00,  // ')'
+    0x08, 0x2A, 0x1C, 0x2A, 0x08,  // '*'
+    0x08, 0x08, 0x3E, 0x08, 0x08,  // '+'
+    0x00, 0x50, 0x30, 0x00, 0x00,  // ','
+    0x08, 0x08, 0x08, 0x08, 0x08,  // '-'
+    0x00, 0x60, 0x60, 0x00, 0x00,  // '.'
+    0x20, 0x10, 0x08, 0x04, 0x02,  // '/'
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  // '0'
+    0x00, 0x42, 0x7F, 0x40, 0x00,  // '1'
+    0x42, 0x61, 0x51, 0x49, 0x46,  // '2'
+    0x21, 0x41, 0x45, 0x4B, 0x31,  // '3'
+    0x18, 0x14, 0x12, 0x7F, 0x10,  // '4'
+    0x27, 0x45, 0x45, 0x45, 0x39,  // '5'
+    0x3C, 0x4A, 0x49, 0x49, 0x30,  // '6'
+    0x01, 0x71, 0x09, 0x05, 0x03,  // '7'
+    0x36, 0x49, 0x49, 0x49, 0x36,  // '8'
+    0x06, 0x49, 0x49, 0x29, 0x1E,  // '9'
+    0x00, 0x36, 0x36, 0x00, 0x00,  // ':'
+    0x00, 0x56, 0x36, 0x00, 0x00,  // ';'
+    0x08, 0x14, 0x22, 0x41, 0x00,  // '<'
+    0x14, 0x14, 0x14, 0x14, 0x14,  // '='
+    0x00, 0x41, 0x22, 0x14, 0x08,  // '>'
+    0x02, 0x01, 0x51, 0x09, 0x06,  // '?'
+    0x32, 0x49, 0x79, 0x41, 0x3E,  // '@'
+    0x7E, 0x11, 0x11, 0x11, 0x7E,  // 'A'
+    0x7F, 0x49, 0x49, 0x49, 0x36,  // 'B'
+    0x3E, 0x41, 0x41, 0x41, 0x22,  // 'C'
+    0x7F, 0x41, 0x41, 0x22, 0x1C,  // 'D'
+    0x7F, 0x49, 0x49, 0x49, 0x41,  // 'E'
+    0x7F, 0x09, 0x09, 0x09, 0x01,  // 'F'
+    0x3E, 0x41, 0x49, 0x49, 0x7A,  // 'G'
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  // 'H'
+    0x00, 0x41, 0x7F, 0x41, 0x00,  // 'I'
+    0x20, 0x40, 0x41, 0x3F, 0x01,  // 'J'
+    0x7F, 0x08, 0x14, 0x22, 0x41,  // 'K'
+    0x7F, 0x40, 0x40, 0x40, 0x40,  // 'L'
+    0x7F, 0x02, 0x0C, 0x02, 0x7F,  // 'M'
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  // 'N'
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  // 'O'
+    0x7F, 0x09, 0x09, 0x09, 0x06,  // 'P'
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  // 'Q'
+    0x7F, 0x09, 0x19, 0x29, 0x46,  // 'R'
+    0x46, 0x49, 0x49, 0x49, 0x31,  // 'S'
+    0x01, 0x01, 0x7F, 0x01, 0x01,  // 'T'
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  // 'U'
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  // 'V'
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  // 'W'
+    0x63, 0x14, 0x08, 0x14, 0x63,  // 'X'
+    0x07, 0x08, 0x70, 0x08, 0x07,  // 'Y'
+    0x61, 0x51, 0x49, 0x45, 0x43,  // 'Z'
+    0x00, 0x7F, 0x41, 0x41, 0x00,  // '['
+    0x02, 0x04, 0x08, 0x10, 0x20,  // '\\'
+    0x00, 0x41, 0x41, 0x7F, 0x00,  // ']'
+    0x04, 0x02, 0x01, 0x02, 0x04,  // '^'
+    0x40, 0x40, 0x40, 0x40, 0x40,  // '_'
+    0x00, 0x01, 0x02, 0x04, 0x00,  // '`'
+    0x20, 0x54, 0x54, 0x54, 0x78,  // 'a'
+    0x7F, 0x48, 0x44, 0x44, 0x38,  // 'b'
+    0x38, 0x44, 0x44, 0x44, 0x20,  // 'c'
+    0x38, 0x44, 0x44, 0x48, 0x7F,  // 'd'
+    0x38, 0x54, 0x54, 0x54, 0x18,  // 'e'
+    0x08, 0x7E, 0x09, 0x01, 0x02,  // 'f'
+    0x0C, 0x52, 0x52, 0x52, 0x3E,  // 'g'
+    0x7F, 0x08, 0x04, 0x04, 0x78,  // 'h'
+    0x00, 0x44, 0x7D, 0x40, 0x00,  // 'i'
+    0x20, 0x40, 0x44, 0x3D, 0x00,  // 'j'
+    0x7F, 0x10, 0x28, 0x44, 0x00,  // 'k'
+    0x00, 0x41, 0x7F, 0x40, 0x00,  // 'l'
+    0x7C, 0x04, 0x18, 0x04, 0x78,  // 'm'
+    0x7C, 0x08, 0x04, 0x04, 0x78,  // 'n'
+    0x38, 0x44, 0x44, 0x44, 0x38,  // 'o'
+    0x7C, 0x14, 0x14, 0x14, 0x08,  // 'p'
+    0x08, 0x14, 0x14, 0x18, 0x7C,  // 'q'
+    0x7C, 0x08, 0x04, 0x04, 0x08,  // 'r'
+    0x48, 0x54, 0x54, 0x54, 0x20,  // 's'
+    0x04, 0x3F, 0x44, 0x40, 0x20,  // 't'
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  // 'u'
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  // 'v'
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  // 'w'
+    0x44, 0x28, 0x10, 0x28, 0x44,  // 'x'
+    0x0C, 0x50, 0x50, 0x50, 0x3C,  // 'y'
+    0x44, 0x64, 0x54, 0x4C, 0x44,  // 'z'
+    0x00, 0x08, 0x36, 0x41, 0x00,  // '{'
+    0x00, 0x00, 0x7F, 0x00, 0x00,  // '|'
+    0x00, 0x41, 0x36, 0x08, 0x00,  // '}'
+    0x08, 0x04, 0x04, 0x08, 0x04,  // '~'
+};
+
+/**
+ * @brief Push the current line buffer into the output lines array
+ *
+ * @param outLines The output lines array
+ * @param lineBuf The current line buffer
+ * @param lineLen The current line length
+ * @param lineCount The current line count
+ * @param maxLines The maximum number of lines allowed
+ *
+ * @return void
+ */
+static void wrapPushLine(TextRaster::Lines& outLines, WrapLine& lineBuf, int& lineLen, int& lineCount, int maxLines) {
+    if (lineCount >= maxLines) {
+        return;
+    }
+
+    lineBuf[lineLen] = '\0';
+    strncpy(outLines[lineCount].data(), lineBuf.data(), TextRaster::WRAP_MAX_CHARS - 1);
+    outLines[lineCount][TextRaster::WRAP_MAX_CHARS - 1] = '\0';
+    ++lineCount;
+
+    lineLen = 0;
+    lineBuf[0] = '\0';
+}
+
+/**
+ * @brief Append a word to the current line buffer, wrapping if necessary
+ *
+ * @param outLines The output lines array
+ * @param lineBuf The current line buffer
+ * @param lineLen The current line length
+ * @param wordBuf The word buffer to append
+ * @param wordLen The word length
+ * @param maxCharsPerLine The maximum characters per line
+ * @param lineCount The current line count
+ * @param maxLines The maximum number of lines allowed
+ *
+ * @return void
+ */
+static void wrapAppendWord(TextRaster::Lines& outLines, WrapLine& lineBuf, int& lineLen, WrapLine& wordBuf,
+                           int& wordLen, int maxCharsPerLine, int& lineCount, int maxLines) {
+    if (wordLen == 0) {
+        return;
+    }
+
+    if (wordLen > maxCharsPerLine) {
+        if (lineLen != 0) {
+            wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
+            if (lineCount >= maxLines) {
+                wordLen = 0;
+
+                return;
+            }
+        }
+        int copyLen = (wordLen > maxCharsPerLine) ? maxCharsPerLine : wordLen;
+        memcpy(lineBuf.data(), wordBuf.data(), static_cast<size_t>(copyLen));
+        lineLen = copyLen;
+        wordLen = 0;
+        wordBuf[0] = '\0';
+
+        return;
+    }
+    if (lineLen == 0) {
+        memcpy(lineBuf.data(), wordBuf.data(), static_cast<size_t>(wordLen));
+        lineLen = wordLen;
+        wordLen = 0;
+        wordBuf[0] = '\0';
+
+        return;
+    }
+    if ((lineLen + 1 + wordLen) <= maxCharsPerLine) {
+        lineBuf[lineLen] = ' ';
+        memcpy(lineBuf.data() + lineLen + 1, wordBuf.data(), static_cast<size_t>(wordLen));
+        lineLen += 1 + wordLen;
+        wordLen = 0;
+        wordBuf[0] = '\0';
+
+        return;
+    }
+    wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
+    if (lineCount >= maxLines) {
+        wordLen = 0;
+
+        return;
+    }
+
+    memcpy(lineBuf.data(), wordBuf.data(), static_cast<size_t>(wordLen));
+    lineLen = wordLen;
+    wordLen = 0;
+    wordBuf[0] = '\0';
+}
+
+/**
+ * @brief Wrap text into lines fitting within max characters and lines
+ *
+ * @param text The input text to wrap
+ * @param maxCharsPerLine Maximum characters allowed per line
+ * @param maxLines Maximum number of lines allowed
+ * @param outLines Output array to hold the wrapped lines
+ *
+ * @return The number of lines used
+ */
+auto TextRaster::wrap(const String& text, int maxCharsPerLine, int maxLines, Lines& outLines) -> int {
+    int lineCount = 0;
+
+    for (auto& row : outLines) {
+        row[0] = '\0';
+    }
+
+    WrapLine lineBuf{};
+    WrapLine wordBuf{};
+    int lineLen = 0;
+    int wordLen = 0;
+
+    for (uint32_t i = 0; i < text.length(); ++i) {
+        char chr = text.charAt(i);
+
+        if (chr == '\r') {
+            continue;
+        }
+
+        if (chr == '\n') {
+            wrapAppendWord(outLines, lineBuf, lineLen, wordBuf, wordLen, maxCharsPerLine, lineCount, maxLines);
+            wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
+
+            if (lineCount >= maxLines) {
+                break;
+            }
+
+            continue;
+        }
+
+        if (chr == ' ' || chr == '\t') {
+            wrapAppendWord(outLines, lineBuf, lineLen, wordBuf, wordLen, maxCharsPerLine, lineCount, maxLines);
+
+            if (lineCount >= maxLines) {
+                break;
+            }
+
+            continue;
+        }
+
+        if (wordLen + 1 < WRAP_MAX_CHARS) {
+            wordBuf[wordLen++] = chr;
+            wordBuf[wordLen] = '\0';
+        }
+    }
+
+    wrapAppendWord(outLines, lineBuf, lineLen, wordBuf, wordLen, maxCharsPerLine, lineCount, maxLines);
+
+    if (lineLen != 0 && lineCount < maxLines) {
+        wrapPushLine(outLines, lineBuf, lineLen, lineCount, maxLines);
+    }
+
+    if (lineCount == 0) {
+        outLines[0][0] = '\0';
+        lineCount = 1;
+    }
+
+    return lineCount;
+}
+
+/**
+ * @brief Get one column of a glyph
+ *
+ * @param chr Character, anything outside printable ASCII is drawn as '?'
+ * @param column Column 0..4, the spacing column 5 and anything else is empty
+ *
+ * @return Column bits, bit 0 is the top row
+ */
+auto TextRaster::glyphColumn(char chr, int column) -> uint8_t {
+    if (column < 0 || column >= GLYPH_COLUMNS) {
+        return 0;
+    }
+    if (chr < GLYPH_FIRST || chr > GLYPH_LAST) {
+        chr = '?';
+    }
+
+    return pgm_read_byte(&GLYPHS[(chr - GLYPH_FIRST) * GLYPH_COLUMNS + column]);
+}
+
+/**
+ * @brief Render one pixel row of a text line into a line buffer
+ *
+ * The buffer is filled with the background first, text past its end is cut off. Colours are
+ * stored as given, so pass them in the byte order the buffer is sent in
+ *
+ * @param text Characters of the line
+ * @param length Characters to draw, a null character ends the line earlier
+ * @param scale Integer text size, each font pixel becomes scale x scale pixels
+ * @param row Pixel row inside the line, 0..CELL_H * scale - 1
+ * @param fgColor Glyph colour
+ * @param bgColor Background colour
+ * @param out Line buffer
+ * @param width Pixels in the line buffer
+ */
+auto TextRaster::rasterizeRow(const char* text, size_t length, uint8_t scale, int row, uint16_t fgColor,
+                              uint16_t bgColor, uint16_t* out, int width) -> void {
+    std::fill_n(out, width, bgColor);
+    if (scale == 0 || row < 0) {
+        return;
+    }
+
+    const int glyphRow = row / scale;
+    if (glyphRow >= GLYPH_ROWS) {
+        return;
+    }
+
+    const auto mask = static_cast<uint8_t>(1U << glyphRow);
+    int xPos = 0;
+    for (size_t i = 0; i < length && text[i] != '\0' && xPos < width; ++i) {
+        for (int column = 0; column < GLYPH_COLUMNS; ++column) {
+            if ((glyphColumn(text[i], column) & mask) == 0) {
+                continue;
+            }
+            const int start = xPos + column * scale;
+            const int end = std::min(start + static_cast<int>(scale), width);
+            if (start < end) {
+                std::fill(out + start, out + end, fgColor);
+            }
+        }
+        xPos += CELL_W * scale;
+    }
+}
+
+/**
+ * @brief Draw one line of text through a single address window
+ *
+ * The line is composed in RAM, glyph cells on the background, and pushed with one transfer when
+ * its strip fits STRIP_MAX_BYTES and the heap, else row by row through the same window. Each
+ * glyph row is rasterized once and repeated for the scaled rows
+ *
+ * @param xPos Left column
+ * @param yPos Top row
+ * @param text Characters of the line, null terminated
+ * @param scale Integer text size
+ * @param fgColor Glyph colour (RGB565)
+ * @param bgColor Background colour (RGB565)
+ * @param minWidth Width to pad the line to with the background, 0 for the text cells only
+ *
+ * @return Bytes sent to the panel, 0 if nothing of the line is on screen
+ */
+auto TextRaster::drawLine(int16_t xPos, int16_t yPos, const char* text, uint8_t scale, uint16_t fgColor,
+                          uint16_t bgColor, int16_t minWidth) -> uint32_t {
+    auto* gfx = DisplayManager::getGfx();
+    if (gfx == nullptr || text == nullptr || scale == 0 || xPos < 0 || yPos < 0) {
+        return 0;
+    }
+
+    const size_t length = strlen(text);
+    const int textW = static_cast<int>(length) * CELL_W * scale;
+    const int screenW = std::min<int>(gfx->width(), MAX_WIDTH);
+    const int width = std::min(std::max(textW, static_cast<int>(minWidth)), screenW - xPos);
+    const int height = std::min(CELL_H * scale, static_cast<int>(gfx->height()) - yPos);
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+
+    const uint16_t fg = toPanelOrder(fgColor);
+    const uint16_t bg = toPanelOrder(bgColor);
+    const auto rowPixels = static_cast<size_t>(width);
+    const uint32_t pixels = static_cast<uint32_t>(width) * static_cast<uint32_t>(height);
+
+    uint16_t* strip = nullptr;
+    if (pixels * 2U <= STRIP_MAX_BYTES && EspClass::getMaxFreeBlockSize() >= pixels * 2U + DISPLAY_HEAP_RESERVE) {
+        strip = new (std::nothrow) uint16_t[pixels];
+    }
+
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    auto* tft = reinterpret_cast<Arduino_TFT*>(gfx);
+    tft->startWrite();
+    tft->writeAddrWindow(xPos, yPos, static_cast<uint16_t>(width), static_cast<uint16_t>(height));
+
+    if (strip != nullptr) {
+        for (int row = 0; row < height; ++row) {
+            uint16_t* line = strip + static_cast<size_t>(row) * rowPixels;
+            if (row % scale == 0) {
+                rasterizeRow(text, length, scale, row, fg, bg, line, width);
+            } else {
+                std::copy_n(line - rowPixels, rowPixels, line);
+            }
+        }
+        DisplayManager::writePanelPixels(strip, pixels);
+        delete[] strip;
+    } else {
+        std::array<uint16_t, MAX_WIDTH> line{};
+        for (int row = 0; row < height; ++row) {
+            if (row % scale == 0) {
+                rasterizeRow(text, length, scale, row, fg, bg, line.data(), width);
+            }
+            DisplayManager::writePanelPixels(line.data(), static_cast<uint32_t>(width));
+        }
+    }
+
+    tft->endWrite();
+
+    return PANEL_ADDR_WINDOW_BYTES + pixels * 2U;
+}
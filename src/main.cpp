@@ -28,6 +28,8 @@
 #include "config/ConfigManager.h"
 #include "wireless/WiFiManager.h"
 #include "display/DisplayManager.h"
+#include "display/GifCatalog.h"
+#include "display/GifSlotStore.h"
 #include "web/Webserver.h"
 #include "web/Api.h"
 #include "ntp/NTPClient.h"
@@ -100,6 +102,14 @@ void setup() {
 
     step++;
 
+    if (GifSlotStore::begin()) {
+        Logger::info(("GIF slot store: " + String(static_cast<unsigned>(GifSlotStore::count())) + " slots").c_str());
+    }
+
+    if (!GifCatalog::begin()) {
+        Logger::warn("GIF catalogue unavailable");
+    }
+
     SecureStorage::setSalt(KV_SALT);
 
     if (configManager.secure.begin()) {
@@ -184,13 +194,15 @@ void loop() {
         last_free_heap_log = now;
         char freeBuf[FREE_BUF_SIZE];
         char initBuf[FREE_BUF_SIZE];
+        char gifBuf[FREE_BUF_SIZE];
         char msgBuf[MSG_BUF_SIZE];
 
         formatBytes(ESP.getFreeHeap(), freeBuf,  // NOLINT(readability-static-accessed-through-instance)
                     sizeof(freeBuf));
         formatBytes(initial_free_heap, initBuf, sizeof(initBuf));
+        formatBytes(Gif::reservedBytes(), gifBuf, sizeof(gifBuf));
 
-        snprintf(msgBuf, sizeof(msgBuf), "Free heap: %s (initial: %s)", freeBuf, initBuf);
+        snprintf(msgBuf, sizeof(msgBuf), "Free heap: %s (initial: %s, GIF reserved: %s)", freeBuf, initBuf, gifBuf);
         Logger::info(msgBuf);
     }
 
@@ -21,10 +21,20 @@
 #include <Logger.h>
 #include <ArduinoJson.h>
 #include <Updater.h>
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
 
 #include "web/Webserver.h"
 #include "web/Api.h"
 #include "display/DisplayManager.h"
+#include "display/GifCatalog.h"
+#include "display/GifFrameIndex.h"
+#include "display/GifNative.h"
+#include "display/GifSlotStore.h"
+#include "display/GifTranscoder.h"
+#include "display/HotPath.h"
 
 #include "config/ConfigManager.h"
 #include "wireless/WiFiManager.h"
@@ -134,6 +144,95 @@ void registerApiEndpoints(Webserver* webserver) {
     // @openapi {get} /gif version=v1 group=GIF summary="List GIFs" requiresAuth=true responses=200:application/json,401:application/json
     webserver->raw().on("/api/v1/gif", HTTP_GET, [webserver]() { handleListGifs(webserver); });
 
+    // @openapi {get} /gif/stats version=v1 group=GIF summary="Get GIF pipeline statistics" requiresAuth=true
+    // responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/stats", HTTP_GET, [webserver]() { handleGifStats(webserver); });
+
+    // @openapi {get} /gif/queue version=v1 group=GIF summary="List the GIF playback queue" requiresAuth=true
+    // responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/queue", HTTP_GET, [webserver]() { handleGifQueueList(webserver); });
+
+    // @openapi {post} /gif/queue version=v1 group=GIF summary="Append a GIF, or every GIF in /gif and /gifs sorted by path, to the playback queue"
+    // requiresAuth=true requestBody=application/json requestBodySchema=name:string,all:boolean,durationMs:integer,loops:integer,repeat:boolean
+    // example={"name":"animation.gif","durationMs":10000,"loops":0}
+    // responses=200:application/json,400:application/json,401:application/json,404:application/json
+    webserver->raw().on("/api/v1/gif/queue", HTTP_POST, [webserver]() { handleGifQueueAdd(webserver); });
+
+    // @openapi {delete} /gif/queue version=v1 group=GIF summary="Stop playback and empty the GIF queue"
+    // requiresAuth=true responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/queue", HTTP_DELETE, [webserver]() { handleGifQueueClear(webserver); });
+
+    // @openapi {post} /gif/queue/skip version=v1 group=GIF summary="Skip to the next queued GIF" requiresAuth=true
+    // responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/queue/skip", HTTP_POST, [webserver]() { handleGifQueueSkip(webserver); });
+
+    // @openapi {post} /gif/seek version=v1 group=GIF summary="Jump to a frame of the GIF playing (indexed files only)"
+    // requiresAuth=true requestBody=application/json requestBodySchema=frame:integer example={"frame":12}
+    // responses=200:application/json,400:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/seek", HTTP_POST, [webserver]() { handleGifSeek(webserver); });
+
+    // @openapi {post} /gif/speed version=v1 group=GIF summary="Set GIF playback speed (0.5 to 4)" requiresAuth=true
+    // requestBody=application/json requestBodySchema=speed:number example={"speed":2}
+    // responses=200:application/json,400:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/speed", HTTP_POST, [webserver]() { handleGifSpeed(webserver); });
+
+    // @openapi {get} /gif/slots version=v1 group=GIF summary="List GIFs stored in the raw flash slot region"
+    // requiresAuth=true responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/gif/slots", HTTP_GET, [webserver]() { handleGifSlotList(webserver); });
+
+    // @openapi {post} /gif/slots version=v1 group=GIF summary="Upload a GIF to a raw flash slot" requiresAuth=true
+    // requestBody=multipart/form-data responses=200:application/json,400:application/json,401:application/json
+    webserver->raw().on(
+        "/api/v1/gif/slots", HTTP_POST, [webserver]() { handleGifSlotUpload(webserver); },
+        [webserver]() { handleGifSlotUpload(webserver); });
+
+    // @openapi {delete} /gif/slots version=v1 group=GIF summary="Delete a raw flash GIF slot" requiresAuth=true
+    // requestBody=application/json requestBodySchema=name:string example={"name":"animation.gif"}
+    // responses=200:application/json,400:application/json,401:application/json,404:application/json
+    webserver->raw().on("/api/v1/gif/slots", HTTP_DELETE, [webserver]() { handleGifSlotDelete(webserver); });
+
+    // @openapi {post} /display/ticker version=v1 group=Display summary="Scroll text through a band of the screen"
+    // requiresAuth=true requestBody=application/json requestBodySchema=text:string,y:integer,height:integer,size:integer,speed:integer
+    // example={"text":"Build 42 passed","y":96,"height":48,"size":2,"speed":40}
+    // responses=200:application/json,400:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/ticker", HTTP_POST, [webserver]() { handleTickerStart(webserver); });
+
+    // @openapi {delete} /display/ticker version=v1 group=Display summary="Stop the scrolling ticker" requiresAuth=true
+    // responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/ticker", HTTP_DELETE, [webserver]() { handleTickerStop(webserver); });
+
+    // @openapi {get} /display/ticker version=v1 group=Display summary="Get ticker state and SPI cost per tick"
+    // requiresAuth=true responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/ticker", HTTP_GET, [webserver]() { handleTickerStatus(webserver); });
+
+    // @openapi {post} /display/status version=v1 group=Display summary="Swap in a status bar at the bottom of the screen"
+    // requiresAuth=true requestBody=application/json requestBodySchema=text:string example={"text":"3 new messages"}
+    // responses=200:application/json,400:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/status", HTTP_POST, [webserver]() { handleStatusBarShow(webserver); });
+
+    // @openapi {delete} /display/status version=v1 group=Display summary="Take the status bar down" requiresAuth=true
+    // responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/status", HTTP_DELETE, [webserver]() { handleStatusBarHide(webserver); });
+
+    // @openapi {get} /display/status version=v1 group=Display summary="Get status bar slots and swap cost"
+    // requiresAuth=true responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/status", HTTP_GET, [webserver]() { handleStatusBarStatus(webserver); });
+
+    // @openapi {post} /display/overlay version=v1 group=Display summary="Add an overlay or update its text"
+    // requiresAuth=true requestBody=application/json requestBodySchema=type:string,id:integer,text:string,x:integer,y:integer,width:integer,height:integer,chars:integer,size:integer
+    // example={"type":"text","text":"12:34","x":150,"y":8,"chars":5,"size":2}
+    // responses=200:application/json,400:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/overlay", HTTP_POST, [webserver]() { handleOverlaySet(webserver); });
+
+    // @openapi {delete} /display/overlay version=v1 group=Display summary="Remove one overlay, or all without an id"
+    // requiresAuth=true requestBody=application/json requestBodySchema=id:integer example={"id":0}
+    // responses=200:application/json,400:application/json,401:application/json,404:application/json
+    webserver->raw().on("/api/v1/display/overlay", HTTP_DELETE, [webserver]() { handleOverlayRemove(webserver); });
+
+    // @openapi {get} /display/overlay version=v1 group=Display summary="Get overlay layers and composition counters"
+    // requiresAuth=true responses=200:application/json,401:application/json
+    webserver->raw().on("/api/v1/display/overlay", HTTP_GET, [webserver]() { handleOverlayStatus(webserver); });
+
     // @openapi {get} /token/check version=v1 group=Authentication summary="Check bearer token validity"
     // requiresAuth=true responses=200:application/json,401:application/json
     webserver->raw().on("/api/v1/token/check", HTTP_GET, [webserver]() { handleTokenCheck(webserver); });
@@ -364,7 +463,7 @@ void handleOtaCancel(Webserver* webserver) {
 }
 
 /**
- * @brief List GIF files and FS info
+ * @brief List GIF files from the catalogue and FS info
  * @param webserver Pointer to the Webserver instance
  *
  * @return void
@@ -381,16 +480,25 @@ void handleListGifs(Webserver* webserver) {
     size_t totalBytes = 0;
 
     if (LittleFS.begin()) {
-        Dir dir = LittleFS.openDir("/gif");
+        GifCatalogCursor cursor;
+        GifCatalogEntry entry{};
+
+        if (GifCatalog::openCursor(cursor) || (GifCatalog::rebuild() && GifCatalog::openCursor(cursor))) {
+            while (GifCatalog::next(cursor, entry)) {
+                if (entry.dir != GIF_CATALOG_DIR_GIF) {
+                    continue;
+                }
 
-        while (dir.next()) {
-            String name = dir.fileName();
-            if (name.endsWith(".gif") || name.endsWith(".GIF")) {
                 JsonObject fileObj = files.add<JsonObject>();
 
-                fileObj["name"] = name;            // NOLINT(readability-misplaced-array-index)
-                fileObj["size"] = dir.fileSize();  // NOLINT(readability-misplaced-array-index)
-                usedBytes += dir.fileSize();
+                fileObj["name"] = entry.name.data();       // NOLINT(readability-misplaced-array-index)
+                fileObj["size"] = entry.size;              // NOLINT(readability-misplaced-array-index)
+                fileObj["width"] = entry.width;            // NOLINT(readability-misplaced-array-index)
+                fileObj["height"] = entry.height;          // NOLINT(readability-misplaced-array-index)
+                fileObj["frames"] = entry.frameCount;      // NOLINT(readability-misplaced-array-index)
+                fileObj["durationMs"] = entry.durationMs;  // NOLINT(readability-misplaced-array-index)
+                fileObj["hash"] = entry.hash;              // NOLINT(readability-misplaced-array-index)
+                usedBytes += entry.size;
             }
         }
 
@@ -432,6 +540,10 @@ void handleGifUploadStart(const String& currentFilename, File& gifFile, bool& up
         }
     }
 
+    // The transcoded copy of a file being replaced is stale from now on
+    GifTranscoder::cancel(currentFilename);
+    GifNative::remove(currentFilename);
+
     gifFile = LittleFS.open(currentFilename, "w");
     if (!gifFile) {
         uploadError = true;
@@ -484,6 +596,19 @@ void handleGifUploadEnd(const String& currentFilename, File& gifFile) {
         gifFile.close();
     }
 
+    if (!GifFrameIndex::build(currentFilename)) {
+        Logger::warn((String("No frame index for: ") + currentFilename).c_str(), "API::GIF");
+    }
+
+    if (!GifCatalog::upsert(currentFilename)) {
+        Logger::warn((String("Not catalogued: ") + currentFilename).c_str(), "API::GIF");
+    }
+
+    // Converted once the screen is idle, played from the converted file from then on
+    if (!GifTranscoder::enqueue(currentFilename)) {
+        Logger::warn((String("Transcode queue full, skipped: ") + currentFilename).c_str(), "API::GIF");
+    }
+
     Logger::info((String("Gif upload end: ") + currentFilename).c_str(), "API::GIF");
 }
 
@@ -505,6 +630,11 @@ void handleGifUploadAborted(const String& currentFilename, File& gifFile, bool&
     }
 
     if (!currentFilename.isEmpty()) {
+        // The upload truncated any file of the same name, its catalogue entry is gone with it
+        (void)GifCatalog::remove(currentFilename);
+        GifTranscoder::cancel(currentFilename);
+        GifNative::remove(currentFilename);
+
         if (LittleFS.remove(currentFilename)) {
             Logger::warn((String("Removed incomplete file: ") + currentFilename).c_str(), "API::GIF");
         } else {
@@ -892,6 +1022,30 @@ void handleOtaFinished(Webserver* webserver) {
     }
 }
 
+/**
+ * @brief Find a GIF by file name in /gifs or /gif, or by slot name as slot:<name>
+ *
+ * Files are looked up in the GIF catalogue, nothing is probed on LittleFS
+ *
+ * @param name File name, any directory part is ignored
+ *
+ * @return The LittleFS path or slot path, or an empty string if the GIF does not exist
+ */
+static auto resolveGifPath(const char* name) -> String {
+    String filename(name);
+
+    if (filename.startsWith(GIF_SLOT_PREFIX)) {
+        return GifSlotStore::find(filename.substring(strlen(GIF_SLOT_PREFIX))) != nullptr ? filename : String("");
+    }
+
+    filename.replace("\\", "/");
+    filename = filename.substring(filename.lastIndexOf('/') + 1);
+
+    GifCatalogEntry entry{};
+
+    return GifCatalog::find(filename, entry) ? GifCatalog::path(entry) : String("");
+}
+
 /**
  * @brief Play a GIF from LittleFS full screen
  *
@@ -939,19 +1093,9 @@ void handlePlayGif(Webserver* webserver) {
         return;
     }
 
-    String filename(name);
-    filename.replace("\\", "/");
-    filename = filename.substring(filename.lastIndexOf('/') + 1);
-
-    String path1 = String("/gifs/") + filename;
-    String path2 = String("/gif/") + filename;
-    String foundPath;
+    String foundPath = resolveGifPath(name);
 
-    if (LittleFS.exists(path1)) {
-        foundPath = path1;
-    } else if (LittleFS.exists(path2)) {
-        foundPath = path2;
-    } else {
+    if (foundPath.isEmpty()) {
         JsonDocument resp;
 
         resp["status"] = "error";
@@ -1002,6 +1146,336 @@ void handleStopGif(Webserver* webserver) {
     webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
 }
 
+/**
+ * @brief Add the rolling averages and 95th percentiles of a GIF frame cost window to a response
+ *
+ * @param out Object to fill
+ * @param timing File or session window
+ *
+ * @return void
+ */
+static void addGifTiming(JsonObject out, const GifFrameStats& timing) {
+    out["frames"] = timing.frames();
+    out["lateFrames"] = timing.lateFrames();
+    out["droppedFrames"] = timing.droppedFrames();
+    out["window"] = static_cast<uint32_t>(timing.samples());
+    out["fps"] = timing.fps(GifFrameMetric::IntervalMs);
+    out["requestedFps"] = timing.fps(GifFrameMetric::DelayMs);
+
+    static constexpr std::array<std::pair<const char*, GifFrameMetric>, 8> METRICS = {{
+        {"decodeUs", GifFrameMetric::DecodeUs},
+        {"spiUs", GifFrameMetric::SpiUs},
+        {"yieldUs", GifFrameMetric::YieldUs},
+        {"windows", GifFrameMetric::Windows},
+        {"bytes", GifFrameMetric::Bytes},
+        {"intervalMs", GifFrameMetric::IntervalMs},
+        {"delayMs", GifFrameMetric::DelayMs},
+        {"lateMs", GifFrameMetric::LateMs},
+    }};
+    for (const auto& [name, metric] : METRICS) {
+        const GifMetricSummary summary = timing.summarize(metric);
+        JsonObject entry = out[name].to<JsonObject>();
+        entry["avg"] = summary.avg;
+        entry["p95"] = summary.p95;
+    }
+}
+
+/**
+ * @brief Report how much of each GIF frame the CPU spent waiting on the panel SPI bus and how well
+ * frames kept to their deadlines
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifStats(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const GifPipelineStats stats = DisplayManager::getGifPipelineStats();
+
+    JsonDocument resp;
+    resp["frames"] = stats.frames;
+    resp["streamedFrames"] = stats.streamedFrames;
+    resp["lastFrameCycles"] = stats.lastFrameCycles;
+    resp["lastIdleCycles"] = stats.lastIdleCycles;
+    resp["avgFrameCycles"] = stats.frames > 0 ? static_cast<uint32_t>(stats.totalFrameCycles / stats.frames) : 0U;
+    resp["avgIdleCyclesPerFrame"] = stats.frames > 0 ? static_cast<uint32_t>(stats.totalIdleCycles / stats.frames) : 0U;
+    resp["idlePercent"] = stats.totalFrameCycles > 0
+                              ? static_cast<uint32_t>((stats.totalIdleCycles * 100U) / stats.totalFrameCycles)
+                              : 0U;
+    resp["lastSkippedRows"] = stats.lastSkippedRows;
+    resp["lastSkippedBytes"] = stats.lastSkippedBytes;
+    resp["avgSkippedBytesPerFrame"] =
+        stats.frames > 0 ? static_cast<uint32_t>(stats.totalSkippedBytes / stats.frames) : 0U;
+    resp["totalSkippedRows"] = static_cast<uint32_t>(stats.totalSkippedRows);
+    resp["panelColorMode"] = DisplayManager::getPanelColorMode() == PanelColorMode::Rgb444 ? "rgb444" : "rgb565";
+    resp["rgb444PaletteBuilds"] = stats.rgb444PaletteBuilds;
+
+    // Schedule adherence: lateness of drawn frames against their deadline, jitter is its mean
+    resp["lateFrames"] = stats.lateFrames;
+    resp["droppedFrames"] = stats.droppedFrames;
+    resp["resyncs"] = stats.resyncs;
+    resp["lastLateMs"] = stats.lastLateMs;
+    resp["maxLateMs"] = stats.maxLateMs;
+    resp["avgJitterMs"] = stats.frames > 0 ? static_cast<float>(stats.totalLateMs) / stats.frames : 0.0F;
+
+    // Adaptive quality: interlaced frames only send every other row while playback cannot keep up
+    resp["qualityMode"] = stats.interlaced ? "interlaced" : "full";
+    resp["interlacedFrames"] = stats.interlacedFrames;
+    resp["degradedMs"] = static_cast<uint32_t>(stats.degradedMs);
+
+    // LittleFS traffic behind the decoder, per decoded frame (drawn or dropped)
+    const uint64_t decodedFrames = static_cast<uint64_t>(stats.frames) + stats.droppedFrames;
+    const char* readTier = "direct";
+    if (stats.readTier == GifReadTier::Ram) {
+        readTier = "ram";
+    } else if (stats.readTier == GifReadTier::ReadAhead) {
+        readTier = "readahead";
+    } else if (stats.readTier == GifReadTier::Flash) {
+        readTier = "flash";
+    }
+    resp["readTier"] = readTier;
+    resp["fileReadCalls"] = static_cast<uint32_t>(stats.fileReadCalls);
+    resp["fileReadCallsPerFrame"] =
+        decodedFrames > 0 ? static_cast<float>(stats.fileReadCalls) / static_cast<float>(decodedFrames) : 0.0F;
+    resp["fileReadBytesPerFrame"] =
+        decodedFrames > 0 ? static_cast<uint32_t>(stats.fileReadBytes / decodedFrames) : 0U;
+
+    // Position from the frame index, frameCount is 0 when the file has none (no seek, loops reopen it)
+    const GifPosition position = DisplayManager::getGifPosition();
+    resp["frame"] = position.frame;
+    resp["frameCount"] = position.frameCount;
+    resp["speed"] = static_cast<float>(position.speedPercent) / 100.0F;
+    resp["indexRewinds"] = stats.indexRewinds;
+
+    // Integer scale picked for the file, above 1 enlarged, below 1 decimated
+    const GifScale scale = DisplayManager::getGifScale();
+    resp["scale"] = static_cast<float>(scale.up) / static_cast<float>(scale.down);
+
+    // Frames played from transcoded files, and uploads still waiting to be transcoded
+    resp["nativeFrames"] = stats.nativeFrames;
+    resp["transcodeQueue"] = static_cast<uint32_t>(GifTranscoder::pending());
+
+    // Decoder, line and read buffers reserved at boot, never taken from the heap
+    resp["reservedBytes"] = static_cast<uint32_t>(Gif::reservedBytes());
+
+    // Where the per-line drawing code runs from, DISPLAY_IRAM_HOT_PATH builds report "iram"
+    resp["hotPath"] = HOT_PATH_IN_IRAM ? "iram" : "flash";
+
+    // Frame rate the draw path alone could sustain, before GIF delays are applied
+    const uint32_t cyclesPerSecond = static_cast<uint32_t>(ESP.getCpuFreqMHz()) * 1000000U;
+    resp["maxFps"] = stats.lastFrameCycles > 0 ? static_cast<float>(cyclesPerSecond) / stats.lastFrameCycles : 0.0F;
+
+    // Per frame cost split into decode, SPI and yield time over the last frames drawn, for the file
+    // playing and for everything played since boot
+    addGifTiming(resp["file"].to<JsonObject>(), DisplayManager::getGifFileTiming());
+    addGifTiming(resp["session"].to<JsonObject>(), DisplayManager::getGifSessionTiming());
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief List the GIF playback queue, the first entry is the one playing
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifQueueList(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const GifPlaylist& playlist = DisplayManager::getGifPlaylist();
+
+    JsonDocument resp;
+    resp["playing"] = playlist.isActive();
+    resp["repeat"] = playlist.isRepeat();
+    resp["capacity"] = GifPlaylist::QUEUE_MAX;
+
+    JsonArray entries = resp["entries"].to<JsonArray>();
+    for (size_t i = 0; i < playlist.size(); ++i) {
+        const GifQueueEntry& entry = playlist.entryAt(i);
+        JsonObject entryObj = entries.add<JsonObject>();
+
+        entryObj["file"] = entry.path;            // NOLINT(readability-misplaced-array-index)
+        entryObj["durationMs"] = entry.durationMs;  // NOLINT(readability-misplaced-array-index)
+        entryObj["loops"] = entry.loops;            // NOLINT(readability-misplaced-array-index)
+    }
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief Append a GIF to the playback queue, or with "all" every catalogued GIF of /gif and /gifs
+ *
+ * loops is the number of plays (0 = until durationMs or a skip), durationMs caps the time on screen.
+ * The catalogue lists GIFs in hash order, "all" queues them sorted by path
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifQueueAdd(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    String body = webserver->raw().arg("plain");
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, body);
+
+    if (err) {
+        JsonDocument resp;
+        resp["status"] = "error";
+        resp["message"] = "invalid json";
+
+        String jsonOut;
+        serializeJson(resp, jsonOut);
+
+        setCorsHeaders(webserver);
+        webserver->raw().send(HTTP_CODE_BAD_REQUEST, "application/json", jsonOut);
+
+        return;
+    }
+
+    GifQueueEntry entry;
+    entry.durationMs = doc["durationMs"] | 0U;
+    entry.loops = doc["loops"] | static_cast<uint16_t>(entry.durationMs > 0 ? 0U : 1U);
+
+    if (!doc["repeat"].isNull()) {
+        DisplayManager::setGifQueueRepeat(doc["repeat"].as<bool>());
+    }
+
+    std::vector<String> paths;
+    const char* name = doc["name"];
+
+    if (doc["all"] | false) {
+        GifCatalogCursor cursor;
+        GifCatalogEntry catalogued{};
+
+        if (GifCatalog::openCursor(cursor)) {
+            while (GifCatalog::next(cursor, catalogued)) {
+                paths.push_back(GifCatalog::path(catalogued));
+            }
+        }
+        std::sort(paths.begin(), paths.end());
+    } else if (name != nullptr && strlen(name) > 0) {
+        String foundPath = resolveGifPath(name);
+
+        if (foundPath.isEmpty()) {
+            JsonDocument resp;
+            resp["status"] = "error";
+            resp["message"] = "file not found";
+
+            String jsonOut;
+            serializeJson(resp, jsonOut);
+
+            setCorsHeaders(webserver);
+            webserver->raw().send(HTTP_CODE_NOT_FOUND, "application/json", jsonOut);
+
+            return;
+        }
+
+        paths.push_back(foundPath);
+    } else if (doc["repeat"].isNull()) {
+        JsonDocument resp;
+        resp["status"] = "error";
+        resp["message"] = "missing name";
+
+        String jsonOut;
+        serializeJson(resp, jsonOut);
+
+        setCorsHeaders(webserver);
+        webserver->raw().send(HTTP_CODE_BAD_REQUEST, "application/json", jsonOut);
+
+        return;
+    }
+
+    size_t queued = 0;
+    for (const String& path : paths) {
+        entry.path = path;
+        if (!DisplayManager::enqueueGif(entry)) {
+            break;
+        }
+        ++queued;
+    }
+
+    JsonDocument resp;
+    resp["status"] = queued == paths.size() ? "queued" : "queue full";
+    resp["queued"] = queued;
+    resp["size"] = DisplayManager::getGifPlaylist().size();
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(queued == paths.size() ? HTTP_CODE_OK : HTTP_CODE_BAD_REQUEST, "application/json", jsonOut);
+}
+
+/**
+ * @brief Stop GIF playback and empty the queue
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifQueueClear(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    DisplayManager::stopGif();
+
+    JsonDocument resp;
+    resp["status"] = "cleared";
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief End the current GIF and start the next queued one
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifQueueSkip(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const bool playing = DisplayManager::skipGif();
+
+    JsonDocument resp;
+    resp["status"] = playing ? "playing" : "idle";
+
+    const GifPlaylist& playlist = DisplayManager::getGifPlaylist();
+    if (playing && playlist.size() > 0) {
+        resp["file"] = playlist.entryAt(0).path;
+    }
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
 /**
  * @brief Delete a GIF file from storage
  */
@@ -1066,6 +1540,11 @@ void handleDeleteGif(Webserver* webserver) {
     }
 
     if (LittleFS.remove(path)) {
+        GifFrameIndex::remove(path);
+        (void)GifCatalog::remove(path);
+        GifTranscoder::cancel(path);
+        GifNative::remove(path);
+
         JsonDocument resp;
         resp["status"] = "success";
         resp["message"] = "file removed";
@@ -1093,6 +1572,538 @@ void handleDeleteGif(Webserver* webserver) {
     }
 }
 
+/**
+ * @brief Send a status/message JSON reply for the GIF slot and playback control endpoints
+ *
+ * @param webserver Pointer to the Webserver instance
+ * @param code HTTP status code
+ * @param status Value of the status field
+ * @param message Value of the message field
+ *
+ * @return void
+ */
+static void sendGifReply(Webserver* webserver, int code, const char* status, const char* message) {
+    JsonDocument resp;
+    resp["status"] = status;
+    resp["message"] = message;
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(code, "application/json", jsonOut);
+}
+
+/**
+ * @brief List the GIFs stored in the raw flash slot region
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifSlotList(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument resp;
+    resp["available"] = GifSlotStore::isAvailable();
+    resp["capacity"] = GifSlotStore::capacity();
+    resp["largestFree"] = GifSlotStore::largestFree();
+    resp["maxSlots"] = GifSlotStore::SLOT_MAX;
+
+    JsonArray slots = resp["slots"].to<JsonArray>();
+    for (size_t i = 0; i < GifSlotStore::count(); ++i) {
+        const GifSlot& slot = GifSlotStore::slotAt(i);
+        JsonObject entry = slots.add<JsonObject>();
+        entry["name"] = slot.name.data();
+        entry["path"] = String(GIF_SLOT_PREFIX) + slot.name.data();
+        entry["size"] = slot.size;
+    }
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief Upload a GIF into a raw flash slot named after the file
+ *
+ * Playback is stopped first, a replaced slot is freed once the upload completes and its sectors are
+ * reused by later writes
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifSlotUpload(Webserver* webserver) {
+    HTTPUpload& upload = webserver->raw().upload();
+    static bool uploadError = false;
+
+    if (upload.status == UPLOAD_FILE_START && !validateBearerToken(webserver)) {
+        uploadError = true;
+        sendGifReply(webserver, HTTP_CODE_UNAUTHORIZED, "error", "Invalid or missing token");
+
+        return;
+    }
+
+    String name = upload.filename;
+    name.replace("\\", "/");
+    name = name.substring(name.lastIndexOf('/') + 1);
+
+    switch (upload.status) {
+        case UPLOAD_FILE_START:
+            DisplayManager::stopGif();
+            uploadError = !GifSlotStore::beginWrite(name);
+            if (uploadError) {
+                Logger::error((String("Cannot start slot write for: ") + name).c_str(), "API::GIF");
+            }
+            break;
+        case UPLOAD_FILE_WRITE:
+            if (!uploadError && !GifSlotStore::write(upload.buf, upload.currentSize)) {
+                Logger::error("Slot write failed, GIF too large for the free slot space", "API::GIF");
+                uploadError = true;
+            }
+            break;
+        case UPLOAD_FILE_END:
+            if (!uploadError && !GifSlotStore::endWrite()) {
+                uploadError = true;
+            }
+            if (!uploadError && !GifFrameIndex::build(String(GIF_SLOT_PREFIX) + name)) {
+                Logger::warn((String("No frame index for slot: ") + name).c_str(), "API::GIF");
+            }
+            break;
+        case UPLOAD_FILE_ABORTED:
+            GifSlotStore::abortWrite();
+            uploadError = true;
+            break;
+        default:
+            break;
+    }
+
+    if (upload.status == UPLOAD_FILE_END || upload.status == UPLOAD_FILE_ABORTED) {
+        if (uploadError) {
+            sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error",
+                         GifSlotStore::isAvailable() ? "Error during slot upload" : "slot store not available");
+
+            return;
+        }
+
+        JsonDocument resp;
+        resp["status"] = "success";
+        resp["message"] = "GIF stored in slot";
+        resp["path"] = String(GIF_SLOT_PREFIX) + name;
+
+        String jsonOut;
+        serializeJson(resp, jsonOut);
+
+        setCorsHeaders(webserver);
+        webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+
+        Logger::info((String("Gif slot stored: ") + name).c_str(), "API::GIF");
+    }
+}
+
+/**
+ * @brief Delete a raw flash GIF slot
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifSlotDelete(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, webserver->raw().arg("plain"))) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "invalid json");
+
+        return;
+    }
+
+    String name = doc["name"] | "";
+    if (name.startsWith(GIF_SLOT_PREFIX)) {
+        name = name.substring(strlen(GIF_SLOT_PREFIX));
+    }
+
+    if (GifSlotStore::find(name) == nullptr) {
+        sendGifReply(webserver, HTTP_CODE_NOT_FOUND, "error", "slot not found");
+
+        return;
+    }
+
+    DisplayManager::stopGif();
+
+    if (!GifSlotStore::remove(name)) {
+        sendGifReply(webserver, HTTP_CODE_INTERNAL_ERROR, "error", "failed to update slot table");
+
+        return;
+    }
+
+    GifFrameIndex::remove(String(GIF_SLOT_PREFIX) + name);
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "slot removed");
+}
+
+/**
+ * @brief Jump to a frame of the GIF playing
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifSeek(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, webserver->raw().arg("plain")) || !doc["frame"].is<uint16_t>()) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "missing or invalid frame");
+
+        return;
+    }
+
+    if (!DisplayManager::seekGif(doc["frame"].as<uint16_t>())) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "no indexed GIF playing or frame out of range");
+
+        return;
+    }
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "frame shown");
+}
+
+/**
+ * @brief Set the GIF playback speed as a factor of the authored frame delays
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleGifSpeed(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, webserver->raw().arg("plain")) || !doc["speed"].is<float>()) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "missing or invalid speed");
+
+        return;
+    }
+
+    const auto percent = static_cast<int32_t>(doc["speed"].as<float>() * 100.0F + 0.5F);
+    if (percent < Gif::SPEED_MIN_PERCENT || percent > Gif::SPEED_MAX_PERCENT) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "speed must be between 0.5 and 4");
+
+        return;
+    }
+
+    DisplayManager::setGifSpeed(static_cast<uint16_t>(percent));
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "speed set");
+}
+
+/**
+ * @brief Start scrolling text through a band of the screen, GIF playback stops
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleTickerStart(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, webserver->raw().arg("plain")) || !doc["text"].is<const char*>()) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "missing or invalid text");
+
+        return;
+    }
+
+    const auto yPos = doc["y"] | static_cast<int16_t>(96);
+    const auto height = doc["height"] | static_cast<int16_t>(48);
+    const auto textSize = doc["size"] | static_cast<uint8_t>(2);
+    const auto speed = doc["speed"] | static_cast<uint16_t>(40);
+
+    if (!DisplayManager::startTicker(yPos, height, String(doc["text"].as<const char*>()), textSize, LCD_WHITE,
+                                     LCD_BLACK, speed)) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "band does not fit the screen");
+
+        return;
+    }
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "ticker started");
+}
+
+/**
+ * @brief Stop the scrolling ticker and clear its band
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleTickerStop(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    DisplayManager::stopTicker();
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "ticker stopped");
+}
+
+/**
+ * @brief Report whether the ticker runs and what its ticks cost on the SPI bus
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleTickerStatus(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const ScrollTickerStats& stats = DisplayManager::getTickerStats();
+
+    JsonDocument resp;
+    resp["active"] = DisplayManager::isTickerActive();
+    resp["ticks"] = stats.ticks;
+    resp["rows"] = stats.rows;
+    resp["bytes"] = stats.bytes;
+    resp["lastTickBytes"] = stats.lastTickBytes;
+    resp["avgTickBytes"] = stats.ticks > 0 ? stats.bytes / stats.ticks : 0U;
+
+    // What repainting the band on every tick would have cost instead
+    resp["redrawBytes"] = stats.redrawBytes;
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief Stage a status bar in hidden GRAM rows and swap it in at the bottom of the screen
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleStatusBarShow(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, webserver->raw().arg("plain")) || !doc["text"].is<const char*>()) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "missing or invalid text");
+
+        return;
+    }
+
+    if (!DisplayManager::showStatusBar(String(doc["text"].as<const char*>()))) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "status bar needs screen rotation 0 or 4");
+
+        return;
+    }
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "status bar shown");
+}
+
+/**
+ * @brief Take the status bar down, the bottom of the screen shows its own content again
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleStatusBarHide(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    DisplayManager::hideStatusBar();
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "status bar hidden");
+}
+
+/**
+ * @brief Report the off-screen band behind the status bar and what staging and swaps cost
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleStatusBarStatus(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const OffscreenBand& band = DisplayManager::getOffscreenBand();
+    const OffscreenBandStats& stats = band.getStats();
+
+    JsonDocument resp;
+    resp["active"] = band.isActive();
+    resp["top"] = band.top();
+    resp["slots"] = band.slots();
+    resp["shownSlot"] = band.shownSlot();
+    resp["stagedBytes"] = stats.stagedBytes;
+    resp["swaps"] = stats.swaps;
+    resp["swapBytes"] = stats.swapBytes;
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief Add a text or rectangle overlay composed over the GIF, or change the text of one
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleOverlaySet(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    JsonDocument doc;
+    if (deserializeJson(doc, webserver->raw().arg("plain"))) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "invalid JSON");
+
+        return;
+    }
+
+    if (doc["id"].is<int>()) {
+        if (!doc["text"].is<const char*>() ||
+            !DisplayManager::setOverlayText(doc["id"].as<int>(), String(doc["text"].as<const char*>()))) {
+            sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "id is not a text overlay or text is missing");
+
+            return;
+        }
+
+        sendGifReply(webserver, HTTP_CODE_OK, "success", "overlay updated");
+
+        return;
+    }
+
+    const auto xPos = doc["x"] | static_cast<int16_t>(0);
+    const auto yPos = doc["y"] | static_cast<int16_t>(0);
+    const String type = doc["type"] | "text";
+    int layer = -1;
+
+    if (type == "rect") {
+        layer = DisplayManager::addOverlayRect(xPos, yPos, doc["width"] | static_cast<int16_t>(0),
+                                               doc["height"] | static_cast<int16_t>(0), LCD_DARK_GREY);
+    } else if (type == "text" && doc["text"].is<const char*>()) {
+        const String text = doc["text"].as<const char*>();
+        const auto maxChars = doc["chars"] | static_cast<uint8_t>(text.length());
+        layer = DisplayManager::addOverlayText(xPos, yPos, maxChars, text, doc["size"] | static_cast<uint8_t>(2),
+                                               LCD_WHITE, LCD_BLACK, true);
+    }
+
+    if (layer < 0) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "overlay invalid, off screen or over budget");
+
+        return;
+    }
+
+    JsonDocument resp;
+    resp["status"] = "success";
+    resp["id"] = layer;
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
+/**
+ * @brief Remove an overlay by id, or every overlay when the body is empty or has no id
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleOverlayRemove(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const String body = webserver->raw().arg("plain");
+    JsonDocument doc;
+    if (body.length() > 0 && deserializeJson(doc, body)) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "invalid json");
+
+        return;
+    }
+
+    if (doc["id"].isNull()) {
+        DisplayManager::clearOverlays();
+        sendGifReply(webserver, HTTP_CODE_OK, "success", "overlays removed");
+
+        return;
+    }
+
+    if (!doc["id"].is<int>()) {
+        sendGifReply(webserver, HTTP_CODE_BAD_REQUEST, "error", "invalid id");
+
+        return;
+    }
+
+    if (!DisplayManager::removeOverlay(doc["id"].as<int>())) {
+        sendGifReply(webserver, HTTP_CODE_NOT_FOUND, "error", "no such overlay");
+
+        return;
+    }
+
+    sendGifReply(webserver, HTTP_CODE_OK, "success", "overlay removed");
+}
+
+/**
+ * @brief Report the overlay layers, their heap and what composing and redrawing them cost
+ *
+ * @param webserver Pointer to the Webserver instance
+ *
+ * @return void
+ */
+void handleOverlayStatus(Webserver* webserver) {
+    if (!requireBearerToken(webserver)) {
+        return;
+    }
+
+    const Compositor& compositor = DisplayManager::getCompositor();
+    const CompositorStats& stats = compositor.getStats();
+
+    JsonDocument resp;
+    resp["layers"] = compositor.layerCount();
+    resp["heapBytes"] = compositor.heapBytes();
+    resp["composedRows"] = stats.composedRows;
+    resp["flushes"] = stats.flushes;
+    resp["strips"] = stats.strips;
+    resp["pushes"] = stats.pushes;
+    resp["bytes"] = stats.bytes;
+
+    String jsonOut;
+    serializeJson(resp, jsonOut);
+
+    setCorsHeaders(webserver);
+    webserver->raw().send(HTTP_CODE_OK, "application/json", jsonOut);
+}
+
 /**
  * @brief Handle WiFi scan
  */
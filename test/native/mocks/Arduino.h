@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Minimal host replacement for the ESP8266 Arduino core, only what the display code needs
+
+#ifndef MOCK_ARDUINO_H
+#define MOCK_ARDUINO_H
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define PROGMEM
+#define memcpy_P memcpy
+#define pgm_read_byte(addr) (*reinterpret_cast<const uint8_t*>(addr))
+#define pgm_read_word(addr) (*reinterpret_cast<const uint16_t*>(addr))
+
+static constexpr uint8_t LOW = 0;
+static constexpr uint8_t HIGH = 1;
+static constexpr uint8_t OUTPUT = 1;
+
+namespace mock {
+// Simulated clock, advanced explicitly by tests (and by delay())
+inline uint32_t nowUs = 0;
+inline uint32_t yieldCount = 0;
+// Simulated time background tasks take on each yield()
+inline uint32_t yieldCostUs = 0;
+inline uint32_t freeHeap = 40000;
+// Raw SPI flash image, erased bytes read 0xFF and writes can only clear bits like NOR flash
+inline std::vector<uint8_t> flash;
+inline uint32_t flashErases = 0;
+
+inline void advanceMs(uint32_t ms) { nowUs += ms * 1000U; }
+inline void advanceUs(uint32_t us) { nowUs += us; }
+}  // namespace mock
+
+inline auto millis() -> uint32_t { return mock::nowUs / 1000U; }
+inline auto micros() -> uint32_t { return mock::nowUs; }
+inline void delay(uint32_t ms) { mock::advanceMs(ms); }
+inline void yield() {
+    ++mock::yieldCount;
+    mock::advanceUs(mock::yieldCostUs);
+}
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+
+class EspClass {
+   public:
+    static auto getFreeHeap() -> uint32_t { return mock::freeHeap; }
+    static auto getMaxFreeBlockSize() -> uint32_t { return mock::freeHeap; }
+    static auto getHeapFragmentation() -> uint8_t { return 0; }
+    // Real host time in nanoseconds so microbenchmarks measure actual work, not the simulated clock
+    static auto getCycleCount() -> uint32_t {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    auto flashEraseSector(uint32_t sector) -> bool {
+        const size_t start = static_cast<size_t>(sector) * FLASH_SECTOR_BYTES;
+        if (start + FLASH_SECTOR_BYTES > mock::flash.size()) {
+            return false;
+        }
+        std::fill_n(mock::flash.begin() + static_cast<long>(start), FLASH_SECTOR_BYTES, 0xFF);
+        ++mock::flashErases;
+        return true;
+    }
+    auto flashWrite(uint32_t address, const uint32_t* data, size_t size) -> bool {
+        if (address % 4U != 0 || size % 4U != 0 || address + size > mock::flash.size()) {
+            return false;
+        }
+        const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            mock::flash[address + i] &= bytes[i];
+        }
+        return true;
+    }
+    auto flashRead(uint32_t address, uint32_t* data, size_t size) -> bool {
+        if (address + size > mock::flash.size()) {
+            return false;
+        }
+        std::memcpy(data, mock::flash.data() + address, size);
+        return true;
+    }
+
+   private:
+    static constexpr size_t FLASH_SECTOR_BYTES = 4096;
+};
+
+inline EspClass ESP;
+
+class String {
+   public:
+    String() = default;
+    String(const char* str) : m_str(str != nullptr ? str : "") {}  // NOLINT(google-explicit-constructor)
+    String(const std::string& str) : m_str(str) {}                  // NOLINT(google-explicit-constructor)
+    explicit String(char chr) : m_str(1, chr) {}
+    explicit String(int value) : m_str(std::to_string(value)) {}
+    explicit String(unsigned int value) : m_str(std::to_string(value)) {}
+    explicit String(long value) : m_str(std::to_string(value)) {}
+    explicit String(unsigned long value) : m_str(std::to_string(value)) {}
+    explicit String(float value) : m_str(std::to_string(value)) {}
+
+    auto c_str() const -> const char* { return m_str.c_str(); }
+    auto length() const -> unsigned int { return static_cast<unsigned int>(m_str.size()); }
+    auto isEmpty() const -> bool { return m_str.empty(); }
+    auto charAt(unsigned int idx) const -> char { return idx < m_str.size() ? m_str[idx] : '\0'; }
+    auto operator[](unsigned int idx) const -> char { return charAt(idx); }
+
+    auto startsWith(const String& prefix) const -> bool { return m_str.rfind(prefix.m_str, 0) == 0; }
+    auto endsWith(const String& suffix) const -> bool {
+        return m_str.size() >= suffix.m_str.size() &&
+               m_str.compare(m_str.size() - suffix.m_str.size(), suffix.m_str.size(), suffix.m_str) == 0;
+    }
+    auto equals(const String& other) const -> bool { return m_str == other.m_str; }
+    auto indexOf(char chr) const -> int {
+        auto pos = m_str.find(chr);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+    auto lastIndexOf(char chr) const -> int {
+        auto pos = m_str.rfind(chr);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+    auto substring(unsigned int from) const -> String { return from < m_str.size() ? m_str.substr(from) : ""; }
+    auto substring(unsigned int from, unsigned int to) const -> String {
+        return from < m_str.size() ? m_str.substr(from, to - from) : "";
+    }
+    void toLowerCase() {
+        std::transform(m_str.begin(), m_str.end(), m_str.begin(), [](unsigned char chr) { return std::tolower(chr); });
+    }
+    void replace(const String& from, const String& to) {
+        if (from.m_str.empty()) {
+            return;
+        }
+        size_t pos = 0;
+        while ((pos = m_str.find(from.m_str, pos)) != std::string::npos) {
+            m_str.replace(pos, from.m_str.size(), to.m_str);
+            pos += to.m_str.size();
+        }
+    }
+
+    auto operator+=(const String& other) -> String& {
+        m_str += other.m_str;
+        return *this;
+    }
+    auto operator==(const String& other) const -> bool { return m_str == other.m_str; }
+    auto operator!=(const String& other) const -> bool { return m_str != other.m_str; }
+    auto operator<(const String& other) const -> bool { return m_str < other.m_str; }
+    friend auto operator+(const String& lhs, const String& rhs) -> String { return lhs.m_str + rhs.m_str; }
+    friend auto operator+(const char* lhs, const String& rhs) -> String { return std::string(lhs) + rhs.m_str; }
+
+   private:
+    std::string m_str;
+};
+
+class HardwareSerial {
+   public:
+    void begin(uint32_t) {}
+    template <typename T>
+    void print(const T&) {}
+    template <typename T>
+    void println(const T&) {}
+};
+
+inline HardwareSerial Serial;
+
+#endif  // MOCK_ARDUINO_H
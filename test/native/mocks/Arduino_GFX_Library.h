@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Counting stand-in for Arduino_GFX: models the ST7789 command stream and keeps a copy of GRAM
+
+#ifndef MOCK_ARDUINO_GFX_LIBRARY_H
+#define MOCK_ARDUINO_GFX_LIBRARY_H
+
+#include <Arduino.h>
+
+#include <array>
+#include <vector>
+
+static constexpr uint8_t ST7789_CASET = 0x2A;
+static constexpr uint8_t ST7789_RASET = 0x2B;
+static constexpr uint8_t ST7789_RAMWR = 0x2C;
+static constexpr uint8_t ST7789_VSCRDEF = 0x33;
+static constexpr uint8_t ST7789_VSCSAD = 0x37;
+
+class Arduino_GFX {
+   public:
+    Arduino_GFX(int16_t width, int16_t height) : m_width(width), m_height(height) {}
+    virtual ~Arduino_GFX() = default;
+
+    auto width() const -> int16_t { return m_width; }
+    auto height() const -> int16_t { return m_height; }
+    auto getRotation() const -> uint8_t { return m_rotation; }
+    void setRotation(uint8_t rotation) { m_rotation = rotation; }
+
+   protected:
+    int16_t m_width;
+    int16_t m_height;
+    uint8_t m_rotation = 0;
+};
+
+class Arduino_TFT : public Arduino_GFX {
+   public:
+    // Bytes on the wire for one writeAddrWindow: CASET + 4 params, RASET + 4 params, RAMWR
+    static constexpr uint32_t ADDR_WINDOW_COMMANDS = 3;
+    static constexpr uint32_t ADDR_WINDOW_BYTES = 11;
+    static constexpr int16_t GRAM_W = 240;
+    static constexpr int16_t GRAM_H = 320;
+    // Panel SPI clock of the firmware (LCD_SPI_HZ)
+    static constexpr uint32_t SPI_HZ = 40000000;
+
+    struct Counters {
+        uint32_t addrWindows = 0;
+        uint32_t commands = 0;
+        uint32_t commandBytes = 0;
+        uint32_t pixelWrites = 0;
+        uint32_t pixelBytes = 0;
+        uint32_t writeSessions = 0;
+
+        // Time the command and pixel bytes take on the wire at SPI_HZ, gaps between transfers excluded
+        auto spiMicros() const -> double {
+            return static_cast<double>(commandBytes + pixelBytes) * 8.0 * 1e6 / static_cast<double>(SPI_HZ);
+        }
+    };
+
+    Arduino_TFT(int16_t width, int16_t height)
+        : Arduino_GFX(width, height), m_gram(static_cast<size_t>(GRAM_W) * GRAM_H, 0) {}
+
+    void startWrite() { ++m_counters.writeSessions; }
+    void endWrite() {}
+
+    // COLMOD as set by the firmware, RGB444 pixels arrive packed two per three bytes
+    void setColorMode444(bool enabled) { m_rgb444 = enabled; }
+
+    void writeAddrWindow(int16_t xPos, int16_t yPos, uint16_t width, uint16_t height) {
+        m_nibbleCount = 0;
+        ++m_counters.addrWindows;
+        m_counters.commands += ADDR_WINDOW_COMMANDS;
+        m_counters.commandBytes += ADDR_WINDOW_BYTES;
+        m_winX = xPos;
+        m_winY = yPos;
+        m_winW = width;
+        m_winH = height;
+        m_cursor = 0;
+    }
+
+    void writePixels(uint16_t* data, uint32_t len) {
+        ++m_counters.pixelWrites;
+        m_counters.pixelBytes += len * 2U;
+        for (uint32_t i = 0; i < len; ++i) {
+            storePixel(data[i]);
+        }
+    }
+
+    // Raw bytes in wire order, RGB565 pixels arrive big-endian
+    void writeBytes(const uint8_t* data, uint32_t len) {
+        ++m_counters.pixelWrites;
+        m_counters.pixelBytes += len;
+        if (m_rgb444) {
+            for (uint32_t i = 0; i < len; ++i) {
+                pushNibble(static_cast<uint8_t>(data[i] >> 4U));
+                pushNibble(static_cast<uint8_t>(data[i] & 0x0FU));
+            }
+            return;
+        }
+        for (uint32_t i = 0; i + 1U < len; i += 2U) {
+            storePixel(static_cast<uint16_t>((data[i] << 8U) | data[i + 1U]));
+        }
+    }
+
+    // Command with its parameters, vertical scroll definition and start address are modelled
+    void writeCommand(uint8_t cmd, const uint8_t* params, uint32_t len) {
+        ++m_counters.commands;
+        m_counters.commandBytes += 1U + len;
+        if (cmd == ST7789_VSCRDEF && len == 6) {
+            m_scrollTop = static_cast<int16_t>((params[0] << 8U) | params[1]);
+            m_scrollHeight = static_cast<int16_t>((params[2] << 8U) | params[3]);
+        } else if (cmd == ST7789_VSCSAD && len == 2) {
+            m_scrollStart = static_cast<int16_t>((params[0] << 8U) | params[1]);
+        }
+    }
+
+    auto counters() const -> const Counters& { return m_counters; }
+    void resetCounters() { m_counters = Counters{}; }
+
+    // Pixel as last written to GRAM, in native RGB565 order
+    auto pixelAt(int16_t xPos, int16_t yPos) const -> uint16_t {
+        return m_gram[static_cast<size_t>(yPos) * GRAM_W + static_cast<size_t>(xPos)];
+    }
+
+    // Pixel the panel shows on a screen line: lines inside the scroll area read GRAM from the start address on
+    auto displayedPixelAt(int16_t xPos, int16_t yPos) const -> uint16_t {
+        if (yPos < m_scrollTop || yPos >= m_scrollTop + m_scrollHeight) {
+            return pixelAt(xPos, yPos);
+        }
+        const int offset = (m_scrollStart - m_scrollTop) + (yPos - m_scrollTop);
+        return pixelAt(xPos, static_cast<int16_t>(m_scrollTop + offset % m_scrollHeight));
+    }
+
+    auto scrollStart() const -> int16_t { return m_scrollStart; }
+    auto scrollHeight() const -> int16_t { return m_scrollHeight; }
+
+   private:
+    Counters m_counters;
+    std::vector<uint16_t> m_gram;
+    int16_t m_winX = 0;
+    int16_t m_winY = 0;
+    uint16_t m_winW = 0;
+    uint16_t m_winH = 0;
+    uint32_t m_cursor = 0;
+    bool m_rgb444 = false;
+    uint32_t m_nibbles = 0;
+    uint32_t m_nibbleCount = 0;
+    int16_t m_scrollTop = 0;
+    int16_t m_scrollHeight = GRAM_H;
+    int16_t m_scrollStart = 0;
+
+    // Three nibbles make one RGB444 pixel, stored widened to RGB565 like the panel shows it
+    void pushNibble(uint8_t nibble) {
+        m_nibbles = (m_nibbles << 4U) | nibble;
+        if (++m_nibbleCount < 3U) {
+            return;
+        }
+        const uint32_t red = (m_nibbles >> 8U) & 0x0FU;
+        const uint32_t green = (m_nibbles >> 4U) & 0x0FU;
+        const uint32_t blue = m_nibbles & 0x0FU;
+        storePixel(static_cast<uint16_t>((((red << 1U) | (red >> 3U)) << 11U) |
+                                         (((green << 2U) | (green >> 2U)) << 5U) | ((blue << 1U) | (blue >> 3U))));
+        m_nibbles = 0;
+        m_nibbleCount = 0;
+    }
+
+    void storePixel(uint16_t color) {
+        if (m_winW == 0 || m_winH == 0) {
+            return;
+        }
+        const auto col = static_cast<int>(m_winX) + static_cast<int>(m_cursor % m_winW);
+        const auto row = static_cast<int>(m_winY) + static_cast<int>((m_cursor / m_winW) % m_winH);
+        ++m_cursor;
+        if (col >= 0 && col < GRAM_W && row >= 0 && row < GRAM_H) {
+            m_gram[static_cast<size_t>(row) * GRAM_W + static_cast<size_t>(col)] = color;
+        }
+    }
+};
+
+#endif  // MOCK_ARDUINO_GFX_LIBRARY_H
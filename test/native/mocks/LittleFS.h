@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Directory-backed LittleFS shim: every path is resolved below mock::fsRoot on the host
+
+#ifndef MOCK_LITTLEFS_H
+#define MOCK_LITTLEFS_H
+
+#include <Arduino.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mock {
+inline std::string fsRoot = "/tmp/geekmagic-littlefs";
+
+// Number of File::read calls and bytes returned, so tests can report I/O pressure
+inline uint32_t fsReadCalls = 0;
+inline uint32_t fsReadBytes = 0;
+
+inline auto fsPath(const String& path) -> std::string { return fsRoot + path.c_str(); }
+}  // namespace mock
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FSInfo {
+    size_t totalBytes;
+    size_t usedBytes;
+    size_t blockSize;
+    size_t pageSize;
+    size_t maxOpenFiles;
+    size_t maxPathLength;
+};
+
+class File {
+   public:
+    File() = default;
+    File(std::FILE* handle, String name) : m_handle(handle, &std::fclose), m_name(std::move(name)) {}
+
+    explicit operator bool() const { return m_handle != nullptr; }
+
+    auto read(uint8_t* buf, size_t len) -> size_t {
+        if (!m_handle) {
+            return 0;
+        }
+        const size_t got = std::fread(buf, 1, len, m_handle.get());
+        ++mock::fsReadCalls;
+        mock::fsReadBytes += static_cast<uint32_t>(got);
+        return got;
+    }
+    auto readBytes(char* buf, size_t len) -> size_t { return read(reinterpret_cast<uint8_t*>(buf), len); }
+    auto write(const uint8_t* buf, size_t len) -> size_t {
+        return m_handle ? std::fwrite(buf, 1, len, m_handle.get()) : 0;
+    }
+    auto seek(uint32_t pos, SeekMode mode = SeekSet) -> bool {
+        const int whence = mode == SeekSet ? SEEK_SET : (mode == SeekCur ? SEEK_CUR : SEEK_END);
+        return m_handle && std::fseek(m_handle.get(), static_cast<long>(pos), whence) == 0;
+    }
+    auto position() const -> size_t { return m_handle ? static_cast<size_t>(std::ftell(m_handle.get())) : 0; }
+    auto size() const -> size_t {
+        if (!m_handle) {
+            return 0;
+        }
+        const long cur = std::ftell(m_handle.get());
+        std::fseek(m_handle.get(), 0, SEEK_END);
+        const long end = std::ftell(m_handle.get());
+        std::fseek(m_handle.get(), cur, SEEK_SET);
+        return static_cast<size_t>(end);
+    }
+    auto name() const -> const char* { return m_name.c_str(); }
+    void close() { m_handle.reset(); }
+
+   private:
+    std::shared_ptr<std::FILE> m_handle;
+    String m_name;
+};
+
+class Dir {
+   public:
+    Dir() = default;
+    explicit Dir(std::vector<std::filesystem::directory_entry> entries) : m_entries(std::move(entries)) {}
+
+    auto next() -> bool { return ++m_index < static_cast<int>(m_entries.size()); }
+    auto fileName() const -> String { return m_entries[static_cast<size_t>(m_index)].path().filename().string(); }
+    auto fileSize() const -> size_t {
+        return static_cast<size_t>(m_entries[static_cast<size_t>(m_index)].file_size());
+    }
+    auto isFile() const -> bool { return m_entries[static_cast<size_t>(m_index)].is_regular_file(); }
+
+   private:
+    std::vector<std::filesystem::directory_entry> m_entries;
+    int m_index = -1;
+};
+
+class LittleFSMock {
+   public:
+    auto begin() -> bool {
+        std::filesystem::create_directories(mock::fsRoot);
+        return true;
+    }
+    void end() {}
+    // Like the core, opening for writing creates the missing parent directories, r+ updates in place
+    auto open(const String& path, const char* mode) -> File {
+        if (mode[0] == 'w') {
+            std::error_code err;
+            std::filesystem::create_directories(std::filesystem::path(mock::fsPath(path)).parent_path(), err);
+        }
+        const char* hostMode = mode[0] == 'w' ? "wb" : (mode[1] == '+' ? "r+b" : "rb");
+        std::FILE* handle = std::fopen(mock::fsPath(path).c_str(), hostMode);
+        return handle != nullptr ? File(handle, path) : File();
+    }
+    auto exists(const String& path) -> bool { return std::filesystem::exists(mock::fsPath(path)); }
+    auto remove(const String& path) -> bool { return std::filesystem::remove(mock::fsPath(path)); }
+    auto rename(const String& from, const String& to) -> bool {
+        std::error_code err;
+        std::filesystem::rename(mock::fsPath(from), mock::fsPath(to), err);
+        return !err;
+    }
+    auto mkdir(const String& path) -> bool { return std::filesystem::create_directories(mock::fsPath(path)); }
+    auto openDir(const String& path) -> Dir {
+        std::vector<std::filesystem::directory_entry> entries;
+        std::error_code err;
+        for (const auto& entry : std::filesystem::directory_iterator(mock::fsPath(path), err)) {
+            entries.push_back(entry);
+        }
+        return Dir(std::move(entries));
+    }
+    auto info(FSInfo& info) -> bool {
+        info = FSInfo{};
+        info.totalBytes = 1024U * 1024U;
+        return true;
+    }
+};
+
+inline LittleFSMock LittleFS;
+
+#endif  // MOCK_LITTLEFS_H
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// HSPI register mock: a kick of SPI1CMD "sends" the FIFO instantly, records the bytes on the wire
+// and raises the transfer-done interrupt when it is enabled and unmasked
+
+#ifndef MOCK_ESP8266_PERI_H
+#define MOCK_ESP8266_PERI_H
+
+#include <cstdint>
+#include <vector>
+
+static constexpr uint32_t SPIBUSY = 1UL << 18U;
+static constexpr uint32_t SPILMOSI = 17;
+static constexpr uint32_t SPIMMOSI = 0x1FF;
+static constexpr uint32_t SPILMISO = 8;
+static constexpr uint32_t SPIMMISO = 0x1FF;
+static constexpr uint32_t SPISTRIE = 1UL << 9U;
+static constexpr uint32_t SPISTRIS = 1UL << 4U;
+static constexpr uint32_t SPII1 = 7;
+
+namespace mock {
+using SpiIsr = void (*)(void*);
+
+struct SpiRegisters {
+    uint32_t user1 = 0;
+    volatile uint32_t fifo[16] = {};  // NOLINT(modernize-avoid-c-arrays)
+    uint32_t kicks = 0;
+    bool capture = true;
+    std::vector<uint8_t> wire;
+
+    SpiIsr isr = nullptr;
+    bool masked = false;
+    bool inIsr = false;
+    uint32_t interrupts = 0;
+};
+
+inline SpiRegisters spi;
+
+struct SpiSlaveRegister {
+    uint32_t value = 0;
+
+    operator uint32_t() const { return value; }  // NOLINT(google-explicit-constructor)
+    auto operator&=(uint32_t mask) -> SpiSlaveRegister& {
+        value &= mask;
+        return *this;
+    }
+    auto operator|=(uint32_t bits) -> SpiSlaveRegister&;
+};
+
+inline SpiSlaveRegister spiSlave;
+
+// Deliver the transfer-done interrupt for as long as it stays raised, enabled and unmasked
+inline void spiRaise() {
+    if (spi.inIsr) {
+        return;
+    }
+    while (spi.isr != nullptr && !spi.masked && (spiSlave.value & SPISTRIE) != 0 &&
+           (spiSlave.value & SPISTRIS) != 0) {
+        spi.inIsr = true;
+        ++spi.interrupts;
+        spi.isr(nullptr);
+        spi.inIsr = false;
+    }
+}
+
+inline auto SpiSlaveRegister::operator|=(uint32_t bits) -> SpiSlaveRegister& {
+    value |= bits;
+    spiRaise();
+    return *this;
+}
+
+struct SpiCmdRegister {
+    // Transfers complete as soon as they start, so the busy bit always reads clear
+    operator uint32_t() const { return 0; }  // NOLINT(google-explicit-constructor)
+
+    auto operator|=(uint32_t value) -> SpiCmdRegister& {
+        if ((value & SPIBUSY) == 0) {
+            return *this;
+        }
+        if (spi.capture) {
+            const uint32_t bytes = (((spi.user1 >> SPILMOSI) & SPIMMOSI) + 1U) / 8U;
+            for (uint32_t i = 0; i < bytes; ++i) {
+                spi.wire.push_back(static_cast<uint8_t>(spi.fifo[i / 4U] >> ((i % 4U) * 8U)));
+            }
+        }
+        ++spi.kicks;
+        spiSlave.value |= SPISTRIS;
+        spiRaise();
+        return *this;
+    }
+};
+
+inline SpiCmdRegister spiCmd;
+}  // namespace mock
+
+#define SPI1CMD mock::spiCmd
+#define SPI1U1 mock::spi.user1
+#define SPI1S mock::spiSlave
+#define SPI1W0 mock::spi.fifo[0]
+#define SPIIR (1U << SPII1)
+
+#endif  // MOCK_ESP8266_PERI_H
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// SPI interrupt plumbing on top of the HSPI register mock
+
+#ifndef MOCK_ETS_SYS_H
+#define MOCK_ETS_SYS_H
+
+#include <esp8266_peri.h>
+
+#define ETS_SPI_INTR_ATTACH(func, arg) (mock::spi.isr = (func))
+#define ETS_SPI_INTR_DISABLE() (mock::spi.masked = true)
+#define ETS_SPI_INTR_ENABLE() (mock::spi.masked = false, mock::spiRaise())
+
+#endif  // MOCK_ETS_SYS_H
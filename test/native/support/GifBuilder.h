@@ -0,0 +1,260 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Tiny GIF writer for host tests, frames are stored with literal-only LZW codes unless compression is asked for
+
+#ifndef TEST_GIF_BUILDER_H
+#define TEST_GIF_BUILDER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct GifFrameSpec {
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint16_t width = 0;
+    uint16_t height = 0;
+    uint16_t delayCs = 10;
+    uint8_t disposal = 1;
+    bool transparent = false;
+    uint8_t transparentIndex = 0;
+    // Real LZW with a growing code table instead of literal codes
+    bool compressed = false;
+    // Rows stored in the four interlace passes
+    bool interlaced = false;
+    // 256 RGB triplets replacing the global table for this frame, empty to use the global one
+    std::vector<uint8_t> localPalette;
+    std::vector<uint8_t> pixels;
+};
+
+class GifBuilder {
+   public:
+    GifBuilder(uint16_t width, uint16_t height) : m_width(width), m_height(height) {
+        m_palette.resize(256U * 3U);
+        for (size_t i = 0; i < 256U; ++i) {
+            m_palette[i * 3U] = static_cast<uint8_t>(i);
+            m_palette[i * 3U + 1U] = static_cast<uint8_t>(255U - i);
+            m_palette[i * 3U + 2U] = static_cast<uint8_t>(i * 7U);
+        }
+    }
+
+    auto addFrame(const GifFrameSpec& frame) -> GifBuilder& {
+        m_frames.push_back(frame);
+        return *this;
+    }
+
+    // Convenience: solid pattern frame covering the given rect
+    static auto patternFrame(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t seed) -> GifFrameSpec {
+        GifFrameSpec frame;
+        frame.x = x;
+        frame.y = y;
+        frame.width = width;
+        frame.height = height;
+        frame.pixels.resize(static_cast<size_t>(width) * height);
+        for (size_t i = 0; i < frame.pixels.size(); ++i) {
+            frame.pixels[i] = static_cast<uint8_t>((i / 7U + seed) % 250U + 1U);
+        }
+        return frame;
+    }
+
+    auto bytes() const -> std::vector<uint8_t> {
+        std::vector<uint8_t> out = {'G', 'I', 'F', '8', '9', 'a'};
+        put16(out, m_width);
+        put16(out, m_height);
+        out.push_back(0xF7);  // global table, 8 bit colour, 256 entries
+        out.push_back(0);
+        out.push_back(0);
+        out.insert(out.end(), m_palette.begin(), m_palette.end());
+
+        for (const auto& frame : m_frames) {
+            out.insert(out.end(), {0x21, 0xF9, 0x04});
+            out.push_back(static_cast<uint8_t>((frame.disposal << 2U) | (frame.transparent ? 1U : 0U)));
+            put16(out, frame.delayCs);
+            out.push_back(frame.transparentIndex);
+            out.push_back(0);
+
+            out.push_back(0x2C);
+            put16(out, frame.x);
+            put16(out, frame.y);
+            put16(out, frame.width);
+            put16(out, frame.height);
+            const bool local = frame.localPalette.size() == 256U * 3U;
+            out.push_back(static_cast<uint8_t>((local ? 0x87U : 0U) | (frame.interlaced ? 0x40U : 0U)));
+            if (local) {
+                out.insert(out.end(), frame.localPalette.begin(), frame.localPalette.end());
+            }
+
+            const auto pixels = frame.interlaced ? interlace(frame.pixels, frame.width, frame.height) : frame.pixels;
+            if (frame.compressed) {
+                appendCompressedData(out, pixels);
+            } else {
+                appendImageData(out, pixels);
+            }
+        }
+
+        out.push_back(0x3B);
+        return out;
+    }
+
+    auto writeTo(const std::string& path) const -> bool {
+        const auto data = bytes();
+        std::FILE* file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return false;
+        }
+        const bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+        std::fclose(file);
+        return ok;
+    }
+
+   private:
+    uint16_t m_width;
+    uint16_t m_height;
+    std::vector<uint8_t> m_palette;
+    std::vector<GifFrameSpec> m_frames;
+
+    static constexpr uint16_t CLEAR_CODE = 256;
+    static constexpr uint16_t END_CODE = 257;
+    static constexpr size_t CODES_PER_CLEAR = 250;
+    static constexpr uint16_t MAX_CODES = 4096;
+
+    static void put16(std::vector<uint8_t>& out, uint16_t value) {
+        out.push_back(static_cast<uint8_t>(value & 0xFFU));
+        out.push_back(static_cast<uint8_t>(value >> 8U));
+    }
+
+    static void appendImageData(std::vector<uint8_t>& out, const std::vector<uint8_t>& pixels) {
+        std::vector<uint8_t> packed;
+        uint32_t acc = 0;
+        uint32_t bits = 0;
+        auto emit = [&](uint16_t code) {
+            acc |= static_cast<uint32_t>(code) << bits;
+            bits += 9;
+            while (bits >= 8) {
+                packed.push_back(static_cast<uint8_t>(acc & 0xFFU));
+                acc >>= 8U;
+                bits -= 8;
+            }
+        };
+
+        for (size_t i = 0; i < pixels.size(); ++i) {
+            if (i % CODES_PER_CLEAR == 0) {
+                emit(CLEAR_CODE);
+            }
+            emit(pixels[i]);
+        }
+        emit(END_CODE);
+        if (bits > 0) {
+            packed.push_back(static_cast<uint8_t>(acc & 0xFFU));
+        }
+
+        appendSubBlocks(out, packed);
+    }
+
+    // Greedy LZW as real encoders write it: codes widen with the table and a clear restarts a full table
+    static void appendCompressedData(std::vector<uint8_t>& out, const std::vector<uint8_t>& pixels) {
+        std::vector<uint8_t> packed;
+        std::unordered_map<uint32_t, uint16_t> table;
+        uint32_t acc = 0;
+        uint32_t bits = 0;
+        uint32_t size = 9;
+        uint16_t next = END_CODE + 1;
+        auto emit = [&](uint16_t code) {
+            acc |= static_cast<uint32_t>(code) << bits;
+            bits += size;
+            while (bits >= 8) {
+                packed.push_back(static_cast<uint8_t>(acc & 0xFFU));
+                acc >>= 8U;
+                bits -= 8;
+            }
+        };
+        // The decoder adds each entry one code later, widths follow the table it will have
+        auto grow = [&]() {
+            ++next;
+            if (next > (1U << size) && size < 12) {
+                ++size;
+            }
+        };
+
+        emit(CLEAR_CODE);
+        if (!pixels.empty()) {
+            uint16_t prefix = pixels[0];
+            for (size_t i = 1; i < pixels.size(); ++i) {
+                const uint32_t key = (static_cast<uint32_t>(prefix) << 8U) | pixels[i];
+                const auto found = table.find(key);
+                if (found != table.end()) {
+                    prefix = found->second;
+                    continue;
+                }
+                emit(prefix);
+                if (next < MAX_CODES) {
+                    table[key] = next;
+                    grow();
+                } else {
+                    emit(CLEAR_CODE);
+                    table.clear();
+                    size = 9;
+                    next = END_CODE + 1;
+                }
+                prefix = pixels[i];
+            }
+            emit(prefix);
+            if (next < MAX_CODES) {
+                grow();
+            }
+        }
+        emit(END_CODE);
+        if (bits > 0) {
+            packed.push_back(static_cast<uint8_t>(acc & 0xFFU));
+        }
+
+        appendSubBlocks(out, packed);
+    }
+
+    static void appendSubBlocks(std::vector<uint8_t>& out, const std::vector<uint8_t>& packed) {
+        out.push_back(8);
+        for (size_t pos = 0; pos < packed.size(); pos += 255U) {
+            const size_t len = std::min<size_t>(255U, packed.size() - pos);
+            out.push_back(static_cast<uint8_t>(len));
+            out.insert(out.end(), packed.begin() + static_cast<long>(pos), packed.begin() + static_cast<long>(pos + len));
+        }
+        out.push_back(0);
+    }
+
+    // Rows 0, 8, 16.. then 4, 12.. then 2, 6.. then the odd ones
+    static auto interlace(const std::vector<uint8_t>& pixels, uint16_t width, uint16_t height) -> std::vector<uint8_t> {
+        std::vector<uint8_t> stored;
+        stored.reserve(pixels.size());
+        const uint16_t starts[4] = {0, 4, 2, 1};
+        const uint16_t steps[4] = {8, 8, 4, 2};
+        for (int pass = 0; pass < 4; ++pass) {
+            for (uint32_t row = starts[pass]; row < height; row += steps[pass]) {
+                const auto begin = pixels.begin() + static_cast<long>(row * width);
+                stored.insert(stored.end(), begin, begin + width);
+            }
+        }
+        return stored;
+    }
+};
+
+#endif  // TEST_GIF_BUILDER_H
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// GIF file held in a vector behind the decoder file callbacks, for driving decoders without the player
+
+#ifndef TEST_GIF_MEMORY_FILE_H
+#define TEST_GIF_MEMORY_FILE_H
+
+#include <AnimatedGIF.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace memgif {
+inline std::vector<uint8_t> data;
+inline uint32_t readCalls = 0;
+// File state of the decoder as last seen by a callback
+inline GIFFILE* lastFile = nullptr;
+
+inline auto open(const char*, int32_t* size) -> void* {
+    *size = static_cast<int32_t>(data.size());
+    return &data;
+}
+
+inline void close(void*) {}
+
+inline auto read(GIFFILE* file, uint8_t* buf, int32_t len) -> int32_t {
+    lastFile = file;
+    ++readCalls;
+    const int32_t got = std::max(0, std::min(len, file->iSize - file->iPos));
+    std::memcpy(buf, data.data() + file->iPos, static_cast<size_t>(got));
+    file->iPos += got;
+    return got;
+}
+
+inline auto seek(GIFFILE* file, int32_t pos) -> int32_t {
+    lastFile = file;
+    file->iPos = std::max(0, std::min(pos, file->iSize));
+    return file->iPos;
+}
+
+// Open the current data with any decoder that takes the AnimatedGIF callbacks
+template <typename Decoder>
+auto openWith(Decoder& decoder, GIF_DRAW_CALLBACK* draw) -> bool {
+    readCalls = 0;
+    decoder.begin(GIF_PALETTE_RGB565_BE);
+    return decoder.open("memory.gif", open, close, read, seek, draw) > 0;
+}
+}  // namespace memgif
+
+#endif  // TEST_GIF_MEMORY_FILE_H
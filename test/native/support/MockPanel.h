@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Host side DisplayManager backed by the counting mock panel
+// Every native test links src/display, so each test_main.cpp includes this header exactly once
+
+#ifndef TEST_MOCK_PANEL_H
+#define TEST_MOCK_PANEL_H
+
+#include <initializer_list>
+#include <vector>
+
+#include "display/DisplayManager.h"
+
+static Arduino_TFT g_panel(240, 240);
+
+namespace mock {
+// Simulated SPI time charged to the clock per pixel byte sent, 0 keeps panel writes instantaneous
+inline uint32_t spiNanosPerByte = 0;
+inline uint64_t spiNanosPending = 0;
+}  // namespace mock
+
+static void chargeSpiTime(uint32_t len) {
+    mock::spiNanosPending += static_cast<uint64_t>(len) * mock::spiNanosPerByte;
+    mock::advanceUs(static_cast<uint32_t>(mock::spiNanosPending / 1000U));
+    mock::spiNanosPending %= 1000U;
+}
+
+auto DisplayManager::getGfx() -> Arduino_GFX* { return &g_panel; }
+
+void DisplayManager::writePanelPixels(const uint16_t* data, uint32_t len) {
+    g_panel.writeBytes(reinterpret_cast<const uint8_t*>(data), len * 2U);
+    chargeSpiTime(len * 2U);
+}
+
+// The mock panel consumes pixels immediately, so asynchronous writes complete on the spot
+void DisplayManager::writePanelPixelsAsync(const uint16_t* data, uint32_t len) { writePanelPixels(data, len); }
+
+void DisplayManager::waitPanelIdle() {}
+
+auto DisplayManager::getPanelWaitCycles() -> uint32_t { return 0; }
+
+void DisplayManager::writePanelBytes(const uint8_t* data, uint32_t len) {
+    g_panel.writeBytes(data, len);
+    chargeSpiTime(len);
+}
+
+void DisplayManager::writePanelBytesAsync(const uint8_t* data, uint32_t len) { writePanelBytes(data, len); }
+
+static PanelColorMode s_mockColorMode = PanelColorMode::Rgb565;
+
+void DisplayManager::setPanelColorMode(PanelColorMode mode) {
+    s_mockColorMode = mode;
+    g_panel.setColorMode444(mode == PanelColorMode::Rgb444);
+}
+
+auto DisplayManager::getPanelColorMode() -> PanelColorMode { return s_mockColorMode; }
+
+// Scroll commands take 16-bit parameters, high byte first
+static void mockWordCommand(uint8_t cmd, std::initializer_list<int> words) {
+    std::vector<uint8_t> params;
+    for (const int word : words) {
+        params.push_back(static_cast<uint8_t>(word >> 8));
+        params.push_back(static_cast<uint8_t>(word & 0xFF));
+    }
+    g_panel.writeCommand(cmd, params.data(), static_cast<uint32_t>(params.size()));
+    chargeSpiTime(1U + static_cast<uint32_t>(params.size()));
+}
+
+void DisplayManager::setPanelScrollArea(int16_t top, int16_t height) {
+    mockWordCommand(ST7789_VSCRDEF, {top, height, PANEL_GRAM_ROWS - top - height});
+}
+
+void DisplayManager::setPanelScrollStart(int16_t line) { mockWordCommand(ST7789_VSCSAD, {line}); }
+
+static void mockFillRect(int16_t xPos, int16_t yPos, int16_t width, int16_t height) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+    const std::vector<uint8_t> black(static_cast<size_t>(width) * static_cast<size_t>(height) * 2U, 0);
+    g_panel.writeAddrWindow(xPos, yPos, static_cast<uint16_t>(width), static_cast<uint16_t>(height));
+    g_panel.writeBytes(black.data(), static_cast<uint32_t>(black.size()));
+}
+
+void DisplayManager::clearScreen() {
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    mockFillRect(0, 0, 240, 240);
+}
+
+void DisplayManager::clearOutside(int16_t xPos, int16_t yPos, int16_t width, int16_t height) {
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+    mockFillRect(0, 0, 240, yPos);
+    mockFillRect(0, static_cast<int16_t>(yPos + height), 240, static_cast<int16_t>(240 - yPos - height));
+    mockFillRect(0, yPos, xPos, height);
+    mockFillRect(static_cast<int16_t>(xPos + width), yPos, static_cast<int16_t>(240 - xPos - width), height);
+}
+
+/**
+ * @brief Copy of the visible 240x240 panel, row by row
+ */
+inline auto captureGram() -> std::vector<uint16_t> {
+    std::vector<uint16_t> gram;
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+    return gram;
+}
+
+#endif  // TEST_MOCK_PANEL_H
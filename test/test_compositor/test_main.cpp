@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Compositor.h"
+#include "display/Gif.h"
+#include "display/GifFrameIndex.h"
+#include "display/TextRaster.h"
+
+static constexpr int FRAME_COUNT = 3;
+static constexpr uint16_t RECT_COLOR = 0xF800;
+static constexpr uint16_t TEXT_COLOR = 0xFFFF;
+static constexpr uint16_t KEY = 0x0000;
+
+// 4x2 icon, the key colour in its corners stays transparent
+static const uint16_t ICON[] PROGMEM = {KEY, 0x001F, 0x001F, KEY, 0x07E0, 0x07E0, 0x07E0, 0x07E0};
+
+struct Rect {
+    int16_t x;
+    int16_t y;
+    int16_t width;
+    int16_t height;
+};
+
+static constexpr Rect RECT = {20, 30, 60, 40};
+static constexpr Rect TEXT = {100, 176, 8 * 6 * 2, 16};
+
+static auto inside(const Rect& rect, int x, int y) -> bool {
+    return x >= rect.x && x < rect.x + rect.width && y >= rect.y && y < rect.y + rect.height;
+}
+
+/**
+ * @brief Play a file to the end, with the compositor merging its layers or without it
+ */
+static auto playToEnd(const char* path, Compositor* compositor, bool rgb444) -> std::vector<uint16_t> {
+    Gif gif;
+    gif.setRgb444Enabled(rgb444);
+    gif.setCompositor(compositor);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+
+        if (compositor != nullptr) {
+            TEST_ASSERT_FALSE(gif.isRgb444Active());
+        }
+    }
+
+    return captureGram();
+}
+
+/**
+ * @brief Opaque frames (streamed) followed by a transparent overlay (per-line runs)
+ */
+static auto writeMixedGif(const char* name) -> void {
+    GifBuilder builder(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 40)));
+    }
+    auto overlay = GifBuilder::patternFrame(10, 10, 200, 200, 9);
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    for (size_t i = 0; i < overlay.pixels.size(); i += 3) {
+        overlay.pixels[i] = 0;
+    }
+    builder.addFrame(overlay);
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "compositor").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+}
+
+void tearDown() {}
+
+void test_layers_are_merged_into_gif_lines() {
+    writeMixedGif("/gif/mixed.gif");
+    const auto plain = playToEnd("/gif/mixed.gif", nullptr, false);
+
+    for (const bool rgb444 : {false, true}) {
+        DisplayManager::clearScreen();
+
+        Compositor compositor;
+        TEST_ASSERT_EQUAL(0, compositor.addRect(RECT.x, RECT.y, RECT.width, RECT.height, RECT_COLOR));
+        TEST_ASSERT_EQUAL(1, compositor.addText(TEXT.x, TEXT.y, 8, "12:34", 2, TEXT_COLOR, 0x0000, true));
+        compositor.flush();
+
+        // Layers only reach the panel inside the GIF lines from here on
+        const auto gram = playToEnd("/gif/mixed.gif", &compositor, rgb444);
+        TEST_ASSERT_FALSE(compositor.isDirty());
+        TEST_ASSERT_EQUAL(1, compositor.getStats().flushes);
+        TEST_ASSERT_GREATER_THAN(0U, compositor.getStats().composedRows);
+
+        std::vector<uint16_t> glyphs(static_cast<size_t>(TEXT.width));
+        for (int y = 0; y < 240; ++y) {
+            if (y >= TEXT.y && y < TEXT.y + TEXT.height) {
+                TextRaster::rasterizeRow("12:34", 5, 2, y - TEXT.y, 1, 0, glyphs.data(), TEXT.width);
+            }
+            for (int x = 0; x < 240; ++x) {
+                const size_t index = static_cast<size_t>(y) * 240U + static_cast<size_t>(x);
+                if (inside(RECT, x, y)) {
+                    TEST_ASSERT_EQUAL_HEX16(RECT_COLOR, gram[index]);
+                } else if (inside(TEXT, x, y) && glyphs[static_cast<size_t>(x - TEXT.x)] == 1) {
+                    TEST_ASSERT_EQUAL_HEX16(TEXT_COLOR, gram[index]);
+                } else {
+                    TEST_ASSERT_EQUAL_HEX16(plain[index], gram[index]);
+                }
+            }
+        }
+    }
+}
+
+void test_removed_layer_shows_the_gif_under_it() {
+    writeMixedGif("/gif/remove.gif");
+    const auto plain = playToEnd("/gif/remove.gif", nullptr, false);
+    DisplayManager::clearScreen();
+
+    Compositor compositor;
+    const int rect = compositor.addRect(RECT.x, RECT.y, RECT.width, RECT.height, RECT_COLOR);
+    TEST_ASSERT_EQUAL(0, rect);
+    compositor.flush();
+    playToEnd("/gif/remove.gif", &compositor, false);
+
+    g_panel.resetCounters();
+    TEST_ASSERT_TRUE(compositor.remove(rect));
+    TEST_ASSERT_FALSE(compositor.remove(rect));
+    compositor.flush();
+
+    // Rows 30..69 cross the strips starting at 24, 32 ... 64: one window each, nothing else sent
+    const int strips = (RECT.y + RECT.height - 1) / Compositor::STRIP_ROWS - RECT.y / Compositor::STRIP_ROWS + 1;
+    TEST_ASSERT_EQUAL(6, strips);
+    TEST_ASSERT_EQUAL(strips, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(RECT.width * RECT.height * 2, g_panel.counters().pixelBytes);
+    TEST_ASSERT_TRUE(plain == captureGram());
+
+    // The backing and the strip buffer go with the last layer
+    TEST_ASSERT_FALSE(compositor.isActive());
+    TEST_ASSERT_EQUAL(0, compositor.heapBytes());
+}
+
+void test_layer_added_during_playback_is_removed_over_a_transparent_frame() {
+    // Full frame, transparent delta across the rectangle, small frame away from it
+    GifBuilder builder(240, 240);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 3));
+    auto delta = GifBuilder::patternFrame(0, 20, 120, 60, 70);
+    delta.transparent = true;
+    delta.transparentIndex = 0;
+    for (size_t i = 0; i < delta.pixels.size(); i += 2) {
+        delta.pixels[i] = 0;
+    }
+    builder.addFrame(delta);
+    builder.addFrame(GifBuilder::patternFrame(200, 200, 20, 20, 140));
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/delta.gif"));
+    TEST_ASSERT_TRUE(GifFrameIndex::build("/gif/delta.gif"));
+    const auto plain = playToEnd("/gif/delta.gif", nullptr, false);
+    DisplayManager::clearScreen();
+
+    Compositor compositor;
+    Gif gif;
+    gif.setCompositor(&compositor);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne("/gif/delta.gif"));
+    gif.update();
+    mock::advanceMs(100);
+
+    // Added over frame 0, the delta only refreshes half of its backing
+    const int rect = compositor.addRect(RECT.x, RECT.y, RECT.width, RECT.height, RECT_COLOR);
+    TEST_ASSERT_EQUAL(0, rect);
+    gif.invalidatePanelRows();
+    compositor.flush();
+    gif.update();
+    mock::advanceMs(100);
+
+    TEST_ASSERT_TRUE(compositor.remove(rect));
+    TEST_ASSERT_TRUE(compositor.hasUnknownBacking());
+    TEST_ASSERT_TRUE(gif.redrawUnderOverlays());
+    TEST_ASSERT_FALSE(compositor.hasUnknownBacking());
+
+    // The next frame is drawn before the flush, as in DisplayManager::update()
+    gif.update();
+    compositor.flush();
+    TEST_ASSERT_FALSE(compositor.isActive());
+    TEST_ASSERT_TRUE(plain == captureGram());
+}
+
+void test_only_strips_of_changed_layers_are_recomposed() {
+    Compositor compositor;
+    const int clock = compositor.addText(TEXT.x, TEXT.y, 8, "12:34", 2, TEXT_COLOR, 0x0000, false);
+    const int label = compositor.addText(0, 0, 10, "weather", 1, TEXT_COLOR, 0x0000, false);
+    const int icon = compositor.addIcon(200, 0, 4, 2, ICON, KEY);
+    TEST_ASSERT_TRUE(clock >= 0 && label >= 0 && icon >= 0);
+    compositor.flush();
+
+    TEST_ASSERT_TRUE(compositor.setText(clock, "12:34"));
+    TEST_ASSERT_FALSE(compositor.isDirty());
+    TEST_ASSERT_FALSE(compositor.setText(icon, "x"));
+
+    const CompositorStats before = compositor.getStats();
+    g_panel.resetCounters();
+    TEST_ASSERT_TRUE(compositor.setText(clock, "12:35"));
+    compositor.flush();
+
+    // Rows 176..191 fill two strips exactly, the label and icon strip is left alone
+    const CompositorStats& after = compositor.getStats();
+    TEST_ASSERT_EQUAL(2, after.strips - before.strips);
+    TEST_ASSERT_EQUAL(2, after.pushes - before.pushes);
+    TEST_ASSERT_EQUAL(2, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(TEXT.width * TEXT.height * 2, g_panel.counters().pixelBytes);
+    TEST_ASSERT_EQUAL(2 * 11 + TEXT.width * TEXT.height * 2, after.bytes - before.bytes);
+
+    // Icon corners keep what was under them
+    TEST_ASSERT_EQUAL_HEX16(0x0000, g_panel.pixelAt(200, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, g_panel.pixelAt(201, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, g_panel.pixelAt(203, 1));
+
+    // Layers must fit the screen and the budget
+    TEST_ASSERT_EQUAL(-1, compositor.addRect(200, 200, 60, 10, RECT_COLOR));
+    TEST_ASSERT_EQUAL(-1, compositor.addRect(0, 0, 240, 40, RECT_COLOR));
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "text update: %u bytes in %u windows, %u bytes of heap for 3 layers",
+             static_cast<unsigned>(after.bytes - before.bytes), static_cast<unsigned>(after.pushes - before.pushes),
+             static_cast<unsigned>(compositor.heapBytes()));
+    TEST_MESSAGE(msg);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_layers_are_merged_into_gif_lines);
+    RUN_TEST(test_removed_layer_shows_the_gif_under_it);
+    RUN_TEST(test_layer_added_during_playback_is_removed_over_a_transparent_frame);
+    RUN_TEST(test_only_strips_of_changed_layers_are_recomposed);
+    return UNITY_END();
+}
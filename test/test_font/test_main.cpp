@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "MockPanel.h"
+#include "display/Font.h"
+
+static constexpr uint16_t FG = 0xFFFF;
+static constexpr uint16_t BG = 0x001F;
+static constexpr int16_t TEXT_X = 10;
+static constexpr int16_t TEXT_Y = 100;
+
+static auto inked(const CachedGlyph& glyph, int col, int row) -> bool {
+    if (col < 0 || col >= glyph.width || row < 0 || row >= glyph.height) {
+        return false;
+    }
+    return (glyph.bits[static_cast<size_t>(row) * glyph.stride + col / 8] & (0x80U >> (col % 8))) != 0;
+}
+
+void setUp() {
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+    FontEngine::releaseCache();
+    mock::freeHeap = 40000;
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_utf8_decoding() {
+    // A, e acute, euro sign, an emoji, then malformed sequences: bad continuation, overlong, truncated
+    const char* text = "A\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\xC3(\xC0\xAF\xE2\x82";
+    const std::vector<uint32_t> expected = {'A', 0xE9, 0x20AC, 0x1F600, 0xFFFD, '(', 0xFFFD, 0xFFFD};
+    std::vector<uint32_t> decoded;
+    for (uint32_t codepoint = FontEngine::decodeUtf8(text); codepoint != 0; codepoint = FontEngine::decodeUtf8(text)) {
+        decoded.push_back(codepoint);
+    }
+    TEST_ASSERT_TRUE(expected == decoded);
+}
+
+void test_glyphs_decode_from_flash() {
+    // The 10 px font is the 6x8 cell design trimmed to its ink, with two rows of accent space on top
+    const Font& small = *FontEngine::forTextSize(1);
+    CachedGlyph scratch;
+    for (char chr = 0x20; chr < 0x7F; ++chr) {
+        const CachedGlyph* glyph = FontEngine::glyph(small, static_cast<uint8_t>(chr), scratch);
+        TEST_ASSERT_NOT_NULL(glyph);
+        int left = 0;
+        while (left < 4 && TextRaster::glyphColumn(chr, left) == 0) {
+            ++left;
+        }
+        // Proportional: one column of spacing after the ink, spaces are three columns wide
+        TEST_ASSERT_EQUAL(chr == ' ' ? 3 : glyph->width + 1, glyph->advance);
+        for (int column = 0; column < 5; ++column) {
+            for (int row = 0; row < 7; ++row) {
+                const bool set = ((TextRaster::glyphColumn(chr, column) >> row) & 1U) != 0;
+                TEST_ASSERT_EQUAL(set, inked(*glyph, column - left - glyph->xOffset, row + 2 - glyph->top));
+            }
+        }
+    }
+
+    // Every glyph of every size decodes, packed and run-length bitmaps alike
+    uint32_t flashBytes = 0;
+    uint32_t decodedBytes = 0;
+    for (uint8_t size = 1; FontEngine::forTextSize(size) != nullptr; ++size) {
+        const Font& font = *FontEngine::forTextSize(size);
+        TEST_ASSERT_EQUAL(10 * size, font.lineHeight);
+        for (uint16_t i = 0; i < font.glyphCount; ++i) {
+            const FontGlyph& entry = font.glyphs[i];
+            const FontGlyph* next = (i + 1U < font.glyphCount) ? &font.glyphs[i + 1U] : nullptr;
+            const CachedGlyph* glyph = FontEngine::glyph(font, entry.codepoint, scratch);
+            TEST_ASSERT_NOT_NULL(glyph);
+            TEST_ASSERT_EQUAL(entry.codepoint, glyph->codepoint);
+            TEST_ASSERT_LESS_OR_EQUAL(font.lineHeight, glyph->top + glyph->height);
+            if (next != nullptr) {
+                TEST_ASSERT_LESS_THAN(next->codepoint, entry.codepoint);
+                flashBytes += next->offset - entry.offset;
+            }
+            decodedBytes += static_cast<uint32_t>(glyph->stride) * glyph->height;
+        }
+    }
+    TEST_ASSERT_NULL(FontEngine::forTextSize(5));
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "glyph bitmaps: %u bytes in flash for %u decoded", static_cast<unsigned>(flashBytes),
+             static_cast<unsigned>(decodedBytes));
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_LESS_THAN(decodedBytes * 3U / 4U, flashBytes);
+
+    // Accented and Greek letters are there, anything else is drawn as '?'
+    const Font& medium = *FontEngine::forTextSize(2);
+    FontGlyph entry{};
+    TEST_ASSERT_TRUE(FontEngine::findGlyph(medium, 0xE9, entry));
+    TEST_ASSERT_TRUE(FontEngine::findGlyph(medium, 0x03A9, entry));
+    TEST_ASSERT_FALSE(FontEngine::findGlyph(medium, 0x4E2D, entry));
+    TEST_ASSERT_EQUAL('?', FontEngine::glyph(medium, 0x4E2D, scratch)->codepoint);
+    TEST_ASSERT_EQUAL(FontEngine::measure(medium, "?", 1), FontEngine::measure(medium, "\xE4\xB8\xAD", 3));
+}
+
+void test_cache_serves_repeated_glyphs() {
+    const Font& font = *FontEngine::forTextSize(2);
+    const auto& stats = FontEngine::getCacheStats();
+
+    FontEngine::drawLine(font, TEXT_X, TEXT_Y, "12:34", FG, BG, 0);
+    TEST_ASSERT_EQUAL(5, stats.misses);
+    const auto first = captureGram();
+
+    // The next clock tick decodes only the digit that changed, the same text nothing at all
+    FontEngine::drawLine(font, TEXT_X, TEXT_Y, "12:35", FG, BG, 0);
+    TEST_ASSERT_EQUAL(6, stats.misses);
+    FontEngine::drawLine(font, TEXT_X, TEXT_Y, "12:34", FG, BG, 0);
+    TEST_ASSERT_EQUAL(6, stats.misses);
+    TEST_ASSERT_EQUAL(9, stats.hits);
+    TEST_ASSERT_TRUE(first == captureGram());
+
+    // More distinct glyphs than slots evict the least recently used ones, glyphs in use stay
+    FontEngine::drawLine(font, 0, 0, "abcdefghijklmn", FG, BG, 0);
+    FontEngine::drawLine(font, 0, 0, "4", FG, BG, 0);
+    TEST_ASSERT_EQUAL(6 + 14, stats.misses);
+    TEST_ASSERT_EQUAL(20 - FontEngine::CACHE_SLOTS, stats.evictions);
+    FontEngine::drawLine(font, 0, 0, "1", FG, BG, 0);
+    TEST_ASSERT_EQUAL(6 + 15, stats.misses);
+    TEST_ASSERT_EQUAL(0, stats.uncached);
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "glyph cache: %u hits, %u misses, %u evictions", static_cast<unsigned>(stats.hits),
+             static_cast<unsigned>(stats.misses), static_cast<unsigned>(stats.evictions));
+    TEST_MESSAGE(msg);
+}
+
+void test_line_in_one_window_with_accents() {
+    const Font& font = *FontEngine::forTextSize(2);
+
+    const uint32_t bytes = FontEngine::drawLine(font, TEXT_X, TEXT_Y, "Cafe", FG, BG, 0);
+    const int width = FontEngine::measure(font, "Cafe", 4);
+    TEST_ASSERT_EQUAL(1, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(1, g_panel.counters().pixelWrites);
+    TEST_ASSERT_EQUAL(11U + static_cast<uint32_t>(width) * font.lineHeight * 2U, bytes);
+    const auto plain = captureGram();
+
+    // Only the accent rows above the x-height differ
+    DisplayManager::clearScreen();
+    TEST_ASSERT_EQUAL(width, FontEngine::measure(font, "Caf\xC3\xA9", 5));
+    FontEngine::drawLine(font, TEXT_X, TEXT_Y, "Caf\xC3\xA9", FG, BG, 0);
+    const auto accented = captureGram();
+    int changed = 0;
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            if (plain[y * 240 + x] != accented[y * 240 + x]) {
+                TEST_ASSERT_TRUE(y >= TEXT_Y && y < TEXT_Y + 6);
+                ++changed;
+            }
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(0, changed);
+
+    // Tall lines are composed in bands, without heap a pixel row at a time and uncached, same pixels
+    const Font& large = *FontEngine::forTextSize(4);
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+    FontEngine::drawLine(large, 0, TEXT_Y, "\xCE\xA9 12:34", FG, BG, 240);
+    TEST_ASSERT_EQUAL(1, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(3, g_panel.counters().pixelWrites);
+    const auto banded = captureGram();
+
+    FontEngine::releaseCache();
+    mock::freeHeap = 4000;
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+    FontEngine::drawLine(large, 0, TEXT_Y, "\xCE\xA9 12:34", FG, BG, 240);
+    TEST_ASSERT_EQUAL(1, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(large.lineHeight, g_panel.counters().pixelWrites);
+    TEST_ASSERT_GREATER_THAN(0, FontEngine::getCacheStats().uncached);
+    TEST_ASSERT_TRUE(banded == captureGram());
+}
+
+void test_wrap_by_pixel_width() {
+    const Font& font = *FontEngine::forTextSize(2);
+    const String text = "Connect\xC3\xA9 \xC3\xA0 GeekMagic\nIP: 192.168.100.200 Supercalifragilistic";
+
+    TextRaster::Lines lines{};
+    const int count = FontEngine::wrap(font, text, 120, TextRaster::WRAP_MAX_LINES, lines);
+    // Words wider than a line are broken where the width runs out
+    const std::vector<std::string> expected = {"Connect\xC3\xA9 \xC3\xA0", "GeekMagic", "IP:", "192.168.100.2", "00",
+                                               "Supercalifragili", "stic"};
+    TEST_ASSERT_EQUAL(expected.size(), count);
+    for (int i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL_STRING(expected[i].c_str(), lines[i].data());
+        TEST_ASSERT_LESS_OR_EQUAL(120, FontEngine::measure(font, lines[i].data(), strlen(lines[i].data())));
+    }
+
+    // Capped at maxLines, empty text is one empty line
+    TEST_ASSERT_EQUAL(2, FontEngine::wrap(font, text, 120, 2, lines));
+    TEST_ASSERT_EQUAL(1, FontEngine::wrap(font, "", 120, 2, lines));
+    TEST_ASSERT_EQUAL_STRING("", lines[0].data());
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_utf8_decoding);
+    RUN_TEST(test_glyphs_decode_from_flash);
+    RUN_TEST(test_cache_serves_repeated_glyphs);
+    RUN_TEST(test_line_in_one_window_with_accents);
+    RUN_TEST(test_wrap_by_pixel_width);
+    return UNITY_END();
+}
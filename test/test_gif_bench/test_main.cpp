@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+// Draw path benchmark: plays a corpus of generated GIFs on the mock panel and prints one line per
+// file, run it alone with `pio test -e native -f test_gif_bench -v` and compare the table between builds.
+// A second table decodes the same kind of files with AnimatedGIF and with the in-tree GifDecoder
+
+#include <unity.h>
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "GifMemoryFile.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+#include "display/GifDecoder.h"
+
+static constexpr int FRAME_COUNT = 8;
+
+struct BenchCase {
+    const char* name;
+    GifBuilder builder;
+    bool autoScale;
+};
+
+struct DecoderRun {
+    uint32_t frames = 0;
+    uint32_t checksum = 0;
+    uint32_t readCalls = 0;
+    double hostUs = 0;
+};
+
+struct BenchResult {
+    uint32_t frames = 0;
+    Arduino_TFT::Counters counters;
+    double hostUs = 0;
+};
+
+/**
+ * @brief Full canvas frames with nothing transparent, the best case for streaming and frame drops
+ */
+static auto opaqueGif() -> GifBuilder {
+    GifBuilder builder(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 30)));
+    }
+    return builder;
+}
+
+/**
+ * @brief A background then overlays punched with transparent pixels, drawn as runs
+ */
+static auto transparentGif() -> GifBuilder {
+    GifBuilder builder(240, 240);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 1));
+    for (int i = 1; i < FRAME_COUNT; ++i) {
+        auto overlay =
+            GifBuilder::patternFrame(static_cast<uint16_t>(i * 10), 40, 160, 160, static_cast<uint8_t>(i * 20));
+        overlay.transparent = true;
+        overlay.transparentIndex = 0;
+        for (size_t p = 0; p < overlay.pixels.size(); p += 5) {
+            overlay.pixels[p] = 0;
+        }
+        builder.addFrame(overlay);
+    }
+    return builder;
+}
+
+/**
+ * @brief A sprite moving over the background, each position cleared again (disposal 2)
+ */
+static auto disposalGif() -> GifBuilder {
+    GifBuilder builder(240, 240);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 9));
+    for (int i = 1; i < FRAME_COUNT; ++i) {
+        auto sprite = GifBuilder::patternFrame(static_cast<uint16_t>(i * 20), static_cast<uint16_t>(i * 15), 64, 64,
+                                               static_cast<uint8_t>(i * 40));
+        sprite.disposal = 2;
+        builder.addFrame(sprite);
+    }
+    return builder;
+}
+
+static auto sizedGif(uint16_t width, uint16_t height) -> GifBuilder {
+    GifBuilder builder(width, height);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, width, height, static_cast<uint8_t>(i * 25)));
+    }
+    return builder;
+}
+
+/**
+ * @brief Full canvas frames as real encoders store them, smooth pattern or noise that keeps the code table busy
+ */
+static auto lzwGif(bool noise) -> GifBuilder {
+    GifBuilder builder(240, 240);
+    uint32_t lcg = 1;
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        auto frame = GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 30));
+        if (noise) {
+            for (auto& pixel : frame.pixels) {
+                lcg = lcg * 1103515245U + 12345U;
+                pixel = static_cast<uint8_t>((lcg >> 16U) % 16U);
+            }
+        }
+        frame.compressed = true;
+        builder.addFrame(frame);
+    }
+    return builder;
+}
+
+static uint32_t s_checksum = 0;
+
+static void checksumLine(GIFDRAW* pDraw) {
+    for (int i = 0; i < pDraw->iWidth; ++i) {
+        s_checksum = s_checksum * 31U + pDraw->pPalette[pDraw->pPixels[i]];
+    }
+}
+
+/**
+ * @brief Decode a file from memory with one decoder, no panel work, only a checksum of the lines
+ */
+template <typename Decoder>
+static auto decodeRun(const GifBuilder& builder) -> DecoderRun {
+    memgif::data = builder.bytes();
+    s_checksum = 0;
+
+    Decoder decoder;
+    TEST_ASSERT_TRUE(memgif::openWith(decoder, checksumLine));
+
+    DecoderRun run;
+    const auto start = std::chrono::steady_clock::now();
+    for (int result = 1; result > 0;) {
+        int delayMs = 0;
+        result = decoder.playFrame(false, &delayMs, nullptr);
+        run.frames += result >= 0 ? 1U : 0U;
+    }
+    run.hostUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    decoder.close();
+
+    run.checksum = s_checksum;
+    run.readCalls = memgif::readCalls;
+    return run;
+}
+
+/**
+ * @brief Play a file to its end, one update per frame deadline, and collect the panel counters
+ */
+static auto runCase(const BenchCase& bench) -> BenchResult {
+    const std::string path = std::string("/gif/") + bench.name + ".gif";
+    TEST_ASSERT_TRUE(bench.builder.writeTo(mock::fsRoot + path));
+
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setAutoScaleEnabled(bench.autoScale);
+    TEST_ASSERT_TRUE(gif.playOne(path.c_str()));
+
+    BenchResult result;
+    while (gif.isPlaying()) {
+        const auto start = std::chrono::steady_clock::now();
+        gif.update();
+        result.hostUs += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        mock::advanceMs(100);
+    }
+
+    result.frames = gif.getPipelineStats().frames;
+    result.counters = g_panel.counters();
+    gif.stop();
+
+    return result;
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-bench").string();
+    std::filesystem::remove_all(mock::fsRoot);
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_corpus_table() {
+    const std::vector<BenchCase> corpus = {
+        {"opaque-240", opaqueGif(), false},
+        {"transparent-240", transparentGif(), false},
+        {"disposal2-240", disposalGif(), false},
+        {"small-80x60", sizedGif(80, 60), false},
+        {"small-80x60-x3", sizedGif(80, 60), true},
+        {"oversized-320x300", sizedGif(320, 300), false},
+        {"oversized-320x300-half", sizedGif(320, 300), true},
+    };
+
+    TEST_MESSAGE("file                     frames  windows/f  cmd B/f  pixel KB/f  SPI ms/f @40MHz  host us/f");
+    for (const BenchCase& bench : corpus) {
+        const BenchResult result = runCase(bench);
+        TEST_ASSERT_EQUAL(FRAME_COUNT, result.frames);
+        TEST_ASSERT_GREATER_THAN(0U, result.counters.pixelBytes);
+
+        const double frames = static_cast<double>(result.frames);
+        char line[160];
+        snprintf(line, sizeof(line), "%-24s %6u %10.1f %8.0f %11.1f %16.2f %10.0f", bench.name,
+                 static_cast<unsigned>(result.frames), result.counters.addrWindows / frames,
+                 result.counters.commandBytes / frames, result.counters.pixelBytes / frames / 1024.0,
+                 result.counters.spiMicros() / frames / 1000.0, result.hostUs / frames);
+        TEST_MESSAGE(line);
+    }
+}
+
+void test_decoder_table() {
+    const std::vector<BenchCase> corpus = {
+        {"literal-240", opaqueGif(), false},
+        {"transparent-240", transparentGif(), false},
+        {"lzw-240", lzwGif(false), false},
+        {"lzw-noise-240", lzwGif(true), false},
+    };
+
+    TEST_MESSAGE("file                     AnimatedGIF us/f  reads/f   GifDecoder us/f  reads/f");
+    for (const BenchCase& bench : corpus) {
+        const DecoderRun library = decodeRun<AnimatedGIF>(bench.builder);
+        const DecoderRun inTree = decodeRun<GifDecoder>(bench.builder);
+
+        // Same lines out of both, only the cost may differ
+        TEST_ASSERT_EQUAL(FRAME_COUNT, inTree.frames);
+        TEST_ASSERT_EQUAL(library.frames, inTree.frames);
+        TEST_ASSERT_EQUAL_HEX32(library.checksum, inTree.checksum);
+
+        const double frames = static_cast<double>(inTree.frames);
+        char line[160];
+        snprintf(line, sizeof(line), "%-24s %16.0f %8.1f %17.0f %8.1f", bench.name, library.hostUs / frames,
+                 library.readCalls / frames, inTree.hostUs / frames, inTree.readCalls / frames);
+        TEST_MESSAGE(line);
+    }
+}
+
+void test_spi_estimate_matches_bytes_on_the_wire() {
+    const BenchResult result = runCase({"estimate", sizedGif(240, 240), false});
+
+    // One streamed window per frame: 11 command bytes and a whole RGB565 frame at 5 MB/s
+    const double expectedUs = (11.0 + 240.0 * 240.0 * 2.0) * FRAME_COUNT * 8.0 / 40.0;
+    TEST_ASSERT_EQUAL(FRAME_COUNT, result.counters.addrWindows);
+    TEST_ASSERT_EQUAL(static_cast<uint32_t>(expectedUs), static_cast<uint32_t>(result.counters.spiMicros()));
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_corpus_table);
+    RUN_TEST(test_decoder_table);
+    RUN_TEST(test_spi_estimate_matches_bytes_on_the_wire);
+    return UNITY_END();
+}
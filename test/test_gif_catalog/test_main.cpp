@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/GifCatalog.h"
+
+static auto smallGif(uint8_t seed, uint16_t frames) -> GifBuilder {
+    GifBuilder builder(40, 30);
+    for (uint16_t i = 0; i < frames; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 40, 30, static_cast<uint8_t>(seed + i)));
+    }
+    return builder;
+}
+
+static auto fnv1a(const std::vector<uint8_t>& bytes) -> uint32_t {
+    uint32_t hash = 2166136261U;
+    for (const uint8_t byte : bytes) {
+        hash = (hash ^ byte) * 16777619U;
+    }
+    return hash;
+}
+
+static auto catalogued() -> std::set<std::string> {
+    std::set<std::string> paths;
+    GifCatalogCursor cursor;
+    GifCatalogEntry entry{};
+    TEST_ASSERT_TRUE(GifCatalog::openCursor(cursor));
+    while (GifCatalog::next(cursor, entry)) {
+        paths.insert(GifCatalog::path(entry).c_str());
+    }
+    return paths;
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-catalog").string();
+    std::filesystem::remove_all(mock::fsRoot);
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    std::filesystem::create_directories(mock::fsRoot + "/gifs");
+}
+
+void tearDown() {}
+
+void test_begin_catalogues_both_directories() {
+    const auto cat = smallGif(1, 3);
+    TEST_ASSERT_TRUE(cat.writeTo(mock::fsRoot + "/gif/cat.gif"));
+    TEST_ASSERT_TRUE(smallGif(9, 1).writeTo(mock::fsRoot + "/gif/dog.GIF"));
+    TEST_ASSERT_TRUE(smallGif(5, 2).writeTo(mock::fsRoot + "/gifs/dog.GIF"));
+    TEST_ASSERT_TRUE(GifBuilder(1, 1).writeTo(mock::fsRoot + "/gif/notes.txt"));
+
+    TEST_ASSERT_TRUE(GifCatalog::begin());
+    TEST_ASSERT_TRUE(catalogued() == std::set<std::string>({"/gif/cat.gif", "/gif/dog.GIF", "/gifs/dog.GIF"}));
+
+    GifCatalogEntry entry{};
+    const uint32_t readsBefore = mock::fsReadCalls;
+    TEST_ASSERT_TRUE(GifCatalog::find("cat.gif", entry));
+    // Header plus the probed buckets, the GIF itself and its directory are never touched
+    TEST_ASSERT_LESS_OR_EQUAL(4U, mock::fsReadCalls - readsBefore);
+
+    const auto bytes = cat.bytes();
+    TEST_ASSERT_EQUAL_STRING("/gif/cat.gif", GifCatalog::path(entry).c_str());
+    TEST_ASSERT_EQUAL(bytes.size(), entry.size);
+    TEST_ASSERT_EQUAL(fnv1a(bytes), entry.hash);
+    TEST_ASSERT_EQUAL(40, entry.width);
+    TEST_ASSERT_EQUAL(30, entry.height);
+    TEST_ASSERT_EQUAL(3, entry.frameCount);
+    TEST_ASSERT_EQUAL(300, entry.durationMs);
+
+    // /gifs wins over /gif like the old directory probes
+    TEST_ASSERT_TRUE(GifCatalog::find("dog.GIF", entry));
+    TEST_ASSERT_EQUAL_STRING("/gifs/dog.GIF", GifCatalog::path(entry).c_str());
+    TEST_ASSERT_EQUAL(2, entry.frameCount);
+    TEST_ASSERT_FALSE(GifCatalog::find("bird.gif", entry));
+    TEST_ASSERT_FALSE(GifCatalog::find("notes.txt", entry));
+}
+
+void test_updates_keep_catalogue_fresh_and_outside_changes_rebuild() {
+    TEST_ASSERT_TRUE(smallGif(1, 1).writeTo(mock::fsRoot + "/gif/a.gif"));
+    TEST_ASSERT_TRUE(GifCatalog::begin());
+
+    const auto replaced = smallGif(3, 4);
+    TEST_ASSERT_TRUE(smallGif(2, 2).writeTo(mock::fsRoot + "/gif/b.gif"));
+    TEST_ASSERT_TRUE(GifCatalog::upsert("/gif/b.gif"));
+    TEST_ASSERT_TRUE(replaced.writeTo(mock::fsRoot + "/gif/a.gif"));
+    TEST_ASSERT_TRUE(GifCatalog::upsert("/gif/a.gif"));
+    TEST_ASSERT_TRUE(std::filesystem::remove(mock::fsRoot + "/gif/b.gif"));
+    TEST_ASSERT_TRUE(GifCatalog::remove("/gif/b.gif"));
+    TEST_ASSERT_FALSE(GifCatalog::remove("/gif/b.gif"));
+
+    // Catalogue kept in step with every change: the boot check walks names only, no GIF is read
+    const uint32_t bytesBefore = mock::fsReadBytes;
+    TEST_ASSERT_TRUE(GifCatalog::begin());
+    TEST_ASSERT_LESS_THAN(static_cast<uint32_t>(replaced.bytes().size()), mock::fsReadBytes - bytesBefore);
+
+    GifCatalogEntry entry{};
+    TEST_ASSERT_TRUE(GifCatalog::find("a.gif", entry));
+    TEST_ASSERT_EQUAL(4, entry.frameCount);
+    TEST_ASSERT_FALSE(GifCatalog::find("b.gif", entry));
+
+    // Files changed behind the catalogue's back are picked up at the next boot
+    TEST_ASSERT_TRUE(smallGif(7, 5).writeTo(mock::fsRoot + "/gif/a.gif"));
+    TEST_ASSERT_TRUE(smallGif(8, 1).writeTo(mock::fsRoot + "/gifs/c.gif"));
+    TEST_ASSERT_TRUE(GifCatalog::begin());
+    TEST_ASSERT_TRUE(GifCatalog::find("a.gif", entry));
+    TEST_ASSERT_EQUAL(5, entry.frameCount);
+    TEST_ASSERT_TRUE(GifCatalog::find("c.gif", entry));
+
+    // A damaged catalogue is rebuilt as well
+    std::filesystem::resize_file(mock::fsRoot + GifCatalog::PATH, 8);
+    TEST_ASSERT_FALSE(GifCatalog::find("a.gif", entry));
+    TEST_ASSERT_TRUE(GifCatalog::begin());
+    TEST_ASSERT_TRUE(GifCatalog::find("a.gif", entry));
+}
+
+void test_table_grows_past_its_initial_buckets() {
+    TEST_ASSERT_TRUE(GifCatalog::begin());
+
+    const auto gif = smallGif(4, 1);
+    std::set<std::string> expected;
+    for (int i = 0; i < 3 * GifCatalog::MIN_BUCKETS; ++i) {
+        const std::string path = "/gif/g" + std::to_string(i) + ".gif";
+        TEST_ASSERT_TRUE(gif.writeTo(mock::fsRoot + path));
+        TEST_ASSERT_TRUE(GifCatalog::upsert(path.c_str()));
+        expected.insert(path);
+
+        // Deletes leave tombstones behind, the next growth drops them
+        if (i % 5 == 4) {
+            TEST_ASSERT_TRUE(GifCatalog::remove(path.c_str()));
+            expected.erase(path);
+        }
+    }
+
+    TEST_ASSERT_TRUE(catalogued() == expected);
+    GifCatalogEntry entry{};
+    TEST_ASSERT_TRUE(GifCatalog::find("g90.gif", entry));
+    TEST_ASSERT_FALSE(GifCatalog::find("g89.gif", entry));
+    TEST_ASSERT_GREATER_THAN(static_cast<int>(GifCatalog::MIN_BUCKETS * sizeof(GifCatalogEntry)),
+                             static_cast<int>(std::filesystem::file_size(mock::fsRoot + GifCatalog::PATH)));
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_catalogues_both_directories);
+    RUN_TEST(test_updates_keep_catalogue_fresh_and_outside_changes_rebuild);
+    RUN_TEST(test_table_grows_past_its_initial_buckets);
+    return UNITY_END();
+}
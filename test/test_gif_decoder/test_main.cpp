@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <unity.h>
+
+#include <vector>
+
+#include "GifBuilder.h"
+#include "GifMemoryFile.h"
+#include "MockPanel.h"
+#include "display/GifDecoder.h"
+
+struct DrawnLine {
+    int x;
+    int y;
+    int row;
+    int width;
+    int height;
+    uint8_t transparent;
+    uint8_t hasTransparency;
+    uint8_t disposal;
+    uint8_t isGlobalPalette;
+    std::vector<uint16_t> colors;
+    std::vector<uint8_t> pixels;
+
+    auto operator==(const DrawnLine& other) const -> bool {
+        return x == other.x && y == other.y && row == other.row && width == other.width && height == other.height &&
+               transparent == other.transparent && hasTransparency == other.hasTransparency &&
+               disposal == other.disposal && isGlobalPalette == other.isGlobalPalette && colors == other.colors &&
+               pixels == other.pixels;
+    }
+};
+
+struct DecodedFrame {
+    int result = 0;
+    int delayMs = 0;
+    std::vector<DrawnLine> lines;
+};
+
+static std::vector<DrawnLine>* s_lines = nullptr;
+
+static void captureLine(GIFDRAW* pDraw) {
+    DrawnLine line{};
+    line.x = pDraw->iX;
+    line.y = pDraw->iY;
+    line.row = pDraw->y;
+    line.width = pDraw->iWidth;
+    line.height = pDraw->iHeight;
+    line.transparent = pDraw->ucTransparent;
+    line.hasTransparency = pDraw->ucHasTransparency;
+    line.disposal = pDraw->ucDisposalMethod;
+    line.isGlobalPalette = pDraw->ucIsGlobalPalette;
+    line.pixels.assign(pDraw->pPixels, pDraw->pPixels + pDraw->iWidth);
+    for (const uint8_t index : line.pixels) {
+        line.colors.push_back(pDraw->pPalette[index]);
+    }
+    s_lines->push_back(line);
+}
+
+/**
+ * @brief Decode every frame of the current memory file
+ */
+template <typename Decoder>
+static auto decodeAll() -> std::vector<DecodedFrame> {
+    Decoder decoder;
+    TEST_ASSERT_TRUE(memgif::openWith(decoder, captureLine));
+
+    std::vector<DecodedFrame> frames;
+    for (int result = 1; result > 0;) {
+        DecodedFrame frame;
+        s_lines = &frame.lines;
+        frame.result = result = decoder.playFrame(false, &frame.delayMs, nullptr);
+        frames.push_back(frame);
+    }
+    decoder.close();
+    return frames;
+}
+
+/**
+ * @brief Every stored frame kind the firmware meets, compressed and literal
+ */
+static auto mixedGif() -> GifBuilder {
+    GifBuilder builder(200, 150);
+
+    auto background = GifBuilder::patternFrame(0, 0, 200, 150, 3);
+    background.compressed = true;
+    builder.addFrame(background);
+
+    builder.addFrame(GifBuilder::patternFrame(20, 30, 50, 40, 60));
+
+    auto overlay = GifBuilder::patternFrame(40, 10, 120, 90, 90);
+    overlay.compressed = true;
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    overlay.disposal = 2;
+    overlay.delayCs = 7;
+    for (size_t i = 0; i < overlay.pixels.size(); i += 4) {
+        overlay.pixels[i] = 0;
+    }
+    builder.addFrame(overlay);
+
+    // Noise fills the code table several times over, the encoder clears it at 4096 entries
+    auto noise = GifBuilder::patternFrame(0, 0, 200, 150, 0);
+    uint32_t lcg = 12345;
+    for (auto& pixel : noise.pixels) {
+        lcg = lcg * 1103515245U + 12345U;
+        pixel = static_cast<uint8_t>((lcg >> 16U) % 24U);
+    }
+    noise.compressed = true;
+    builder.addFrame(noise);
+
+    auto local = GifBuilder::patternFrame(10, 10, 64, 64, 200);
+    local.compressed = true;
+    for (size_t i = 0; i < 256; ++i) {
+        const auto value = static_cast<uint8_t>(i);
+        local.localPalette.insert(local.localPalette.end(), {static_cast<uint8_t>(255U - value), 0, value});
+    }
+    builder.addFrame(local);
+
+    return builder;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_lines_match_animated_gif() {
+    const auto builder = mixedGif();
+    memgif::data = builder.bytes();
+
+    const auto expected = decodeAll<AnimatedGIF>();
+    const auto decoded = decodeAll<GifDecoder>();
+
+    TEST_ASSERT_EQUAL(5, decoded.size());
+    TEST_ASSERT_EQUAL(expected.size(), decoded.size());
+    for (size_t i = 0; i < decoded.size(); ++i) {
+        TEST_ASSERT_EQUAL(expected[i].result, decoded[i].result);
+        TEST_ASSERT_EQUAL(expected[i].delayMs, decoded[i].delayMs);
+        TEST_ASSERT_EQUAL(expected[i].lines.size(), decoded[i].lines.size());
+        TEST_ASSERT_TRUE(expected[i].lines == decoded[i].lines);
+    }
+    TEST_ASSERT_EQUAL(0, decoded.back().result);
+    TEST_ASSERT_EQUAL(70, decoded[2].delayMs);
+    TEST_ASSERT_EQUAL(2, decoded[2].lines[0].disposal);
+    TEST_ASSERT_EQUAL(0, decoded[4].lines[0].isGlobalPalette);
+
+    // Against the source pixels too, not only against the other decoder
+    const auto& noise = decoded[3].lines;
+    uint32_t lcg = 12345;
+    for (const auto& line : noise) {
+        for (const uint8_t pixel : line.pixels) {
+            lcg = lcg * 1103515245U + 12345U;
+            TEST_ASSERT_EQUAL_UINT8((lcg >> 16U) % 24U, pixel);
+        }
+    }
+
+    // Chunked input: a handful of reads per frame instead of one per field
+    TEST_ASSERT_LESS_THAN(memgif::data.size() / 512U + 5U * 4U, memgif::readCalls);
+}
+
+void test_interlaced_rows_arrive_with_their_image_row() {
+    for (const uint16_t height : {37, 40, 1, 5}) {
+        GifBuilder builder(30, height);
+        auto frame = GifBuilder::patternFrame(0, 0, 30, height, 11);
+        frame.interlaced = true;
+        frame.compressed = height % 2 == 1;
+        builder.addFrame(frame);
+        memgif::data = builder.bytes();
+
+        const auto decoded = decodeAll<GifDecoder>();
+        TEST_ASSERT_EQUAL(1, decoded.size());
+        TEST_ASSERT_EQUAL(height, decoded[0].lines.size());
+
+        // Passes in order: 0, 8, 16.. first and every image row exactly once
+        std::vector<int> seen(height, 0);
+        TEST_ASSERT_EQUAL(0, decoded[0].lines[0].row);
+        for (const auto& line : decoded[0].lines) {
+            ++seen[static_cast<size_t>(line.row)];
+            const auto begin = frame.pixels.begin() + static_cast<long>(line.row) * 30;
+            TEST_ASSERT_TRUE(std::vector<uint8_t>(begin, begin + 30) == line.pixels);
+        }
+        TEST_ASSERT_TRUE(std::vector<int>(height, 1) == seen);
+    }
+}
+
+void test_rewind_replays_frames_from_saved_position() {
+    const auto builder = mixedGif();
+    memgif::data = builder.bytes();
+
+    GifDecoder decoder;
+    TEST_ASSERT_TRUE(memgif::openWith(decoder, captureLine));
+    std::vector<DrawnLine> lines;
+    s_lines = &lines;
+    int delayMs = 0;
+
+    // The file position after a frame is the start of the next one, like AnimatedGIF leaves it
+    TEST_ASSERT_EQUAL(1, decoder.playFrame(false, &delayMs, nullptr));
+    const int32_t second = memgif::lastFile->iPos;
+    TEST_ASSERT_EQUAL_HEX8(0x21, memgif::data[static_cast<size_t>(second)]);
+
+    lines.clear();
+    TEST_ASSERT_EQUAL(1, decoder.playFrame(false, &delayMs, nullptr));
+    const auto first = lines;
+    (void)decoder.playFrame(false, &delayMs, nullptr);
+
+    memgif::seek(memgif::lastFile, second);
+    lines.clear();
+    TEST_ASSERT_EQUAL(1, decoder.playFrame(false, &delayMs, nullptr));
+    TEST_ASSERT_TRUE(first == lines);
+    decoder.close();
+}
+
+void test_truncated_frame_still_sends_every_row() {
+    GifBuilder builder(40, 30);
+    auto frame = GifBuilder::patternFrame(0, 0, 40, 30, 5);
+    frame.transparent = true;
+    frame.transparentIndex = 7;
+    builder.addFrame(frame);
+    memgif::data = builder.bytes();
+    memgif::data.resize(memgif::data.size() - 600);
+
+    const auto decoded = decodeAll<GifDecoder>();
+    TEST_ASSERT_EQUAL(1, decoded.size());
+    TEST_ASSERT_EQUAL(0, decoded[0].result);
+    TEST_ASSERT_EQUAL(30, decoded[0].lines.size());
+    TEST_ASSERT_TRUE(frame.pixels.front() == decoded[0].lines[0].pixels[0]);
+    TEST_ASSERT_EQUAL(7, decoded[0].lines.back().pixels.back());
+
+    // Not a GIF at all
+    memgif::data = {'P', 'N', 'G', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    GifDecoder decoder;
+    TEST_ASSERT_FALSE(memgif::openWith(decoder, captureLine));
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_lines_match_animated_gif);
+    RUN_TEST(test_interlaced_rows_arrive_with_their_image_row);
+    RUN_TEST(test_rewind_replays_frames_from_saved_position);
+    RUN_TEST(test_truncated_frame_still_sends_every_row);
+    return UNITY_END();
+}
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static void writeGif(const char* name) {
+    GifBuilder builder(60, 60);
+    for (int i = 0; i < 2; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 60, 60, static_cast<uint8_t>(i * 50)));
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-decoder-pool").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    writeGif("/gif/pool.gif");
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_playback_starts_without_free_heap() {
+    // No heap block left at all: every start and stop reuses the slot reserved at boot
+    mock::freeHeap = 0;
+
+    Gif gif;
+    for (int i = 0; i < 20; ++i) {
+        TEST_ASSERT_TRUE(gif.playOne("/gif/pool.gif"));
+        gif.update();
+        TEST_ASSERT_TRUE(gif.isPlaying());
+        gif.stop();
+        TEST_ASSERT_FALSE(gif.isPlaying());
+    }
+
+    TEST_ASSERT_GREATER_THAN(static_cast<int>(sizeof(AnimatedGIF)), static_cast<int>(Gif::reservedBytes()));
+}
+
+void test_idle_player_yields_slot_to_the_next() {
+    Gif first;
+    TEST_ASSERT_TRUE(first.playOne("/gif/pool.gif"));
+    while (first.isPlaying()) {
+        first.update();
+        mock::advanceMs(100);
+    }
+
+    // A finished player still holds the slot until another one starts
+    Gif second;
+    TEST_ASSERT_TRUE(second.playOne("/gif/pool.gif"));
+    second.update();
+    TEST_ASSERT_EQUAL(1, second.getPipelineStats().frames);
+
+    // Only one decoder exists, the playing owner keeps it
+    TEST_ASSERT_FALSE(first.begin());
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_playback_starts_without_free_heap);
+    RUN_TEST(test_idle_player_yields_slot_to_the_next);
+    return UNITY_END();
+}
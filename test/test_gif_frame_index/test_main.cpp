@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+#include "display/GifFrameIndex.h"
+
+static constexpr uint16_t PLAYS = 3;
+
+/**
+ * @brief Five frames: full, partial, partial with transparency, full, partial
+ */
+static auto keyframeGif() -> GifBuilder {
+    GifBuilder builder(120, 120);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, 1));
+    builder.addFrame(GifBuilder::patternFrame(10, 10, 40, 30, 50));
+    auto overlay = GifBuilder::patternFrame(30, 20, 50, 50, 90);
+    overlay.transparent = true;
+    overlay.delayCs = 25;
+    builder.addFrame(overlay);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, 130));
+    builder.addFrame(GifBuilder::patternFrame(60, 70, 20, 20, 170));
+    return builder;
+}
+
+/**
+ * @brief Decode the first frames of a file one update at a time and capture the panel
+ */
+static auto gramAfterFrames(const char* path, int frames) -> std::vector<uint16_t> {
+    Gif gif;
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+    for (int i = 0; i < frames; ++i) {
+        gif.update();
+        mock::advanceMs(250);
+    }
+    return captureGram();
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-frame-index").string();
+    std::filesystem::remove_all(mock::fsRoot);
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    mock::freeHeap = 8000;
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_index_records_offsets_delays_and_rects() {
+    const auto builder = keyframeGif();
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/key.gif"));
+    const auto bytes = builder.bytes();
+
+    TEST_ASSERT_TRUE(GifFrameIndex::build("/gif/key.gif"));
+    TEST_ASSERT_EQUAL_STRING("/gifidx/gif/key.gif.idx", GifFrameIndex::sidecarPath("/gif/key.gif").c_str());
+
+    GifFrameIndexHeader header{};
+    GifFrameEntry first{};
+    TEST_ASSERT_TRUE(GifFrameIndex::load("/gif/key.gif", static_cast<uint32_t>(bytes.size()), header, first));
+    TEST_ASSERT_EQUAL(5, header.frameCount);
+    TEST_ASSERT_EQUAL(100 + 100 + 250 + 100 + 100, header.durationMs);
+
+    // The first frame starts right after the global colour table, every frame at its control extension
+    TEST_ASSERT_EQUAL(13 + 768, first.offset);
+    File sidecar = LittleFS.open(GifFrameIndex::sidecarPath("/gif/key.gif"), "r");
+    for (uint16_t i = 0; i < header.frameCount; ++i) {
+        GifFrameEntry entry{};
+        TEST_ASSERT_TRUE(GifFrameIndex::readEntry(sidecar, i, entry));
+        TEST_ASSERT_EQUAL_HEX8(0x21, bytes[entry.offset]);
+        TEST_ASSERT_EQUAL_HEX8(0xF9, bytes[entry.offset + 1]);
+    }
+
+    GifFrameEntry overlay{};
+    TEST_ASSERT_TRUE(GifFrameIndex::readEntry(sidecar, 2, overlay));
+    TEST_ASSERT_EQUAL(250, overlay.delayMs);
+    TEST_ASSERT_EQUAL(GIF_FRAME_TRANSPARENT, overlay.flags);
+    TEST_ASSERT_EQUAL(30, overlay.x);
+    TEST_ASSERT_EQUAL(20, overlay.y);
+    TEST_ASSERT_EQUAL(50, overlay.width);
+    TEST_ASSERT_EQUAL(50, overlay.height);
+    GifFrameEntry full{};
+    TEST_ASSERT_TRUE(GifFrameIndex::readEntry(sidecar, 3, full));
+    TEST_ASSERT_EQUAL(GIF_FRAME_FULL_CANVAS, full.flags);
+    sidecar.close();
+
+    // A sidecar built for another version of the file is stale, ensure() rebuilds it
+    GifBuilder changed(120, 120);
+    changed.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, 7));
+    TEST_ASSERT_TRUE(changed.writeTo(mock::fsRoot + "/gif/key.gif"));
+    const auto changedSize = static_cast<uint32_t>(changed.bytes().size());
+    TEST_ASSERT_FALSE(GifFrameIndex::load("/gif/key.gif", changedSize, header, first));
+    TEST_ASSERT_TRUE(GifFrameIndex::ensure("/gif/key.gif"));
+    TEST_ASSERT_TRUE(GifFrameIndex::load("/gif/key.gif", changedSize, header, first));
+    TEST_ASSERT_EQUAL(1, header.frameCount);
+
+    GifFrameIndex::remove("/gif/key.gif");
+    TEST_ASSERT_FALSE(LittleFS.exists(GifFrameIndex::sidecarPath("/gif/key.gif")));
+}
+
+void test_indexed_loops_rewind_without_reopening() {
+    const auto builder = keyframeGif();
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/loop.gif"));
+
+    uint32_t reads[2] = {};
+    uint32_t rewinds[2] = {};
+    std::vector<uint16_t> grams[2];
+    for (int indexed = 0; indexed < 2; ++indexed) {
+        if (indexed == 1) {
+            TEST_ASSERT_TRUE(GifFrameIndex::build("/gif/loop.gif"));
+        }
+
+        Gif gif;
+        gif.setReadCacheEnabled(false);
+        gif.setPlayCount(PLAYS);
+        TEST_ASSERT_TRUE(gif.begin());
+        TEST_ASSERT_TRUE(gif.playOne("/gif/loop.gif"));
+        TEST_ASSERT_EQUAL(indexed == 1 ? 5 : 0, gif.getPosition().frameCount);
+        while (gif.isPlaying()) {
+            gif.update();
+            mock::advanceMs(250);
+        }
+
+        TEST_ASSERT_EQUAL(5 * PLAYS, gif.getPipelineStats().frames);
+        reads[indexed] = static_cast<uint32_t>(gif.getPipelineStats().fileReadCalls);
+        rewinds[indexed] = gif.getPipelineStats().indexRewinds;
+        grams[indexed] = captureGram();
+    }
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "%u plays: %u decoder reads reopening, %u with index rewinds", PLAYS, reads[0],
+             reads[1]);
+    TEST_MESSAGE(msg);
+
+    TEST_ASSERT_EQUAL(0, rewinds[0]);
+    TEST_ASSERT_EQUAL(PLAYS - 1, rewinds[1]);
+    TEST_ASSERT_LESS_THAN(reads[0], reads[1]);
+    TEST_ASSERT_TRUE(grams[0] == grams[1]);
+}
+
+void test_seek_rebuilds_canvas_from_last_full_frame() {
+    const auto builder = keyframeGif();
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/seek.gif"));
+    TEST_ASSERT_TRUE(GifFrameIndex::build("/gif/seek.gif"));
+
+    for (const uint16_t target : {2, 4, 1}) {
+        const auto expected = gramAfterFrames("/gif/seek.gif", target + 1);
+
+        // Other content on the panel first: the seek must repaint everything the target frame shows
+        gramAfterFrames("/gif/seek.gif", 4);
+        Gif gif;
+        TEST_ASSERT_TRUE(gif.begin());
+        TEST_ASSERT_TRUE(gif.playOne("/gif/seek.gif"));
+        gif.update();
+        TEST_ASSERT_TRUE(gif.seekToFrame(target));
+        TEST_ASSERT_EQUAL(target, gif.getPosition().frame);
+        gif.update();
+
+        TEST_ASSERT_TRUE(expected == captureGram());
+        TEST_ASSERT_FALSE(gif.seekToFrame(5));
+    }
+
+    // Without an index there is nothing to seek with
+    GifFrameIndex::remove("/gif/seek.gif");
+    Gif gif;
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne("/gif/seek.gif"));
+    TEST_ASSERT_FALSE(gif.seekToFrame(1));
+}
+
+void test_speed_scales_frame_deadlines() {
+    GifBuilder builder(40, 40);
+    for (int i = 0; i < 4; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 40, 40, static_cast<uint8_t>(i * 30)));
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/speed.gif"));
+
+    // 100 ms frames; out of range speeds are clamped to 50..400 %
+    const std::pair<uint16_t, uint32_t> cases[] = {{200, 50}, {50, 200}, {400, 25}, {1000, 25}, {10, 200}};
+    for (const auto& [percent, stepMs] : cases) {
+        Gif gif;
+        gif.setSpeed(percent);
+        TEST_ASSERT_TRUE(gif.begin());
+        TEST_ASSERT_TRUE(gif.playOne("/gif/speed.gif"));
+
+        const uint32_t start = gif.getNextFrameDueMs();
+        gif.update();
+        TEST_ASSERT_EQUAL(start + stepMs, gif.getNextFrameDueMs());
+        mock::advanceMs(stepMs);
+        gif.update();
+        TEST_ASSERT_EQUAL(start + 2 * stepMs, gif.getNextFrameDueMs());
+        TEST_ASSERT_EQUAL(0, gif.getPipelineStats().lateFrames);
+    }
+}
+
+void test_time_cap_counts_authored_time() {
+    // 12 s authored, 24 s on the clock at half speed, past the 20 s cap of a file
+    GifBuilder builder(40, 40);
+    for (int i = 0; i < 20; ++i) {
+        auto frame = GifBuilder::patternFrame(0, 0, 40, 40, static_cast<uint8_t>(i * 10));
+        frame.delayCs = 60;
+        builder.addFrame(frame);
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/slow.gif"));
+
+    Gif gif;
+    gif.setSpeed(50);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne("/gif/slow.gif"));
+    for (int i = 0; i < 40 && gif.isPlaying(); ++i) {
+        gif.update();
+        mock::advanceMs(gif.getNextFrameDueMs() - millis());
+    }
+    TEST_ASSERT_EQUAL(20, gif.getPipelineStats().frames);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_index_records_offsets_delays_and_rects);
+    RUN_TEST(test_indexed_loops_rewind_without_reopening);
+    RUN_TEST(test_seek_rebuilds_canvas_from_last_full_frame);
+    RUN_TEST(test_speed_scales_frame_deadlines);
+    RUN_TEST(test_time_cap_counts_authored_time);
+    return UNITY_END();
+}
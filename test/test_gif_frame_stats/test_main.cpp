@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+#include "display/GifFrameStats.h"
+
+static constexpr int FRAME_COUNT = 6;
+static constexpr uint32_t FRAME_BYTES = 240U * 240U * 2U;
+static constexpr uint32_t SPI_NS_PER_BYTE = 100;
+static constexpr uint32_t YIELD_US = 20;
+
+/**
+ * @brief Draw frames one update at a time, polling every millisecond
+ */
+static void drawFrames(Gif& gif, int count) {
+    for (int drawn = 0; drawn < count;) {
+        const uint32_t frames = gif.getPipelineStats().frames;
+        gif.update();
+        if (gif.getPipelineStats().frames != frames) {
+            ++drawn;
+        }
+        mock::advanceMs(1);
+    }
+}
+
+static void writeGif(const char* name, uint16_t delayCs) {
+    GifBuilder builder(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        auto frame = GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 30));
+        frame.delayCs = delayCs;
+        builder.addFrame(frame);
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-frame-stats").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {
+    mock::spiNanosPerByte = 0;
+    mock::yieldCostUs = 0;
+}
+
+void test_window_keeps_last_frames_with_mean_and_p95() {
+    GifFrameStats stats;
+    TEST_ASSERT_EQUAL(0, stats.summarize(GifFrameMetric::DecodeUs).p95);
+
+    for (uint32_t i = 1; i <= 20; ++i) {
+        GifFrameSample sample;
+        sample.decodeUs = i;
+        stats.record(sample, i % 4 == 0);
+    }
+    TEST_ASSERT_EQUAL(10, stats.summarize(GifFrameMetric::DecodeUs).avg);
+    TEST_ASSERT_EQUAL(19, stats.summarize(GifFrameMetric::DecodeUs).p95);
+    TEST_ASSERT_EQUAL(5, stats.lateFrames());
+
+    // Older frames roll out of the window, the counters keep them
+    for (uint32_t i = 21; i <= 100; ++i) {
+        GifFrameSample sample;
+        sample.decodeUs = i;
+        stats.record(sample, false);
+    }
+    stats.recordDrop();
+    TEST_ASSERT_EQUAL(GifFrameStats::WINDOW, stats.samples());
+    TEST_ASSERT_EQUAL(100, stats.frames());
+    TEST_ASSERT_EQUAL(1, stats.droppedFrames());
+    TEST_ASSERT_EQUAL(84, stats.summarize(GifFrameMetric::DecodeUs).avg);
+    TEST_ASSERT_EQUAL(99, stats.summarize(GifFrameMetric::DecodeUs).p95);
+
+    stats.reset();
+    TEST_ASSERT_EQUAL(0, stats.samples());
+    TEST_ASSERT_EQUAL(0, stats.frames());
+}
+
+void test_playback_splits_frame_cost_per_file_and_session() {
+    writeGif("/gif/first.gif", 10);
+    writeGif("/gif/second.gif", 5);
+    mock::spiNanosPerByte = SPI_NS_PER_BYTE;
+    mock::yieldCostUs = YIELD_US;
+
+    Gif gif;
+    TEST_ASSERT_TRUE(gif.playOne("/gif/first.gif"));
+    drawFrames(gif, FRAME_COUNT);
+
+    // Opaque full screen frames are streamed: one window and a whole frame of pixels each
+    const GifFrameStats& file = gif.getFileTiming();
+    TEST_ASSERT_EQUAL(FRAME_COUNT, file.frames());
+    TEST_ASSERT_EQUAL(1, file.summarize(GifFrameMetric::Windows).p95);
+    TEST_ASSERT_EQUAL(FRAME_BYTES, file.summarize(GifFrameMetric::Bytes).avg);
+    TEST_ASSERT_EQUAL(FRAME_BYTES * SPI_NS_PER_BYTE / 1000U, file.summarize(GifFrameMetric::SpiUs).avg);
+    TEST_ASSERT_GREATER_OR_EQUAL(241U * YIELD_US, file.summarize(GifFrameMetric::YieldUs).avg);
+    TEST_ASSERT_EQUAL(0, file.summarize(GifFrameMetric::DecodeUs).p95);
+
+    // Every frame but the first waited out its 100 ms delay, drawn within the 1 ms polling step
+    TEST_ASSERT_EQUAL(100, file.summarize(GifFrameMetric::DelayMs).p95);
+    TEST_ASSERT_GREATER_OR_EQUAL(100U, file.summarize(GifFrameMetric::IntervalMs).p95);
+    TEST_ASSERT_LESS_OR_EQUAL(101U, file.summarize(GifFrameMetric::IntervalMs).p95);
+    TEST_ASSERT_FLOAT_WITHIN(0.5F, 10.0F * FRAME_COUNT / (FRAME_COUNT - 1), file.fps(GifFrameMetric::DelayMs));
+    TEST_ASSERT_FLOAT_WITHIN(0.5F, file.fps(GifFrameMetric::DelayMs), file.fps(GifFrameMetric::IntervalMs));
+    TEST_ASSERT_EQUAL(0, file.lateFrames());
+
+    // 50 ms frames cost about 17 ms each: nothing is late either, the next file starts a fresh window
+    TEST_ASSERT_TRUE(gif.playOne("/gif/second.gif"));
+    drawFrames(gif, 2);
+    TEST_ASSERT_EQUAL(2, gif.getFileTiming().frames());
+    TEST_ASSERT_EQUAL(50, gif.getFileTiming().summarize(GifFrameMetric::DelayMs).p95);
+    TEST_ASSERT_EQUAL(FRAME_COUNT + 2, gif.getSessionTiming().frames());
+    TEST_ASSERT_EQUAL(100, gif.getSessionTiming().summarize(GifFrameMetric::DelayMs).p95);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "session: decode %u us, spi %u us, yield %u us per frame, %.1f of %.1f fps",
+             gif.getSessionTiming().summarize(GifFrameMetric::DecodeUs).avg,
+             gif.getSessionTiming().summarize(GifFrameMetric::SpiUs).avg,
+             gif.getSessionTiming().summarize(GifFrameMetric::YieldUs).avg,
+             static_cast<double>(gif.getSessionTiming().fps(GifFrameMetric::IntervalMs)),
+             static_cast<double>(gif.getSessionTiming().fps(GifFrameMetric::DelayMs)));
+    TEST_MESSAGE(msg);
+}
+
+void test_late_and_dropped_frames_are_counted() {
+    writeGif("/gif/late.gif", 5);
+
+    Gif gif;
+    gif.setLoopEnabled(true);
+    TEST_ASSERT_TRUE(gif.playOne("/gif/late.gif"));
+    drawFrames(gif, 1);
+
+    // A stall longer than two delays: the next frame is decoded without drawing, the one after is late
+    mock::advanceMs(120);
+    drawFrames(gif, 1);
+
+    const GifFrameStats& file = gif.getFileTiming();
+    TEST_ASSERT_EQUAL(2, file.frames());
+    TEST_ASSERT_EQUAL(1, file.droppedFrames());
+    TEST_ASSERT_EQUAL(1, file.lateFrames());
+    TEST_ASSERT_EQUAL(100, file.summarize(GifFrameMetric::DelayMs).p95);
+    TEST_ASSERT_GREATER_THAN(100U, file.summarize(GifFrameMetric::IntervalMs).p95);
+    TEST_ASSERT_GREATER_THAN(5U, file.summarize(GifFrameMetric::LateMs).p95);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_window_keeps_last_frames_with_mean_and_p95);
+    RUN_TEST(test_playback_splits_frame_cost_per_file_and_session);
+    RUN_TEST(test_late_and_dropped_frames_are_counted);
+    return UNITY_END();
+}
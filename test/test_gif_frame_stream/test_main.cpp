@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static constexpr int FRAME_COUNT = 3;
+
+struct RunResult {
+    Arduino_TFT::Counters counters;
+    GifPipelineStats stats;
+    std::vector<uint16_t> gram;
+};
+
+/**
+ * @brief Play a GIF file to the end on the mock panel and capture counters and GRAM
+ */
+static auto playToEnd(const char* path, bool streaming) -> RunResult {
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setFrameStreamingEnabled(streaming);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+    }
+
+    RunResult result;
+    result.counters = g_panel.counters();
+    result.stats = gif.getPipelineStats();
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            result.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+
+    return result;
+}
+
+static void writeGif(const char* name, const GifBuilder& builder) {
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-frame-stream").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_opaque_fullscreen_uses_one_window_per_frame() {
+    GifBuilder builder(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 40)));
+    }
+    writeGif("/gif/opaque.gif", builder);
+
+    const auto lineByLine = playToEnd("/gif/opaque.gif", false);
+    const auto streamed = playToEnd("/gif/opaque.gif", true);
+
+    TEST_ASSERT_EQUAL(FRAME_COUNT * 240, lineByLine.counters.addrWindows);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, streamed.counters.addrWindows);
+    TEST_ASSERT_EQUAL(lineByLine.counters.pixelBytes, streamed.counters.pixelBytes);
+    TEST_ASSERT_TRUE(lineByLine.gram == streamed.gram);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, streamed.stats.frames);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, streamed.stats.streamedFrames);
+    TEST_ASSERT_EQUAL(0, lineByLine.stats.streamedFrames);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "per frame: %u -> %u commands, %u command bytes saved, %u pixel bytes",
+             static_cast<unsigned>(lineByLine.counters.commands / FRAME_COUNT),
+             static_cast<unsigned>(streamed.counters.commands / FRAME_COUNT),
+             static_cast<unsigned>((lineByLine.counters.commandBytes - streamed.counters.commandBytes) / FRAME_COUNT),
+             static_cast<unsigned>(streamed.counters.pixelBytes / FRAME_COUNT));
+    TEST_MESSAGE(msg);
+}
+
+void test_small_centered_gif_is_streamed() {
+    GifBuilder builder(120, 80);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 120, 80, 3));
+    writeGif("/gif/small.gif", builder);
+
+    const auto lineByLine = playToEnd("/gif/small.gif", false);
+    const auto streamed = playToEnd("/gif/small.gif", true);
+
+    TEST_ASSERT_EQUAL(1, streamed.counters.addrWindows);
+    TEST_ASSERT_TRUE(lineByLine.gram == streamed.gram);
+
+    // Palette arrives pre-swapped, the panel must still see the right colour (index 4 at 60,80)
+    const uint16_t expected = static_cast<uint16_t>(((4U & 0xF8U) << 8U) | ((251U & 0xFCU) << 3U) | (28U >> 3U));
+    TEST_ASSERT_EQUAL(expected, g_panel.pixelAt(60, 80));
+}
+
+void test_transparent_frame_falls_back_to_line_path() {
+    GifBuilder builder(240, 240);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 1));
+
+    auto overlay = GifBuilder::patternFrame(20, 20, 100, 100, 9);
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    for (size_t i = 0; i < overlay.pixels.size(); i += 3) {
+        overlay.pixels[i] = 0;
+    }
+    builder.addFrame(overlay);
+    writeGif("/gif/transparent.gif", builder);
+
+    const auto lineByLine = playToEnd("/gif/transparent.gif", false);
+    const auto streamed = playToEnd("/gif/transparent.gif", true);
+
+    // First frame is streamed, the transparent overlay still uses one window per opaque run
+    TEST_ASSERT_GREATER_THAN(100U, streamed.counters.addrWindows);
+    TEST_ASSERT_LESS_THAN(lineByLine.counters.addrWindows, streamed.counters.addrWindows);
+    TEST_ASSERT_TRUE(lineByLine.gram == streamed.gram);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_opaque_fullscreen_uses_one_window_per_frame);
+    RUN_TEST(test_small_centered_gif_is_streamed);
+    RUN_TEST(test_transparent_frame_falls_back_to_line_path);
+    return UNITY_END();
+}
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+// Same window cost as the firmware model: pixel bytes that fit in the time of one address window
+static constexpr uint32_t WINDOW_COST_BYTES = 36;
+static constexpr double SPI_MHZ = 40.0;
+
+struct RunResult {
+    Arduino_TFT::Counters counters;
+    std::vector<uint16_t> gram;
+};
+
+/**
+ * @brief Clear the mock panel to black, the way DisplayManager::clearScreen() does before playback
+ */
+static void clearPanel() {
+    const std::vector<uint8_t> black(240U * 240U * 2U, 0);
+    g_panel.writeAddrWindow(0, 0, 240, 240);
+    g_panel.writeBytes(black.data(), static_cast<uint32_t>(black.size()));
+}
+
+static auto playToEnd(const std::string& path, bool coalesce) -> RunResult {
+    clearPanel();
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setGapCoalescingEnabled(coalesce);
+    gif.markPanelCleared();
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path.c_str()));
+
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+    }
+
+    RunResult result;
+    result.counters = g_panel.counters();
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            result.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Estimated SPI time at 40 MHz, window overhead expressed with the firmware cost model
+ */
+static auto estimateUs(const Arduino_TFT::Counters& counters) -> double {
+    const double bytes = counters.pixelBytes + static_cast<double>(counters.addrWindows) * WINDOW_COST_BYTES;
+    return bytes * 8.0 / SPI_MHZ;
+}
+
+/**
+ * @brief Single transparent frame where pixel i is transparent when keep(i) is false
+ */
+template <typename Keep>
+static auto transparentFrame(uint8_t seed, Keep keep) -> GifFrameSpec {
+    auto frame = GifBuilder::patternFrame(0, 0, 240, 240, seed);
+    frame.transparent = true;
+    frame.transparentIndex = 0;
+    for (size_t i = 0; i < frame.pixels.size(); ++i) {
+        if (!keep(i)) {
+            frame.pixels[i] = 0;
+        }
+    }
+    return frame;
+}
+
+static auto writeGif(const std::string& name, const GifBuilder& builder) -> std::string {
+    const std::string path = "/gif/" + name;
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + path));
+    return path;
+}
+
+static void report(const char* name, const RunResult& split, const RunResult& merged) {
+    char msg[200];
+    snprintf(msg, sizeof(msg), "%-10s windows %6u -> %5u, pixel bytes %6u -> %6u, est. SPI %7.0f -> %7.0f us", name,
+             static_cast<unsigned>(split.counters.addrWindows), static_cast<unsigned>(merged.counters.addrWindows),
+             static_cast<unsigned>(split.counters.pixelBytes), static_cast<unsigned>(merged.counters.pixelBytes),
+             estimateUs(split.counters), estimateUs(merged.counters));
+    TEST_MESSAGE(msg);
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-gap-coalesce").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_dithered_gaps_over_cleared_panel_are_merged() {
+    GifBuilder builder(240, 240);
+    builder.addFrame(transparentFrame(3, [](size_t i) { return (i + (i / 240U)) % 3U != 0U; }));
+    const auto path = writeGif("dither.gif", builder);
+
+    const auto split = playToEnd(path, false);
+    const auto merged = playToEnd(path, true);
+
+    TEST_ASSERT_TRUE(split.gram == merged.gram);
+    TEST_ASSERT_GREATER_OR_EQUAL(240U * 80U, split.counters.addrWindows);
+    TEST_ASSERT_EQUAL(240U, merged.counters.addrWindows);
+    TEST_ASSERT_LESS_THAN(estimateUs(split.counters), estimateUs(merged.counters));
+}
+
+void test_wide_gaps_stay_split() {
+    GifBuilder builder(240, 240);
+    // Two 20 px sprites per row, 100 px apart: a merge would cost more than the extra window
+    builder.addFrame(transparentFrame(5, [](size_t i) {
+        const size_t col = i % 240U;
+        return col < 20U || (col >= 120U && col < 140U);
+    }));
+    const auto path = writeGif("sprites.gif", builder);
+
+    const auto split = playToEnd(path, false);
+    const auto merged = playToEnd(path, true);
+
+    TEST_ASSERT_TRUE(split.gram == merged.gram);
+    TEST_ASSERT_EQUAL(split.counters.addrWindows, merged.counters.addrWindows);
+}
+
+void test_unknown_background_is_not_merged() {
+    GifBuilder builder(240, 240);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 7));
+    builder.addFrame(transparentFrame(9, [](size_t i) { return i % 4U != 0U; }));
+    const auto path = writeGif("over-opaque.gif", builder);
+
+    const auto split = playToEnd(path, false);
+    const auto merged = playToEnd(path, true);
+
+    // The overlay sits on the previous frame's pixels, filling its gaps would erase them
+    TEST_ASSERT_TRUE(split.gram == merged.gram);
+    TEST_ASSERT_EQUAL(split.counters.addrWindows, merged.counters.addrWindows);
+}
+
+void test_benchmark_sample_transparent_gifs() {
+    struct Sample {
+        const char* name;
+        GifBuilder builder;
+    };
+
+    std::vector<Sample> samples;
+
+    samples.push_back({"dither-3", GifBuilder(240, 240)});
+    samples.back().builder.addFrame(transparentFrame(1, [](size_t i) { return (i + (i / 240U)) % 3U != 0U; }));
+
+    samples.push_back({"sparse-2", GifBuilder(240, 240)});
+    samples.back().builder.addFrame(
+        transparentFrame(2, [](size_t i) { return ((i * 2654435761U) >> 16U) % 2U != 0U; }));
+
+    samples.push_back({"holes-8px", GifBuilder(240, 240)});
+    samples.back().builder.addFrame(transparentFrame(4, [](size_t i) { return (i % 240U) % 24U >= 8U; }));
+
+    samples.push_back({"sprites", GifBuilder(240, 240)});
+    samples.back().builder.addFrame(transparentFrame(6, [](size_t i) { return (i % 240U) % 80U < 16U; }));
+
+    for (const auto& sample : samples) {
+        const auto path = writeGif(std::string(sample.name) + ".gif", sample.builder);
+        const auto split = playToEnd(path, false);
+        const auto merged = playToEnd(path, true);
+
+        TEST_ASSERT_TRUE(split.gram == merged.gram);
+        TEST_ASSERT_TRUE(estimateUs(merged.counters) <= estimateUs(split.counters));
+        report(sample.name, split, merged);
+    }
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_dithered_gaps_over_cleared_panel_are_merged);
+    RUN_TEST(test_wide_gaps_stay_split);
+    RUN_TEST(test_unknown_background_is_not_merged);
+    RUN_TEST(test_benchmark_sample_transparent_gifs);
+    return UNITY_END();
+}
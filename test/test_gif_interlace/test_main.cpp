@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static constexpr int FRAME_COUNT = 12;
+static constexpr uint32_t FRAME_BYTES = 240U * 240U * 2U;
+
+// Full frames take 69 ms against a 50 ms delay, interlaced ones 35 ms
+static constexpr uint32_t SLOW_SPI_NS_PER_BYTE = 600;
+static constexpr uint32_t FAST_SPI_NS_PER_BYTE = 100;
+
+/**
+ * @brief Draw frames one update at a time, polling every millisecond
+ *
+ * @return Pixel bytes sent for the last frame
+ */
+static auto drawFrames(Gif& gif, int count) -> uint32_t {
+    uint32_t lastBytes = 0;
+    for (int drawn = 0; drawn < count;) {
+        const uint32_t frames = gif.getPipelineStats().frames;
+        const uint32_t bytes = g_panel.counters().pixelBytes;
+        gif.update();
+        if (gif.getPipelineStats().frames != frames) {
+            lastBytes = g_panel.counters().pixelBytes - bytes;
+            ++drawn;
+        }
+        mock::advanceMs(1);
+    }
+    return lastBytes;
+}
+
+static void writeGif(const char* name, bool partial) {
+    GifBuilder builder(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        auto frame = partial && i > 0 ? GifBuilder::patternFrame(20, 20, 200, 200, static_cast<uint8_t>(i * 20))
+                                      : GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 20));
+        frame.delayCs = 5;
+        builder.addFrame(frame);
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-interlace").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    g_panel.resetCounters();
+}
+
+void tearDown() { mock::spiNanosPerByte = 0; }
+
+void test_sustained_lateness_halves_rows_until_headroom_returns() {
+    writeGif("/gif/full.gif", false);
+
+    Gif gif;
+    gif.setFrameDropEnabled(false);
+    gif.setLoopEnabled(true);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne("/gif/full.gif"));
+
+    mock::spiNanosPerByte = SLOW_SPI_NS_PER_BYTE;
+    TEST_ASSERT_EQUAL(FRAME_BYTES, drawFrames(gif, 2));
+    TEST_ASSERT_FALSE(gif.getPipelineStats().interlaced);
+
+    // Every frame falls further behind: interlacing kicks in and the schedule is caught up
+    drawFrames(gif, 4);
+    TEST_ASSERT_TRUE(gif.getPipelineStats().interlaced);
+    TEST_ASSERT_EQUAL(FRAME_BYTES / 2, drawFrames(gif, 1));
+    drawFrames(gif, 30);
+    TEST_ASSERT_TRUE(gif.getPipelineStats().interlaced);
+    TEST_ASSERT_LESS_OR_EQUAL(5U, gif.getPipelineStats().lastLateMs);
+
+    // A full update would fit again: back to full frames after a run of on time ones
+    mock::spiNanosPerByte = FAST_SPI_NS_PER_BYTE;
+    drawFrames(gif, 12);
+    TEST_ASSERT_FALSE(gif.getPipelineStats().interlaced);
+    TEST_ASSERT_EQUAL(FRAME_BYTES, drawFrames(gif, 1));
+
+    const GifPipelineStats& stats = gif.getPipelineStats();
+    TEST_ASSERT_GREATER_OR_EQUAL(40U, stats.interlacedFrames);
+    TEST_ASSERT_EQUAL(static_cast<uint64_t>(stats.interlacedFrames) * 50U, stats.degradedMs);
+
+    // Both parities were refreshed since, the panel shows the frame in full
+    const auto degraded = captureGram();
+    gif.stop();
+    Gif reference;
+    TEST_ASSERT_TRUE(reference.begin());
+    TEST_ASSERT_TRUE(reference.playOne("/gif/full.gif"));
+    mock::spiNanosPerByte = 0;
+    const uint16_t frame = static_cast<uint16_t>((stats.frames - 1) % FRAME_COUNT);
+    drawFrames(reference, frame + 1);
+    TEST_ASSERT_TRUE(degraded == captureGram());
+}
+
+void test_partial_frames_and_disabled_mode_stay_full() {
+    writeGif("/gif/partial.gif", true);
+    writeGif("/gif/full.gif", false);
+    mock::spiNanosPerByte = SLOW_SPI_NS_PER_BYTE;
+
+    Gif partial;
+    partial.setFrameDropEnabled(false);
+    partial.setLoopEnabled(true);
+    TEST_ASSERT_TRUE(partial.begin());
+    TEST_ASSERT_TRUE(partial.playOne("/gif/partial.gif"));
+    drawFrames(partial, 20);
+    TEST_ASSERT_FALSE(partial.getPipelineStats().interlaced);
+    TEST_ASSERT_EQUAL(0, partial.getPipelineStats().interlacedFrames);
+    partial.stop();
+
+    Gif disabled;
+    disabled.setFrameDropEnabled(false);
+    disabled.setInterlaceEnabled(false);
+    disabled.setLoopEnabled(true);
+    TEST_ASSERT_TRUE(disabled.begin());
+    TEST_ASSERT_TRUE(disabled.playOne("/gif/full.gif"));
+    TEST_ASSERT_EQUAL(FRAME_BYTES, drawFrames(disabled, 10));
+    TEST_ASSERT_EQUAL(0, disabled.getPipelineStats().interlacedFrames);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_sustained_lateness_halves_rows_until_headroom_returns);
+    RUN_TEST(test_partial_frames_and_disabled_mode_stay_full);
+    return UNITY_END();
+}
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+#include "display/GifNative.h"
+#include "display/GifTranscoder.h"
+
+static constexpr int FRAME_COUNT = 6;
+
+/**
+ * @brief Full frame, partial frame cleared to background, transparent overlay, the first frame
+ * again, then a small frame shown twice
+ */
+static auto mixedGif() -> GifBuilder {
+    GifBuilder builder(160, 120);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 160, 120, 1));
+    auto cleared = GifBuilder::patternFrame(20, 10, 60, 40, 40);
+    cleared.disposal = 2;
+    builder.addFrame(cleared);
+    auto overlay = GifBuilder::patternFrame(50, 30, 60, 60, 90);
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    for (size_t i = 0; i < overlay.pixels.size(); i += 3) {
+        overlay.pixels[i] = 0;
+    }
+    builder.addFrame(overlay);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 160, 120, 1));
+    builder.addFrame(GifBuilder::patternFrame(100, 80, 30, 20, 170));
+    builder.addFrame(GifBuilder::patternFrame(100, 80, 30, 20, 170));
+    return builder;
+}
+
+static void transcodeAll() {
+    for (int i = 0; i < 100 && GifTranscoder::pending() > 0; ++i) {
+        GifTranscoder::update(true);
+    }
+    TEST_ASSERT_EQUAL(0, GifTranscoder::pending());
+    TEST_ASSERT_FALSE(GifTranscoder::isRunning());
+}
+
+/**
+ * @brief Play a file once from a black panel, capturing the panel after every frame
+ */
+static auto playFrames(const char* path, bool native, GifPipelineStats& stats, uint32_t& pixelBytes)
+    -> std::vector<std::vector<uint16_t>> {
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setNativeEnabled(native);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    std::vector<std::vector<uint16_t>> grams;
+    while (gif.isPlaying()) {
+        gif.update();
+        grams.push_back(captureGram());
+        mock::advanceMs(100);
+    }
+
+    stats = gif.getPipelineStats();
+    pixelBytes = g_panel.counters().pixelBytes;
+    return grams;
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-native").string();
+    std::filesystem::remove_all(mock::fsRoot);
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    mock::freeHeap = 40000;
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_native_playback_matches_gif_frame_by_frame() {
+    TEST_ASSERT_TRUE(mixedGif().writeTo(mock::fsRoot + "/gif/mixed.gif"));
+    TEST_ASSERT_TRUE(GifTranscoder::enqueue("/gif/mixed.gif"));
+    transcodeAll();
+    TEST_ASSERT_TRUE(GifNative::exists("/gif/mixed.gif"));
+    TEST_ASSERT_FALSE(LittleFS.exists(GifNative::path("/gif/mixed.gif") + ".tmp"));
+
+    GifPipelineStats gifStats;
+    GifPipelineStats nativeStats;
+    uint32_t gifBytes = 0;
+    uint32_t nativeBytes = 0;
+    const auto decoded = playFrames("/gif/mixed.gif", false, gifStats, gifBytes);
+    const auto native = playFrames("/gif/mixed.gif", true, nativeStats, nativeBytes);
+
+    TEST_ASSERT_EQUAL(FRAME_COUNT, decoded.size());
+    TEST_ASSERT_EQUAL(FRAME_COUNT, native.size());
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        TEST_ASSERT_TRUE_MESSAGE(decoded[static_cast<size_t>(i)] == native[static_cast<size_t>(i)], "frame differs");
+    }
+
+    TEST_ASSERT_EQUAL(0, gifStats.nativeFrames);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, nativeStats.nativeFrames);
+    TEST_ASSERT_LESS_THAN(gifBytes, nativeBytes);
+
+    const auto fileBytes = std::filesystem::file_size(mock::fsRoot + GifNative::path("/gif/mixed.gif").c_str());
+    char msg[140];
+    snprintf(msg, sizeof(msg), "%d frames: %u pixel bytes decoded, %u from the %u byte native file", FRAME_COUNT,
+             gifBytes, nativeBytes, static_cast<unsigned>(fileBytes));
+    TEST_MESSAGE(msg);
+}
+
+void test_native_loops_and_seeks() {
+    TEST_ASSERT_TRUE(mixedGif().writeTo(mock::fsRoot + "/gif/loop.gif"));
+    TEST_ASSERT_TRUE(GifTranscoder::enqueue("/gif/loop.gif"));
+    transcodeAll();
+
+    GifPipelineStats stats;
+    uint32_t bytes = 0;
+    const auto once = playFrames("/gif/loop.gif", true, stats, bytes);
+
+    DisplayManager::clearScreen();
+    Gif gif;
+    gif.setPlayCount(2);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne("/gif/loop.gif"));
+    TEST_ASSERT_EQUAL(FRAME_COUNT, gif.getPosition().frameCount);
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+    }
+    TEST_ASSERT_EQUAL(2 * FRAME_COUNT, gif.getPipelineStats().nativeFrames);
+    TEST_ASSERT_TRUE(once.back() == captureGram());
+
+    DisplayManager::clearScreen();
+    Gif seeking;
+    TEST_ASSERT_TRUE(seeking.begin());
+    TEST_ASSERT_TRUE(seeking.playOne("/gif/loop.gif"));
+    TEST_ASSERT_TRUE(seeking.seekToFrame(3));
+    seeking.update();
+    TEST_ASSERT_TRUE(once[3] == captureGram());
+    TEST_ASSERT_FALSE(seeking.seekToFrame(FRAME_COUNT));
+}
+
+void test_transcoder_yields_to_playback_and_heap() {
+    TEST_ASSERT_TRUE(mixedGif().writeTo(mock::fsRoot + "/gif/busy.gif"));
+    TEST_ASSERT_TRUE(GifTranscoder::enqueue("/gif/busy.gif"));
+    TEST_ASSERT_TRUE(GifTranscoder::enqueue("/gif/busy.gif"));
+    TEST_ASSERT_FALSE(GifTranscoder::enqueue("slot:busy.gif"));
+    TEST_ASSERT_EQUAL(1, GifTranscoder::pending());
+
+    // Not enough heap: nothing starts until the retry delay is over
+    mock::freeHeap = 8000;
+    GifTranscoder::update(true);
+    TEST_ASSERT_FALSE(GifTranscoder::isRunning());
+    mock::freeHeap = 40000;
+    GifTranscoder::update(true);
+    TEST_ASSERT_FALSE(GifTranscoder::isRunning());
+    mock::advanceMs(6000);
+    GifTranscoder::update(true);
+    TEST_ASSERT_TRUE(GifTranscoder::isRunning());
+
+    // Playback starting halfway through abandons the conversion, it starts over once idle again
+    GifTranscoder::update(true);
+    GifTranscoder::update(true);
+    GifTranscoder::update(false);
+    TEST_ASSERT_FALSE(GifTranscoder::isRunning());
+    TEST_ASSERT_EQUAL(1, GifTranscoder::pending());
+    TEST_ASSERT_FALSE(GifNative::exists("/gif/busy.gif"));
+    TEST_ASSERT_FALSE(LittleFS.exists(GifNative::path("/gif/busy.gif") + ".tmp"));
+
+    transcodeAll();
+    TEST_ASSERT_TRUE(GifNative::exists("/gif/busy.gif"));
+
+    // Cancelled while converting: nothing is written
+    TEST_ASSERT_TRUE(mixedGif().writeTo(mock::fsRoot + "/gif/gone.gif"));
+    TEST_ASSERT_TRUE(GifTranscoder::enqueue("/gif/gone.gif"));
+    GifTranscoder::update(true);
+    GifTranscoder::cancel("/gif/gone.gif");
+    TEST_ASSERT_FALSE(GifTranscoder::isRunning());
+    transcodeAll();
+    TEST_ASSERT_FALSE(GifNative::exists("/gif/gone.gif"));
+}
+
+void test_stale_native_file_is_ignored() {
+    TEST_ASSERT_TRUE(mixedGif().writeTo(mock::fsRoot + "/gif/stale.gif"));
+    TEST_ASSERT_TRUE(GifTranscoder::enqueue("/gif/stale.gif"));
+    transcodeAll();
+
+    // Replaced behind the transcoder's back: the GIF itself plays
+    GifBuilder replaced(80, 80);
+    replaced.addFrame(GifBuilder::patternFrame(0, 0, 80, 80, 9));
+    TEST_ASSERT_TRUE(replaced.writeTo(mock::fsRoot + "/gif/stale.gif"));
+
+    GifPipelineStats stats;
+    uint32_t bytes = 0;
+    const auto grams = playFrames("/gif/stale.gif", true, stats, bytes);
+    TEST_ASSERT_EQUAL(1, grams.size());
+    TEST_ASSERT_EQUAL(0, stats.nativeFrames);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_native_playback_matches_gif_frame_by_frame);
+    RUN_TEST(test_native_loops_and_seeks);
+    RUN_TEST(test_transcoder_yields_to_playback_and_heap);
+    RUN_TEST(test_stale_native_file_is_ignored);
+    return UNITY_END();
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+#include "display/GifPlaylist.h"
+
+static constexpr uint32_t FRAME_DELAY_MS = 100;
+
+/**
+ * @brief Write a GIF of frameCount full-canvas frames of the given size
+ */
+static void writeGif(const char* name, uint16_t size, int frameCount, uint8_t seed) {
+    GifBuilder builder(size, size);
+    for (int i = 0; i < frameCount; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, size, size, static_cast<uint8_t>(seed + i * 30)));
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+static auto entry(const char* path, uint16_t loops = 1, uint32_t durationMs = 0) -> GifQueueEntry {
+    GifQueueEntry result;
+    result.path = path;
+    result.loops = loops;
+    result.durationMs = durationMs;
+    return result;
+}
+
+/**
+ * @brief Run the playlist with a 1 ms poll until it goes idle, returning when each frame was drawn
+ */
+static auto runPlaylist(Gif& gif, GifPlaylist& playlist, uint32_t limitMs = 5000) -> std::vector<uint32_t> {
+    std::vector<uint32_t> drawnAtMs;
+    const uint32_t startMs = millis();
+    do {
+        const uint32_t before = gif.getPipelineStats().frames;
+        playlist.update();
+        if (gif.getPipelineStats().frames != before) {
+            drawnAtMs.push_back(millis() - startMs);
+        }
+        mock::advanceMs(1);
+    } while ((playlist.size() > 0 || gif.isPlaying()) && millis() - startMs < limitMs);
+    return drawnAtMs;
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-playlist").string();
+    std::filesystem::remove_all(mock::fsRoot);
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_next_file_is_preloaded_and_starts_on_schedule() {
+    writeGif("/gif/a.gif", 40, 3, 1);
+    writeGif("/gif/b.gif", 40, 2, 9);
+
+    Gif gif;
+    GifPlaylist playlist(gif);
+    TEST_ASSERT_TRUE(playlist.enqueue(entry("/gif/a.gif")));
+    TEST_ASSERT_TRUE(playlist.enqueue(entry("/gif/b.gif")));
+
+    // The first update starts a.gif, draws its first frame and opens b.gif behind it
+    playlist.update();
+    TEST_ASSERT_EQUAL(1, gif.getPipelineStats().frames);
+    TEST_ASSERT_TRUE(gif.isPreloaded("/gif/b.gif"));
+
+    const auto drawnAtMs = runPlaylist(gif, playlist);
+
+    // The other four frames on a single 100 ms grid, b.gif follows a.gif's last delay without a gap
+    TEST_ASSERT_EQUAL(4, drawnAtMs.size());
+    for (size_t i = 0; i < drawnAtMs.size(); ++i) {
+        TEST_ASSERT_EQUAL((i + 1) * FRAME_DELAY_MS, drawnAtMs[i]);
+    }
+    TEST_ASSERT_EQUAL(0, playlist.size());
+    TEST_ASSERT_FALSE(playlist.isActive());
+
+    // Starting an entry never scans the file, frame indexes are written at upload or catalogue time
+    TEST_ASSERT_FALSE(std::filesystem::exists(mock::fsRoot + "/gifidx"));
+}
+
+void test_loops_and_duration_end_entries() {
+    writeGif("/gif/a.gif", 40, 3, 1);
+    writeGif("/gif/b.gif", 40, 2, 9);
+
+    Gif gif;
+    GifPlaylist playlist(gif);
+    playlist.enqueue(entry("/gif/a.gif", 2));
+    playlist.enqueue(entry("/gif/b.gif", 0, 250));
+
+    const auto drawnAtMs = runPlaylist(gif, playlist);
+
+    // a.gif twice (600 ms), then b.gif looping until its 250 ms are up
+    TEST_ASSERT_EQUAL(6 + 3, drawnAtMs.size());
+    TEST_ASSERT_EQUAL(600, drawnAtMs[6]);
+    TEST_ASSERT_EQUAL(800, drawnAtMs.back());
+}
+
+void test_unreadable_entries_are_dropped_and_queue_repeats() {
+    writeGif("/gif/a.gif", 40, 3, 1);
+
+    Gif gif;
+    GifPlaylist playlist(gif);
+    playlist.setRepeat(true);
+    playlist.enqueue(entry("/gif/missing.gif"));
+    playlist.enqueue(entry("/gif/a.gif"));
+
+    const auto drawnAtMs = runPlaylist(gif, playlist, 1000);
+
+    TEST_ASSERT_EQUAL(1, playlist.size());
+    TEST_ASSERT_TRUE(playlist.entryAt(0).path == "/gif/a.gif");
+    TEST_ASSERT_EQUAL(10, drawnAtMs.size());
+    TEST_ASSERT_TRUE(playlist.skip());
+    playlist.clear();
+    TEST_ASSERT_EQUAL(0, playlist.size());
+    TEST_ASSERT_FALSE(gif.isPlaying());
+}
+
+void test_smaller_canvas_clears_only_the_border() {
+    writeGif("/gif/big.gif", 80, 1, 1);
+    writeGif("/gif/small.gif", 40, 1, 9);
+
+    Gif gif;
+    GifPlaylist playlist(gif);
+    playlist.enqueue(entry("/gif/big.gif"));
+    playlist.enqueue(entry("/gif/small.gif"));
+
+    runPlaylist(gif, playlist);
+
+    // big.gif covered 80..159, small.gif 100..139: the ring between them is cleared
+    TEST_ASSERT_EQUAL(0, g_panel.pixelAt(85, 85));
+    TEST_ASSERT_EQUAL(0, g_panel.pixelAt(150, 120));
+    TEST_ASSERT_NOT_EQUAL(0, g_panel.pixelAt(120, 120));
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_next_file_is_preloaded_and_starts_on_schedule);
+    RUN_TEST(test_loops_and_duration_end_entries);
+    RUN_TEST(test_unreadable_entries_are_dropped_and_queue_repeats);
+    RUN_TEST(test_smaller_canvas_clears_only_the_border);
+    return UNITY_END();
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static constexpr int FRAME_COUNT = 4;
+static constexpr uint16_t PLAYS = 3;
+
+struct TierRun {
+    GifPipelineStats stats;
+    uint32_t fsReadCalls;
+    uint32_t fsReadBytes;
+    std::vector<uint16_t> gram;
+};
+
+/**
+ * @brief Play a GIF PLAYS times with the given heap size and cache setting, counting LittleFS reads
+ */
+static auto playTier(const char* path, uint32_t freeHeap, bool cache) -> TierRun {
+    mock::freeHeap = freeHeap;
+    mock::fsReadCalls = 0;
+    mock::fsReadBytes = 0;
+
+    Gif gif;
+    gif.setReadCacheEnabled(cache);
+    gif.setPlayCount(PLAYS);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+    }
+
+    TierRun run;
+    run.stats = gif.getPipelineStats();
+    run.fsReadCalls = mock::fsReadCalls;
+    run.fsReadBytes = mock::fsReadBytes;
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            run.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+    return run;
+}
+
+static void report(const char* name, const TierRun& run) {
+    const uint32_t frames = run.stats.frames;
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%-10s %6.1f read calls/frame, %6u bytes/frame", name,
+             static_cast<double>(run.fsReadCalls) / frames, static_cast<unsigned>(run.fsReadBytes / frames));
+    TEST_MESSAGE(msg);
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-read-tier").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_read_tiers_cut_littlefs_reads() {
+    GifBuilder builder(80, 80);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 80, 80, static_cast<uint8_t>(i * 40)));
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/tier.gif"));
+    const auto fileSize = static_cast<uint32_t>(builder.bytes().size());
+
+    const auto direct = playTier("/gif/tier.gif", 8000, false);
+    const auto readAhead = playTier("/gif/tier.gif", 8000, true);
+    const auto ram = playTier("/gif/tier.gif", 60000, true);
+
+    report("direct", direct);
+    report("read-ahead", readAhead);
+    report("ram", ram);
+
+    TEST_ASSERT_TRUE(direct.stats.readTier == GifReadTier::Direct);
+    TEST_ASSERT_TRUE(readAhead.stats.readTier == GifReadTier::ReadAhead);
+    TEST_ASSERT_TRUE(ram.stats.readTier == GifReadTier::Ram);
+    TEST_ASSERT_EQUAL(FRAME_COUNT * PLAYS, ram.stats.frames);
+
+    // The window absorbs small decoder reads, the RAM copy is read once for all loops
+#ifdef GIF_INTREE_DECODER
+    // The in-tree decoder already reads whole chunks, the window still merges them
+    TEST_ASSERT_LESS_THAN(direct.fsReadCalls / 2U, readAhead.fsReadCalls);
+#else
+    TEST_ASSERT_LESS_THAN(direct.fsReadCalls / 4U, readAhead.fsReadCalls);
+#endif
+    TEST_ASSERT_EQUAL(1, ram.fsReadCalls);
+    TEST_ASSERT_EQUAL(fileSize, ram.fsReadBytes);
+    TEST_ASSERT_EQUAL(readAhead.fsReadCalls, readAhead.stats.fileReadCalls);
+
+    TEST_ASSERT_TRUE(direct.gram == readAhead.gram);
+    TEST_ASSERT_TRUE(direct.gram == ram.gram);
+}
+
+void test_backward_seek_inside_window_needs_no_read() {
+    GifBuilder builder(30, 30);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 30, 30, 5));
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/small.gif"));
+
+    // Smaller than the window: one refill per play serves every read and rewind of that play
+    TEST_ASSERT_LESS_THAN(2048U, builder.bytes().size());
+    const auto readAhead = playTier("/gif/small.gif", 8000, true);
+
+    TEST_ASSERT_EQUAL(PLAYS, readAhead.stats.frames);
+    TEST_ASSERT_EQUAL(PLAYS, readAhead.fsReadCalls);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_read_tiers_cut_littlefs_reads);
+    RUN_TEST(test_backward_seek_inside_window_needs_no_read);
+    return UNITY_END();
+}
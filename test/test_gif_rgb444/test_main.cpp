@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <cmath>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static constexpr int FRAME_COUNT = 3;
+static constexpr double SPI_BYTES_PER_S = 40e6 / 8.0;
+
+enum class Mode { Rgb565, Rgb444, Rgb444Dither };
+
+struct RunResult {
+    Arduino_TFT::Counters counters;
+    std::vector<uint16_t> gram;
+    uint32_t paletteBuilds = 0;
+};
+
+static auto playToEnd(const std::string& path, Mode mode) -> RunResult {
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setRowSkipEnabled(false);
+    gif.setRgb444Enabled(mode != Mode::Rgb565);
+    gif.setDitherEnabled(mode == Mode::Rgb444Dither);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path.c_str()));
+
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+    }
+
+    TEST_ASSERT_EQUAL(mode != Mode::Rgb565, gif.isRgb444Active());
+
+    RunResult result;
+    result.counters = g_panel.counters();
+    result.paletteBuilds = gif.getPipelineStats().rgb444PaletteBuilds;
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            result.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+
+    // Back to RGB565 the way UI drawing does it
+    DisplayManager::setPanelColorMode(PanelColorMode::Rgb565);
+
+    return result;
+}
+
+/**
+ * @brief RGB565 color as the panel shows it after a truncating RGB444 write
+ */
+static auto truncated444(uint16_t color) -> uint16_t {
+    const uint32_t red = (color >> 12U) & 0x0FU;
+    const uint32_t green = (color >> 7U) & 0x0FU;
+    const uint32_t blue = (color >> 1U) & 0x0FU;
+    return static_cast<uint16_t>((((red << 1U) | (red >> 3U)) << 11U) | (((green << 2U) | (green >> 2U)) << 5U) |
+                                 ((blue << 1U) | (blue >> 3U)));
+}
+
+static auto writeGif(const std::string& name, const GifBuilder& builder) -> std::string {
+    const std::string path = "/gif/" + name;
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + path));
+    return path;
+}
+
+static auto fps(const Arduino_TFT::Counters& counters) -> double {
+    return SPI_BYTES_PER_S * FRAME_COUNT / static_cast<double>(counters.pixelBytes + counters.commandBytes);
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-rgb444").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_fullscreen_frames_send_three_quarters_of_the_bytes() {
+    GifBuilder builder(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 30)));
+    }
+    const auto path = writeGif("full.gif", builder);
+
+    const auto rgb565 = playToEnd(path, Mode::Rgb565);
+    const auto rgb444 = playToEnd(path, Mode::Rgb444);
+
+    TEST_ASSERT_EQUAL(FRAME_COUNT, rgb444.counters.addrWindows);
+    TEST_ASSERT_EQUAL(rgb565.counters.pixelBytes * 3U / 4U, rgb444.counters.pixelBytes);
+
+    for (size_t i = 0; i < rgb565.gram.size(); ++i) {
+        TEST_ASSERT_EQUAL(truncated444(rgb565.gram[i]), rgb444.gram[i]);
+    }
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "240x240 SPI bound at 40 MHz: RGB565 %.1f fps, RGB444 %.1f fps (+%.0f%%)",
+             fps(rgb565.counters), fps(rgb444.counters), (fps(rgb444.counters) / fps(rgb565.counters) - 1.0) * 100.0);
+    TEST_MESSAGE(msg);
+}
+
+void test_transparent_rows_are_packed_per_window() {
+    GifBuilder builder(240, 240);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 1));
+
+    auto overlay = GifBuilder::patternFrame(30, 30, 99, 60, 40);
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    for (size_t i = 0; i < overlay.pixels.size(); i += 5) {
+        overlay.pixels[i] = 0;
+    }
+    builder.addFrame(overlay);
+    const auto path = writeGif("overlay.gif", builder);
+
+    const auto rgb565 = playToEnd(path, Mode::Rgb565);
+    const auto rgb444 = playToEnd(path, Mode::Rgb444);
+
+    // Odd-length runs end on a half pixel pair, the next window must start clean
+    for (size_t i = 0; i < rgb565.gram.size(); ++i) {
+        TEST_ASSERT_EQUAL(truncated444(rgb565.gram[i]), rgb444.gram[i]);
+    }
+}
+
+void test_dither_keeps_average_colour() {
+    GifBuilder builder(240, 240);
+    GifFrameSpec frame = GifBuilder::patternFrame(0, 0, 240, 240, 0);
+    // Index 70: green 185 -> 6-bit 46, halfway between two 4-bit levels
+    std::fill(frame.pixels.begin(), frame.pixels.end(), 70);
+    builder.addFrame(frame);
+    const auto path = writeGif("solid.gif", builder);
+
+    const auto truncated = playToEnd(path, Mode::Rgb444);
+    const auto dithered = playToEnd(path, Mode::Rgb444Dither);
+
+    const double wanted = 46.0 / 4.0;
+    double sumTruncated = 0;
+    double sumDithered = 0;
+    for (size_t i = 0; i < truncated.gram.size(); ++i) {
+        sumTruncated += (truncated.gram[i] >> 7U) & 0x0FU;
+        sumDithered += (dithered.gram[i] >> 7U) & 0x0FU;
+    }
+    const auto count = static_cast<double>(truncated.gram.size());
+
+    TEST_ASSERT_TRUE(std::fabs(sumDithered / count - wanted) < std::fabs(sumTruncated / count - wanted));
+    TEST_ASSERT_TRUE(std::fabs(sumDithered / count - wanted) < 0.01);
+}
+
+void test_palette_is_converted_once_per_palette_change() {
+    GifBuilder global(240, 240);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        global.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, static_cast<uint8_t>(i * 30)));
+    }
+
+    // Global palette, a local one, then the global palette again
+    GifBuilder local(240, 240);
+    local.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 0));
+    GifFrameSpec frame = GifBuilder::patternFrame(0, 0, 240, 240, 30);
+    frame.localPalette.resize(256U * 3U);
+    for (size_t i = 0; i < frame.localPalette.size(); ++i) {
+        frame.localPalette[i] = static_cast<uint8_t>(255U - i % 256U);
+    }
+    local.addFrame(frame);
+    local.addFrame(GifBuilder::patternFrame(0, 0, 240, 240, 60));
+
+    TEST_ASSERT_EQUAL(1, playToEnd(writeGif("global.gif", global), Mode::Rgb444Dither).paletteBuilds);
+    TEST_ASSERT_EQUAL(3, playToEnd(writeGif("local.gif", local), Mode::Rgb444Dither).paletteBuilds);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_fullscreen_frames_send_three_quarters_of_the_bytes);
+    RUN_TEST(test_transparent_rows_are_packed_per_window);
+    RUN_TEST(test_dither_keeps_average_colour);
+    RUN_TEST(test_palette_is_converted_once_per_palette_change);
+    return UNITY_END();
+}
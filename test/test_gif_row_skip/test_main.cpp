@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static constexpr int CHANGED_ROW = 100;
+static constexpr int CHANGED_ROWS = 20;
+
+struct RunResult {
+    Arduino_TFT::Counters counters;
+    GifPipelineStats stats;
+    std::vector<uint16_t> gram;
+};
+
+/**
+ * @brief Play a GIF file to the end on the mock panel and capture counters and GRAM
+ */
+static auto playToEnd(const char* path, bool streaming, bool rowSkip) -> RunResult {
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setFrameStreamingEnabled(streaming);
+    gif.setRowSkipEnabled(rowSkip);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    while (gif.isPlaying()) {
+        gif.update();
+        mock::advanceMs(100);
+    }
+
+    RunResult result;
+    result.counters = g_panel.counters();
+    result.stats = gif.getPipelineStats();
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            result.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Full-frame GIF where the second frame only changes a band of rows and the third repeats it
+ */
+static void writeBandGif(const char* name) {
+    GifBuilder builder(240, 240);
+    auto base = GifBuilder::patternFrame(0, 0, 240, 240, 5);
+    auto band = base;
+    for (size_t i = CHANGED_ROW * 240U; i < (CHANGED_ROW + CHANGED_ROWS) * 240U; ++i) {
+        band.pixels[i] = static_cast<uint8_t>(band.pixels[i] % 200U + 20U);
+    }
+    builder.addFrame(base).addFrame(band).addFrame(band);
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-row-skip").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_streamed_frames_only_send_changed_rows() {
+    writeBandGif("/gif/band.gif");
+
+    const auto full = playToEnd("/gif/band.gif", true, false);
+    const auto skipped = playToEnd("/gif/band.gif", true, true);
+
+    TEST_ASSERT_TRUE(full.gram == skipped.gram);
+    TEST_ASSERT_EQUAL(0, full.stats.totalSkippedRows);
+
+    // Frame 2 sends the changed band, frame 3 sends nothing
+    TEST_ASSERT_EQUAL(240U * 480U * 3U, full.counters.pixelBytes);
+    TEST_ASSERT_EQUAL(240U * 480U + CHANGED_ROWS * 480U, skipped.counters.pixelBytes);
+    TEST_ASSERT_EQUAL(240U, skipped.stats.lastSkippedRows);
+    TEST_ASSERT_EQUAL(240U * 480U, skipped.stats.lastSkippedBytes);
+    TEST_ASSERT_EQUAL(240U * 2U - CHANGED_ROWS, skipped.stats.totalSkippedRows);
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "3 frames: %u -> %u pixel bytes, %u rows skipped",
+             static_cast<unsigned>(full.counters.pixelBytes), static_cast<unsigned>(skipped.counters.pixelBytes),
+             static_cast<unsigned>(skipped.stats.totalSkippedRows));
+    TEST_MESSAGE(msg);
+}
+
+void test_line_path_skips_unchanged_rows() {
+    writeBandGif("/gif/band-lines.gif");
+
+    const auto full = playToEnd("/gif/band-lines.gif", false, false);
+    const auto skipped = playToEnd("/gif/band-lines.gif", false, true);
+
+    TEST_ASSERT_TRUE(full.gram == skipped.gram);
+    TEST_ASSERT_EQUAL(240U + CHANGED_ROWS, skipped.counters.addrWindows);
+}
+
+void test_transparent_runs_invalidate_rows() {
+    GifBuilder builder(240, 240);
+    const auto base = GifBuilder::patternFrame(0, 0, 240, 240, 2);
+
+    auto overlay = GifBuilder::patternFrame(0, 0, 240, 240, 90);
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    for (size_t i = 0; i < overlay.pixels.size(); ++i) {
+        if ((i % 240U) >= 8U) {
+            overlay.pixels[i] = 0;
+        }
+    }
+
+    builder.addFrame(base).addFrame(overlay).addFrame(base);
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/overlay.gif"));
+
+    const auto full = playToEnd("/gif/overlay.gif", true, false);
+    const auto skipped = playToEnd("/gif/overlay.gif", true, true);
+
+    // The overlay changed the first columns, so the repeated base frame must be sent again
+    TEST_ASSERT_TRUE(full.gram == skipped.gram);
+    TEST_ASSERT_EQUAL(0, skipped.stats.totalSkippedRows);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_streamed_frames_only_send_changed_rows);
+    RUN_TEST(test_line_path_skips_unchanged_rows);
+    RUN_TEST(test_transparent_runs_invalidate_rows);
+    return UNITY_END();
+}
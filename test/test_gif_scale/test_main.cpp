@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+using Gram = std::vector<uint16_t>;
+
+/**
+ * @brief Colour of a GifBuilder palette index as the panel stores it
+ */
+static auto paletteColor(uint8_t index) -> uint16_t {
+    const auto red = static_cast<uint8_t>(index);
+    const auto green = static_cast<uint8_t>(255U - index);
+    const auto blue = static_cast<uint8_t>(index * 7U);
+    return static_cast<uint16_t>(((red & 0xF8U) << 8U) | ((green & 0xFCU) << 3U) | (blue >> 3U));
+}
+
+/**
+ * @brief Play a file once from a black panel, capturing the panel after every frame
+ */
+static auto playFrames(const char* path, bool autoScale, GifScale& scale) -> std::vector<Gram> {
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+
+    Gif gif;
+    gif.setAutoScaleEnabled(autoScale);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+    scale = gif.getScale();
+
+    std::vector<Gram> grams;
+    while (gif.isPlaying()) {
+        gif.update();
+        grams.push_back(captureGram());
+        mock::advanceMs(100);
+    }
+    return grams;
+}
+
+/**
+ * @brief Full frame, partial frame cleared to background, transparent overlay, small frame
+ */
+static auto layeredGif(uint16_t size) -> GifBuilder {
+    GifBuilder builder(size, size);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, size, size, 1));
+    auto cleared = GifBuilder::patternFrame(5, 7, 30, 20, 40);
+    cleared.disposal = 2;
+    builder.addFrame(cleared);
+    auto overlay = GifBuilder::patternFrame(11, 3, 40, 40, 90);
+    overlay.transparent = true;
+    overlay.transparentIndex = 0;
+    for (size_t i = 0; i < overlay.pixels.size(); i += 3) {
+        overlay.pixels[i] = 0;
+    }
+    builder.addFrame(overlay);
+    builder.addFrame(GifBuilder::patternFrame(30, 31, 9, 9, 170));
+    return builder;
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-scale").string();
+    std::filesystem::remove_all(mock::fsRoot);
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_scale_follows_canvas_size() {
+    const struct {
+        uint16_t width;
+        uint16_t height;
+        uint8_t up;
+        uint8_t down;
+    } cases[] = {{120, 120, 2, 1}, {80, 80, 3, 1}, {40, 60, 3, 1}, {160, 120, 1, 1}, {240, 240, 1, 1},
+                 {480, 480, 1, 2}, {300, 200, 1, 2}, {500, 240, 1, 1}, {0, 0, 1, 1}};
+
+    for (const auto& expected : cases) {
+        const GifScale scale = Gif::autoScale(expected.width, expected.height, 240, 240);
+        TEST_ASSERT_EQUAL(expected.up, scale.up);
+        TEST_ASSERT_EQUAL(expected.down, scale.down);
+    }
+}
+
+void test_enlarged_frames_match_unscaled_composition() {
+    for (const uint16_t size : {120, 80}) {
+        const std::string path = "/gif/small" + std::to_string(size) + ".gif";
+        TEST_ASSERT_TRUE(layeredGif(size).writeTo(mock::fsRoot + path));
+
+        GifScale unscaled;
+        GifScale scale;
+        const auto reference = playFrames(path.c_str(), false, unscaled);
+        const auto enlarged = playFrames(path.c_str(), true, scale);
+        TEST_ASSERT_EQUAL(1, unscaled.up);
+        TEST_ASSERT_EQUAL(240 / size, scale.up);
+        TEST_ASSERT_EQUAL(reference.size(), enlarged.size());
+
+        // Every panel pixel shows the unscaled pixel it was enlarged from, the border stays black
+        const int refOffset = (240 - size) / 2;
+        const int offset = (240 - size * scale.up) / 2;
+        for (size_t frame = 0; frame < enlarged.size(); ++frame) {
+            for (int y = 0; y < 240; ++y) {
+                for (int x = 0; x < 240; ++x) {
+                    const int canvasX = x - offset;
+                    const int canvasY = y - offset;
+                    uint16_t expected = 0;
+                    if (canvasX >= 0 && canvasY >= 0 && canvasX < size * scale.up && canvasY < size * scale.up) {
+                        expected = reference[frame][static_cast<size_t>((refOffset + canvasY / scale.up) * 240 +
+                                                                        refOffset + canvasX / scale.up)];
+                    }
+                    TEST_ASSERT_EQUAL_HEX16(expected, enlarged[frame][static_cast<size_t>(y * 240 + x)]);
+                }
+            }
+        }
+    }
+}
+
+void test_enlarged_lines_share_one_window() {
+    GifBuilder builder(120, 120);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, 3));
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/opaque.gif"));
+
+    GifScale scale;
+    playFrames("/gif/opaque.gif", true, scale);
+
+    // One window and two row writes per decoded line
+    TEST_ASSERT_EQUAL(120, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(240 * 240 * 2, g_panel.counters().pixelBytes);
+}
+
+void test_oversized_gif_is_decimated() {
+    GifBuilder builder(480, 400);
+    const auto full = GifBuilder::patternFrame(0, 0, 480, 400, 7);
+    const auto patch = GifBuilder::patternFrame(101, 50, 60, 31, 77);
+    builder.addFrame(full);
+    builder.addFrame(patch);
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/large.gif"));
+
+    GifScale scale;
+    const auto grams = playFrames("/gif/large.gif", true, scale);
+    TEST_ASSERT_EQUAL(2, scale.down);
+    TEST_ASSERT_EQUAL(2, grams.size());
+
+    // Composed canvas, then every other line and pixel of it centred on the panel
+    std::vector<uint8_t> canvas = full.pixels;
+    for (uint16_t y = 0; y < patch.height; ++y) {
+        for (uint16_t x = 0; x < patch.width; ++x) {
+            canvas[static_cast<size_t>((patch.y + y) * 480 + patch.x + x)] = patch.pixels[y * patch.width + x];
+        }
+    }
+
+    const int offsetY = (240 - 200) / 2;
+    for (int y = 0; y < 240; ++y) {
+        for (int x = 0; x < 240; ++x) {
+            const int canvasY = (y - offsetY) * 2;
+            const uint16_t expected = canvasY >= 0 && canvasY < 400
+                                          ? paletteColor(canvas[static_cast<size_t>(canvasY * 480 + x * 2)])
+                                          : 0;
+            TEST_ASSERT_EQUAL_HEX16(expected, grams[1][static_cast<size_t>(y * 240 + x)]);
+        }
+    }
+}
+
+void test_scaling_off_keeps_canvas_size() {
+    GifBuilder builder(120, 120);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, 3));
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/plain.gif"));
+
+    Gif gif;
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.preload("/gif/plain.gif"));
+    TEST_ASSERT_EQUAL(120, gif.getPreloadedCanvas().width);
+    gif.setAutoScaleEnabled(true);
+    TEST_ASSERT_EQUAL(240, gif.getPreloadedCanvas().width);
+    TEST_ASSERT_TRUE(gif.playOne("/gif/plain.gif"));
+    TEST_ASSERT_EQUAL(2, gif.getScale().up);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_scale_follows_canvas_size);
+    RUN_TEST(test_enlarged_frames_match_unscaled_composition);
+    RUN_TEST(test_enlarged_lines_share_one_window);
+    RUN_TEST(test_oversized_gif_is_decimated);
+    RUN_TEST(test_scaling_off_keeps_canvas_size);
+    return UNITY_END();
+}
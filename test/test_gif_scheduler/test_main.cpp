@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+
+static constexpr int FRAME_COUNT = 8;
+static constexpr uint32_t FRAME_DELAY_MS = 100;
+
+struct ScheduleRun {
+    std::vector<uint32_t> drawnAtMs;
+    GifPipelineStats stats;
+    std::vector<uint16_t> gram;
+};
+
+/**
+ * @brief Play a GIF polling update() every pollMs, with one stall of stallMs after the first frame
+ *
+ * Times are relative to the start of playback, drawnAtMs holds when each drawn frame reached the panel
+ */
+static auto playWithStall(const char* path, uint32_t pollMs, uint32_t stallMs) -> ScheduleRun {
+    Gif gif;
+    TEST_ASSERT_TRUE(gif.begin());
+    const uint32_t startMs = millis();
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    ScheduleRun run;
+    bool stalled = false;
+    while (gif.isPlaying()) {
+        const uint32_t before = gif.getPipelineStats().frames;
+        gif.update();
+        if (gif.getPipelineStats().frames != before) {
+            run.drawnAtMs.push_back(millis() - startMs);
+        }
+        if (!stalled && !run.drawnAtMs.empty()) {
+            mock::advanceMs(stallMs);
+            stalled = true;
+        }
+        mock::advanceMs(pollMs);
+    }
+
+    run.stats = gif.getPipelineStats();
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            run.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+    return run;
+}
+
+static void writeGif(const char* name, const GifBuilder& builder) {
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + name));
+}
+
+static void writeFullFrameGif(const char* name) {
+    GifBuilder builder(40, 40);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 40, 40, static_cast<uint8_t>(i * 30)));
+    }
+    writeGif(name, builder);
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-scheduler").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+}
+
+void tearDown() {}
+
+void test_deadlines_do_not_drift_with_poll_granularity() {
+    writeFullFrameGif("/gif/full.gif");
+
+    // A 7 ms poll used to add up to 6 ms per frame, deadlines keep every frame within one poll
+    const auto run = playWithStall("/gif/full.gif", 7, 0);
+
+    TEST_ASSERT_EQUAL(FRAME_COUNT, run.drawnAtMs.size());
+    for (size_t i = 0; i < run.drawnAtMs.size(); ++i) {
+        TEST_ASSERT_GREATER_OR_EQUAL(i * FRAME_DELAY_MS, run.drawnAtMs[i]);
+        TEST_ASSERT_LESS_THAN(i * FRAME_DELAY_MS + 7U, run.drawnAtMs[i]);
+    }
+    TEST_ASSERT_EQUAL(0, run.stats.droppedFrames);
+    TEST_ASSERT_LESS_THAN(7U, run.stats.maxLateMs);
+}
+
+void test_full_frames_are_dropped_to_catch_up() {
+    writeFullFrameGif("/gif/full.gif");
+
+    const auto reference = playWithStall("/gif/full.gif", 1, 0);
+    const auto stalled = playWithStall("/gif/full.gif", 1, 350);
+
+    // Frames 1 and 2 are already stale after the stall, one update each, frame 3 lands at 353 ms
+    TEST_ASSERT_EQUAL(2, stalled.stats.droppedFrames);
+    TEST_ASSERT_EQUAL(FRAME_COUNT - 2, stalled.drawnAtMs.size());
+    TEST_ASSERT_EQUAL(1, stalled.stats.lateFrames);
+    TEST_ASSERT_EQUAL(53, stalled.stats.maxLateMs);
+    TEST_ASSERT_EQUAL((FRAME_COUNT - 1) * FRAME_DELAY_MS, stalled.drawnAtMs.back());
+    TEST_ASSERT_TRUE(reference.gram == stalled.gram);
+}
+
+void test_partial_frames_are_shown_late_not_dropped() {
+    GifBuilder builder(40, 40);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 40, 40, 1));
+    for (int i = 1; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(10, 10, 20, 20, static_cast<uint8_t>(i * 30)));
+    }
+    writeGif("/gif/partial.gif", builder);
+
+    const auto run = playWithStall("/gif/partial.gif", 1, 350);
+
+    // Skipping a delta frame would leave its pixels missing, so the backlog is drawn back to back
+    TEST_ASSERT_EQUAL(0, run.stats.droppedFrames);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, run.drawnAtMs.size());
+    TEST_ASSERT_EQUAL(3, run.stats.lateFrames);
+    TEST_ASSERT_EQUAL((FRAME_COUNT - 1) * FRAME_DELAY_MS, run.drawnAtMs.back());
+}
+
+void test_long_stall_restarts_the_schedule() {
+    writeFullFrameGif("/gif/full.gif");
+
+    const auto run = playWithStall("/gif/full.gif", 1, 3000);
+
+    TEST_ASSERT_EQUAL(1, run.stats.resyncs);
+    TEST_ASSERT_EQUAL(0, run.stats.droppedFrames);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, run.drawnAtMs.size());
+    TEST_ASSERT_EQUAL(3001U, run.drawnAtMs[1]);
+    TEST_ASSERT_EQUAL(3001U + FRAME_DELAY_MS, run.drawnAtMs[2]);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_deadlines_do_not_drift_with_poll_granularity);
+    RUN_TEST(test_full_frames_are_dropped_to_catch_up);
+    RUN_TEST(test_partial_frames_are_shown_late_not_dropped);
+    RUN_TEST(test_long_stall_restarts_the_schedule);
+    return UNITY_END();
+}
@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#include "GifBuilder.h"
+#include "MockPanel.h"
+#include "display/Gif.h"
+#include "display/GifSlotStore.h"
+
+static constexpr uint32_t FLASH_BYTES = 256U * 1024U;
+static constexpr uint32_t REGION_OFFSET = 64U * 1024U;
+static constexpr uint32_t REGION_BYTES = 128U * 1024U;
+static constexpr int FRAME_COUNT = 4;
+
+struct SlotRun {
+    GifPipelineStats stats;
+    uint32_t fsReadCalls;
+    uint64_t updateNs;
+    std::vector<uint16_t> gram;
+};
+
+static auto attachRegion() -> bool {
+    return GifSlotStore::begin(REGION_OFFSET, REGION_BYTES, mock::flash.data() + REGION_OFFSET);
+}
+
+static auto storeSlot(const char* name, const std::vector<uint8_t>& data) -> bool {
+    if (!GifSlotStore::beginWrite(name)) {
+        return false;
+    }
+    // Uneven chunks like HTTP upload buffers
+    for (size_t pos = 0; pos < data.size(); pos += 1460U) {
+        if (!GifSlotStore::write(data.data() + pos, std::min<size_t>(1460U, data.size() - pos))) {
+            return false;
+        }
+    }
+    return GifSlotStore::endWrite();
+}
+
+/**
+ * @brief Play a GIF to the end with a small heap (no RAM tier) and capture reads, host time and GRAM
+ */
+static auto playFrom(const char* path, bool cache) -> SlotRun {
+    mock::fsReadCalls = 0;
+    uint64_t updateNs = 0;
+
+    Gif gif;
+    gif.setReadCacheEnabled(cache);
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_TRUE(gif.playOne(path));
+
+    // Open, read callbacks, decode and draw all happen inside update(), time the whole call
+    while (gif.isPlaying()) {
+        const uint32_t start = EspClass::getCycleCount();
+        gif.update();
+        updateNs += EspClass::getCycleCount() - start;
+        mock::advanceMs(100);
+    }
+
+    SlotRun run;
+    run.updateNs = updateNs;
+    run.stats = gif.getPipelineStats();
+    run.fsReadCalls = mock::fsReadCalls;
+    for (int16_t y = 0; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            run.gram.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+    return run;
+}
+
+static void report(const char* name, const SlotRun& run) {
+    const uint32_t frames = run.stats.frames;
+    char msg[160];
+    snprintf(msg, sizeof(msg), "%-10s %6.1f read calls/frame, %8.1f us/frame on host", name,
+             static_cast<double>(run.fsReadCalls) / frames,
+             static_cast<double>(run.updateNs) / frames / 1000.0);
+    TEST_MESSAGE(msg);
+}
+
+void setUp() {
+    mock::fsRoot = (std::filesystem::temp_directory_path() / "gif-slot-store").string();
+    std::filesystem::create_directories(mock::fsRoot + "/gif");
+    mock::flash.assign(FLASH_BYTES, 0xFF);
+    mock::freeHeap = 8000;
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_slot_playback_reads_no_files() {
+    GifBuilder builder(120, 120);
+    for (int i = 0; i < FRAME_COUNT; ++i) {
+        builder.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, static_cast<uint8_t>(i * 40)));
+    }
+    TEST_ASSERT_TRUE(builder.writeTo(mock::fsRoot + "/gif/anim.gif"));
+    TEST_ASSERT_TRUE(attachRegion());
+    TEST_ASSERT_TRUE(storeSlot("anim.gif", builder.bytes()));
+
+    const auto direct = playFrom("/gif/anim.gif", false);
+    const auto readAhead = playFrom("/gif/anim.gif", true);
+    const auto slot = playFrom("slot:anim.gif", true);
+
+    report("direct", direct);
+    report("read-ahead", readAhead);
+    report("slot", slot);
+
+    TEST_ASSERT_TRUE(slot.stats.readTier == GifReadTier::Flash);
+    TEST_ASSERT_EQUAL(FRAME_COUNT, slot.stats.frames);
+    TEST_ASSERT_EQUAL(0, slot.fsReadCalls);
+    TEST_ASSERT_GREATER_THAN(0U, direct.fsReadCalls);
+    TEST_ASSERT_TRUE(direct.gram == slot.gram);
+    TEST_ASSERT_TRUE(readAhead.gram == slot.gram);
+}
+
+void test_slot_preload_reads_header_from_flash() {
+    GifBuilder builder(60, 40);
+    builder.addFrame(GifBuilder::patternFrame(0, 0, 60, 40, 1));
+    TEST_ASSERT_TRUE(attachRegion());
+    TEST_ASSERT_TRUE(storeSlot("small.gif", builder.bytes()));
+
+    Gif gif;
+    TEST_ASSERT_TRUE(gif.begin());
+    TEST_ASSERT_FALSE(gif.preload("slot:missing.gif"));
+    TEST_ASSERT_TRUE(gif.preload("slot:small.gif"));
+    TEST_ASSERT_TRUE(gif.isPreloaded("slot:small.gif"));
+    TEST_ASSERT_EQUAL(60, gif.getPreloadedCanvas().width);
+    TEST_ASSERT_EQUAL(40, gif.getPreloadedCanvas().height);
+    TEST_ASSERT_TRUE(gif.playOne("slot:small.gif"));
+    TEST_ASSERT_FALSE(gif.isPreloaded("slot:small.gif"));
+}
+
+void test_slot_table_survives_reattach() {
+    GifBuilder big(120, 120);
+    big.addFrame(GifBuilder::patternFrame(0, 0, 120, 120, 2));
+    GifBuilder small(20, 20);
+    small.addFrame(GifBuilder::patternFrame(0, 0, 20, 20, 3));
+    const auto bigBytes = big.bytes();
+    const auto smallBytes = small.bytes();
+
+    // An erased region is an empty store
+    TEST_ASSERT_TRUE(attachRegion());
+    TEST_ASSERT_EQUAL(0, GifSlotStore::count());
+    TEST_ASSERT_EQUAL(REGION_BYTES - GifSlotStore::SECTOR_BYTES, GifSlotStore::largestFree());
+
+    TEST_ASSERT_TRUE(storeSlot("a.gif", smallBytes));
+    TEST_ASSERT_TRUE(storeSlot("b.gif", bigBytes));
+    TEST_ASSERT_TRUE(storeSlot("c.gif", smallBytes));
+    TEST_ASSERT_TRUE(GifSlotStore::remove("b.gif"));
+    TEST_ASSERT_FALSE(GifSlotStore::remove("b.gif"));
+
+    TEST_ASSERT_TRUE(attachRegion());
+    TEST_ASSERT_EQUAL(2, GifSlotStore::count());
+    const GifSlot* slot = GifSlotStore::find("c.gif");
+    TEST_ASSERT_NOT_NULL(slot);
+    TEST_ASSERT_EQUAL(smallBytes.size(), slot->size);
+    TEST_ASSERT_EQUAL(0, slot->offset % GifSlotStore::SECTOR_BYTES);
+    TEST_ASSERT_EQUAL(0, memcmp(GifSlotStore::data(*slot), smallBytes.data(), smallBytes.size()));
+
+    // Replacing a slot keeps one entry, a GIF larger than any gap is refused and leaves the table alone
+    TEST_ASSERT_TRUE(storeSlot("a.gif", bigBytes));
+    TEST_ASSERT_EQUAL(2, GifSlotStore::count());
+    TEST_ASSERT_EQUAL(bigBytes.size(), GifSlotStore::find("a.gif")->size);
+    const std::vector<uint8_t> tooLarge(GifSlotStore::largestFree() + 1U, 0x47);
+    TEST_ASSERT_FALSE(storeSlot("huge.gif", tooLarge));
+    TEST_ASSERT_EQUAL(2, GifSlotStore::count());
+    TEST_ASSERT_NULL(GifSlotStore::find("huge.gif"));
+
+    TEST_ASSERT_FALSE(GifSlotStore::beginWrite("a-name-that-does-not-fit.gif"));
+}
+
+void test_replace_keeps_old_slot_until_complete() {
+    GifBuilder first(40, 40);
+    first.addFrame(GifBuilder::patternFrame(0, 0, 40, 40, 4));
+    GifBuilder second(60, 60);
+    second.addFrame(GifBuilder::patternFrame(0, 0, 60, 60, 5));
+    const auto firstBytes = first.bytes();
+    const auto secondBytes = second.bytes();
+
+    TEST_ASSERT_TRUE(attachRegion());
+    TEST_ASSERT_TRUE(storeSlot("a.gif", firstBytes));
+    const uint32_t firstOffset = GifSlotStore::find("a.gif")->offset;
+
+    // An upload aborted half way leaves the stored GIF in the table and on flash, also after a reboot
+    TEST_ASSERT_TRUE(GifSlotStore::beginWrite("a.gif"));
+    TEST_ASSERT_TRUE(GifSlotStore::write(secondBytes.data(), secondBytes.size() / 2U));
+    GifSlotStore::abortWrite();
+    TEST_ASSERT_TRUE(attachRegion());
+    const GifSlot* slot = GifSlotStore::find("a.gif");
+    TEST_ASSERT_NOT_NULL(slot);
+    TEST_ASSERT_EQUAL(firstBytes.size(), slot->size);
+    TEST_ASSERT_EQUAL(0, memcmp(GifSlotStore::data(*slot), firstBytes.data(), firstBytes.size()));
+
+    // A complete upload lands beside the old data and swaps the entry in one table write
+    TEST_ASSERT_TRUE(storeSlot("a.gif", secondBytes));
+    TEST_ASSERT_TRUE(attachRegion());
+    TEST_ASSERT_EQUAL(1, GifSlotStore::count());
+    slot = GifSlotStore::find("a.gif");
+    TEST_ASSERT_NOT_NULL(slot);
+    TEST_ASSERT_NOT_EQUAL(firstOffset, slot->offset);
+    TEST_ASSERT_EQUAL(secondBytes.size(), slot->size);
+    TEST_ASSERT_EQUAL(0, memcmp(GifSlotStore::data(*slot), secondBytes.data(), secondBytes.size()));
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_slot_playback_reads_no_files);
+    RUN_TEST(test_slot_preload_reads_header_from_flash);
+    RUN_TEST(test_slot_table_survives_reattach);
+    RUN_TEST(test_replace_keeps_old_slot_until_complete);
+    return UNITY_END();
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <vector>
+
+#include "MockPanel.h"
+#include "display/OffscreenBand.h"
+
+static constexpr int16_t BAND_H = 24;
+static constexpr int16_t BAND_TOP = 240 - BAND_H;
+static constexpr uint16_t FG = 0xFFFF;
+static constexpr uint16_t BG = 0x2104;
+
+static void fillRows(int16_t top, int16_t height, uint16_t color) {
+    const std::vector<uint16_t> row(240, static_cast<uint16_t>((color >> 8U) | (color << 8U)));
+    g_panel.writeAddrWindow(0, top, 240, static_cast<uint16_t>(height));
+    for (int16_t i = 0; i < height; ++i) {
+        DisplayManager::writePanelPixels(row.data(), 240);
+    }
+}
+
+/**
+ * @brief What the panel shows in the band, line by line
+ */
+static auto shownBand() -> std::vector<uint16_t> {
+    std::vector<uint16_t> pixels;
+    for (int16_t y = BAND_TOP; y < 240; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            pixels.push_back(g_panel.displayedPixelAt(x, y));
+        }
+    }
+    return pixels;
+}
+
+/**
+ * @brief Band-high slice of GRAM starting at a row, as the band would show it
+ */
+static auto gramRows(int16_t top) -> std::vector<uint16_t> {
+    std::vector<uint16_t> pixels;
+    for (int16_t y = top; y < top + BAND_H; ++y) {
+        for (int16_t x = 0; x < 240; ++x) {
+            pixels.push_back(g_panel.pixelAt(x, y));
+        }
+    }
+    return pixels;
+}
+
+void setUp() {
+    g_panel.setRotation(0);
+    DisplayManager::setPanelScrollArea(0, DisplayManager::PANEL_GRAM_ROWS);
+    DisplayManager::setPanelScrollStart(0);
+    fillRows(0, 240, 0x07E0);
+}
+
+void tearDown() {}
+
+void test_staged_slot_is_revealed_by_one_command() {
+    OffscreenBand band;
+    TEST_ASSERT_TRUE(band.begin(BAND_H));
+    // The band's own rows plus three band-high slices of the 80 hidden rows
+    TEST_ASSERT_EQUAL(4, band.slots());
+    TEST_ASSERT_EQUAL(240, band.slotRow(1));
+    TEST_ASSERT_EQUAL(288, band.slotRow(3));
+
+    const auto before = shownBand();
+    TEST_ASSERT_TRUE(band.stageText(1, 10, "WiFi OK  12:30", 2, FG, BG));
+    TEST_ASSERT_TRUE(before == shownBand());
+
+    const auto staged = gramRows(band.slotRow(1));
+    g_panel.resetCounters();
+    TEST_ASSERT_TRUE(band.show(1));
+    TEST_ASSERT_TRUE(staged == shownBand());
+    TEST_ASSERT_FALSE(before == shownBand());
+    TEST_ASSERT_EQUAL(3, g_panel.counters().commandBytes);
+    TEST_ASSERT_EQUAL(0, g_panel.counters().pixelBytes);
+
+    // Text is centred: a glyph pixel of 'W' on the band's middle rows, background above it
+    TEST_ASSERT_EQUAL_HEX16(BG, g_panel.displayedPixelAt(10, BAND_TOP + 2));
+    TEST_ASSERT_EQUAL_HEX16(FG, g_panel.displayedPixelAt(10, BAND_TOP + 4));
+
+    // The rest of the screen did not move
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, g_panel.displayedPixelAt(120, BAND_TOP - 1));
+    TEST_ASSERT_EQUAL_HEX16(0x07E0, g_panel.displayedPixelAt(120, 0));
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "%d-row status bar: %u bytes staged off screen, %u bytes to swap it in", BAND_H,
+             static_cast<unsigned>(band.getStats().stagedBytes), static_cast<unsigned>(band.getStats().swapBytes));
+    TEST_MESSAGE(msg);
+    band.end();
+}
+
+void test_screen_underneath_keeps_updating_while_a_slot_is_shown() {
+    OffscreenBand band;
+    TEST_ASSERT_TRUE(band.begin(BAND_H));
+    TEST_ASSERT_TRUE(band.stageText(1, 10, "first", 2, FG, BG));
+    TEST_ASSERT_TRUE(band.show(1));
+    const auto first = shownBand();
+
+    // Double buffering: the next bar goes to another hidden slot while the first stays on screen
+    TEST_ASSERT_TRUE(band.stageText(2, 10, "second", 2, FG, BG));
+    TEST_ASSERT_TRUE(first == shownBand());
+
+    // Drawing to the screen (a GIF frame) reaches the band's own rows without showing through
+    fillRows(0, 240, 0x001F);
+    TEST_ASSERT_TRUE(first == shownBand());
+    TEST_ASSERT_EQUAL_HEX16(0x001F, g_panel.displayedPixelAt(0, BAND_TOP - 1));
+
+    TEST_ASSERT_TRUE(band.show(2));
+    TEST_ASSERT_FALSE(first == shownBand());
+    TEST_ASSERT_TRUE(band.show(0));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, g_panel.displayedPixelAt(5, BAND_TOP));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, g_panel.displayedPixelAt(5, 239));
+
+    // Ending the band keeps slot 0 and the unscrolled layout
+    TEST_ASSERT_TRUE(band.show(3));
+    band.end();
+    TEST_ASSERT_EQUAL(0, g_panel.scrollStart());
+    TEST_ASSERT_EQUAL(DisplayManager::PANEL_GRAM_ROWS, g_panel.scrollHeight());
+    TEST_ASSERT_EQUAL_HEX16(0x001F, g_panel.displayedPixelAt(5, 239));
+}
+
+void test_bad_bands_and_slots_are_refused() {
+    OffscreenBand band;
+    TEST_ASSERT_FALSE(band.begin(0));
+    TEST_ASSERT_FALSE(band.begin(81));
+    TEST_ASSERT_FALSE(band.show(1));
+
+    TEST_ASSERT_TRUE(band.begin(80));
+    TEST_ASSERT_EQUAL(2, band.slots());
+    TEST_ASSERT_FALSE(band.show(2));
+    TEST_ASSERT_FALSE(band.stageText(2, 10, "x", 1, FG, BG));
+    TEST_ASSERT_FALSE(band.stageText(1, 239, "x", 1, FG, BG));
+
+    g_panel.setRotation(3);
+    TEST_ASSERT_FALSE(band.begin(BAND_H));
+    TEST_ASSERT_FALSE(band.isActive());
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_staged_slot_is_revealed_by_one_command);
+    RUN_TEST(test_screen_underneath_keeps_updating_while_a_slot_is_shown);
+    RUN_TEST(test_bad_bands_and_slots_are_refused);
+    return UNITY_END();
+}
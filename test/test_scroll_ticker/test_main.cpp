@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "MockPanel.h"
+#include "display/ScrollTicker.h"
+
+static constexpr int16_t TEXT_X = 10;
+static constexpr int16_t BAND_TOP = 100;
+static constexpr int16_t BAND_H = 48;
+static constexpr uint8_t TEXT_SIZE = 2;
+static constexpr uint16_t FG = 0xF800;
+static constexpr uint16_t BG = 0x001F;
+static constexpr const char* TEXT = "BREAKING: TICKER SCROLLS IN HARDWARE";
+// Word wrap of TEXT at (240 - 10) / 12 = 19 characters
+static const std::vector<std::string> LINES = {"BREAKING: TICKER", "SCROLLS IN HARDWARE"};
+static constexpr int LINE_H = TextRaster::CELL_H * TEXT_SIZE;
+static constexpr int CONTENT_ROWS = 2 * LINE_H + BAND_H;
+
+/**
+ * @brief Colour of one pixel of the looping ticker content, straight from the glyph table
+ */
+static auto contentPixel(int xPos, int row) -> uint16_t {
+    if (row < 0) {
+        return BG;
+    }
+    row %= CONTENT_ROWS;
+    const auto line = static_cast<size_t>(row / LINE_H);
+    const int glyphRow = (row % LINE_H) / TEXT_SIZE;
+    const int cell = (xPos - TEXT_X) / (TextRaster::CELL_W * TEXT_SIZE);
+    if (line >= LINES.size() || xPos < TEXT_X || cell >= static_cast<int>(LINES[line].size())) {
+        return BG;
+    }
+    const int column = ((xPos - TEXT_X) % (TextRaster::CELL_W * TEXT_SIZE)) / TEXT_SIZE;
+    const uint8_t bits = TextRaster::glyphColumn(LINES[line][static_cast<size_t>(cell)], column);
+    return ((bits >> glyphRow) & 1U) != 0 ? FG : BG;
+}
+
+/**
+ * @brief Check what the panel shows in the band after a number of scrolled rows
+ */
+static void assertBandShows(int scrolled) {
+    for (int16_t line = 0; line < BAND_H; ++line) {
+        for (int16_t x = 0; x < 240; ++x) {
+            const uint16_t expected = contentPixel(x, scrolled - BAND_H + line);
+            if (g_panel.displayedPixelAt(x, static_cast<int16_t>(BAND_TOP + line)) != expected) {
+                char msg[96];
+                snprintf(msg, sizeof(msg), "after %d rows: band line %d, x %d", scrolled, line, x);
+                TEST_FAIL_MESSAGE(msg);
+            }
+        }
+    }
+}
+
+static void fillRows(int16_t top, int16_t height, uint16_t color) {
+    const std::vector<uint16_t> row(240, static_cast<uint16_t>((color >> 8U) | (color << 8U)));
+    g_panel.writeAddrWindow(0, top, 240, static_cast<uint16_t>(height));
+    for (int16_t i = 0; i < height; ++i) {
+        DisplayManager::writePanelPixels(row.data(), 240);
+    }
+}
+
+void setUp() {
+    g_panel.setRotation(0);
+    DisplayManager::setPanelScrollArea(0, DisplayManager::PANEL_GRAM_ROWS);
+    DisplayManager::setPanelScrollStart(0);
+}
+
+void tearDown() {}
+
+void test_band_shows_text_entering_from_the_bottom() {
+    fillRows(BAND_TOP - 4, 4, 0x07E0);
+    fillRows(BAND_TOP + BAND_H, 4, 0x07E0);
+
+    ScrollTicker ticker;
+    TEST_ASSERT_TRUE(ticker.begin(TEXT_X, BAND_TOP, BAND_H, TEXT, TEXT_SIZE, FG, BG, 60));
+    assertBandShows(0);
+
+    // Single rows, then bursts that wrap around the end of the band, through more than one loop
+    int scrolled = 0;
+    for (int i = 0; i < CONTENT_ROWS + 10; ++i) {
+        ticker.scroll(1);
+        assertBandShows(++scrolled);
+    }
+    for (const uint16_t rows : {5, 17, 30, 48, 7}) {
+        ticker.scroll(rows);
+        scrolled += rows;
+        assertBandShows(scrolled);
+    }
+
+    // Rows around the band are never written
+    for (int16_t x = 0; x < 240; ++x) {
+        TEST_ASSERT_EQUAL_HEX16(0x07E0, g_panel.displayedPixelAt(x, BAND_TOP - 1));
+        TEST_ASSERT_EQUAL_HEX16(0x07E0, g_panel.displayedPixelAt(x, BAND_TOP + BAND_H));
+    }
+    ticker.end();
+}
+
+void test_tick_costs_one_row_instead_of_the_band() {
+    ScrollTicker ticker;
+    TEST_ASSERT_TRUE(ticker.begin(TEXT_X, BAND_TOP, BAND_H, TEXT, TEXT_SIZE, FG, BG, 60));
+
+    // 60 rows per second: 100 ms are due 6 rows, moved in one tick
+    g_panel.resetCounters();
+    mock::advanceMs(100);
+    ticker.update();
+    const auto& stats = ticker.getStats();
+    TEST_ASSERT_EQUAL(1, stats.ticks);
+    TEST_ASSERT_EQUAL(6, stats.rows);
+    TEST_ASSERT_EQUAL(11 + 6 * 480 + 3, stats.lastTickBytes);
+    TEST_ASSERT_EQUAL(g_panel.counters().commandBytes + g_panel.counters().pixelBytes, stats.bytes);
+
+    g_panel.resetCounters();
+    ticker.scroll(1);
+    TEST_ASSERT_EQUAL(11 + 480 + 3, stats.lastTickBytes);
+    TEST_ASSERT_EQUAL(stats.lastTickBytes, g_panel.counters().commandBytes + g_panel.counters().pixelBytes);
+    TEST_ASSERT_EQUAL(11 + BAND_H * 480, stats.redrawBytes);
+
+    char msg[120];
+    snprintf(msg, sizeof(msg), "%d-row band, 1 row per tick: %u SPI bytes per tick, %u for a full redraw (%ux)", BAND_H,
+             static_cast<unsigned>(stats.lastTickBytes), static_cast<unsigned>(stats.redrawBytes),
+             static_cast<unsigned>(stats.redrawBytes / stats.lastTickBytes));
+    TEST_MESSAGE(msg);
+
+    // Rows that wrap around the end of the band need a second window
+    g_panel.resetCounters();
+    ticker.scroll(BAND_H - 3);
+    TEST_ASSERT_EQUAL(2, g_panel.counters().addrWindows);
+    ticker.end();
+}
+
+void test_end_restores_the_panel_and_bad_bands_are_refused() {
+    ScrollTicker ticker;
+    TEST_ASSERT_TRUE(ticker.begin(TEXT_X, BAND_TOP, BAND_H, TEXT, TEXT_SIZE, FG, BG, 60));
+    ticker.scroll(20);
+    ticker.end();
+    TEST_ASSERT_FALSE(ticker.isActive());
+    TEST_ASSERT_EQUAL(0, g_panel.scrollStart());
+    TEST_ASSERT_EQUAL(DisplayManager::PANEL_GRAM_ROWS, g_panel.scrollHeight());
+    for (int16_t line = BAND_TOP; line < BAND_TOP + BAND_H; ++line) {
+        TEST_ASSERT_EQUAL_HEX16(BG, g_panel.displayedPixelAt(120, line));
+    }
+
+    TEST_ASSERT_FALSE(ticker.begin(TEXT_X, 200, 41, TEXT, TEXT_SIZE, FG, BG, 60));
+    TEST_ASSERT_FALSE(ticker.begin(TEXT_X, BAND_TOP, 0, TEXT, TEXT_SIZE, FG, BG, 60));
+    TEST_ASSERT_FALSE(ticker.begin(235, BAND_TOP, BAND_H, TEXT, TEXT_SIZE, FG, BG, 60));
+
+    // Rows run along the scroll direction only when the panel is not turned sideways or upside down
+    g_panel.setRotation(1);
+    TEST_ASSERT_FALSE(ticker.begin(TEXT_X, BAND_TOP, BAND_H, TEXT, TEXT_SIZE, FG, BG, 60));
+    g_panel.setRotation(4);
+    TEST_ASSERT_TRUE(ticker.begin(TEXT_X, BAND_TOP, BAND_H, TEXT, TEXT_SIZE, FG, BG, 60));
+    ticker.end();
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_band_shows_text_entering_from_the_bottom);
+    RUN_TEST(test_tick_costs_one_row_instead_of_the_band);
+    RUN_TEST(test_end_restores_the_panel_and_bad_bands_are_refused);
+    return UNITY_END();
+}
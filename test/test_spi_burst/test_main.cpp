@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+#include <esp8266_peri.h>
+
+#include <array>
+
+#include "MockPanel.h"
+#include "display/SpiBurstBus.h"
+
+static constexpr size_t LINE_PIXELS = 240;
+static constexpr int BENCH_LINES = 240 * 50;
+
+static std::array<uint16_t, 256> g_paletteLE{};
+static std::array<uint16_t, 256> g_paletteBE{};
+static std::array<uint8_t, LINE_PIXELS> g_indices{};
+
+void setUp() {
+    mock::spi = mock::SpiRegisters{};
+    mock::spiSlave = mock::SpiSlaveRegister{};
+
+    for (size_t i = 0; i < g_paletteLE.size(); ++i) {
+        const auto color = static_cast<uint16_t>(i * 0x0101U + 0x1234U);
+        g_paletteLE[i] = color;
+        g_paletteBE[i] = static_cast<uint16_t>((color >> 8U) | (color << 8U));
+    }
+    for (size_t i = 0; i < g_indices.size(); ++i) {
+        g_indices[i] = static_cast<uint8_t>(i * 31U);
+    }
+}
+
+void tearDown() {}
+
+/**
+ * @brief Previous path: little-endian lookup, then a per-pixel swap into the byte buffer handed to the FIFO
+ */
+static void lineSwapPath(std::array<uint16_t, LINE_PIXELS>& lineBuf, std::array<uint8_t, LINE_PIXELS * 2>& wireBuf) {
+    for (size_t i = 0; i < LINE_PIXELS; ++i) {
+        lineBuf[i] = g_paletteLE[g_indices[i]];
+    }
+    for (size_t i = 0; i < LINE_PIXELS; ++i) {
+        wireBuf[i * 2U] = static_cast<uint8_t>(lineBuf[i] >> 8U);
+        wireBuf[i * 2U + 1U] = static_cast<uint8_t>(lineBuf[i]);
+    }
+    SpiBurstBus::writeBytes(wireBuf.data(), static_cast<uint32_t>(wireBuf.size()));
+}
+
+/**
+ * @brief Current path: one lookup and one store per pixel, the buffer goes to the FIFO untouched
+ */
+static void linePreSwappedPath(std::array<uint16_t, LINE_PIXELS>& lineBuf) {
+    for (size_t i = 0; i < LINE_PIXELS; ++i) {
+        lineBuf[i] = g_paletteBE[g_indices[i]];
+    }
+    SpiBurstBus::writeBytes(reinterpret_cast<const uint8_t*>(lineBuf.data()), LINE_PIXELS * 2U);
+}
+
+void test_line_is_sent_in_64_byte_bursts_in_wire_order() {
+    std::array<uint16_t, LINE_PIXELS> lineBuf{};
+    linePreSwappedPath(lineBuf);
+
+    TEST_ASSERT_EQUAL((LINE_PIXELS * 2U + 63U) / 64U, mock::spi.kicks);
+    TEST_ASSERT_EQUAL(LINE_PIXELS * 2U, mock::spi.wire.size());
+
+    for (size_t i = 0; i < LINE_PIXELS; ++i) {
+        const uint16_t color = g_paletteLE[g_indices[i]];
+        TEST_ASSERT_EQUAL(color >> 8U, mock::spi.wire[i * 2U]);
+        TEST_ASSERT_EQUAL(color & 0xFFU, mock::spi.wire[i * 2U + 1U]);
+    }
+}
+
+void test_unaligned_tail_is_staged() {
+    std::array<uint8_t, 71> bytes{};
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(i + 1U);
+    }
+
+    SpiBurstBus::writeBytes(bytes.data() + 1, 70);
+
+    TEST_ASSERT_EQUAL(2, mock::spi.kicks);
+    TEST_ASSERT_EQUAL(70, mock::spi.wire.size());
+    TEST_ASSERT_EQUAL(2, mock::spi.wire[0]);
+    TEST_ASSERT_EQUAL(71, mock::spi.wire[69]);
+}
+
+void test_async_line_is_refilled_from_interrupt() {
+    std::array<uint16_t, LINE_PIXELS> lineBuf{};
+    for (size_t i = 0; i < LINE_PIXELS; ++i) {
+        lineBuf[i] = g_paletteBE[g_indices[i]];
+    }
+
+    SpiBurstBus::begin();
+    SpiBurstBus::writeBytesAsync(reinterpret_cast<const uint8_t*>(lineBuf.data()), LINE_PIXELS * 2U);
+
+    const uint32_t bursts = (LINE_PIXELS * 2U + 63U) / 64U;
+#ifdef SPI_BURST_POLLED
+    // Without the interrupt the rest of the line waits for the caller to pump the FIFO
+    TEST_ASSERT_FALSE(SpiBurstBus::isIdle());
+    TEST_ASSERT_EQUAL(1, mock::spi.kicks);
+    TEST_ASSERT_EQUAL(0, mock::spi.interrupts);
+    SpiBurstBus::waitIdle();
+    TEST_ASSERT_EQUAL(bursts, mock::spi.kicks);
+    TEST_ASSERT_EQUAL(0, mock::spi.interrupts);
+#else
+    // Only the first burst is started by the caller, each transfer-done interrupt starts the next one
+    TEST_ASSERT_TRUE(SpiBurstBus::isIdle());
+    TEST_ASSERT_EQUAL(bursts, mock::spi.kicks);
+    TEST_ASSERT_EQUAL(bursts, mock::spi.interrupts);
+#endif
+    TEST_ASSERT_EQUAL(LINE_PIXELS * 2U, mock::spi.wire.size());
+    TEST_ASSERT_EQUAL(0, mock::spiSlave.value & SPISTRIE);
+}
+
+void test_async_line_without_interrupt_drains_on_wait() {
+    std::array<uint8_t, 200> bytes{};
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(i);
+    }
+
+    SpiBurstBus::writeBytesAsync(bytes.data(), static_cast<uint32_t>(bytes.size()));
+
+    TEST_ASSERT_FALSE(SpiBurstBus::isIdle());
+    TEST_ASSERT_EQUAL(1, mock::spi.kicks);
+
+    SpiBurstBus::waitIdle();
+
+    TEST_ASSERT_TRUE(SpiBurstBus::isIdle());
+    TEST_ASSERT_EQUAL(4, mock::spi.kicks);
+    TEST_ASSERT_EQUAL(199, mock::spi.wire[199]);
+}
+
+void test_benchmark_swap_vs_preswapped_palette() {
+    std::array<uint16_t, LINE_PIXELS> lineBuf{};
+    std::array<uint8_t, LINE_PIXELS * 2> wireBuf{};
+    mock::spi.capture = false;
+
+    const uint32_t swapStart = EspClass::getCycleCount();
+    for (int i = 0; i < BENCH_LINES; ++i) {
+        lineSwapPath(lineBuf, wireBuf);
+    }
+    const uint32_t swapCycles = EspClass::getCycleCount() - swapStart;
+
+    const uint32_t directStart = EspClass::getCycleCount();
+    for (int i = 0; i < BENCH_LINES; ++i) {
+        linePreSwappedPath(lineBuf);
+    }
+    const uint32_t directCycles = EspClass::getCycleCount() - directStart;
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "per line: swap path %u, pre-swapped path %u (host cycle counter)",
+             static_cast<unsigned>(swapCycles / BENCH_LINES), static_cast<unsigned>(directCycles / BENCH_LINES));
+    TEST_MESSAGE(msg);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_line_is_sent_in_64_byte_bursts_in_wire_order);
+    RUN_TEST(test_unaligned_tail_is_staged);
+    RUN_TEST(test_async_line_is_refilled_from_interrupt);
+    RUN_TEST(test_async_line_without_interrupt_drains_on_wait);
+    RUN_TEST(test_benchmark_swap_vs_preswapped_palette);
+    return UNITY_END();
+}
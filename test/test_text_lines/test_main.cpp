@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: GPL-3.0-or-later
+/*
+ * GeekMagic Open Firmware
+ * Copyright (C) 2026 Times-Z
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <unity.h>
+
+#include <cstring>
+#include <vector>
+
+#include "MockPanel.h"
+#include "display/TextRaster.h"
+
+static constexpr uint16_t FG = 0xFFFF;
+static constexpr uint16_t BG = 0x001F;
+static constexpr int16_t TEXT_X = 10;
+static constexpr int16_t TEXT_Y = 100;
+
+/**
+ * @brief The print() path being replaced: Arduino_TFT::drawChar with an opaque background
+ *
+ * One address window per glyph cell, then one bus write per font column per pixel row, each
+ * repeating the colour textSize times
+ */
+static void printGlyphByGlyph(int16_t xPos, int16_t yPos, const char* text, uint8_t scale) {
+    const uint16_t fg = static_cast<uint16_t>((FG >> 8U) | (FG << 8U));
+    const uint16_t bg = static_cast<uint16_t>((BG >> 8U) | (BG << 8U));
+    std::vector<uint16_t> run(scale);
+
+    for (size_t i = 0; text[i] != '\0'; ++i) {
+        const auto cellX = static_cast<int16_t>(xPos + static_cast<int>(i) * TextRaster::CELL_W * scale);
+        g_panel.writeAddrWindow(cellX, yPos, static_cast<uint16_t>(TextRaster::CELL_W * scale),
+                                static_cast<uint16_t>(TextRaster::CELL_H * scale));
+        for (int row = 0; row < TextRaster::CELL_H * scale; ++row) {
+            for (int column = 0; column < TextRaster::CELL_W; ++column) {
+                const bool set = ((TextRaster::glyphColumn(text[i], column) >> (row / scale)) & 1U) != 0;
+                std::fill(run.begin(), run.end(), set ? fg : bg);
+                DisplayManager::writePanelPixels(run.data(), scale);
+            }
+        }
+    }
+}
+
+void setUp() {
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+    mock::freeHeap = 40000;
+}
+
+void tearDown() { mock::freeHeap = 40000; }
+
+void test_line_matches_glyph_by_glyph_in_one_transfer() {
+    const char* text = "IP 10.0.0.42";
+
+    for (const uint8_t scale : {1, 2, 3}) {
+        DisplayManager::clearScreen();
+        g_panel.resetCounters();
+        printGlyphByGlyph(TEXT_X, TEXT_Y, text, scale);
+        const auto glyphs = g_panel.counters();
+        const auto expected = captureGram();
+
+        DisplayManager::clearScreen();
+        g_panel.resetCounters();
+        const uint32_t bytes = TextRaster::drawLine(TEXT_X, TEXT_Y, text, scale, FG, BG, 0);
+        const auto line = g_panel.counters();
+
+        TEST_ASSERT_TRUE(expected == captureGram());
+        TEST_ASSERT_EQUAL(1, line.addrWindows);
+        // Lines over STRIP_MAX_BYTES are sent a pixel row at a time
+        const bool whole = line.pixelBytes <= TextRaster::STRIP_MAX_BYTES;
+        TEST_ASSERT_EQUAL(whole ? 1 : TextRaster::CELL_H * scale, line.pixelWrites);
+        TEST_ASSERT_EQUAL(glyphs.pixelBytes, line.pixelBytes);
+        TEST_ASSERT_EQUAL(line.commandBytes + line.pixelBytes, bytes);
+        TEST_ASSERT_EQUAL(strlen(text), glyphs.addrWindows);
+
+        char msg[200];
+        snprintf(msg, sizeof(msg),
+                 "size %u: glyph by glyph %u windows + %u writes (%.0f us), one line %u window + %u writes (%.0f us)",
+                 scale, static_cast<unsigned>(glyphs.addrWindows), static_cast<unsigned>(glyphs.pixelWrites),
+                 glyphs.spiMicros(), static_cast<unsigned>(line.addrWindows), static_cast<unsigned>(line.pixelWrites),
+                 line.spiMicros());
+        TEST_MESSAGE(msg);
+    }
+}
+
+void test_padding_and_low_heap_keep_one_window() {
+    // Padded to the right edge, the cells after the text show the background
+    TextRaster::drawLine(TEXT_X, TEXT_Y, "ok", 2, FG, BG, static_cast<int16_t>(240 - TEXT_X));
+    TEST_ASSERT_EQUAL(1, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL_HEX16(BG, g_panel.pixelAt(239, TEXT_Y));
+    TEST_ASSERT_EQUAL_HEX16(BG, g_panel.pixelAt(239, TEXT_Y + 15));
+    const auto padded = captureGram();
+
+    // Without heap for a strip the line goes out a pixel row at a time, still in one window
+    DisplayManager::clearScreen();
+    g_panel.resetCounters();
+    mock::freeHeap = 4000;
+    TextRaster::drawLine(TEXT_X, TEXT_Y, "ok", 2, FG, BG, static_cast<int16_t>(240 - TEXT_X));
+    TEST_ASSERT_EQUAL(1, g_panel.counters().addrWindows);
+    TEST_ASSERT_EQUAL(TextRaster::CELL_H * 2, g_panel.counters().pixelWrites);
+    TEST_ASSERT_TRUE(padded == captureGram());
+
+    // Clipped at the screen edges, nothing at all when off screen
+    g_panel.resetCounters();
+    TEST_ASSERT_EQUAL(11U + 10U * 8U * 2U, TextRaster::drawLine(230, 232, "wide text", 1, FG, BG, 0));
+    TEST_ASSERT_EQUAL(0U, TextRaster::drawLine(240, 0, "x", 1, FG, BG, 0));
+    TEST_ASSERT_EQUAL(0U, TextRaster::drawLine(0, 0, "x", 0, FG, BG, 0));
+    TEST_ASSERT_EQUAL(1, g_panel.counters().addrWindows);
+}
+
+auto main() -> int {
+    UNITY_BEGIN();
+    RUN_TEST(test_line_matches_glyph_by_glyph_in_one_transfer);
+    RUN_TEST(test_padding_and_low_heap_keep_one_window);
+    return UNITY_END();
+}